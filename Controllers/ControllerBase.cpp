@@ -5,8 +5,17 @@
 *************************************************************************/
 
 #include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <istream>
 #include <memory>
+#include <ostream>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 #include "../Models/Errors/CollectionException.hpp"
 #include "../Models/Errors/IndexOverflowException.hpp"
@@ -16,13 +25,26 @@
 #include "../Models/Core/Model.hpp"
 #include "../Models/Core/Line.hpp"
 #include "../Models/Core/Face.hpp"
+#include "../Models/Mesh/Decimator.hpp"
+#include "../Models/Mesh/MassProperties.hpp"
+#include "../Models/Mesh/Normals.hpp"
+#include "../Models/Mesh/SpatialOrder.hpp"
 #include "../Models/Storage/ImporterBase.hpp"
+#include "../Models/Storage/EditJournal.hpp"
 #include "../Models/Storage/ExporterBase.hpp"
+#include "../Models/Storage/ExportOptions.hpp"
+#include "../Models/Storage/ImportCache.hpp"
+#include "../Models/Storage/ModelDelta.hpp"
+#include "../Models/Storage/ProgressBuffer.hpp"
 #include "../Models/Storage/StorageFactory.hpp"
+#include "../Models/Tools/FileSync.hpp"
+#include "../Models/Tools/OrientedBox.hpp"
+#include "../Models/Tools/Sphere.hpp"
 #include "ControllerBase.hpp"
 using namespace std;
 using namespace C3w::Errors;
 using namespace C3w::Storage;
+using namespace C3w::Tools;
 
 namespace C3w {
 
@@ -37,6 +59,25 @@ namespace Controllers {
 **********************************************************************/
 ControllerBase::ControllerBase(): m_Model("unnamed") {}
 
+// 预写日志达到此记录数时自动增量保存并清空
+constexpr size_t ControllerBase::COMPACT_RECORD_COUNT;
+// 增量记录的字节数超过基准的此比例时，压缩时完整重写基准
+constexpr double ControllerBase::COMPACT_DELTA_RATIO;
+
+/**********************************************************************
+【函数名称】 析构函数
+【函数功能】 取消并等待后台任务。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::~ControllerBase() {
+    if (m_pTask != nullptr) {
+        m_pTask->bCancelled = true;
+        m_TaskThread.join();
+    }
+}
+
 /**********************************************************************
 【函数名称】 GetName
 【函数功能】 获取模型的名称。
@@ -59,6 +100,8 @@ string ControllerBase::GetName() const {
 **********************************************************************/
 void ControllerBase::SetName(string Name) {
     m_Model.Name = Name;
+    m_Revision++;
+    WriteJournal({ EditJournal::Operation::SET_NAME, 0, 0, Name, {} });
 }
 
 /**********************************************************************
@@ -129,12 +172,17 @@ ControllerBase::Result ControllerBase::AddLine(
         return Result::POINT_COLLISION;
     }
     m_LineStatus.push_back(Status::CREATED);
+    m_Revision++;
+    WriteJournal({
+        EditJournal::Operation::ADD_LINE, 0, 0, "",
+        { X1, Y1, Z1, X2, Y2, Z2 }
+    });
     return Result::OK;
 }
 
 /**********************************************************************
 【函数名称】 ModifyLine
-【函数功能】 修改一个线段。
+【函数功能】 修改一个线段，新建的线段仍保持新建状态。
 【参数】
     Index: 线段的下标。
     PointIndex: 要修改的点在线段中的下标。
@@ -165,7 +213,14 @@ ControllerBase::Result ControllerBase::ModifyLine(
     catch (IndexOverflowException) {
         return Result::INDEX_OVERFLOW;
     }
-    m_LineStatus[Index] = Status::MODIFIED;
+    if (m_LineStatus[Index] != Status::CREATED) {
+        m_LineStatus[Index] = Status::MODIFIED;
+    }
+    m_Revision++;
+    WriteJournal({
+        EditJournal::Operation::MODIFY_LINE, Index, PointIndex, "",
+        { X, Y, Z }
+    });
     return Result::OK;
 }
 
@@ -185,6 +240,9 @@ ControllerBase::Result ControllerBase::RemoveLine(size_t Index) {
     catch (IndexOverflowException) {
         return Result::INDEX_OVERFLOW;
     }
+    MarkRemoved(m_LineStatus, m_RemovedLines, Index);
+    m_Revision++;
+    WriteJournal({ EditJournal::Operation::REMOVE_LINE, Index, 0, "", {} });
     return Result::OK;
 }
 
@@ -259,12 +317,18 @@ ControllerBase::Result ControllerBase::AddFace(
         return Result::POINT_COLLISION;
     }
     m_FaceStatus.push_back(Status::CREATED);
+    m_pNormals.reset();
+    m_Revision++;
+    WriteJournal({
+        EditJournal::Operation::ADD_FACE, 0, 0, "",
+        { X1, Y1, Z1, X2, Y2, Z2, X3, Y3, Z3 }
+    });
     return Result::OK;
 }
 
 /**********************************************************************
 【函数名称】 ModifyFace
-【函数功能】 修改一个面。
+【函数功能】 修改一个面，新建的面仍保持新建状态。
 【参数】
     Index: 面的下标。
     PointIndex: 要修改的点在面中的下标。
@@ -295,7 +359,15 @@ ControllerBase::Result ControllerBase::ModifyFace(
     catch (IndexOverflowException) {
         return Result::INDEX_OVERFLOW;
     }
-    m_FaceStatus[Index] = Status::MODIFIED;
+    if (m_FaceStatus[Index] != Status::CREATED) {
+        m_FaceStatus[Index] = Status::MODIFIED;
+    }
+    m_pNormals.reset();
+    m_Revision++;
+    WriteJournal({
+        EditJournal::Operation::MODIFY_FACE, Index, PointIndex, "",
+        { X, Y, Z }
+    });
     return Result::OK;
 }
 
@@ -315,6 +387,10 @@ ControllerBase::Result ControllerBase::RemoveFace(size_t Index) {
     catch (IndexOverflowException) {
         return Result::INDEX_OVERFLOW;
     }
+    MarkRemoved(m_FaceStatus, m_RemovedFaces, Index);
+    m_pNormals.reset();
+    m_Revision++;
+    WriteJournal({ EditJournal::Operation::REMOVE_FACE, Index, 0, "", {} });
     return Result::OK;
 }
 
@@ -333,29 +409,121 @@ ControllerBase::Statistics ControllerBase::GetStatistics() const {
         /* .TotalLineLength     */  0,
         /* .TotalFaceCount      */  m_Model.Faces.Count(), 
         /* .TotalFaceArea       */  0,
-        /* .BoundingBoxVolume   */  m_Model.GetBoundingBox().GetVolume()
+        /* .BoundingBoxVolume   */  m_Model.GetBoundingBox().GetVolume(),
+        /* .OrientedBoxVolume   */  0,
+        /* .BoundingSphereRadius*/  0,
+        /* .Volume              */  0,
+        /* .Centroid            */  Point<3>::VOID,
+        /* .InertiaTensor       */  {}
     };
     Stats.TotalPointCount = 
         Stats.TotalLineCount * 2 + Stats.TotalFaceCount * 3;
     for (auto& Line: m_Model.Lines) {
         Stats.TotalLineLength += Line.GetLength();
     }
-    for (auto& Face: m_Model.Faces) {
-        Stats.TotalFaceArea += Face.GetArea();
-    }
+    Stats.TotalFaceArea = m_Model.GetTotalArea();
+    Stats.OrientedBoxVolume = 
+        Tools::OrientedBox<3>::GetOrientedBoxOf(m_Model).GetVolume();
+    Stats.BoundingSphereRadius = 
+        Tools::Sphere<3>::GetBoundingSphereOf(m_Model).Radius;
+    auto Mass = Mesh::MassProperties::GetMassPropertiesOf(m_Model);
+    Stats.Volume = Mass.Volume;
+    Stats.Centroid = Mass.Centroid;
+    Stats.InertiaTensor = Mass.Inertia;
     return Stats;
 }
 
+/**********************************************************************
+【函数名称】 GetNormals
+【函数功能】 获取模型的面法向与面积加权的顶点法向。
+    结果被缓存，直到面被添加、修改、删除或模型被替换。
+【参数】 无
+【返回值】
+    法向的常引用，在下一次修改面之前有效。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+const Mesh::Normals& ControllerBase::GetNormals() const {
+    if (m_pNormals == nullptr) {
+        m_pNormals.reset(new Mesh::Normals(m_Model));
+    }
+    return *m_pNormals;
+}
+
+/**********************************************************************
+【函数名称】 SimplifyModel
+【函数功能】 使用二次误差度量简化模型，线段保持不变，
+    所有面标记为已修改。
+【参数】
+    TargetFaceCount: 目标面数。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::SimplifyModel(size_t TargetFaceCount) {
+    m_Model = Mesh::Decimator::Simplify(m_Model, TargetFaceCount);
+    m_FaceStatus.assign(m_Model.Faces.Count(), Status::MODIFIED);
+    m_pNormals.reset();
+    // 简化后的面与基准文件中的面不再一一对应
+    m_bHasBase = false;
+    m_Revision++;
+    // 简化是确定的，日志只记录目标面数而非简化后的所有面
+    WriteJournal({
+        EditJournal::Operation::SIMPLIFY, TargetFaceCount, 0, "", {}
+    });
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 ReorderModel
+【函数功能】 沿 Morton 曲线重排模型中的线段与面，
+    元素的状态随元素一同移动。
+【参数】 无
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::ReorderModel() {
+    vector<size_t> LineOrder;
+    vector<size_t> FaceOrder;
+    Mesh::SpatialOrder<3>::ReorderInplace(m_Model, LineOrder, FaceOrder);
+    vector<Status> LineStatus;
+    LineStatus.reserve(LineOrder.size());
+    for (size_t ullIndex: LineOrder) {
+        LineStatus.push_back(m_LineStatus[ullIndex]);
+    }
+    m_LineStatus = move(LineStatus);
+    vector<Status> FaceStatus;
+    FaceStatus.reserve(FaceOrder.size());
+    for (size_t ullIndex: FaceOrder) {
+        FaceStatus.push_back(m_FaceStatus[ullIndex]);
+    }
+    m_FaceStatus = move(FaceStatus);
+    // 法向按面的下标缓存，顺序改变后失效
+    m_pNormals.reset();
+    // 元素的下标与基准文件中的下标不再一致
+    m_bHasBase = false;
+    m_Revision++;
+    WriteJournal({ EditJournal::Operation::REORDER, 0, 0, "", {} });
+    return Result::OK;
+}
+
 /**********************************************************************
 【函数名称】 LoadModel
-【函数功能】 从文件加载一个模型。
+【函数功能】 从文件加载一个模型，应用增量保存的附属文件，
+    并重放预写日志中的修改。
+    不重排时，该文件成为之后增量保存的基准。
 【参数】
     Path: 文件位置。
+    Reorder: 是否在加载后沿 Morton 曲线重排。
 【返回值】
-    函数发生的错误类型。
+    函数发生的错误类型。有后台任务时返回 TASK_RUNNING。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-ControllerBase::Result ControllerBase::LoadModel(string Path) {
+ControllerBase::Result ControllerBase::LoadModel(string Path, bool Reorder) {
+    // 后台加载结束时会以其结果替换模型，覆盖同步加载的结果
+    if (m_pTask != nullptr) {
+        return Result::TASK_RUNNING;
+    }
     unique_ptr<ImporterBase<3>> pImporter;
     try {
         pImporter = StorageFactory::GetImporter<3>(GetExtension(Path));
@@ -363,8 +531,24 @@ ControllerBase::Result ControllerBase::LoadModel(string Path) {
     catch (StorageFactoryLookupException) {
         return Result::STORAGE_LOOKUP_ERROR;
     }
+    Model<3> NewModel(m_Model.Name);
+    vector<EditJournal::Record> Records;
+    size_t ullAppendedBytes = 0;
     try {
-        pImporter->Import(Path, m_Model);
+        auto Parse = [&pImporter, &Path](Model<3>& Parsed) {
+            pImporter->Import(Path, Parsed);
+            return true;
+        };
+        // 二进制格式本身读取已足够快，只缓存文本格式的导入结果
+        if (m_pCache == nullptr || pImporter->IsBinary()) {
+            Parse(NewModel);
+        }
+        else {
+            m_pCache->Import(Path, NewModel, Parse);
+        }
+        ApplyDeltas(Path, NewModel);
+        ullAppendedBytes = pImporter->GetAppendedSize(Path);
+        Records = EditJournal::Read(Path + EditJournal::SUFFIX);
     }
     catch (FileOpenException) {
         return Result::FILE_OPEN_ERROR;
@@ -372,22 +556,46 @@ ControllerBase::Result ControllerBase::LoadModel(string Path) {
     catch (FileFormatException) {
         return Result::FILE_FORMAT_ERROR;
     }
-    m_LineStatus.assign(m_Model.Lines.Count(), Status::UNTOUCHED);
-    m_FaceStatus.assign(m_Model.Faces.Count(), Status::UNTOUCHED);
-    m_Path = Path;
+    m_Model = move(NewModel);
+    m_pNormals.reset();
+    m_Revision++;
+    ResetBase(Path);
+    MeasureBase(Path, ullAppendedBytes);
+    m_BaseLevelCount = 1;
+    // 附属文件与日志中的下标相对于文件中的顺序，重放之后才能重排
+    ReplayJournal(Path, Records);
+    if (Reorder) {
+        ReorderModel();
+    }
     return Result::OK;
 }
 
 /**********************************************************************
 【函数名称】 SaveModel
-【函数功能】 向文件保存一个模型。
+【函数功能】 向文件完整保存一个模型，并删除其增量保存的附属文件。
+    导出的文件能还原模型时（见 ExporterBase::CanRoundTrip），
+    该文件成为之后增量保存的基准，所有元素的状态重置为未修改；
+    预写日志打开时，日志移到该文件并清空，否则删除其预写日志。
+    不能还原时由 KeepBase 处理原基准与预写日志。
 【参数】
     Path: 文件位置。
+    LodLevelCount: 保存的细节层级数，仅 .c3w 文件使用。
+    OptimizeVertexCache: 是否为 GPU 顶点缓存重排面与顶点。
+    WriteNormals: 是否计算并写出法向。
 【返回值】
-    函数发生的错误类型。
+    函数发生的错误类型。有后台任务时返回 TASK_RUNNING。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-ControllerBase::Result ControllerBase::SaveModel(string Path) {
+ControllerBase::Result ControllerBase::SaveModel(
+    string Path,
+    size_t LodLevelCount,
+    bool OptimizeVertexCache,
+    bool WriteNormals
+) {
+    // 后台保存会替换基准文件并删除附属文件
+    if (m_pTask != nullptr) {
+        return Result::TASK_RUNNING;
+    }
     if (Path.empty()) {
         Path = m_Path;
     }
@@ -398,8 +606,314 @@ ControllerBase::Result ControllerBase::SaveModel(string Path) {
     catch (StorageFactoryLookupException) {
         return Result::STORAGE_LOOKUP_ERROR;
     }
+    ExportOptions Options;
+    Options.LodLevelCount = LodLevelCount;
+    // 不写出法向时无需计算
+    if (WriteNormals) {
+        Options.pNormals = &GetNormals();
+    }
+    Options.bOptimizeVertexCache = OptimizeVertexCache;
+    try {
+        pExporter->Export(Path, m_Model, Options);
+    }
+    catch (FileOpenException) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    remove((Path + ModelDelta::JOURNAL_SUFFIX).c_str());
+    size_t ullJournalCount = 0;
+    if (m_pJournal != nullptr) {
+        // 清空日志前，文件的内容必须已经写入磁盘
+        FileSync::Sync(Path);
+        ullJournalCount = m_pJournal->GetRecordCount();
+    }
+    // 例如 .stl 文件，或优化顶点缓存改变了面在文件中的顺序
+    if (!pExporter->CanRoundTrip(m_Model, Options)) {
+        KeepBase(Path);
+        return Result::OK;
+    }
+    ResetBase(Path);
+    MeasureBase(Path, 0);
+    m_BaseLevelCount = LodLevelCount;
+    ResetJournal(Path, ullJournalCount);
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 SaveChanges
+【函数功能】 将上次加载或保存之后删除、修改与新建的元素
+    作为一条 ModelDelta 记录追加到基准文件：
+    导出器支持追加时追加到文件末尾，否则追加到附属文件中。
+    写入的数据量与修改的元素数成正比。
+    成功后所有元素的状态重置为未修改，预写日志被清空。
+【参数】 无
+【返回值】
+    函数发生的错误类型。重排、简化模型后或尚未加载、保存时
+    没有基准，返回 FULL_SAVE_REQUIRED，应先使用 SaveModel。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::SaveChanges() {
+    // 后台保存会替换基准文件并删除附属文件
+    if (m_pTask != nullptr) {
+        return Result::TASK_RUNNING;
+    }
+    if (!m_bHasBase) {
+        return Result::FULL_SAVE_REQUIRED;
+    }
+    if (m_Revision == m_SavedRevision) {
+        return Result::OK;
+    }
+    unique_ptr<ExporterBase<3>> pExporter;
+    try {
+        pExporter = StorageFactory::GetExporter<3>(GetExtension(m_Path));
+    }
+    catch (StorageFactoryLookupException) {
+        return Result::STORAGE_LOOKUP_ERROR;
+    }
+    string DeltaPath = m_Path;
+    if (!pExporter->CanAppendDelta()) {
+        DeltaPath += ModelDelta::JOURNAL_SUFFIX;
+    }
+    // 追加到文件末尾时，基准文件必须仍然存在
+    else if (!ifstream(m_Path, ios::in | ios::binary).is_open()) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    // 记录一次追加并写入磁盘，之后才能清空预写日志
+    ostringstream Delta;
+    GetDelta().Write(Delta);
+    if (!FileSync::Append(DeltaPath, Delta.str())) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    m_DeltaBytes += Delta.str().size();
+    size_t ullJournalCount = 0;
+    if (m_pJournal != nullptr) {
+        ullJournalCount = m_pJournal->GetRecordCount();
+    }
+    ResetBase(m_Path);
+    ResetJournal(m_Path, ullJournalCount);
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 BeginLoadModel
+【函数功能】 在后台线程中从文件加载一个模型到新的模型中，
+    当前模型在 EndTask 之前保持不变。
+【参数】
+    Path: 文件位置。
+    Reorder: 是否在加载后沿 Morton 曲线重排。
+    OnProgress: 形如 void(const TaskProgress& Progress) 的函数，
+        每读入一块数据在后台线程中调用一次。
+【返回值】
+    函数发生的错误类型，文件本身的错误由 EndTask 返回。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::BeginLoadModel(
+    string Path,
+    bool Reorder,
+    function<void(const TaskProgress&)> OnProgress
+) {
+    if (m_pTask != nullptr) {
+        return Result::TASK_RUNNING;
+    }
+    shared_ptr<ImporterBase<3>> pImporter;
+    try {
+        pImporter = StorageFactory::GetImporter<3>(GetExtension(Path));
+    }
+    catch (StorageFactoryLookupException) {
+        return Result::STORAGE_LOOKUP_ERROR;
+    }
+    shared_ptr<TaskState> pTask = make_shared<TaskState>();
+    pTask->Path = Path;
+    pTask->bLoading = true;
+    pTask->bReorder = Reorder;
+    pTask->pModel.reset(new Model<3>(m_Model.Name));
+    // 二进制格式本身读取已足够快，只缓存文本格式的导入结果
+    shared_ptr<const ImportCache> pCache;
+    if (!pImporter->IsBinary()) {
+        pCache = m_pCache;
+    }
+    m_TaskThread = thread(RunLoad, pTask, pImporter, pCache, OnProgress);
+    m_pTask = pTask;
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 BeginSaveModel
+【函数功能】 在后台线程中向文件保存当前模型的副本，之后对模型的
+    修改不影响本次保存。先写入临时文件，成功后替换目标文件，
+    因此取消或失败时原文件保持不变。
+【参数】
+    Path: 文件位置。
+    LodLevelCount: 保存的细节层级数，仅 .c3w 文件使用。
+    OptimizeVertexCache: 是否为 GPU 顶点缓存重排面与顶点。
+    WriteNormals: 是否计算并写出法向。
+    OnProgress: 形如 void(const TaskProgress& Progress) 的函数，
+        每写出一块数据在后台线程中调用一次。
+【返回值】
+    函数发生的错误类型，写入时的错误由 EndTask 返回。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::BeginSaveModel(
+    string Path,
+    size_t LodLevelCount,
+    bool OptimizeVertexCache,
+    bool WriteNormals,
+    function<void(const TaskProgress&)> OnProgress
+) {
+    if (m_pTask != nullptr) {
+        return Result::TASK_RUNNING;
+    }
+    if (Path.empty()) {
+        Path = m_Path;
+    }
+    shared_ptr<ExporterBase<3>> pExporter;
+    try {
+        pExporter = StorageFactory::GetExporter<3>(GetExtension(Path));
+    }
+    catch (StorageFactoryLookupException) {
+        return Result::STORAGE_LOOKUP_ERROR;
+    }
+    shared_ptr<TaskState> pTask = make_shared<TaskState>();
+    pTask->Path = Path;
+    pTask->pModel.reset(new Model<3>(m_Model));
+    if (WriteNormals) {
+        pTask->pNormals.reset(new Mesh::Normals(GetNormals()));
+    }
+    pTask->LodLevelCount = LodLevelCount;
+    pTask->bOptimizeVertexCache = OptimizeVertexCache;
+    ExportOptions Options;
+    Options.LodLevelCount = LodLevelCount;
+    Options.bOptimizeVertexCache = OptimizeVertexCache;
+    pTask->bCanRoundTrip = pExporter->CanRoundTrip(m_Model, Options);
+    pTask->Revision = m_Revision;
+    if (m_pJournal != nullptr) {
+        pTask->JournalRecordCount = m_pJournal->GetRecordCount();
+    }
+    pTask->ElementCount = m_Model.Lines.Count() + m_Model.Faces.Count();
+    m_TaskThread = thread(RunSave, pTask, pExporter, OnProgress);
+    m_pTask = pTask;
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 IsTaskFinished
+【函数功能】 判断后台任务是否已结束，可在等待时轮询。
+【参数】 无
+【返回值】
+    后台任务是否已结束，没有后台任务时为真。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ControllerBase::IsTaskFinished() const {
+    return m_pTask == nullptr || m_pTask->bFinished;
+}
+
+/**********************************************************************
+【函数名称】 GetTaskProgress
+【函数功能】 获取后台任务的进度，可在等待时轮询。
+【参数】 无
+【返回值】
+    后台任务的进度，没有后台任务时各项均为 0。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::TaskProgress ControllerBase::GetTaskProgress() const {
+    if (m_pTask == nullptr) {
+        return TaskProgress { 0, 0, 0 };
+    }
+    return GetProgress(*m_pTask);
+}
+
+/**********************************************************************
+【函数名称】 CancelTask
+【函数功能】 请求取消后台任务，任务在读入或写出下一块数据时结束。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::CancelTask() {
+    if (m_pTask != nullptr) {
+        m_pTask->bCancelled = true;
+    }
+}
+
+/**********************************************************************
+【函数名称】 EndTask
+【函数功能】 等待后台任务结束。加载成功时以新模型替换当前模型，
+    取消或失败时当前模型保持不变。加载或保存成功时，
+    文件成为增量保存的基准的条件与 LoadModel、SaveModel 相同，
+    保存期间模型又被修改时除外；保存的文件不能还原模型时
+    同样由 KeepBase 处理。
+【参数】 无
+【返回值】
+    后台任务发生的错误类型，被取消时为 CANCELLED，
+    没有后台任务时为 OK。
+    后台任务中抛出的其他异常在此重新抛出。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::EndTask() {
+    if (m_pTask == nullptr) {
+        return Result::OK;
+    }
+    m_TaskThread.join();
+    shared_ptr<TaskState> pTask = move(m_pTask);
+    if (pTask->pException != nullptr) {
+        rethrow_exception(pTask->pException);
+    }
+    if (pTask->TaskResult != Result::OK) {
+        return pTask->TaskResult;
+    }
+    if (pTask->bLoading) {
+        m_Model = move(*pTask->pModel);
+        m_pNormals.reset();
+        m_Revision++;
+        ResetBase(pTask->Path);
+        MeasureBase(pTask->Path, pTask->AppendedBytes);
+        m_BaseLevelCount = 1;
+        ReplayJournal(pTask->Path, pTask->JournalRecords);
+        if (pTask->bReorder) {
+            ReorderModel();
+        }
+    }
+    else if (!pTask->bCanRoundTrip) {
+        KeepBase(pTask->Path);
+    }
+    // 保存的是开始时的副本，之后的修改仍相对于原来的基准，而原基准可能
+    // 已被覆盖，因此只有模型未被修改时才能以新文件为基准
+    else if (pTask->Revision == m_Revision) {
+        ResetBase(pTask->Path);
+        MeasureBase(pTask->Path, 0);
+        m_BaseLevelCount = pTask->LodLevelCount;
+        ResetJournal(pTask->Path, pTask->JournalRecordCount);
+    }
+    else {
+        m_Path = pTask->Path;
+        m_bHasBase = false;
+        // 开始保存之后的记录相对于新文件，重放仍然正确
+        ResetJournal(pTask->Path, pTask->JournalRecordCount);
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 OpenJournal
+【函数功能】 先增量保存之前的修改，再在基准文件旁创建预写日志，
+    之后的每次修改都追加到日志中，加载该文件时重放。
+    日志达到 COMPACT_RECORD_COUNT 条记录时由 Compact 压缩。
+【参数】 无
+【返回值】
+    函数发生的错误类型。没有基准时返回 FULL_SAVE_REQUIRED，
+    应先使用 SaveModel。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::OpenJournal() {
+    if (m_pJournal != nullptr) {
+        return Result::OK;
+    }
+    // 日志相对于文件记录修改，因此之前的修改必须先写入文件
+    Result SaveResult = SaveChanges();
+    if (SaveResult != Result::OK) {
+        return SaveResult;
+    }
     try {
-        pExporter->Export(Path, m_Model);
+        m_pJournal.reset(new EditJournal(m_Path + EditJournal::SUFFIX));
     }
     catch (FileOpenException) {
         return Result::FILE_OPEN_ERROR;
@@ -407,6 +921,78 @@ ControllerBase::Result ControllerBase::SaveModel(string Path) {
     return Result::OK;
 }
 
+/**********************************************************************
+【函数名称】 CloseJournal
+【函数功能】 提交剩余的记录并关闭预写日志，日志文件保留。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::CloseJournal() {
+    m_pJournal.reset();
+}
+
+/**********************************************************************
+【函数名称】 FlushJournal
+【函数功能】 等待预写日志中已追加的记录全部写入磁盘。
+【参数】 无
+【返回值】
+    函数发生的错误类型，日志未打开时为 OK。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::FlushJournal() {
+    if (m_pJournal != nullptr && !m_pJournal->Flush()) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 IsJournalOpen
+【函数功能】 判断预写日志是否已打开。
+【参数】 无
+【返回值】
+    预写日志是否已打开。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ControllerBase::IsJournalOpen() const {
+    return m_pJournal != nullptr;
+}
+
+/**********************************************************************
+【函数名称】 SetCacheDirectory
+【函数功能】 设置导入缓存的目录，之后加载文本格式的文件时
+    优先读取缓存的快照，未命中时在解析后写入快照。
+    正在运行的后台任务继续使用原来的设置。
+【参数】
+    Directory: 已经存在的目录，为空时关闭缓存。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::SetCacheDirectory(string Directory) {
+    if (Directory.empty()) {
+        m_pCache.reset();
+    }
+    else {
+        m_pCache = make_shared<ImportCache>(Directory);
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetCacheDirectory
+【函数功能】 获取导入缓存的目录。
+【参数】 无
+【返回值】
+    导入缓存的目录，未开启缓存时为空。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+string ControllerBase::GetCacheDirectory() const {
+    if (m_pCache == nullptr) {
+        return "";
+    }
+    return m_pCache->GetDirectory();
+}
+
 /**********************************************************************
 【函数名称】 GetExtension
 【函数功能】 从路径中提取文件扩展名。
@@ -431,6 +1017,555 @@ string ControllerBase::GetExtension(string Path) {
     }
 }
 
+/**********************************************************************
+【函数名称】 ResetBase
+【函数功能】 以文件为增量保存的基准，所有元素的状态重置为未修改。
+【参数】
+    Path: 基准文件的位置。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::ResetBase(string Path) {
+    m_LineStatus.assign(m_Model.Lines.Count(), Status::UNTOUCHED);
+    m_FaceStatus.assign(m_Model.Faces.Count(), Status::UNTOUCHED);
+    m_RemovedLines.clear();
+    m_RemovedFaces.clear();
+    m_Path = Path;
+    m_bHasBase = true;
+    m_SavedRevision = m_Revision;
+}
+
+/**********************************************************************
+【函数名称】 GetDelta
+【函数功能】 生成当前模型相对于基准文件的增量记录。
+    新建的元素总在基准中剩余的元素之后，因此剩余元素当前的
+    下标即为删除后的下标。
+【参数】 无
+【返回值】
+    增量记录。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ModelDelta ControllerBase::GetDelta() const {
+    ModelDelta Delta;
+    Delta.Name = m_Model.Name;
+    Delta.RemovedLines = m_RemovedLines;
+    for (size_t i = 0; i < m_LineStatus.size(); i++) {
+        if (m_LineStatus[i] == Status::MODIFIED) {
+            Delta.ModifiedLines.emplace_back(i, m_Model.Lines[i]);
+        }
+        else if (m_LineStatus[i] == Status::CREATED) {
+            Delta.CreatedLines.push_back(m_Model.Lines[i]);
+        }
+    }
+    Delta.RemovedFaces = m_RemovedFaces;
+    for (size_t i = 0; i < m_FaceStatus.size(); i++) {
+        if (m_FaceStatus[i] == Status::MODIFIED) {
+            Delta.ModifiedFaces.emplace_back(i, m_Model.Faces[i]);
+        }
+        else if (m_FaceStatus[i] == Status::CREATED) {
+            Delta.CreatedFaces.push_back(m_Model.Faces[i]);
+        }
+    }
+    return Delta;
+}
+
+/**********************************************************************
+【函数名称】 MarkRemoved
+【函数功能】 在元素被删除后更新状态与被删除的基准下标。
+【参数】
+    Statuses: 元素的状态。
+    Removed: 被删除的元素在基准文件中的下标。
+    Index: 被删除元素删除前的下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::MarkRemoved(
+    vector<Status>& Statuses,
+    vector<size_t>& Removed,
+    size_t Index
+) {
+    // 新建的元素不在基准文件中，只需删除其状态
+    if (Statuses[Index] != Status::CREATED) {
+        // 基准中剩余的元素保持原有顺序，第 Index 个剩余元素的基准下标
+        // 为第 Index 个不在 Removed 中的自然数
+        size_t ullBaseIndex = Index;
+        auto Position = Removed.begin();
+        while (Position != Removed.end() && *Position <= ullBaseIndex) {
+            ullBaseIndex++;
+            ++Position;
+        }
+        Removed.insert(Position, ullBaseIndex);
+    }
+    Statuses.erase(Statuses.begin() + Index);
+}
+
+/**********************************************************************
+【函数名称】 ApplyDeltas
+【函数功能】 应用模型文件的附属文件中增量保存的记录，
+    附属文件不存在时不做任何事。
+【参数】
+    Path: 模型文件的位置。
+    AModel: 从模型文件导入的模型。
+【返回值】 无
+    如果记录无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::ApplyDeltas(string Path, Model<3>& AModel) {
+    ifstream Deltas(Path + ModelDelta::JOURNAL_SUFFIX, ios::in | ios::binary);
+    if (Deltas.is_open()) {
+        ModelDelta::ApplyAll(Deltas, AModel);
+    }
+}
+
+/**********************************************************************
+【函数名称】 WriteJournal
+【函数功能】 预写日志打开时追加一条记录，记录数达到
+    COMPACT_RECORD_COUNT 且可以增量保存时，以 Compact 清空日志。
+【参数】
+    ARecord: 要追加的记录。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::WriteJournal(const EditJournal::Record& ARecord) {
+    if (m_pJournal == nullptr) {
+        return;
+    }
+    m_pJournal->Append(ARecord);
+    // 没有基准或有后台任务时无法增量保存，日志继续增长直到下一次保存
+    if (
+        m_pJournal->GetRecordCount() >= COMPACT_RECORD_COUNT &&
+        m_bHasBase &&
+        m_pTask == nullptr
+    ) {
+        Compact();
+    }
+}
+
+/**********************************************************************
+【函数名称】 ReplayJournal
+【函数功能】 在刚加载的模型上依次重放预写日志中的记录，
+    遇到第一条失败的记录即停止；预写日志打开时，
+    以成功重放的记录替换日志。
+【参数】
+    Path: 模型文件的位置。
+    Records: 预写日志中的记录。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::ReplayJournal(
+    string Path,
+    const vector<EditJournal::Record>& Records
+) {
+    // 重放时暂时移走日志，重放的修改不会再次追加
+    unique_ptr<EditJournal> pJournal = move(m_pJournal);
+    size_t ullReplayed = 0;
+    while (
+        ullReplayed < Records.size() &&
+        Replay(Records[ullReplayed]) == Result::OK
+    ) {
+        ullReplayed++;
+    }
+    m_pJournal = move(pJournal);
+    if (m_pJournal == nullptr) {
+        return;
+    }
+    // 失败的记录与文件不一致，连同之后的记录一同丢弃
+    vector<EditJournal::Record> Replayed(
+        Records.begin(),
+        Records.begin() + ullReplayed
+    );
+    // 原日志仍相对于其模型文件，失败时只需关闭
+    if (!m_pJournal->Reset(Path + EditJournal::SUFFIX, Replayed)) {
+        m_pJournal.reset();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Replay
+【函数功能】 调用记录对应的修改函数重放一条记录。
+【参数】
+    ARecord: 要重放的记录。
+【返回值】
+    修改函数发生的错误类型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::Replay(
+    const EditJournal::Record& ARecord
+) {
+    // 坐标的个数在读取时已按操作确定
+    const vector<double>& Values = ARecord.Coordinates;
+    switch (ARecord.Op) {
+        case EditJournal::Operation::SET_NAME : {
+            SetName(ARecord.Name);
+            return Result::OK;
+        }
+        case EditJournal::Operation::ADD_LINE : {
+            return AddLine(
+                Values[0], Values[1], Values[2],
+                Values[3], Values[4], Values[5]
+            );
+        }
+        case EditJournal::Operation::MODIFY_LINE : {
+            return ModifyLine(
+                ARecord.Index,
+                ARecord.PointIndex,
+                Values[0], Values[1], Values[2]
+            );
+        }
+        case EditJournal::Operation::REMOVE_LINE : {
+            return RemoveLine(ARecord.Index);
+        }
+        case EditJournal::Operation::ADD_FACE : {
+            return AddFace(
+                Values[0], Values[1], Values[2],
+                Values[3], Values[4], Values[5],
+                Values[6], Values[7], Values[8]
+            );
+        }
+        case EditJournal::Operation::MODIFY_FACE : {
+            return ModifyFace(
+                ARecord.Index,
+                ARecord.PointIndex,
+                Values[0], Values[1], Values[2]
+            );
+        }
+        case EditJournal::Operation::REMOVE_FACE : {
+            return RemoveFace(ARecord.Index);
+        }
+        case EditJournal::Operation::SIMPLIFY : {
+            return SimplifyModel(ARecord.Index);
+        }
+        default : {
+            return ReorderModel();
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 ResetJournal
+【函数功能】 文件保存成功后，预写日志打开时将其移到该文件旁，
+    只保留第 First 条之后的记录，否则删除该文件旁的日志。
+【参数】
+    Path: 保存的文件的位置。
+    First: 保留的第一条记录的下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::ResetJournal(string Path, size_t First) {
+    string JournalPath = Path + EditJournal::SUFFIX;
+    if (m_pJournal == nullptr) {
+        remove(JournalPath.c_str());
+    }
+    // 文件已包含原日志中的修改，原日志再次重放会重复修改，
+    // 因此无法替换时关闭并删除原日志
+    else if (!m_pJournal->Reset(JournalPath, First)) {
+        string OldPath = m_pJournal->GetPath();
+        m_pJournal.reset();
+        remove(OldPath.c_str());
+    }
+}
+
+/**********************************************************************
+【函数名称】 KeepBase
+【函数功能】 保存的文件不能还原模型、不能作为基准时调用。
+    另存为其他文件时，原基准、元素状态与预写日志保持不变，
+    只删除目标文件旁的旧日志；覆盖了基准文件时不再有基准，
+    原日志相对于被覆盖的内容，因此关闭并删除。
+【参数】
+    Path: 保存的文件的位置。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::KeepBase(string Path) {
+    if (Path != m_Path) {
+        remove((Path + EditJournal::SUFFIX).c_str());
+        return;
+    }
+    m_bHasBase = false;
+    if (m_pJournal != nullptr) {
+        string JournalPath = m_pJournal->GetPath();
+        m_pJournal.reset();
+        remove(JournalPath.c_str());
+    }
+    else {
+        remove((Path + EditJournal::SUFFIX).c_str());
+    }
+}
+
+/**********************************************************************
+【函数名称】 MeasureBase
+【函数功能】 基准文件改变后，记录完整保存的内容与之后增量保存的
+    记录各自的字节数。
+【参数】
+    Path: 基准文件的位置。
+    AppendedBytes: 基准文件末尾追加的增量记录的字节数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::MeasureBase(string Path, size_t AppendedBytes) {
+    size_t ullFileBytes = GetFileSize(Path);
+    m_BaseBytes = ullFileBytes > AppendedBytes
+        ? ullFileBytes - AppendedBytes
+        : 0;
+    m_DeltaBytes = AppendedBytes +
+        GetFileSize(Path + ModelDelta::JOURNAL_SUFFIX);
+}
+
+/**********************************************************************
+【函数名称】 Compact
+【函数功能】 先增量保存以清空预写日志；增量记录的字节数超过基准的
+    COMPACT_DELTA_RATIO 时，再以相同的层级数完整重写基准，
+    同时清空附属文件或文件末尾的记录，使基准与增量记录的总量
+    不随修改无限增长。重写的文件不能还原模型时保留原基准。
+【参数】 无
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::Compact() {
+    Result SaveResult = SaveChanges();
+    if (
+        SaveResult != Result::OK ||
+        static_cast<double>(m_DeltaBytes) <=
+            COMPACT_DELTA_RATIO * static_cast<double>(m_BaseBytes)
+    ) {
+        return SaveResult;
+    }
+    unique_ptr<ExporterBase<3>> pExporter;
+    try {
+        pExporter = StorageFactory::GetExporter<3>(GetExtension(m_Path));
+    }
+    catch (StorageFactoryLookupException) {
+        return Result::STORAGE_LOOKUP_ERROR;
+    }
+    ExportOptions Options;
+    Options.LodLevelCount = m_BaseLevelCount;
+    // 重写后不能再作为基准时，保留原基准与增量记录
+    if (!pExporter->CanRoundTrip(m_Model, Options)) {
+        return Result::OK;
+    }
+    // 删除附属文件或重写文件末尾的记录，并清空预写日志
+    return SaveModel(m_Path, m_BaseLevelCount);
+}
+
+/**********************************************************************
+【函数名称】 GetFileSize
+【函数功能】 获取文件的字节数。
+【参数】
+    Path: 文件的位置。
+【返回值】
+    文件的字节数，文件无法打开时为 0。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t ControllerBase::GetFileSize(string Path) {
+    ifstream File(Path, ios::in | ios::binary);
+    if (!File.is_open()) {
+        return 0;
+    }
+    File.seekg(0, ios::end);
+    streamoff llSize = File.tellg();
+    return llSize > 0 ? static_cast<size_t>(llSize) : 0;
+}
+
+/**********************************************************************
+【函数名称】 GetProgress
+【函数功能】 读取任务状态中的进度。
+【参数】
+    State: 任务状态。
+【返回值】
+    任务的进度。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::TaskProgress ControllerBase::GetProgress(
+    const TaskState& State
+) {
+    return TaskProgress {
+        State.ProcessedBytes,
+        State.TotalBytes,
+        State.ElementCount
+    };
+}
+
+/**********************************************************************
+【函数名称】 RunLoad
+【函数功能】 在后台线程中执行加载任务。
+【参数】
+    pTask: 任务状态。
+    pImporter: 导入器。
+    pCache: 导入缓存，为空时直接解析文件。
+    OnProgress: 进度回调，可以为空。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::RunLoad(
+    shared_ptr<TaskState> pTask,
+    shared_ptr<ImporterBase<3>> pImporter,
+    shared_ptr<const ImportCache> pCache,
+    function<void(const TaskProgress&)> OnProgress
+) {
+    Model<3>& NewModel = *pTask->pModel;
+    try {
+        auto Parse = [&pTask, &pImporter, &OnProgress](Model<3>& Parsed) {
+            return ParseFile(*pTask, *pImporter, OnProgress, Parsed);
+        };
+        if (pCache == nullptr) {
+            Parse(NewModel);
+        }
+        else {
+            pCache->Import(pTask->Path, NewModel, Parse);
+        }
+        ApplyDeltas(pTask->Path, NewModel);
+        pTask->AppendedBytes = pImporter->GetAppendedSize(pTask->Path);
+        // 日志调用控制器的修改函数重放，由 EndTask 在重排之前完成
+        pTask->JournalRecords = EditJournal::Read(
+            pTask->Path + EditJournal::SUFFIX
+        );
+        pTask->ElementCount = NewModel.Lines.Count() + NewModel.Faces.Count();
+    }
+    catch (FileOpenException) {
+        pTask->TaskResult = Result::FILE_OPEN_ERROR;
+    }
+    catch (FileFormatException) {
+        pTask->TaskResult = Result::FILE_FORMAT_ERROR;
+    }
+    catch (...) {
+        pTask->pException = current_exception();
+    }
+    // 取消后读取提前结束，结果无论成功与否都不完整
+    if (pTask->bCancelled) {
+        pTask->TaskResult = Result::CANCELLED;
+        pTask->pException = nullptr;
+    }
+    pTask->bFinished = true;
+}
+
+/**********************************************************************
+【函数名称】 ParseFile
+【函数功能】 在后台线程中解析加载任务的文件，并更新任务的进度。
+【参数】
+    Task: 任务状态。
+    Importer: 导入器。
+    OnProgress: 进度回调，可以为空。
+    Parsed: 接收解析结果的模型。
+【返回值】
+    结果是否完整，即任务是否未被取消。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ControllerBase::ParseFile(
+    TaskState& Task,
+    const ImporterBase<3>& Importer,
+    const function<void(const TaskProgress&)>& OnProgress,
+    Model<3>& Parsed
+) {
+    ios::openmode Mode = ios::in;
+    if (Importer.IsBinary()) {
+        Mode |= ios::binary;
+    }
+    ifstream File(Task.Path, Mode);
+    if (!File.is_open()) {
+        throw FileOpenException(Task.Path);
+    }
+    File.seekg(0, ios::end);
+    streamoff llSize = File.tellg();
+    File.seekg(0, ios::beg);
+    if (llSize > 0) {
+        Task.TotalBytes = static_cast<size_t>(llSize);
+    }
+    // 回调在本线程的读取中调用，此时读取模型是安全的
+    ProgressBuffer Buffer(
+        *File.rdbuf(),
+        [&Task, &Parsed, &OnProgress](size_t ProcessedBytes) {
+            Task.ProcessedBytes = ProcessedBytes;
+            Task.ElementCount = Parsed.Lines.Count() + Parsed.Faces.Count();
+            if (OnProgress) {
+                OnProgress(GetProgress(Task));
+            }
+            return !Task.bCancelled;
+        }
+    );
+    istream Stream(&Buffer);
+    Importer.Import(Stream, Parsed);
+    return !Task.bCancelled;
+}
+
+/**********************************************************************
+【函数名称】 RunSave
+【函数功能】 在后台线程中执行保存任务。
+【参数】
+    pTask: 任务状态。
+    pExporter: 导出器。
+    OnProgress: 进度回调，可以为空。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ControllerBase::RunSave(
+    shared_ptr<TaskState> pTask,
+    shared_ptr<ExporterBase<3>> pExporter,
+    function<void(const TaskProgress&)> OnProgress
+) {
+    string TempPath = pTask->Path + ".tmp";
+    bool bWritten = false;
+    try {
+        ios::openmode Mode = ios::out | ios::trunc;
+        if (pExporter->IsBinary()) {
+            Mode |= ios::binary;
+        }
+        ofstream File(TempPath, Mode);
+        if (!File.is_open()) {
+            throw FileOpenException(TempPath);
+        }
+        {
+            ProgressBuffer Buffer(
+                *File.rdbuf(),
+                [&pTask, &OnProgress](size_t ProcessedBytes) {
+                    pTask->ProcessedBytes = ProcessedBytes;
+                    if (OnProgress) {
+                        OnProgress(GetProgress(*pTask));
+                    }
+                    return !pTask->bCancelled;
+                }
+            );
+            ostream Stream(&Buffer);
+            ExportOptions Options;
+            Options.LodLevelCount = pTask->LodLevelCount;
+            Options.pNormals = pTask->pNormals.get();
+            Options.bOptimizeVertexCache = pTask->bOptimizeVertexCache;
+            pExporter->Export(Stream, *pTask->pModel, Options);
+            Stream.flush();
+            bWritten = Stream.good();
+        }
+        File.close();
+        // 替换目标文件前先写入磁盘，崩溃时不会留下不完整的目标文件
+        bWritten = bWritten && !File.fail() && FileSync::Sync(TempPath);
+        if (!bWritten && !pTask->bCancelled) {
+            throw FileOpenException(TempPath);
+        }
+    }
+    catch (FileOpenException) {
+        pTask->TaskResult = Result::FILE_OPEN_ERROR;
+    }
+    catch (...) {
+        pTask->pException = current_exception();
+    }
+    if (pTask->bCancelled) {
+        pTask->TaskResult = Result::CANCELLED;
+        pTask->pException = nullptr;
+        bWritten = false;
+    }
+    if (bWritten) {
+        if (!FileSync::Rename(TempPath, pTask->Path)) {
+            pTask->TaskResult = Result::FILE_OPEN_ERROR;
+        }
+        else {
+            remove((pTask->Path + ModelDelta::JOURNAL_SUFFIX).c_str());
+        }
+    }
+    else {
+        remove(TempPath.c_str());
+    }
+    pTask->bFinished = true;
+}
+
 }
 
 }
\ No newline at end of file
@@ -7,13 +7,25 @@
 #ifndef CONTROLLER_BASE_HPP
 #define CONTROLLER_BASE_HPP
 
+#include <atomic>
 #include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 #include "../Models/Core/Model.hpp"
 #include "../Models/Core/Line.hpp"
 #include "../Models/Core/Face.hpp"
 #include "../Models/Core/Point.hpp"
+#include "../Models/Mesh/MassProperties.hpp"
+#include "../Models/Mesh/Normals.hpp"
+#include "../Models/Storage/EditJournal.hpp"
+#include "../Models/Storage/ExporterBase.hpp"
+#include "../Models/Storage/ImportCache.hpp"
+#include "../Models/Storage/ImporterBase.hpp"
+#include "../Models/Storage/ModelDelta.hpp"
 using namespace std;
 
 namespace C3w {
@@ -29,10 +41,11 @@ namespace Controllers {
         Status: 表示一个元素的状态。
         GetElementResult: 用于 GetLines, GetFaces 表示其返回值。
         Statistics: 作为 GetStatistics 的返回值。
+        TaskProgress: 表示后台任务的进度。
     构造与析构：
         默认构造函数。
         删除拷贝、移动构造函数。
-        虚析构函数。
+        虚析构函数，取消并等待后台任务。
     操作：
         GetName: 获取模型名称。
         GetLines, GetFaces: 获取模型中所有线段/面。
@@ -41,8 +54,23 @@ namespace Controllers {
         ModifyLine, ModifyFace: 修改模型中指定线段/面的点坐标。
         RemoveLine, RemoveFace: 删除模型中的线段/面。
         GetStatistics: 获取模型统计信息。
+        GetNormals: 获取缓存的面与顶点法向，面被修改后重新计算。
+        SimplifyModel: 使用二次误差度量简化模型。
+        ReorderModel: 沿 Morton 曲线重排模型中的线段与面。
         LoadModel: 从文件中加载模型。
         SaveModel: 向文件中保存模型。
+        SaveChanges: 只将上次加载或保存之后的修改追加到原文件。
+        BeginLoadModel: 在后台线程中从文件加载模型。
+        BeginSaveModel: 在后台线程中向文件保存模型。
+        IsTaskFinished: 判断后台任务是否已结束。
+        GetTaskProgress: 获取后台任务的进度。
+        CancelTask: 请求取消后台任务。
+        EndTask: 等待后台任务结束并应用其结果。
+        OpenJournal: 打开预写日志，之后的每次修改都追加到日志中。
+        CloseJournal: 关闭预写日志。
+        FlushJournal: 等待预写日志中的记录写入磁盘。
+        IsJournalOpen: 判断预写日志是否已打开。
+        SetCacheDirectory, GetCacheDirectory: 设置/获取导入缓存的目录。
         PointToString (protected): 将点转化为字符串，纯虚函数。
         LineToString (protected): 将线段转化为字符串，纯虚函数。
         FaceToString (protected): 将面转化为字符串，纯虚函数。
@@ -76,12 +104,19 @@ class ControllerBase {
             // 点重复
             POINT_COLLISION,
             // 元素重复
-            ELEMENT_COLLISION
+            ELEMENT_COLLISION,
+            // 已有后台任务正在运行
+            TASK_RUNNING,
+            // 操作被取消
+            CANCELLED,
+            // 没有可供增量保存的基准文件
+            FULL_SAVE_REQUIRED
         };
 
         /**********************************************************************
         【类名】 Status
-        【功能】 代表线段/面是否为刚创建的或是被修改过的。
+        【功能】 代表线段/面相对于上一次加载或保存，
+            是否为刚创建的或是被修改过的。
         【接口说明】 枚举，表示元素的状态。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
@@ -110,7 +145,9 @@ class ControllerBase {
         /**********************************************************************
         【类名】 Statistics
         【功能】 用于 GetStatistics 的返回值。
-        【接口说明】 点数量，线段数量/总长度，面数量/总面积，外接长方体体积。
+        【接口说明】 点数量，线段数量/总长度，面数量/总面积，外接长方体体积，
+            有向包围盒体积，最小包围球半径，
+            面所围实体的体积/质心/惯性张量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         struct Statistics {
@@ -126,6 +163,31 @@ class ControllerBase {
             double TotalFaceArea;
             // 外接长方体体积
             double BoundingBoxVolume;
+            // 有向包围盒体积
+            double OrientedBoxVolume;
+            // 最小包围球半径
+            double BoundingSphereRadius;
+            // 面所围实体的体积
+            double Volume;
+            // 面所围实体的质心
+            Point<3> Centroid;
+            // 面所围实体关于质心的惯性张量
+            Mesh::MassProperties::Tensor InertiaTensor;
+        };
+
+        /**********************************************************************
+        【类名】 TaskProgress
+        【功能】 用于 GetTaskProgress 与后台任务的进度回调。
+        【接口说明】 已读入或写出的字节数，文件的总字节数，元素数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct TaskProgress {
+            // 已读入或写出的字节数
+            size_t ProcessedBytes;
+            // 文件的总字节数，未知时为 0
+            size_t TotalBytes;
+            // 加载时为已解析的元素数，保存时为要写出的元素数
+            size_t ElementCount;
         };
         
         // 构造函数
@@ -199,7 +261,7 @@ class ControllerBase {
         );
         /**********************************************************************
         【函数名称】 ModifyLine
-        【函数功能】 修改一个线段。
+        【函数功能】 修改一个线段，新建的线段仍保持新建状态。
         【参数】
             Index: 线段的下标。
             PointIndex: 要修改的点在线段中的下标。
@@ -261,7 +323,7 @@ class ControllerBase {
         );
         /**********************************************************************
         【函数名称】 ModifyFace
-        【函数功能】 修改一个面。
+        【函数功能】 修改一个面，新建的面仍保持新建状态。
         【参数】
             Index: 面的下标。
             PointIndex: 要修改的点在面中的下标。
@@ -295,33 +357,239 @@ class ControllerBase {
         **********************************************************************/
         Statistics GetStatistics() const;
         /**********************************************************************
+        【函数名称】 GetNormals
+        【函数功能】 获取模型的面法向与面积加权的顶点法向。
+            结果被缓存，直到面被添加、修改、删除或模型被替换。
+        【参数】 无
+        【返回值】
+            法向的常引用，在下一次修改面之前有效。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const Mesh::Normals& GetNormals() const;
+        /**********************************************************************
+        【函数名称】 SimplifyModel
+        【函数功能】 使用二次误差度量简化模型，线段保持不变，
+            所有面标记为已修改。
+        【参数】
+            TargetFaceCount: 目标面数。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result SimplifyModel(size_t TargetFaceCount);
+        /**********************************************************************
+        【函数名称】 ReorderModel
+        【函数功能】 沿 Morton 曲线重排模型中的线段与面，
+            元素的状态随元素一同移动。
+        【参数】 无
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result ReorderModel();
+        /**********************************************************************
         【函数名称】 LoadModel
-        【函数功能】 从文件加载一个模型。
+        【函数功能】 从文件加载一个模型，应用增量保存的附属文件，
+            并重放预写日志中的修改。
+            不重排时，该文件成为之后增量保存的基准。
         【参数】
             Path: 文件位置。
+            Reorder: 是否在加载后沿 Morton 曲线重排，默认为否。
         【返回值】
-            函数发生的错误类型。
+            函数发生的错误类型。有后台任务时返回 TASK_RUNNING。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Result LoadModel(string Path);
+        Result LoadModel(string Path, bool Reorder = false);
         /**********************************************************************
         【函数名称】 SaveModel
-        【函数功能】 向文件保存一个模型。
+        【函数功能】 向文件完整保存一个模型，并删除其增量保存的附属文件。
+            导出的文件能还原模型时（见 ExporterBase::CanRoundTrip），
+            该文件成为之后增量保存的基准，所有元素的状态重置为未修改；
+            预写日志打开时，日志移到该文件并清空，否则删除其预写日志。
+            不能还原时由 KeepBase 处理原基准与预写日志。
         【参数】
             Path: 文件位置。
+            LodLevelCount: 保存的细节层级数，仅 .c3w 文件使用，默认为 1。
+            OptimizeVertexCache: 是否为 GPU 顶点缓存重排面与顶点，默认为否。
+            WriteNormals: 是否计算并写出法向，默认为否。
         【返回值】
-            函数发生的错误类型。
+            函数发生的错误类型。有后台任务时返回 TASK_RUNNING。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result SaveModel(
+            string Path,
+            size_t LodLevelCount = 1,
+            bool OptimizeVertexCache = false,
+            bool WriteNormals = false
+        );
+        /**********************************************************************
+        【函数名称】 SaveChanges
+        【函数功能】 将上次加载或保存之后删除、修改与新建的元素
+            作为一条 ModelDelta 记录追加到基准文件：
+            导出器支持追加时追加到文件末尾，否则追加到附属文件中。
+            写入的数据量与修改的元素数成正比。
+            成功后所有元素的状态重置为未修改，预写日志被清空。
+        【参数】 无
+        【返回值】
+            函数发生的错误类型。重排、简化模型后或尚未加载、保存时
+            没有基准，返回 FULL_SAVE_REQUIRED，应先使用 SaveModel。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result SaveChanges();
+        /**********************************************************************
+        【函数名称】 BeginLoadModel
+        【函数功能】 在后台线程中从文件加载一个模型到新的模型中，
+            当前模型在 EndTask 之前保持不变。
+        【参数】
+            Path: 文件位置。
+            Reorder: 是否在加载后沿 Morton 曲线重排，默认为否。
+            OnProgress: 形如 void(const TaskProgress& Progress) 的函数，
+                每读入一块数据在后台线程中调用一次，默认为空。
+        【返回值】
+            函数发生的错误类型，文件本身的错误由 EndTask 返回。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result BeginLoadModel(
+            string Path,
+            bool Reorder = false,
+            function<void(const TaskProgress&)> OnProgress = nullptr
+        );
+        /**********************************************************************
+        【函数名称】 BeginSaveModel
+        【函数功能】 在后台线程中向文件保存当前模型的副本，之后对模型的
+            修改不影响本次保存。先写入临时文件，成功后替换目标文件，
+            因此取消或失败时原文件保持不变。
+        【参数】
+            Path: 文件位置。
+            LodLevelCount: 保存的细节层级数，仅 .c3w 文件使用，默认为 1。
+            OptimizeVertexCache: 是否为 GPU 顶点缓存重排面与顶点，默认为否。
+            WriteNormals: 是否计算并写出法向，默认为否。
+            OnProgress: 形如 void(const TaskProgress& Progress) 的函数，
+                每写出一块数据在后台线程中调用一次，默认为空。
+        【返回值】
+            函数发生的错误类型，写入时的错误由 EndTask 返回。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result BeginSaveModel(
+            string Path,
+            size_t LodLevelCount = 1,
+            bool OptimizeVertexCache = false,
+            bool WriteNormals = false,
+            function<void(const TaskProgress&)> OnProgress = nullptr
+        );
+        /**********************************************************************
+        【函数名称】 IsTaskFinished
+        【函数功能】 判断后台任务是否已结束，可在等待时轮询。
+        【参数】 无
+        【返回值】
+            后台任务是否已结束，没有后台任务时为真。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsTaskFinished() const;
+        /**********************************************************************
+        【函数名称】 GetTaskProgress
+        【函数功能】 获取后台任务的进度，可在等待时轮询。
+        【参数】 无
+        【返回值】
+            后台任务的进度，没有后台任务时各项均为 0。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        TaskProgress GetTaskProgress() const;
+        /**********************************************************************
+        【函数名称】 CancelTask
+        【函数功能】 请求取消后台任务，任务在读入或写出下一块数据时结束。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void CancelTask();
+        /**********************************************************************
+        【函数名称】 EndTask
+        【函数功能】 等待后台任务结束。加载成功时以新模型替换当前模型，
+            取消或失败时当前模型保持不变。加载或保存成功时，
+            文件成为增量保存的基准的条件与 LoadModel、SaveModel 相同，
+            保存期间模型又被修改时除外；保存的文件不能还原模型时
+            同样由 KeepBase 处理。
+        【参数】 无
+        【返回值】
+            后台任务发生的错误类型，被取消时为 CANCELLED，
+            没有后台任务时为 OK。
+            后台任务中抛出的其他异常在此重新抛出。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result EndTask();
+        /**********************************************************************
+        【函数名称】 OpenJournal
+        【函数功能】 先增量保存之前的修改，再在基准文件旁创建预写日志，
+            之后的每次修改都追加到日志中，加载该文件时重放。
+            日志达到 COMPACT_RECORD_COUNT 条记录时由 Compact 压缩。
+        【参数】 无
+        【返回值】
+            函数发生的错误类型。没有基准时返回 FULL_SAVE_REQUIRED，
+            应先使用 SaveModel。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result OpenJournal();
+        /**********************************************************************
+        【函数名称】 CloseJournal
+        【函数功能】 提交剩余的记录并关闭预写日志，日志文件保留。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void CloseJournal();
+        /**********************************************************************
+        【函数名称】 FlushJournal
+        【函数功能】 等待预写日志中已追加的记录全部写入磁盘。
+        【参数】 无
+        【返回值】
+            函数发生的错误类型，日志未打开时为 OK。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result FlushJournal();
+        /**********************************************************************
+        【函数名称】 IsJournalOpen
+        【函数功能】 判断预写日志是否已打开。
+        【参数】 无
+        【返回值】
+            预写日志是否已打开。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Result SaveModel(string Path);
+        bool IsJournalOpen() const;
+        /**********************************************************************
+        【函数名称】 SetCacheDirectory
+        【函数功能】 设置导入缓存的目录，之后加载文本格式的文件时
+            优先读取缓存的快照，未命中时在解析后写入快照。
+            正在运行的后台任务继续使用原来的设置。
+        【参数】
+            Directory: 已经存在的目录，为空时关闭缓存。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void SetCacheDirectory(string Directory);
+        /**********************************************************************
+        【函数名称】 GetCacheDirectory
+        【函数功能】 获取导入缓存的目录。
+        【参数】 无
+        【返回值】
+            导入缓存的目录，未开启缓存时为空。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        string GetCacheDirectory() const;
 
         // 操作符
 
         // 删除赋值运算符
         ControllerBase& operator=(const ControllerBase& Other) = delete;
 
-        // 虚析构函数
-        virtual ~ControllerBase() = default;
+        /**********************************************************************
+        【函数名称】 析构函数
+        【函数功能】 取消并等待后台任务。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual ~ControllerBase();
 
     protected:
         /**********************************************************************
@@ -363,10 +631,90 @@ class ControllerBase {
             Status AStatus
         ) const = 0;
     private:
+        // 预写日志达到此记录数时自动增量保存并清空
+        static constexpr size_t COMPACT_RECORD_COUNT { 4096 };
+        // 增量记录的字节数超过基准的此比例时，压缩时完整重写基准
+        static constexpr double COMPACT_DELTA_RATIO { 0.5 };
+
         string m_Path;
         Model<3> m_Model;
         vector<Status> m_LineStatus;
         vector<Status> m_FaceStatus;
+        // 被删除的线段在基准文件中的下标，严格递增
+        vector<size_t> m_RemovedLines;
+        // 被删除的面在基准文件中的下标，严格递增
+        vector<size_t> m_RemovedFaces;
+        // m_Path 是否为增量保存的基准
+        bool m_bHasBase { false };
+        // 修改计数，每次修改模型时递增
+        size_t m_Revision { 0 };
+        // 上一次加载或保存时的修改计数
+        size_t m_SavedRevision { 0 };
+        // 基准文件中完整保存的内容的字节数
+        size_t m_BaseBytes { 0 };
+        // 基准之后增量保存的记录的字节数，含附属文件
+        size_t m_DeltaBytes { 0 };
+        // 基准文件保存的细节层级数，重写基准时沿用
+        size_t m_BaseLevelCount { 1 };
+        // 缓存的法向，为空表示需要重新计算
+        mutable unique_ptr<Mesh::Normals> m_pNormals;
+        // 预写日志，为空表示未打开
+        unique_ptr<Storage::EditJournal> m_pJournal;
+        // 导入缓存，为空表示未开启；后台线程共享其所有权
+        shared_ptr<const Storage::ImportCache> m_pCache;
+
+        /**********************************************************************
+        【类名】 TaskState
+        【功能】 控制器与后台线程共享的任务状态。
+        【接口说明】 进度与取消标志为原子变量，其余成员在任务结束前
+            只由后台线程访问。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct TaskState {
+            // 文件位置
+            string Path;
+            // 是否为加载任务
+            bool bLoading { false };
+            // 加载后是否重排
+            bool bReorder { false };
+            // 开始保存时的修改计数
+            size_t Revision { 0 };
+            // 开始保存时预写日志中的记录数
+            size_t JournalRecordCount { 0 };
+            // 加载时读取的预写日志记录
+            vector<Storage::EditJournal::Record> JournalRecords;
+            // 已读入或写出的字节数
+            atomic<size_t> ProcessedBytes { 0 };
+            // 文件的总字节数
+            atomic<size_t> TotalBytes { 0 };
+            // 已解析或要写出的元素数
+            atomic<size_t> ElementCount { 0 };
+            // 是否已请求取消
+            atomic<bool> bCancelled { false };
+            // 是否已结束
+            atomic<bool> bFinished { false };
+            // 任务的结果
+            Result TaskResult { Result::OK };
+            // 任务中抛出的其他异常
+            exception_ptr pException;
+            // 加载得到的模型，或要保存的模型副本
+            unique_ptr<Model<3>> pModel;
+            // 要保存的法向副本，为空时不写出法向
+            unique_ptr<Mesh::Normals> pNormals;
+            // 保存的细节层级数
+            size_t LodLevelCount { 1 };
+            // 保存时是否优化顶点缓存
+            bool bOptimizeVertexCache { false };
+            // 保存的文件能否还原模型，作为增量保存的基准
+            bool bCanRoundTrip { false };
+            // 加载的文件末尾追加的增量记录的字节数
+            size_t AppendedBytes { 0 };
+        };
+
+        // 后台线程
+        thread m_TaskThread;
+        // 后台任务的状态，为空表示没有后台任务
+        shared_ptr<TaskState> m_pTask;
 
         /**********************************************************************
         【函数名称】 GetExtension
@@ -378,6 +726,204 @@ class ControllerBase {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         static string GetExtension(string Path);
+        /**********************************************************************
+        【函数名称】 ResetBase
+        【函数功能】 以文件为增量保存的基准，所有元素的状态重置为未修改。
+        【参数】
+            Path: 基准文件的位置。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void ResetBase(string Path);
+        /**********************************************************************
+        【函数名称】 GetDelta
+        【函数功能】 生成当前模型相对于基准文件的增量记录。
+            新建的元素总在基准中剩余的元素之后，因此剩余元素当前的
+            下标即为删除后的下标。
+        【参数】 无
+        【返回值】
+            增量记录。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Storage::ModelDelta GetDelta() const;
+        /**********************************************************************
+        【函数名称】 MarkRemoved
+        【函数功能】 在元素被删除后更新状态与被删除的基准下标。
+        【参数】
+            Statuses: 元素的状态。
+            Removed: 被删除的元素在基准文件中的下标。
+            Index: 被删除元素删除前的下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void MarkRemoved(
+            vector<Status>& Statuses,
+            vector<size_t>& Removed,
+            size_t Index
+        );
+        /**********************************************************************
+        【函数名称】 ApplyDeltas
+        【函数功能】 应用模型文件的附属文件中增量保存的记录，
+            附属文件不存在时不做任何事。
+        【参数】
+            Path: 模型文件的位置。
+            AModel: 从模型文件导入的模型。
+        【返回值】 无
+            如果记录无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void ApplyDeltas(string Path, Model<3>& AModel);
+        /**********************************************************************
+        【函数名称】 WriteJournal
+        【函数功能】 预写日志打开时追加一条记录，记录数达到
+            COMPACT_RECORD_COUNT 且可以增量保存时，以 Compact 清空日志。
+        【参数】
+            ARecord: 要追加的记录。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void WriteJournal(const Storage::EditJournal::Record& ARecord);
+        /**********************************************************************
+        【函数名称】 ReplayJournal
+        【函数功能】 在刚加载的模型上依次重放预写日志中的记录，
+            遇到第一条失败的记录即停止；预写日志打开时，
+            以成功重放的记录替换日志。
+        【参数】
+            Path: 模型文件的位置。
+            Records: 预写日志中的记录。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void ReplayJournal(
+            string Path,
+            const vector<Storage::EditJournal::Record>& Records
+        );
+        /**********************************************************************
+        【函数名称】 Replay
+        【函数功能】 调用记录对应的修改函数重放一条记录。
+        【参数】
+            ARecord: 要重放的记录。
+        【返回值】
+            修改函数发生的错误类型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result Replay(const Storage::EditJournal::Record& ARecord);
+        /**********************************************************************
+        【函数名称】 ResetJournal
+        【函数功能】 文件保存成功后，预写日志打开时将其移到该文件旁，
+            只保留第 First 条之后的记录，否则删除该文件旁的日志。
+        【参数】
+            Path: 保存的文件的位置。
+            First: 保留的第一条记录的下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void ResetJournal(string Path, size_t First);
+        /**********************************************************************
+        【函数名称】 KeepBase
+        【函数功能】 保存的文件不能还原模型、不能作为基准时调用。
+            另存为其他文件时，原基准、元素状态与预写日志保持不变，
+            只删除目标文件旁的旧日志；覆盖了基准文件时不再有基准，
+            原日志相对于被覆盖的内容，因此关闭并删除。
+        【参数】
+            Path: 保存的文件的位置。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void KeepBase(string Path);
+        /**********************************************************************
+        【函数名称】 MeasureBase
+        【函数功能】 基准文件改变后，记录完整保存的内容与之后增量保存的
+            记录各自的字节数。
+        【参数】
+            Path: 基准文件的位置。
+            AppendedBytes: 基准文件末尾追加的增量记录的字节数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void MeasureBase(string Path, size_t AppendedBytes);
+        /**********************************************************************
+        【函数名称】 Compact
+        【函数功能】 先增量保存以清空预写日志；增量记录的字节数超过基准的
+            COMPACT_DELTA_RATIO 时，再以相同的层级数完整重写基准，
+            同时清空附属文件或文件末尾的记录，使基准与增量记录的总量
+            不随修改无限增长。重写的文件不能还原模型时保留原基准。
+        【参数】 无
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result Compact();
+        /**********************************************************************
+        【函数名称】 GetFileSize
+        【函数功能】 获取文件的字节数。
+        【参数】
+            Path: 文件的位置。
+        【返回值】
+            文件的字节数，文件无法打开时为 0。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static size_t GetFileSize(string Path);
+        /**********************************************************************
+        【函数名称】 GetProgress
+        【函数功能】 读取任务状态中的进度。
+        【参数】
+            State: 任务状态。
+        【返回值】
+            任务的进度。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static TaskProgress GetProgress(const TaskState& State);
+        /**********************************************************************
+        【函数名称】 RunLoad
+        【函数功能】 在后台线程中执行加载任务。
+        【参数】
+            pTask: 任务状态。
+            pImporter: 导入器。
+            pCache: 导入缓存，为空时直接解析文件。
+            OnProgress: 进度回调，可以为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void RunLoad(
+            shared_ptr<TaskState> pTask,
+            shared_ptr<Storage::ImporterBase<3>> pImporter,
+            shared_ptr<const Storage::ImportCache> pCache,
+            function<void(const TaskProgress&)> OnProgress
+        );
+        /**********************************************************************
+        【函数名称】 ParseFile
+        【函数功能】 在后台线程中解析加载任务的文件，并更新任务的进度。
+        【参数】
+            Task: 任务状态。
+            Importer: 导入器。
+            OnProgress: 进度回调，可以为空。
+            Parsed: 接收解析结果的模型。
+        【返回值】
+            结果是否完整，即任务是否未被取消。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static bool ParseFile(
+            TaskState& Task,
+            const Storage::ImporterBase<3>& Importer,
+            const function<void(const TaskProgress&)>& OnProgress,
+            Model<3>& Parsed
+        );
+        /**********************************************************************
+        【函数名称】 RunSave
+        【函数功能】 在后台线程中执行保存任务。
+        【参数】
+            pTask: 任务状态。
+            pExporter: 导出器。
+            OnProgress: 进度回调，可以为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void RunSave(
+            shared_ptr<TaskState> pTask,
+            shared_ptr<Storage::ExporterBase<3>> pExporter,
+            function<void(const TaskProgress&)> OnProgress
+        );
 };
 
 }
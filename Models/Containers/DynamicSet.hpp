@@ -29,8 +29,10 @@ namespace Containers {
         接受初始化列表的构造函数。
         接受向量的构造函数。
         拷贝构造函数。
+        FromDistinct: 从已知互不相同的元素创建集合，不检查唯一性。
     操作：
         Clear: 清空所有元素。
+        TransformInplace: 就地修改全部或部分元素，不检查唯一性。
         Intersection: 求集合的交集。
         Union: 求集合的并集。
         Difference: 求集合的补集。
@@ -87,6 +89,18 @@ class DynamicSet: public DistinctCollection<T> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         DynamicSet(const DynamicSet<T>& Other) = default;
+        /**********************************************************************
+        【函数名称】 FromDistinct
+        【函数功能】 使用已知互不相同的元素创建 DynamicSet 类型实例。
+            构造函数逐对比较元素，代价为元素个数的平方；
+            此函数跳过该检查，调用者需保证元素互不相同。
+        【参数】
+            Elements: 元素组成的向量，所有权移交给集合。
+        【返回值】
+            包含这些元素的集合。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static DynamicSet<T> FromDistinct(vector<T>&& Elements);
 
         // 属性
         /**********************************************************************
@@ -110,6 +124,33 @@ class DynamicSet: public DistinctCollection<T> {
         **********************************************************************/
         void Clear();
         /**********************************************************************
+        【函数名称】 TransformInplace
+        【函数功能】 对每个元素调用函数，就地修改元素。
+            为了避免逐个 Set 带来的开销，此操作不检查元素的唯一性，
+            调用者需保证修改后元素仍然互不相同（例如可逆的变换）。
+        【参数】 
+            Function: 形如 void(T& Element) 的函数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename F>
+        void TransformInplace(F Function);
+        /**********************************************************************
+        【函数名称】 TransformInplace
+        【函数功能】 对 [Begin, End) 区间内的元素调用函数，就地修改元素。
+            不同线程可以同时修改互不重叠的区间。
+            此操作不检查元素的唯一性，调用者需保证修改后元素仍然互不相同。
+        【参数】 
+            Function: 形如 void(T& Element) 的函数。
+            Begin: 区间起始下标。
+            End: 区间结束下标（不含）。
+        【返回值】 无
+            如果区间越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename F>
+        void TransformInplace(F Function, size_t Begin, size_t End);
+        /**********************************************************************
         【函数名称】 Intersection
         【函数功能】 返回此集合与另一集合的交集。
         【参数】 
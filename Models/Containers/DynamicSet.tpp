@@ -5,10 +5,12 @@
 *************************************************************************/
 
 #include <cstddef>
+#include <utility>
 #include <vector>
 #include "DistinctCollection.hpp"
 #include "DynamicSet.hpp"
 #include "../Errors/CollectionException.hpp"
+#include "../Errors/IndexOverflowException.hpp"
 using namespace std;
 using namespace C3w::Errors;
 
@@ -54,6 +56,24 @@ DynamicSet<T>::DynamicSet(const vector<T>& Elements) {
     m_Elements = Elements;
 }
 
+/**********************************************************************
+【函数名称】 FromDistinct
+【函数功能】 使用已知互不相同的元素创建 DynamicSet 类型实例。
+    构造函数逐对比较元素，代价为元素个数的平方；
+    此函数跳过该检查，调用者需保证元素互不相同。
+【参数】
+    Elements: 元素组成的向量，所有权移交给集合。
+【返回值】
+    包含这些元素的集合。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+DynamicSet<T> DynamicSet<T>::FromDistinct(vector<T>&& Elements) {
+    DynamicSet<T> Result;
+    Result.m_Elements = move(Elements);
+    return Result;
+}
+
 /**********************************************************************
 【函数名称】 Count
 【函数功能】 获取元素个数。
@@ -79,6 +99,48 @@ void DynamicSet<T>::Clear() {
     m_Elements.clear();
 }
 
+/**********************************************************************
+【函数名称】 TransformInplace
+【函数功能】 对每个元素调用函数，就地修改元素。
+    为了避免逐个 Set 带来的开销，此操作不检查元素的唯一性，
+    调用者需保证修改后元素仍然互不相同（例如可逆的变换）。
+【参数】 
+    Function: 形如 void(T& Element) 的函数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+template <typename F>
+void DynamicSet<T>::TransformInplace(F Function) {
+    for (auto& Element: m_Elements) {
+        Function(Element);
+    }
+}
+
+/**********************************************************************
+【函数名称】 TransformInplace
+【函数功能】 对 [Begin, End) 区间内的元素调用函数，就地修改元素。
+    不同线程可以同时修改互不重叠的区间。
+    此操作不检查元素的唯一性，调用者需保证修改后元素仍然互不相同。
+【参数】 
+    Function: 形如 void(T& Element) 的函数。
+    Begin: 区间起始下标。
+    End: 区间结束下标（不含）。
+【返回值】 无
+    如果区间越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+template <typename F>
+void DynamicSet<T>::TransformInplace(F Function, size_t Begin, size_t End) {
+    if (End > m_Elements.size()) {
+        throw IndexOverflowException(End, m_Elements.size());
+    }
+    for (size_t i = Begin; i < End; i++) {
+        Function(m_Elements[i]);
+    }
+}
+
 /**********************************************************************
 【函数名称】 Intersection
 【函数功能】 返回此集合与另一集合的交集。
@@ -37,6 +37,7 @@ namespace Containers {
         拷贝构造函数。
     操作：
         ToDynamic: 将自身转化为 DynamicSet。
+        TransformInplace: 就地修改所有元素，不检查唯一性。
     操作符：
         operator=: 默认赋值运算符。
         operator DynamicSet<T>: 同 ToDynamic。
@@ -104,6 +105,18 @@ class FixedSet: public DistinctCollection<T> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         DynamicSet<T> ToDynamic() const;
+        /**********************************************************************
+        【函数名称】 TransformInplace
+        【函数功能】 对每个元素调用函数，就地修改元素。
+            为了避免逐个 Set 带来的开销，此操作不检查元素的唯一性，
+            调用者需保证修改后元素仍然互不相同（例如可逆的变换）。
+        【参数】 
+            Function: 形如 void(T& Element) 的函数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename F>
+        void TransformInplace(F Function);
 
         // 操作符
 
@@ -88,6 +88,24 @@ DynamicSet<T> FixedSet<T, N>::ToDynamic() const {
     return DynamicSet<T>(vector<T>(begin(), end()));
 }
 
+/**********************************************************************
+【函数名称】 TransformInplace
+【函数功能】 对每个元素调用函数，就地修改元素。
+    为了避免逐个 Set 带来的开销，此操作不检查元素的唯一性，
+    调用者需保证修改后元素仍然互不相同（例如可逆的变换）。
+【参数】 
+    Function: 形如 void(T& Element) 的函数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T, size_t N>
+template <typename F>
+void FixedSet<T, N>::TransformInplace(F Function) {
+    for (auto& Element: m_Elements) {
+        Function(Element);
+    }
+}
+
 /**********************************************************************
 【函数名称】 operator DynamicSet<T>
 【函数功能】 将自身转化为 DynamicSet。
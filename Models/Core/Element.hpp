@@ -11,6 +11,7 @@
 #include <initializer_list>
 #include <string>
 #include "Point.hpp"
+#include "Transform.hpp"
 #include "Vector.hpp"
 #include "../Containers/FixedSet.hpp"
 #include "../Tools/Representable.hpp"
@@ -21,7 +22,8 @@ namespace C3w {
 
 /*************************************************************************
 【类名】 Element
-【功能】 定义一个维数 N，点数 S 的元素作为 Line 与 Face 的基类。
+【功能】 定义一个维数 N，点数 S，点的分量类型为 T 的元素作为 Line 与 Face 的基类。
+    T 默认为 double，长度与面积总是以 double 计算。
 【接口说明】 
     继承于 C3w::Tools::Representable:
         实现 ToString。
@@ -46,13 +48,14 @@ namespace C3w {
         Promote: 填充至更高维度。
         Move(Inplace): 平移元素。
         Scale(Inplace): 缩放元素。
+        ApplyInplace: 对元素作用一个变换。
     运算符：
         operator[]: 调用 Points.operator[]。
         operator==/!=: 同 IsEqual。
         operator=: 默认赋值运算符。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
-template <size_t N, size_t S>
+template <size_t N, size_t S, typename T = double>
 class Element: public Tools::Representable {
     public:
         // 成员
@@ -62,7 +65,7 @@ class Element: public Tools::Representable {
         // 点数量，与模板中 S 相等。
         static constexpr size_t POINT_COUNT { S };
         // 点集合。
-        FixedSet<Point<N>, S> Points;
+        FixedSet<Point<N, T>, S> Points;
 
         // 构造函数
 
@@ -76,7 +79,7 @@ class Element: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Element(initializer_list<Point<N>> Points);
+        Element(initializer_list<Point<N, T>> Points);
         /**********************************************************************
         【函数名称】 构造函数
         【函数功能】 使用 FixedSet 初始化 Element 对象。
@@ -85,7 +88,7 @@ class Element: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        explicit Element(const FixedSet<Point<N>, S>& Points);
+        explicit Element(const FixedSet<Point<N, T>, S>& Points);
         /**********************************************************************
         【函数名称】 拷贝构造函数
         【函数功能】 使用另一 Element 初始化 Element 对象。
@@ -94,7 +97,7 @@ class Element: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Element(const Element<N, S>& Other) = default;
+        Element(const Element<N, S, T>& Other) = default;
 
         // 属性
 
@@ -128,7 +131,7 @@ class Element: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void SetPoint(size_t Index, const Point<N>& Value);
+        void SetPoint(size_t Index, const Point<N, T>& Value);
         /**********************************************************************
         【函数名称】 TrySetPoint
         【函数功能】 尝试设置指定下标位置的点坐标。
@@ -139,7 +142,7 @@ class Element: public Tools::Representable {
             操作是否成功。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool TrySetPoint(size_t Index, const Point<N>& Value);
+        bool TrySetPoint(size_t Index, const Point<N, T>& Value);
         /**********************************************************************
         【函数名称】 IsEqual
         【函数功能】 判断自身和另一元素是否相等。
@@ -149,7 +152,7 @@ class Element: public Tools::Representable {
             两元素是否相等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool IsEqual(const Element<N, S>& Other) const;
+        bool IsEqual(const Element<N, S, T>& Other) const;
         /**********************************************************************
         【函数名称】 IsEqual
         【函数功能】 判断两元素是否相等。
@@ -161,8 +164,8 @@ class Element: public Tools::Representable {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         static bool IsEqual(
-            const Element<N, S>& Left, 
-            const Element<N, S>& Right
+            const Element<N, S, T>& Left, 
+            const Element<N, S, T>& Right
         );
         /**********************************************************************
         【函数名称】 Project
@@ -172,7 +175,7 @@ class Element: public Tools::Representable {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         template <size_t M>
-        Element<M, S> Project() const;
+        Element<M, S, T> Project() const;
         /**********************************************************************
         【函数名称】 Promote
         【函数功能】 将自身升至 M 维。
@@ -182,7 +185,7 @@ class Element: public Tools::Representable {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         template <size_t M>
-        Element<M, S> Promote(double Padder = 0) const;
+        Element<M, S, T> Promote(T Padder = 0) const;
         /**********************************************************************
         【函数名称】 Move
         【函数功能】 将自身向指定方向移动指定长度并存储为新的元素。
@@ -192,7 +195,7 @@ class Element: public Tools::Representable {
             移动后的元素。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Element<N, S> Move(const Vector<double, N>& Delta) const;
+        Element<N, S, T> Move(const Vector<T, N>& Delta) const;
         /**********************************************************************
         【函数名称】 Move
         【函数功能】 将元素向指定方向移动指定长度。
@@ -203,9 +206,9 @@ class Element: public Tools::Representable {
             移动后的元素。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Element<N, S> Move(
-            const Element<N, S>& AElement,
-            const Vector<double, N>& Delta
+        static Element<N, S, T> Move(
+            const Element<N, S, T>& AElement,
+            const Vector<T, N>& Delta
         );
         /**********************************************************************
         【函数名称】 MoveInplace
@@ -215,7 +218,7 @@ class Element: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void MoveInplace(const Vector<double, N>& Delta) const;
+        void MoveInplace(const Vector<T, N>& Delta);
         /**********************************************************************
         【函数名称】 Scale
         【函数功能】 将自身以定点为中心缩放并存储为新的元素。
@@ -226,7 +229,7 @@ class Element: public Tools::Representable {
             缩放后的元素。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Element<N, S> Scale(const Point<N>& Ref, double Ratio) const;
+        Element<N, S, T> Scale(const Point<N, T>& Ref, double Ratio) const;
         /**********************************************************************
         【函数名称】 Scale
         【函数功能】 将元素以定点为中心缩放并存储为新的元素。
@@ -238,9 +241,9 @@ class Element: public Tools::Representable {
             缩放后的元素。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Element<N, S> Scale(
-            const Element<N, S>& AElement,
-            const Point<N>& Ref,
+        static Element<N, S, T> Scale(
+            const Element<N, S, T>& AElement,
+            const Point<N, T>& Ref,
             double Ratio
         );
         /**********************************************************************
@@ -250,9 +253,21 @@ class Element: public Tools::Representable {
             Ref: 参考点。
             Ratio: 缩放的比例。
         【返回值】 无
+            如果比例为 0，抛出 SingularTransformException。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void ScaleInplace(const Point<N>& Ref, double Ratio);
+        void ScaleInplace(const Point<N, T>& Ref, double Ratio);
+        /**********************************************************************
+        【函数名称】 ApplyInplace
+        【函数功能】 对自身的每个点作用变换，直接修改这些点。
+        【参数】 
+            ATransform: 要作用的变换。
+        【返回值】 无
+            如果变换不是仿射变换，抛出 NonAffineTransformException。
+            如果变换不可逆，抛出 SingularTransformException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void ApplyInplace(const Transform<N>& ATransform);
 
         // 操作符
 
@@ -265,7 +280,7 @@ class Element: public Tools::Representable {
             在指定下标的点。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        const Point<N>& operator[](size_t Index) const;
+        const Point<N, T>& operator[](size_t Index) const;
         /**********************************************************************
         【函数名称】 operator==
         【函数功能】 判断自身和另一元素是否相等。
@@ -275,7 +290,7 @@ class Element: public Tools::Representable {
             两元素是否相等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool operator==(const Element<N, S>& Other) const;
+        bool operator==(const Element<N, S, T>& Other) const;
         /**********************************************************************
         【函数名称】 operator!=
         【函数功能】 判断自身和另一元素是否相等。
@@ -285,7 +300,7 @@ class Element: public Tools::Representable {
             两元素是否相等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool operator!=(const Element<N, S>& Other) const;
+        bool operator!=(const Element<N, S, T>& Other) const;
         /**********************************************************************
         【函数名称】 operator=
         【函数功能】 将另一元素赋值给自身。
@@ -295,7 +310,7 @@ class Element: public Tools::Representable {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Element<N, S>& operator=(const Element<N, S>& Other) = default;
+        Element<N, S, T>& operator=(const Element<N, S, T>& Other) = default;
 
         // 格式化
 
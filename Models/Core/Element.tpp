@@ -10,11 +10,15 @@
 #include <string>
 #include "Element.hpp"
 #include "Point.hpp"
+#include "Transform.hpp"
 #include "Vector.hpp"
 #include "../Containers/FixedSet.hpp"
 #include "../Errors/NotImplementedException.hpp"
+#include "../Errors/NonAffineTransformException.hpp"
+#include "../Errors/SingularTransformException.hpp"
 using namespace std;
 using namespace C3w::Containers;
+using namespace C3w::Errors;
 
 namespace C3w {
 
@@ -26,8 +30,10 @@ namespace C3w {
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-Element<N, S>::Element(initializer_list<Point<N>> Points): Points(Points) {}
+template <size_t N, size_t S, typename T>
+Element<N, S, T>::Element(
+    initializer_list<Point<N, T>> Points
+): Points(Points) {}
 
 /**********************************************************************
 【函数名称】 构造函数
@@ -37,8 +43,10 @@ Element<N, S>::Element(initializer_list<Point<N>> Points): Points(Points) {}
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-Element<N, S>::Element(const FixedSet<Point<N>, S>& Points): Points(Points) {}
+template <size_t N, size_t S, typename T>
+Element<N, S, T>::Element(
+    const FixedSet<Point<N, T>, S>& Points
+): Points(Points) {}
 
 /**********************************************************************
 【函数名称】 GetLength
@@ -48,8 +56,8 @@ Element<N, S>::Element(const FixedSet<Point<N>, S>& Points): Points(Points) {}
     此元素的长度。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-double Element<N, S>::GetLength() const {
+template <size_t N, size_t S, typename T>
+double Element<N, S, T>::GetLength() const {
     throw NotImplementedException("GetLength");
 }
 
@@ -61,8 +69,8 @@ double Element<N, S>::GetLength() const {
     此元素的面积。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-double Element<N, S>::GetArea() const {
+template <size_t N, size_t S, typename T>
+double Element<N, S, T>::GetArea() const {
     throw NotImplementedException("GetArea");
 }
 
@@ -75,8 +83,8 @@ double Element<N, S>::GetArea() const {
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-void Element<N, S>::SetPoint(size_t Index, const Point<N>& Value) {
+template <size_t N, size_t S, typename T>
+void Element<N, S, T>::SetPoint(size_t Index, const Point<N, T>& Value) {
     Points.Set(Index, Value);
 }
 
@@ -90,8 +98,8 @@ void Element<N, S>::SetPoint(size_t Index, const Point<N>& Value) {
     操作是否成功。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-bool Element<N, S>::TrySetPoint(size_t Index, const Point<N>& Value) {
+template <size_t N, size_t S, typename T>
+bool Element<N, S, T>::TrySetPoint(size_t Index, const Point<N, T>& Value) {
     return Points.TrySet(Index, Value);
 }
 
@@ -104,8 +112,8 @@ bool Element<N, S>::TrySetPoint(size_t Index, const Point<N>& Value) {
     两元素是否相等。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-bool Element<N, S>::IsEqual(const Element<N, S>& Other) const {
+template <size_t N, size_t S, typename T>
+bool Element<N, S, T>::IsEqual(const Element<N, S, T>& Other) const {
     return IsEqual(*this, Other);
 }
 
@@ -119,10 +127,10 @@ bool Element<N, S>::IsEqual(const Element<N, S>& Other) const {
     两元素是否相等。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-bool Element<N, S>::IsEqual(
-    const Element<N, S>& Left, 
-    const Element<N, S>& Right
+template <size_t N, size_t S, typename T>
+bool Element<N, S, T>::IsEqual(
+    const Element<N, S, T>& Left, 
+    const Element<N, S, T>& Right
 ) {
     return Left.Points == Right.Points;
 }
@@ -134,14 +142,14 @@ bool Element<N, S>::IsEqual(
 【返回值】 一个 M 维的元素。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
+template <size_t N, size_t S, typename T>
 template <size_t M>
-Element<M, S> Element<N, S>::Project() const {
-    array<Point<N>, S> Points;
+Element<M, S, T> Element<N, S, T>::Project() const {
+    array<Point<N, T>, S> Points;
     for (size_t i = 0; i < S; i++) {
         Points[i] = Points[i].template Project<M>();
     }
-    return Element<M, S>(FixedSet<Point<M>, S>(Points));
+    return Element<M, S, T>(FixedSet<Point<M, T>, S>(Points));
 }
 
 /**********************************************************************
@@ -151,14 +159,14 @@ Element<M, S> Element<N, S>::Project() const {
 【返回值】 一个 M 维的元素。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
+template <size_t N, size_t S, typename T>
 template <size_t M>
-Element<M, S> Element<N, S>::Promote(double Padder) const {
-    array<Point<N>, S> Points;
+Element<M, S, T> Element<N, S, T>::Promote(T Padder) const {
+    array<Point<N, T>, S> Points;
     for (size_t i = 0; i < S; i++) {
         Points[i] = Points[i].template Promote<M>(Padder);
     }
-    return Element<M, S>(FixedSet<Point<M>, S>(Points));
+    return Element<M, S, T>(FixedSet<Point<M, T>, S>(Points));
 }
 
 /**********************************************************************
@@ -170,8 +178,8 @@ Element<M, S> Element<N, S>::Promote(double Padder) const {
     移动后的元素。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-Element<N, S> Element<N, S>::Move(const Vector<double, N>& Delta) const {
+template <size_t N, size_t S, typename T>
+Element<N, S, T> Element<N, S, T>::Move(const Vector<T, N>& Delta) const {
     return Move(*this, Delta);
 }
 
@@ -185,16 +193,16 @@ Element<N, S> Element<N, S>::Move(const Vector<double, N>& Delta) const {
     移动后的元素。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-Element<N, S> Element<N, S>::Move(
-    const Element<N, S>& AElement,
-    const Vector<double, N>& Delta
+template <size_t N, size_t S, typename T>
+Element<N, S, T> Element<N, S, T>::Move(
+    const Element<N, S, T>& AElement,
+    const Vector<T, N>& Delta
 ) {
-    array<Point<N>, S> Points;
+    array<Point<N, T>, S> Points;
     for (size_t i = 0; i < S; i++) {
         Points[i] = AElement.Points[i] + Delta;
     }
-    return Element<N, S>(FixedSet<Point<N>, S>(Points));
+    return Element<N, S, T>(FixedSet<Point<N, T>, S>(Points));
 }
 
 /**********************************************************************
@@ -205,11 +213,12 @@ Element<N, S> Element<N, S>::Move(
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-void Element<N, S>::MoveInplace(const Vector<double, N>& Delta) const {
-    // 不能对 FixedSet 的元素使用 +=
-    // 因为 FixedSet::operator[] 只能返回常引用
-    *this = Move(*this, Delta);
+template <size_t N, size_t S, typename T>
+void Element<N, S, T>::MoveInplace(const Vector<T, N>& Delta) {
+    // 平移不会使不同的点重合，可以跳过唯一性检查
+    Points.TransformInplace([&Delta](Point<N, T>& APoint) {
+        APoint += Delta;
+    });
 }
 
 /**********************************************************************
@@ -222,8 +231,11 @@ void Element<N, S>::MoveInplace(const Vector<double, N>& Delta) const {
     缩放后的元素。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-Element<N, S> Element<N, S>::Scale(const Point<N>& Ref, double Ratio) const {
+template <size_t N, size_t S, typename T>
+Element<N, S, T> Element<N, S, T>::Scale(
+    const Point<N, T>& Ref,
+    double Ratio
+) const {
     return Scale(*this, Ref, Ratio);
 }
 
@@ -238,17 +250,17 @@ Element<N, S> Element<N, S>::Scale(const Point<N>& Ref, double Ratio) const {
     缩放后的元素。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-Element<N, S> Element<N, S>::Scale(
-    const Element<N, S>& AElement,
-    const Point<N>& Ref,
+template <size_t N, size_t S, typename T>
+Element<N, S, T> Element<N, S, T>::Scale(
+    const Element<N, S, T>& AElement,
+    const Point<N, T>& Ref,
     double Ratio
 ) {
-    array<Point<N>, S> Points;
+    array<Point<N, T>, S> Points;
     for (size_t i = 0; i < S; i++) {
         Points[i] = Ref + (AElement.Points[i] - Ref) * Ratio;
     }
-    return Element<N, S>(FixedSet<Point<N>, S>(Points));
+    return Element<N, S, T>(FixedSet<Point<N, T>, S>(Points));
 }
 
 /**********************************************************************
@@ -258,13 +270,41 @@ Element<N, S> Element<N, S>::Scale(
     Ref: 参考点。
     Ratio: 缩放的比例。
 【返回值】 无
+    如果比例为 0，抛出 SingularTransformException。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-void Element<N, S>::ScaleInplace(const Point<N>& Ref, double Ratio) {
-    // 不能对 FixedSet 的元素使用 +=
-    // 因为 FixedSet::operator[] 只能返回常引用
-    *this = Scale(*this, Ref, Ratio);
+template <size_t N, size_t S, typename T>
+void Element<N, S, T>::ScaleInplace(const Point<N, T>& Ref, double Ratio) {
+    // 比例为 0 时所有点都会与参考点重合
+    if (Ratio == 0) {
+        throw SingularTransformException(0);
+    }
+    Points.TransformInplace([&Ref, Ratio](Point<N, T>& APoint) {
+        APoint = Ref + (APoint - Ref) * Ratio;
+    });
+}
+
+/**********************************************************************
+【函数名称】 ApplyInplace
+【函数功能】 对自身的每个点作用变换，直接修改这些点。
+【参数】 
+    ATransform: 要作用的变换。
+【返回值】 无
+    如果变换不是仿射变换，抛出 NonAffineTransformException。
+    如果变换不可逆，抛出 SingularTransformException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t S, typename T>
+void Element<N, S, T>::ApplyInplace(const Transform<N>& ATransform) {
+    if (!ATransform.IsAffine()) {
+        throw NonAffineTransformException();
+    }
+    if (!ATransform.IsInvertible()) {
+        throw SingularTransformException(ATransform.Determinant());
+    }
+    Points.TransformInplace([&ATransform](Point<N, T>& APoint) {
+        ATransform.ApplyAffineInplace(APoint);
+    });
 }
 
 /**********************************************************************
@@ -276,8 +316,8 @@ void Element<N, S>::ScaleInplace(const Point<N>& Ref, double Ratio) {
     在指定下标的点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-const Point<N>& Element<N, S>::operator[](size_t Index) const {
+template <size_t N, size_t S, typename T>
+const Point<N, T>& Element<N, S, T>::operator[](size_t Index) const {
     return Points[Index];
 }
 
@@ -290,8 +330,8 @@ const Point<N>& Element<N, S>::operator[](size_t Index) const {
     两元素是否相等。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-bool Element<N, S>::operator==(const Element<N, S>& Other) const {
+template <size_t N, size_t S, typename T>
+bool Element<N, S, T>::operator==(const Element<N, S, T>& Other) const {
     return IsEqual(Other);
 }
 
@@ -304,8 +344,8 @@ bool Element<N, S>::operator==(const Element<N, S>& Other) const {
     两元素是否相等。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-bool Element<N, S>::operator!=(const Element<N, S>& Other) const {
+template <size_t N, size_t S, typename T>
+bool Element<N, S, T>::operator!=(const Element<N, S, T>& Other) const {
     return !IsEqual(Other);
 }
 
@@ -317,8 +357,8 @@ bool Element<N, S>::operator!=(const Element<N, S>& Other) const {
     此对象的字符串表达形式。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, size_t S>
-string Element<N, S>::ToString() const {
+template <size_t N, size_t S, typename T>
+string Element<N, S, T>::ToString() const {
     return Points.ToString();
 }
 
@@ -0,0 +1,608 @@
+/*************************************************************************
+【文件名】 Expression.hpp
+【功能模块和目的】 Expression 类及其运算符实现向量与点运算的表达式模板。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef EXPRESSION_HPP
+#define EXPRESSION_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include "../Tools/Constexpr.hpp"
+using namespace std;
+
+namespace C3w {
+
+template <typename T, size_t N>
+class Vector;
+
+template <size_t N, typename T>
+class Point;
+
+template <typename Result, typename Operation, typename Left, typename Right>
+class Expression;
+
+/*************************************************************************
+【类名】 VectorTraits
+【功能】 类型特征，描述可以参与表达式运算的类型。
+    Vector、Point 与 Expression 的 IS_VECTOR 为 true，
+    并给出分量类型 ValueType、维数 DIMENSION 与求值结果的类型 Result；
+    其他类型的 IS_VECTOR 为 false，不含其他成员。
+【接口说明】 类型特征，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <typename X>
+struct VectorTraits {
+    // 是否可以参与表达式运算
+    static constexpr bool IS_VECTOR { false };
+};
+
+/*************************************************************************
+【类名】 VectorTraits<Vector<T, N>>
+【功能】 向量的类型特征，求值结果为向量。
+【接口说明】 类型特征，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <typename T, size_t N>
+struct VectorTraits<Vector<T, N>> {
+    // 是否可以参与表达式运算
+    static constexpr bool IS_VECTOR { true };
+    // 维数
+    static constexpr size_t DIMENSION { N };
+    // 分量类型
+    using ValueType = T;
+    // 求值结果的类型
+    using Result = Vector<T, N>;
+};
+
+/*************************************************************************
+【类名】 VectorTraits<Point<N, T>>
+【功能】 点的类型特征，求值结果为点。
+【接口说明】 类型特征，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N, typename T>
+struct VectorTraits<Point<N, T>> {
+    // 是否可以参与表达式运算
+    static constexpr bool IS_VECTOR { true };
+    // 维数
+    static constexpr size_t DIMENSION { N };
+    // 分量类型
+    using ValueType = T;
+    // 求值结果的类型
+    using Result = Point<N, T>;
+};
+
+/*************************************************************************
+【类名】 VectorTraits<Expression<Result, Operation, Left, Right>>
+【功能】 表达式的类型特征，与其求值结果的类型特征相同。
+【接口说明】 类型特征，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <typename R, typename Operation, typename Left, typename Right>
+struct VectorTraits<Expression<R, Operation, Left, Right>> {
+    // 是否可以参与表达式运算
+    static constexpr bool IS_VECTOR { true };
+    // 维数
+    static constexpr size_t DIMENSION { VectorTraits<R>::DIMENSION };
+    // 分量类型
+    using ValueType = typename VectorTraits<R>::ValueType;
+    // 求值结果的类型
+    using Result = R;
+};
+
+/*************************************************************************
+【类名】 Scalar
+【功能】 将标量包装为所有分量都相同的操作数，用于数乘表达式。
+【接口说明】
+    构造与析构：
+        接受一个 T 的构造函数。
+        拷贝构造函数。
+    访问器：
+        GetComponentUnchecked: 返回标量自身。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <typename T>
+class Scalar final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用标量初始化 Scalar 对象。
+        【参数】
+            Value: 标量的值。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR explicit Scalar(T Value);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 Scalar 初始化 Scalar 对象。
+        【参数】
+            Other: 另一个标量。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Scalar(const Scalar<T>& Other) = default;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 GetComponentUnchecked
+        【函数功能】 返回任意下标处的分量，即标量自身。
+        【参数】
+            Index: 分量的下标，不使用。
+        【返回值】
+            标量的值。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR T GetComponentUnchecked(size_t Index) const;
+
+    private:
+        // 标量的值
+        T m_Value;
+};
+
+/*************************************************************************
+【类名】 OperandStorage
+【功能】 类型特征，决定表达式如何保存操作数。
+    向量与点按常引用保存，避免复制；
+    表达式与标量只含引用或一个数，按值保存，
+    以免引用在其所在的完整表达式结束前失效。
+【接口说明】 类型特征，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <typename X>
+struct OperandStorage {
+    // 保存操作数的类型
+    using Type = const X&;
+};
+
+/*************************************************************************
+【类名】 OperandStorage<Expression<Result, Operation, Left, Right>>
+【功能】 表达式按值保存。
+【接口说明】 类型特征，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <typename Result, typename Operation, typename Left, typename Right>
+struct OperandStorage<Expression<Result, Operation, Left, Right>> {
+    // 保存操作数的类型
+    using Type = Expression<Result, Operation, Left, Right>;
+};
+
+/*************************************************************************
+【类名】 OperandStorage<Scalar<T>>
+【功能】 标量按值保存。
+【接口说明】 类型特征，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <typename T>
+struct OperandStorage<Scalar<T>> {
+    // 保存操作数的类型
+    using Type = Scalar<T>;
+};
+
+/*************************************************************************
+【类名】 DifferenceResult
+【功能】 类型特征，求差的结果类型。
+    两点之差为向量，其余情况与左操作数的结果类型相同。
+【接口说明】 类型特征，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <typename Left, typename Right>
+struct DifferenceResult {
+    // 结果类型
+    using Type = Left;
+};
+
+/*************************************************************************
+【类名】 DifferenceResult<Point<N, T>, Point<N, T>>
+【功能】 两点之差为分量类型相同的向量。
+【接口说明】 类型特征，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N, typename T>
+struct DifferenceResult<Point<N, T>, Point<N, T>> {
+    // 结果类型
+    using Type = Vector<T, N>;
+};
+
+/*************************************************************************
+【类名】 ExpressionOperation
+【功能】 静态类，包含表达式对单个分量进行的运算。
+【接口说明】
+    构造函数：
+        私有默认构造函数。
+    内嵌类型：
+        Plus: 加法。
+        Minus: 减法。
+        Times: 乘法。
+        Negation: 取相反数，忽略右操作数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class ExpressionOperation final {
+    public:
+        // 内嵌类型
+
+        /**********************************************************************
+        【类名】 Plus
+        【功能】 分量的加法。
+        【接口说明】
+            操作：
+                Apply: 求两个分量的和。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct Plus {
+            /******************************************************************
+            【函数名称】 Apply
+            【函数功能】 求两个分量的和。
+            【参数】
+                Left, Right: 两个分量。
+            【返回值】
+                两个分量的和。
+            【开发者及日期】 赵一彤 2024/7/24
+            ******************************************************************/
+            template <typename T>
+            static C3W_CONSTEXPR T Apply(const T& Left, const T& Right);
+        };
+        /**********************************************************************
+        【类名】 Minus
+        【功能】 分量的减法。
+        【接口说明】
+            操作：
+                Apply: 求两个分量的差。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct Minus {
+            /******************************************************************
+            【函数名称】 Apply
+            【函数功能】 求两个分量的差。
+            【参数】
+                Left, Right: 两个分量。
+            【返回值】
+                两个分量的差。
+            【开发者及日期】 赵一彤 2024/7/24
+            ******************************************************************/
+            template <typename T>
+            static C3W_CONSTEXPR T Apply(const T& Left, const T& Right);
+        };
+        /**********************************************************************
+        【类名】 Times
+        【功能】 分量的乘法。
+        【接口说明】
+            操作：
+                Apply: 求两个分量的积。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct Times {
+            /******************************************************************
+            【函数名称】 Apply
+            【函数功能】 求两个分量的积。
+            【参数】
+                Left, Right: 两个分量。
+            【返回值】
+                两个分量的积。
+            【开发者及日期】 赵一彤 2024/7/24
+            ******************************************************************/
+            template <typename T>
+            static C3W_CONSTEXPR T Apply(const T& Left, const T& Right);
+        };
+        /**********************************************************************
+        【类名】 Negation
+        【功能】 分量的相反数。
+        【接口说明】
+            操作：
+                Apply: 求左分量的相反数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct Negation {
+            /******************************************************************
+            【函数名称】 Apply
+            【函数功能】 求左分量的相反数。
+            【参数】
+                Left: 分量。
+                Right: 不使用。
+            【返回值】
+                左分量的相反数。
+            【开发者及日期】 赵一彤 2024/7/24
+            ******************************************************************/
+            template <typename T>
+            static C3W_CONSTEXPR T Apply(const T& Left, const T& Right);
+        };
+
+    private:
+        // 静态类，隐藏构造函数。
+        ExpressionOperation();
+};
+
+/*************************************************************************
+【类名】 Expression
+【功能】 延迟求值的向量/点运算表达式。
+    Vector 与 Point 的 +、-、数乘运算符不再立即计算，
+    而是返回记录操作数的表达式，嵌套的表达式在转换为结果类型时
+    以一次展开的循环逐分量求值，不产生中间的向量或点。
+    表达式按常引用保存向量与点，因此只应在其所在的完整表达式内使用，
+    不应使用 auto 保存。
+【接口说明】
+    构造与析构：
+        接受两个操作数的构造函数。
+        拷贝构造函数。
+    访问器：
+        GetComponentUnchecked: 不检查下标，求指定下标处的分量。
+    操作：
+        Evaluate: 求值为结果类型。
+    操作符：
+        operator Result: 隐式转换为结果类型，同 Evaluate。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <typename Result, typename Operation, typename Left, typename Right>
+class Expression final {
+    public:
+        // 内嵌类型
+
+        // 分量类型
+        using ValueType = typename VectorTraits<Result>::ValueType;
+
+        // 成员
+
+        // 维数
+        static constexpr size_t DIMENSION { VectorTraits<Result>::DIMENSION };
+
+        static_assert(
+            VectorTraits<Left>::DIMENSION == DIMENSION,
+            "Operands must have the same dimension."
+        );
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用两个操作数初始化 Expression 对象。
+        【参数】
+            LeftOperand: 左操作数。
+            RightOperand: 右操作数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR Expression(
+            const Left& LeftOperand,
+            const Right& RightOperand
+        );
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 Expression 初始化 Expression 对象。
+        【参数】
+            Other: 另一个表达式。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Expression(const Expression& Other) = default;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 GetComponentUnchecked
+        【函数功能】 求指定下标处的分量，不检查下标。
+        【参数】
+            Index: 分量的下标，必须小于 DIMENSION。
+        【返回值】
+            表达式在该下标处的分量。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR ValueType GetComponentUnchecked(size_t Index) const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Evaluate
+        【函数功能】 逐分量求值。
+        【参数】 无
+        【返回值】
+            表达式的值。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR Result Evaluate() const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator Result
+        【函数功能】 隐式转换为结果类型。
+        【参数】 无
+        【返回值】
+            表达式的值。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR operator Result() const;
+
+    private:
+        // 左操作数
+        typename OperandStorage<Left>::Type m_Left;
+        // 右操作数
+        typename OperandStorage<Right>::Type m_Right;
+};
+
+// 表达式的运算符
+
+/**********************************************************************
+【函数名称】 operator-
+【函数功能】 求向量、点或表达式的相反数。
+【参数】
+    Operand: 操作数。
+【返回值】
+    延迟求值的表达式，结果类型与操作数相同。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename X>
+C3W_CONSTEXPR typename enable_if<
+    VectorTraits<X>::IS_VECTOR,
+    Expression<
+        typename VectorTraits<X>::Result,
+        ExpressionOperation::Negation,
+        X,
+        X
+    >
+>::type operator-(const X& Operand);
+/**********************************************************************
+【函数名称】 operator+
+【函数功能】 求两个向量、点或表达式的和。
+【参数】
+    Left: 左操作数。
+    Right: 右操作数。
+【返回值】
+    延迟求值的表达式，结果类型与左操作数相同。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L, typename R>
+C3W_CONSTEXPR typename enable_if<
+    VectorTraits<L>::IS_VECTOR && VectorTraits<R>::IS_VECTOR,
+    Expression<
+        typename VectorTraits<L>::Result,
+        ExpressionOperation::Plus,
+        L,
+        R
+    >
+>::type operator+(const L& Left, const R& Right);
+/**********************************************************************
+【函数名称】 operator-
+【函数功能】 求两个向量、点或表达式的差。
+【参数】
+    Left: 左操作数。
+    Right: 右操作数。
+【返回值】
+    延迟求值的表达式，两点之差为向量，其余与左操作数相同。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L, typename R>
+C3W_CONSTEXPR typename enable_if<
+    VectorTraits<L>::IS_VECTOR && VectorTraits<R>::IS_VECTOR,
+    Expression<
+        typename DifferenceResult<
+            typename VectorTraits<L>::Result,
+            typename VectorTraits<R>::Result
+        >::Type,
+        ExpressionOperation::Minus,
+        L,
+        R
+    >
+>::type operator-(const L& Left, const R& Right);
+/**********************************************************************
+【函数名称】 operator*
+【函数功能】 将向量或结果为向量的表达式与标量数乘。
+【参数】
+    Left: 向量或表达式。
+    Factor: 标量。
+【返回值】
+    延迟求值的表达式，结果类型为向量。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L>
+C3W_CONSTEXPR typename enable_if<
+    is_same<
+        typename VectorTraits<L>::Result,
+        Vector<
+            typename VectorTraits<L>::ValueType,
+            VectorTraits<L>::DIMENSION
+        >
+    >::value,
+    Expression<
+        typename VectorTraits<L>::Result,
+        ExpressionOperation::Times,
+        L,
+        Scalar<typename VectorTraits<L>::ValueType>
+    >
+>::type operator*(
+    const L& Left,
+    typename VectorTraits<L>::ValueType Factor
+);
+/**********************************************************************
+【函数名称】 operator*
+【函数功能】 将标量与向量或结果为向量的表达式数乘。
+【参数】
+    Factor: 标量。
+    Right: 向量或表达式。
+【返回值】
+    延迟求值的表达式，结果类型为向量。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename R>
+C3W_CONSTEXPR typename enable_if<
+    is_same<
+        typename VectorTraits<R>::Result,
+        Vector<
+            typename VectorTraits<R>::ValueType,
+            VectorTraits<R>::DIMENSION
+        >
+    >::value,
+    Expression<
+        typename VectorTraits<R>::Result,
+        ExpressionOperation::Times,
+        R,
+        Scalar<typename VectorTraits<R>::ValueType>
+    >
+>::type operator*(
+    typename VectorTraits<R>::ValueType Factor,
+    const R& Right
+);
+/**********************************************************************
+【函数名称】 operator*
+【函数功能】 求两个向量或结果为向量的表达式的内积，立即求值。
+【参数】
+    Left: 左操作数。
+    Right: 右操作数。
+【返回值】
+    两者的内积。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L, typename R>
+C3W_CONSTEXPR typename enable_if<
+    is_same<
+        typename VectorTraits<L>::Result,
+        Vector<
+            typename VectorTraits<L>::ValueType,
+            VectorTraits<L>::DIMENSION
+        >
+    >::value && is_same<
+        typename VectorTraits<R>::Result,
+        typename VectorTraits<L>::Result
+    >::value,
+    typename VectorTraits<L>::ValueType
+>::type operator*(const L& Left, const R& Right);
+/**********************************************************************
+【函数名称】 operator==
+【函数功能】 判断两个向量、点或表达式是否相等，表达式先求值。
+【参数】
+    Left: 左操作数。
+    Right: 右操作数。
+【返回值】
+    两者是否相等，同 Vector::IsEqual 的编码比较。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L, typename R>
+C3W_CONSTEXPR typename enable_if<
+    VectorTraits<L>::IS_VECTOR && VectorTraits<R>::IS_VECTOR,
+    bool
+>::type operator==(const L& Left, const R& Right);
+/**********************************************************************
+【函数名称】 operator!=
+【函数功能】 判断两个向量、点或表达式是否不等，表达式先求值。
+【参数】
+    Left: 左操作数。
+    Right: 右操作数。
+【返回值】
+    两者是否不等，同 Vector::IsEqual 的编码比较。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L, typename R>
+C3W_CONSTEXPR typename enable_if<
+    VectorTraits<L>::IS_VECTOR && VectorTraits<R>::IS_VECTOR,
+    bool
+>::type operator!=(const L& Left, const R& Right);
+
+}
+
+#include "Expression.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,394 @@
+/*************************************************************************
+【文件名】 Expression.tpp
+【功能模块和目的】 为 Expression.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <type_traits>
+#include "Expression.hpp"
+#include "../Tools/Unroll.hpp"
+using namespace std;
+
+namespace C3w {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用标量初始化 Scalar 对象。
+【参数】
+    Value: 标量的值。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+C3W_CONSTEXPR inline Scalar<T>::Scalar(T Value): m_Value(Value) {}
+
+/**********************************************************************
+【函数名称】 GetComponentUnchecked
+【函数功能】 返回任意下标处的分量，即标量自身。
+【参数】
+    Index: 分量的下标，不使用。
+【返回值】
+    标量的值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+C3W_CONSTEXPR inline T Scalar<T>::GetComponentUnchecked(size_t Index) const {
+    return m_Value;
+}
+
+/**********************************************************************
+【函数名称】 Apply
+【函数功能】 求两个分量的和。
+【参数】
+    Left, Right: 两个分量。
+【返回值】
+    两个分量的和。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+C3W_CONSTEXPR inline T ExpressionOperation::Plus::Apply(
+    const T& Left,
+    const T& Right
+) {
+    return Left + Right;
+}
+
+/**********************************************************************
+【函数名称】 Apply
+【函数功能】 求两个分量的差。
+【参数】
+    Left, Right: 两个分量。
+【返回值】
+    两个分量的差。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+C3W_CONSTEXPR inline T ExpressionOperation::Minus::Apply(
+    const T& Left,
+    const T& Right
+) {
+    return Left - Right;
+}
+
+/**********************************************************************
+【函数名称】 Apply
+【函数功能】 求两个分量的积。
+【参数】
+    Left, Right: 两个分量。
+【返回值】
+    两个分量的积。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+C3W_CONSTEXPR inline T ExpressionOperation::Times::Apply(
+    const T& Left,
+    const T& Right
+) {
+    return Left * Right;
+}
+
+/**********************************************************************
+【函数名称】 Apply
+【函数功能】 求左分量的相反数。
+【参数】
+    Left: 分量。
+    Right: 不使用。
+【返回值】
+    左分量的相反数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+C3W_CONSTEXPR inline T ExpressionOperation::Negation::Apply(
+    const T& Left,
+    const T& Right
+) {
+    return -Left;
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用两个操作数初始化 Expression 对象。
+【参数】
+    LeftOperand: 左操作数。
+    RightOperand: 右操作数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename Result, typename Operation, typename Left, typename Right>
+C3W_CONSTEXPR inline Expression<Result, Operation, Left, Right>::Expression(
+    const Left& LeftOperand,
+    const Right& RightOperand
+): m_Left(LeftOperand), m_Right(RightOperand) {}
+
+/**********************************************************************
+【函数名称】 GetComponentUnchecked
+【函数功能】 求指定下标处的分量，不检查下标。
+【参数】
+    Index: 分量的下标，必须小于 DIMENSION。
+【返回值】
+    表达式在该下标处的分量。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename Result, typename Operation, typename Left, typename Right>
+C3W_CONSTEXPR inline
+typename Expression<Result, Operation, Left, Right>::ValueType
+Expression<Result, Operation, Left, Right>::GetComponentUnchecked(
+    size_t Index
+) const {
+    return Operation::template Apply<ValueType>(
+        m_Left.GetComponentUnchecked(Index),
+        m_Right.GetComponentUnchecked(Index)
+    );
+}
+
+/**********************************************************************
+【函数名称】 Evaluate
+【函数功能】 逐分量求值。
+【参数】 无
+【返回值】
+    表达式的值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename Result, typename Operation, typename Left, typename Right>
+C3W_CONSTEXPR inline Result
+Expression<Result, Operation, Left, Right>::Evaluate() const {
+    Result AResult;
+    Tools::Unroll<DIMENSION>::For([this, &AResult](size_t i) {
+        AResult.GetComponentUnchecked(i) = GetComponentUnchecked(i);
+    });
+    return AResult;
+}
+
+/**********************************************************************
+【函数名称】 operator Result
+【函数功能】 隐式转换为结果类型。
+【参数】 无
+【返回值】
+    表达式的值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename Result, typename Operation, typename Left, typename Right>
+C3W_CONSTEXPR inline
+Expression<Result, Operation, Left, Right>::operator Result() const {
+    return Evaluate();
+}
+
+/**********************************************************************
+【函数名称】 operator-
+【函数功能】 求向量、点或表达式的相反数。
+【参数】
+    Operand: 操作数。
+【返回值】
+    延迟求值的表达式，结果类型与操作数相同。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename X>
+C3W_CONSTEXPR inline typename enable_if<
+    VectorTraits<X>::IS_VECTOR,
+    Expression<
+        typename VectorTraits<X>::Result,
+        ExpressionOperation::Negation,
+        X,
+        X
+    >
+>::type operator-(const X& Operand) {
+    return { Operand, Operand };
+}
+
+/**********************************************************************
+【函数名称】 operator+
+【函数功能】 求两个向量、点或表达式的和。
+【参数】
+    Left: 左操作数。
+    Right: 右操作数。
+【返回值】
+    延迟求值的表达式，结果类型与左操作数相同。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L, typename R>
+C3W_CONSTEXPR inline typename enable_if<
+    VectorTraits<L>::IS_VECTOR && VectorTraits<R>::IS_VECTOR,
+    Expression<
+        typename VectorTraits<L>::Result,
+        ExpressionOperation::Plus,
+        L,
+        R
+    >
+>::type operator+(const L& Left, const R& Right) {
+    return { Left, Right };
+}
+
+/**********************************************************************
+【函数名称】 operator-
+【函数功能】 求两个向量、点或表达式的差。
+【参数】
+    Left: 左操作数。
+    Right: 右操作数。
+【返回值】
+    延迟求值的表达式，两点之差为向量，其余与左操作数相同。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L, typename R>
+C3W_CONSTEXPR inline typename enable_if<
+    VectorTraits<L>::IS_VECTOR && VectorTraits<R>::IS_VECTOR,
+    Expression<
+        typename DifferenceResult<
+            typename VectorTraits<L>::Result,
+            typename VectorTraits<R>::Result
+        >::Type,
+        ExpressionOperation::Minus,
+        L,
+        R
+    >
+>::type operator-(const L& Left, const R& Right) {
+    return { Left, Right };
+}
+
+/**********************************************************************
+【函数名称】 operator*
+【函数功能】 将向量或结果为向量的表达式与标量数乘。
+【参数】
+    Left: 向量或表达式。
+    Factor: 标量。
+【返回值】
+    延迟求值的表达式，结果类型为向量。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L>
+C3W_CONSTEXPR inline typename enable_if<
+    is_same<
+        typename VectorTraits<L>::Result,
+        Vector<
+            typename VectorTraits<L>::ValueType,
+            VectorTraits<L>::DIMENSION
+        >
+    >::value,
+    Expression<
+        typename VectorTraits<L>::Result,
+        ExpressionOperation::Times,
+        L,
+        Scalar<typename VectorTraits<L>::ValueType>
+    >
+>::type operator*(
+    const L& Left,
+    typename VectorTraits<L>::ValueType Factor
+) {
+    using ValueType = typename VectorTraits<L>::ValueType;
+    return { Left, Scalar<ValueType>(Factor) };
+}
+
+/**********************************************************************
+【函数名称】 operator*
+【函数功能】 将标量与向量或结果为向量的表达式数乘。
+【参数】
+    Factor: 标量。
+    Right: 向量或表达式。
+【返回值】
+    延迟求值的表达式，结果类型为向量。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename R>
+C3W_CONSTEXPR inline typename enable_if<
+    is_same<
+        typename VectorTraits<R>::Result,
+        Vector<
+            typename VectorTraits<R>::ValueType,
+            VectorTraits<R>::DIMENSION
+        >
+    >::value,
+    Expression<
+        typename VectorTraits<R>::Result,
+        ExpressionOperation::Times,
+        R,
+        Scalar<typename VectorTraits<R>::ValueType>
+    >
+>::type operator*(
+    typename VectorTraits<R>::ValueType Factor,
+    const R& Right
+) {
+    using ValueType = typename VectorTraits<R>::ValueType;
+    // 分量乘以标量，与 Vector::Multiply 的运算顺序一致
+    return { Right, Scalar<ValueType>(Factor) };
+}
+
+/**********************************************************************
+【函数名称】 operator*
+【函数功能】 求两个向量或结果为向量的表达式的内积，立即求值。
+【参数】
+    Left: 左操作数。
+    Right: 右操作数。
+【返回值】
+    两者的内积。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L, typename R>
+C3W_CONSTEXPR inline typename enable_if<
+    is_same<
+        typename VectorTraits<L>::Result,
+        Vector<
+            typename VectorTraits<L>::ValueType,
+            VectorTraits<L>::DIMENSION
+        >
+    >::value && is_same<
+        typename VectorTraits<R>::Result,
+        typename VectorTraits<L>::Result
+    >::value,
+    typename VectorTraits<L>::ValueType
+>::type operator*(const L& Left, const R& Right) {
+    using ValueType = typename VectorTraits<L>::ValueType;
+    ValueType Result = 0;
+    Tools::Unroll<VectorTraits<L>::DIMENSION>::For(
+        [&Result, &Left, &Right](size_t i) {
+            Result += Left.GetComponentUnchecked(i) *
+                Right.GetComponentUnchecked(i);
+        }
+    );
+    return Result;
+}
+
+
+/**********************************************************************
+【函数名称】 operator==
+【函数功能】 判断两个向量、点或表达式是否相等，表达式先求值。
+【参数】
+    Left: 左操作数。
+    Right: 右操作数。
+【返回值】
+    两者是否相等，同 Vector::IsEqual 的编码比较。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L, typename R>
+C3W_CONSTEXPR inline typename enable_if<
+    VectorTraits<L>::IS_VECTOR && VectorTraits<R>::IS_VECTOR,
+    bool
+>::type operator==(const L& Left, const R& Right) {
+    using ResultVector = Vector<
+        typename VectorTraits<L>::ValueType,
+        VectorTraits<L>::DIMENSION
+    >;
+    // 向量与点直接绑定，表达式求值为临时对象
+    const ResultVector& LeftValue = Left;
+    const ResultVector& RightValue = Right;
+    return ResultVector::IsEqual(LeftValue, RightValue);
+}
+
+/**********************************************************************
+【函数名称】 operator!=
+【函数功能】 判断两个向量、点或表达式是否不等，表达式先求值。
+【参数】
+    Left: 左操作数。
+    Right: 右操作数。
+【返回值】
+    两者是否不等，同 Vector::IsEqual 的编码比较。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename L, typename R>
+C3W_CONSTEXPR inline typename enable_if<
+    VectorTraits<L>::IS_VECTOR && VectorTraits<R>::IS_VECTOR,
+    bool
+>::type operator!=(const L& Left, const R& Right) {
+    return !(Left == Right);
+}
+
+}
\ No newline at end of file
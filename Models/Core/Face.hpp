@@ -14,9 +14,9 @@ namespace C3w {
 
 /*************************************************************************
 【类名】 Face
-【功能】 定义一个维数 N 的面。
+【功能】 定义一个维数 N、点的分量类型为 T 的面。
 【接口说明】 
-    继承于 C3w::Element<N, 3>:
+    继承于 C3w::Element<N, 3, T>:
         继承全部接口。
         实现 GetLength, GetArea。
     成员：
@@ -31,22 +31,22 @@ namespace C3w {
         operator=: 默认赋值运算符。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
-template <size_t N>
-class Face: public Element<N, 3> {
+template <size_t N, typename T = double>
+class Face: public Element<N, 3, T> {
     public:
         // 成员
 
         // 第一个点
-        const Point<N>& First { this->Points[0] };
+        const Point<N, T>& First { this->Points[0] };
         // 第二个点
-        const Point<N>& Second { this->Points[1] };
+        const Point<N, T>& Second { this->Points[1] };
         // 第三个点
-        const Point<N>& Third { this->Points[2] };
+        const Point<N, T>& Third { this->Points[2] };
 
         // 构造函数
 
         // 使用 Element 的构造函数
-        using Element<N, 3>::Element;
+        using Element<N, 3, T>::Element;
         /**********************************************************************
         【函数名称】 构造函数
         【函数功能】 使用三个点初始化 Face 对象。
@@ -58,9 +58,9 @@ class Face: public Element<N, 3> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Face(
-            const Point<N>& First, 
-            const Point<N>& Second,
-            const Point<N>& Third
+            const Point<N, T>& First, 
+            const Point<N, T>& Second,
+            const Point<N, T>& Third
         );
         /**********************************************************************
         【函数名称】 构造函数
@@ -70,7 +70,7 @@ class Face: public Element<N, 3> {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Face(const Element<N, 3>& AElement);
+        Face(const Element<N, 3, T>& AElement);
         /**********************************************************************
         【函数名称】 拷贝构造函数
         【函数功能】 使用另一 Face 对象初始化 Face 对象。
@@ -79,7 +79,7 @@ class Face: public Element<N, 3> {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Face(const Face<N>& Other);
+        Face(const Face<N, T>& Other);
 
         // 属性
 
@@ -94,7 +94,7 @@ class Face: public Element<N, 3> {
         double GetLength() const override;
         /**********************************************************************
         【函数名称】 GetArea
-        【函数功能】 求此元素的面积。
+        【函数功能】 求此元素的面积，使用 AreaKernel 的叉积公式。
         【参数】 无
         【返回值】
             此元素的面积。
@@ -113,7 +113,7 @@ class Face: public Element<N, 3> {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Face<N>& operator=(const Element<N, 3>& AElement);
+        Face<N, T>& operator=(const Element<N, 3, T>& AElement);
         /**********************************************************************
         【函数名称】 operator=
         【函数功能】 将另一面赋值给自身。
@@ -123,7 +123,7 @@ class Face: public Element<N, 3> {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Face<N>& operator=(const Face<N>& Other);
+        Face<N, T>& operator=(const Face<N, T>& Other);
 };
 
 }
@@ -8,6 +8,7 @@
 #include "Element.hpp"
 #include "Face.hpp"
 #include "Point.hpp"
+#include "../Tools/AreaKernel.hpp"
 using namespace std;
 
 namespace C3w {
@@ -22,12 +23,12 @@ namespace C3w {
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Face<N>::Face(
-    const Point<N>& First, 
-    const Point<N>& Second,
-    const Point<N>& Third
-): Element<N, 3>({ First, Second, Third }) {}
+template <size_t N, typename T>
+Face<N, T>::Face(
+    const Point<N, T>& First, 
+    const Point<N, T>& Second,
+    const Point<N, T>& Third
+): Element<N, 3, T>({ First, Second, Third }) {}
 
 /**********************************************************************
 【函数名称】 构造函数
@@ -37,8 +38,10 @@ Face<N>::Face(
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Face<N>::Face(const Element<N, 3>& AElement): Element<N, 3>(AElement) {}
+template <size_t N, typename T>
+Face<N, T>::Face(
+    const Element<N, 3, T>& AElement
+): Element<N, 3, T>(AElement) {}
 
 /**********************************************************************
 【函数名称】 拷贝构造函数
@@ -48,8 +51,8 @@ Face<N>::Face(const Element<N, 3>& AElement): Element<N, 3>(AElement) {}
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Face<N>::Face(const Face<N>& Other): Element<N, 3>(Other) {}
+template <size_t N, typename T>
+Face<N, T>::Face(const Face<N, T>& Other): Element<N, 3, T>(Other) {}
 
 /**********************************************************************
 【函数名称】 GetLength
@@ -59,30 +62,26 @@ Face<N>::Face(const Face<N>& Other): Element<N, 3>(Other) {}
     此元素的长度。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-double Face<N>::GetLength() const {
+template <size_t N, typename T>
+double Face<N, T>::GetLength() const {
     return (
-        Point<N>::Distance(First, Second) +
-        Point<N>::Distance(Second, Third) +
-        Point<N>::Distance(Third, First)
+        Point<N, T>::Distance(First, Second) +
+        Point<N, T>::Distance(Second, Third) +
+        Point<N, T>::Distance(Third, First)
     );
 }
 
 /**********************************************************************
 【函数名称】 GetArea
-【函数功能】 求此元素的面积。
+【函数功能】 求此元素的面积，使用 AreaKernel 的叉积公式。
 【参数】 无
 【返回值】
     此元素的面积。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-double Face<N>::GetArea() const {
-    double rA = Point<N>::Distance(First, Second);
-    double rB = Point<N>::Distance(Second, Third);
-    double rC = Point<N>::Distance(Third, First);
-    double rP = (rA + rB + rC) / 2;
-    return sqrt((rP - rA) * (rP - rB) * (rP - rC) * rP);
+template <size_t N, typename T>
+double Face<N, T>::GetArea() const {
+    return Tools::AreaKernel<N>::GetArea(First, Second, Third);
 }
 
 /**********************************************************************
@@ -94,10 +93,10 @@ double Face<N>::GetArea() const {
     自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Face<N>& Face<N>::operator=(const Element<N, 3>& AElement) {
+template <size_t N, typename T>
+Face<N, T>& Face<N, T>::operator=(const Element<N, 3, T>& AElement) {
     if (this != &AElement) {
-        Element<N, 3>::operator=(AElement);
+        Element<N, 3, T>::operator=(AElement);
     }
     return *this;
 }
@@ -111,10 +110,10 @@ Face<N>& Face<N>::operator=(const Element<N, 3>& AElement) {
     自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Face<N>& Face<N>::operator=(const Face<N>& Other) {
+template <size_t N, typename T>
+Face<N, T>& Face<N, T>::operator=(const Face<N, T>& Other) {
     if (this != &Other) {
-        Element<N, 3>::operator=(Other);
+        Element<N, 3, T>::operator=(Other);
     }
     return *this;
 }
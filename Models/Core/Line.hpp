@@ -15,9 +15,9 @@ namespace C3w {
 
 /*************************************************************************
 【类名】 Line
-【功能】 定义一个维数 N 的线段。
+【功能】 定义一个维数 N、点的分量类型为 T 的线段。
 【接口说明】 
-    继承于 C3w::Element<N, 2>:
+    继承于 C3w::Element<N, 2, T>:
         继承全部接口。
         实现 GetLength, GetArea。
     成员：
@@ -33,23 +33,23 @@ namespace C3w {
         Intersection: 求两条线段的交点。
     操作符：
         operator=: 默认赋值运算符。
-        operator Vector<double, N>: 将线段转化为向量。
+        operator Vector<T, N>: 将线段转化为向量。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
-template <size_t N>
-class Line: public Element<N, 2> {
+template <size_t N, typename T = double>
+class Line: public Element<N, 2, T> {
     public:
         // 属性
         
         // 起始点
-        const Point<N>& Start { this->Points[0] };
+        const Point<N, T>& Start { this->Points[0] };
         // 终止点
-        const Point<N>& End { this->Points[1] };
+        const Point<N, T>& End { this->Points[1] };
 
         // 构造函数
 
         // 使用 Element 的构造函数
-        using Element<N, 2>::Element;
+        using Element<N, 2, T>::Element;
         /**********************************************************************
         【函数名称】 构造函数
         【函数功能】 使用两个点初始化 Line 对象。
@@ -59,7 +59,7 @@ class Line: public Element<N, 2> {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Line(const Point<N>& Start, const Point<N>& End);
+        Line(const Point<N, T>& Start, const Point<N, T>& End);
         /**********************************************************************
         【函数名称】 构造函数
         【函数功能】 使用一个 Element 初始化 Line 对象。
@@ -68,7 +68,7 @@ class Line: public Element<N, 2> {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Line(const Element<N, 2>& AElement);
+        Line(const Element<N, 2, T>& AElement);
         /**********************************************************************
         【函数名称】 拷贝构造函数
         【函数功能】 使用另一 Line 对象初始化 Line 对象。
@@ -77,7 +77,7 @@ class Line: public Element<N, 2> {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Line(const Line<N>& Other);
+        Line(const Line<N, T>& Other);
 
         // 属性
 
@@ -111,7 +111,7 @@ class Line: public Element<N, 2> {
             自身和指定向量是否平行。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool IsParallel(const Line<N>& Other) const;
+        bool IsParallel(const Line<N, T>& Other) const;
         /**********************************************************************
         【函数名称】 IsParallel
         【函数功能】 判断两个线段是否平行。
@@ -123,8 +123,8 @@ class Line: public Element<N, 2> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         static bool IsParallel(
-            const Line<N>& Left, 
-            const Line<N>& Right
+            const Line<N, T>& Left, 
+            const Line<N, T>& Right
         );
         /**********************************************************************
         【函数名称】 IsPerpendicular
@@ -135,7 +135,7 @@ class Line: public Element<N, 2> {
             自身和指定线段是否垂直。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool IsPerpendicular(const Line<N>& Other) const;
+        bool IsPerpendicular(const Line<N, T>& Other) const;
         /**********************************************************************
         【函数名称】 IsPerpendicular
         【函数功能】 判断两个线段是否垂直。
@@ -147,22 +147,22 @@ class Line: public Element<N, 2> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         static bool IsPerpendicular(
-            const Line<N>& Left,
-            const Line<N>& Right
+            const Line<N, T>& Left,
+            const Line<N, T>& Right
         );
         /**********************************************************************
         【函数名称】 Intersection
-        【函数功能】 获取自身与另一线段的交点。无交点返回 Point<N>::VOID。
+        【函数功能】 获取自身与另一线段的交点。无交点返回 Point<N, T>::VOID。
         【参数】 
             Other: 另一个线段。
         【返回值】 
             两个线段的交点。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Point<N> Intersection(const Line<N>& Other) const;
+        Point<N, T> Intersection(const Line<N, T>& Other) const;
         /**********************************************************************
         【函数名称】 Intersection
-        【函数功能】 获取两线段的交点。无交点返回 Point<N>::VOID。
+        【函数功能】 获取两线段的交点。无交点返回 Point<N, T>::VOID。
         【参数】 
             Left: 第一个线段。
             Right: 第二个线段。
@@ -170,9 +170,9 @@ class Line: public Element<N, 2> {
             两个线段的交点。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Point<N> Intersection(
-            const Line<N>& Left, 
-            const Line<N>& Right
+        static Point<N, T> Intersection(
+            const Line<N, T>& Left, 
+            const Line<N, T>& Right
         );
 
         // 操作符
@@ -186,7 +186,7 @@ class Line: public Element<N, 2> {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Line<N>& operator=(const Element<N, 2>& AElement);
+        Line<N, T>& operator=(const Element<N, 2, T>& AElement);
         /**********************************************************************
         【函数名称】 operator=
         【函数功能】 将另一线段赋值给自身。
@@ -196,16 +196,16 @@ class Line: public Element<N, 2> {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Line<N>& operator=(const Line<N>& Other);
+        Line<N, T>& operator=(const Line<N, T>& Other);
         /**********************************************************************
-        【函数名称】 operator Vector<double, N>
+        【函数名称】 operator Vector<T, N>
         【函数功能】 将自身转化为向量。
         【参数】 无
         【返回值】
             从起点指向终点的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        operator Vector<double, N>() const;
+        operator Vector<T, N>() const;
 };
 
 }
@@ -22,9 +22,9 @@ namespace C3w {
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Line<N>::Line(const Point<N>& Start, const Point<N>& End)
-    : Element<N, 2>({ Start, End }) {}
+template <size_t N, typename T>
+Line<N, T>::Line(const Point<N, T>& Start, const Point<N, T>& End)
+    : Element<N, 2, T>({ Start, End }) {}
 
 /**********************************************************************
 【函数名称】 构造函数
@@ -34,8 +34,10 @@ Line<N>::Line(const Point<N>& Start, const Point<N>& End)
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Line<N>::Line(const Element<N, 2>& AElement): Element<N, 2>(AElement) {}
+template <size_t N, typename T>
+Line<N, T>::Line(
+    const Element<N, 2, T>& AElement
+): Element<N, 2, T>(AElement) {}
 
 /**********************************************************************
 【函数名称】 拷贝构造函数
@@ -45,8 +47,8 @@ Line<N>::Line(const Element<N, 2>& AElement): Element<N, 2>(AElement) {}
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Line<N>::Line(const Line<N>& Other): Element<N, 2>(Other) {}
+template <size_t N, typename T>
+Line<N, T>::Line(const Line<N, T>& Other): Element<N, 2, T>(Other) {}
 
 /**********************************************************************
 【函数名称】 GetLength
@@ -56,9 +58,9 @@ Line<N>::Line(const Line<N>& Other): Element<N, 2>(Other) {}
     此元素的长度。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-double Line<N>::GetLength() const {
-    return Point<N>::Distance(Start, End);
+template <size_t N, typename T>
+double Line<N, T>::GetLength() const {
+    return Point<N, T>::Distance(Start, End);
 }
 
 /**********************************************************************
@@ -69,8 +71,8 @@ double Line<N>::GetLength() const {
     此元素的面积。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-double Line<N>::GetArea() const {
+template <size_t N, typename T>
+double Line<N, T>::GetArea() const {
     return 0;
 }
 
@@ -83,8 +85,8 @@ double Line<N>::GetArea() const {
     自身和指定向量是否平行。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-bool Line<N>::IsParallel(const Line<N>& Other) const {
+template <size_t N, typename T>
+bool Line<N, T>::IsParallel(const Line<N, T>& Other) const {
     return IsParallel(*this, Other);
 }
 
@@ -98,12 +100,12 @@ bool Line<N>::IsParallel(const Line<N>& Other) const {
     两个向量是否平行。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-bool Line<N>::IsParallel(
-    const Line<N>& Left, 
-    const Line<N>& Right
+template <size_t N, typename T>
+bool Line<N, T>::IsParallel(
+    const Line<N, T>& Left, 
+    const Line<N, T>& Right
 ) {
-    return Vector<double, N>::IsParallel(Left, Right);
+    return Vector<T, N>::IsParallel(Left, Right);
 }
 
 /**********************************************************************
@@ -115,8 +117,8 @@ bool Line<N>::IsParallel(
     自身和指定线段是否垂直。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-bool Line<N>::IsPerpendicular(const Line<N>& Other) const {
+template <size_t N, typename T>
+bool Line<N, T>::IsPerpendicular(const Line<N, T>& Other) const {
     return IsPerpendicular(*this, Other);
 }
 
@@ -130,31 +132,31 @@ bool Line<N>::IsPerpendicular(const Line<N>& Other) const {
     两个线段是否垂直。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-bool Line<N>::IsPerpendicular(
-    const Line<N>& Left,
-    const Line<N>& Right
+template <size_t N, typename T>
+bool Line<N, T>::IsPerpendicular(
+    const Line<N, T>& Left,
+    const Line<N, T>& Right
 ) {
-    return Vector<double, N>::IsPerpendicular(Left, Right);
+    return Vector<T, N>::IsPerpendicular(Left, Right);
 }
 
 /**********************************************************************
 【函数名称】 Intersection
-【函数功能】 获取自身与另一线段的交点。无交点返回 Point<N>::VOID。
+【函数功能】 获取自身与另一线段的交点。无交点返回 Point<N, T>::VOID。
 【参数】 
     Other: 另一个线段。
 【返回值】 
     两个线段的交点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N> Line<N>::Intersection(const Line<N>& Other) const {
+template <size_t N, typename T>
+Point<N, T> Line<N, T>::Intersection(const Line<N, T>& Other) const {
     return Intersection(*this, Other);
 }
 
 /**********************************************************************
 【函数名称】 Intersection
-【函数功能】 获取两线段的交点。无交点返回 Point<N>::VOID。
+【函数功能】 获取两线段的交点。无交点返回 Point<N, T>::VOID。
 【参数】 
     Left: 第一个线段。
     Right: 第二个线段。
@@ -162,19 +164,19 @@ Point<N> Line<N>::Intersection(const Line<N>& Other) const {
     两个线段的交点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N> Line<N>::Intersection(
-    const Line<N>& Left, 
-    const Line<N>& Right
+template <size_t N, typename T>
+Point<N, T> Line<N, T>::Intersection(
+    const Line<N, T>& Left, 
+    const Line<N, T>& Right
 ) {
     if (IsParallel(Left, Right)) {
-        return Point<N>::VOID;
+        return Point<N, T>::VOID;
     }
     // 矩阵 A = (Vec1 | Vec2)
-    Vector<double, N> Vec1 = Left;
-    Vector<double, N> Vec2 = Right;
+    Vector<T, N> Vec1 = Left;
+    Vector<T, N> Vec2 = Right;
     // 方程 Ax = b 中的 b 向量
-    Vector<double, N> Coef = Right.Start - Left.Start;
+    Vector<T, N> Coef = Right.Start - Left.Start;
     // 向量 x = (rRatio1 rRatio2)^T
     double rRatio1 = 0;
     double rRatio2 = 0;
@@ -193,7 +195,7 @@ Point<N> Line<N>::Intersection(
         return Left.Start + Vec1 * rRatio1;
     }
     else {
-        return Point<N>::VOID;
+        return Point<N, T>::VOID;
     }
 }
 
@@ -206,10 +208,10 @@ Point<N> Line<N>::Intersection(
     自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Line<N>& Line<N>::operator=(const Element<N, 2>& AElement) {
+template <size_t N, typename T>
+Line<N, T>& Line<N, T>::operator=(const Element<N, 2, T>& AElement) {
     if (this != &AElement) {
-        Element<N, 2>::operator=(AElement);
+        Element<N, 2, T>::operator=(AElement);
     }
     return *this;
 }
@@ -223,24 +225,24 @@ Line<N>& Line<N>::operator=(const Element<N, 2>& AElement) {
     自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Line<N>& Line<N>::operator=(const Line<N>& Other) {
+template <size_t N, typename T>
+Line<N, T>& Line<N, T>::operator=(const Line<N, T>& Other) {
     if (this != &Other) {
-        Element<N, 2>::operator=(Other);
+        Element<N, 2, T>::operator=(Other);
     }
     return *this;
 }
 
 /**********************************************************************
-【函数名称】 operator Vector<double, N>
+【函数名称】 operator Vector<T, N>
 【函数功能】 将自身转化为向量。
 【参数】 无
 【返回值】
     从起点指向终点的向量。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Line<N>::operator Vector<double, N>() const {
+template <size_t N, typename T>
+Line<N, T>::operator Vector<T, N>() const {
     return End - Start;
 }
 
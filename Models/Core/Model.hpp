@@ -9,9 +9,11 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 #include "Face.hpp"
 #include "Line.hpp"
 #include "Point.hpp"
+#include "Transform.hpp"
 #include "../Containers/DynamicSet.hpp"
 #include "../Tools/Box.hpp"
 using namespace std;
@@ -20,8 +22,9 @@ using namespace C3w::Containers;
 namespace C3w {
 
 /*************************************************************************
-【类名】 Vector
-【功能】 定义一个维数为 N 的模型。
+【类名】 Model
+【功能】 定义一个维数为 N、点的分量类型为 T 的模型。
+    T 默认为 double，面积等累加量总是以 double 计算。
 【接口说明】 
     成员：
         DIMENSION: 表示维数。
@@ -33,17 +36,22 @@ namespace C3w {
         接受名称的构造函数。
         接受名称、线段与面集合的构造函数。
         拷贝构造函数。
+        接受分量类型不同的模型的转换构造函数。
         Merged: 将两个模型融合为一个。
         虚析构函数。
     操作：
         CollectPoints: 收集模型中所有点，虚函数。
-        GetBoundingBox: 利用 CollectPoints 的点创建包围盒。
+        ForEachPoint: 按顺序访问所有元素的点，不收集、不去重。
+        GetBoundingBox: 利用 ForEachPoint 一次遍历创建包围盒。
+        GetFaceAreas: 批量求每个面的面积。
+        GetTotalArea: 批量求所有面的面积之和。
+        ApplyInplace: 对模型中所有的点作用一个变换。
         * 所有添加、删除、修改的操作均调用 Lines 和 Faces 的接口，不另设接口。
     操作符：
         operator=: 默认赋值运算符。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
-template <size_t N>
+template <size_t N, typename T = double>
 class Model {
     public:
         // 成员
@@ -53,9 +61,9 @@ class Model {
         // 名称
         string Name;
         // 线段集合
-        DynamicSet<Line<N>> Lines;
+        DynamicSet<Line<N, T>> Lines;
         // 面集合
-        DynamicSet<Face<N>> Faces;
+        DynamicSet<Face<N, T>> Faces;
 
         // 构造函数
 
@@ -88,8 +96,8 @@ class Model {
         **********************************************************************/
         Model(
             string Name, 
-            const DynamicSet<Line<N>>& Lines, 
-            const DynamicSet<Face<N>>& Faces
+            const DynamicSet<Line<N, T>>& Lines, 
+            const DynamicSet<Face<N, T>>& Faces
         );
         /**********************************************************************
         【函数名称】 拷贝构造函数
@@ -99,7 +107,18 @@ class Model {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Model(const Model<N>& Other) = default;
+        Model(const Model<N, T>& Other) = default;
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用分量类型不同的模型初始化 Model 类型实例，
+            例如将导入的双精度模型转换为单精度以减少内存占用。
+        【参数】
+            Other: 分量类型为 U 的模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename U>
+        explicit Model(const Model<N, U>& Other);
         /**********************************************************************
         【函数名称】 Merged
         【函数功能】 将两个模型融合为一个。
@@ -111,9 +130,9 @@ class Model {
             融合后的模型。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Model<N> Merged(
-            const Model<N>& First, 
-            const Model<N>& Second, 
+        Model<N, T> Merged(
+            const Model<N, T>& First, 
+            const Model<N, T>& Second, 
             string Name
         );
 
@@ -127,7 +146,18 @@ class Model {
             包含模型中所有点的集合。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        virtual DynamicSet<Point<N>> CollectPoints() const;
+        virtual DynamicSet<Point<N, T>> CollectPoints() const;
+        /**********************************************************************
+        【函数名称】 ForEachPoint
+        【函数功能】 按顺序访问模型中所有元素的点，先线段后面。
+            不分配内存，被多个元素共享的点会被访问多次。
+        【参数】
+            Function: 对每个点调用的函数，参数为 const Point<N, T>&。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename F>
+        void ForEachPoint(F Function) const;
         /**********************************************************************
         【函数名称】 GetBoundingBox
         【函数功能】 获取能包含此模型中所有元素的最小长方体。
@@ -137,6 +167,38 @@ class Model {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Tools::Box<N> GetBoundingBox() const;
+        /**********************************************************************
+        【函数名称】 GetFaceAreas
+        【函数功能】 求每个面的面积。在多个线程中将面复制为结构数组，
+            再以 AreaKernel 的批量版本计算。
+        【参数】 无
+        【返回值】
+            与 Faces 顺序相同的面积数组，可用于按面积加权的采样。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        vector<double> GetFaceAreas() const;
+        /**********************************************************************
+        【函数名称】 GetTotalArea
+        【函数功能】 求所有面的面积之和，计算方式同 GetFaceAreas，
+            不分配与面数成正比的内存，各批的和使用补偿求和。
+        【参数】 无
+        【返回值】
+            所有面的面积之和。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        double GetTotalArea() const;
+        /**********************************************************************
+        【函数名称】 ApplyInplace
+        【函数功能】 对模型中所有元素的点作用变换，直接修改这些点。
+            元素较多时使用多个线程，不分配额外的内存。
+        【参数】
+            ATransform: 要作用的变换。
+        【返回值】 无
+            如果变换不是仿射变换，抛出 NonAffineTransformException。
+            如果变换不可逆，抛出 SingularTransformException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void ApplyInplace(const Transform<N>& ATransform);
 
         // 操作符
         
@@ -149,10 +211,26 @@ class Model {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Model<N>& operator=(const Model<N>& Other) = default;
+        Model<N, T>& operator=(const Model<N, T>& Other) = default;
 
         // 虚析构函数
         virtual ~Model() = default;
+
+    private:
+        /**********************************************************************
+        【函数名称】 ForEachFaceBatch
+        【函数功能】 将 [Begin, End) 区间内的面按 AreaKernel::BATCH_SIZE
+            分批复制为结构数组，并对每一批调用函数。
+        【参数】
+            Begin: 第一个面的下标。
+            End: 最后一个面的下一个下标。
+            Function: 形如 void(const Batch&, size_t Offset, size_t Count)
+                的函数，Offset 为该批第一个面的下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename F>
+        void ForEachFaceBatch(size_t Begin, size_t End, F Function) const;
 };
 
 }
@@ -4,13 +4,24 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <array>
 #include <cstddef>
+#include <limits>
 #include <string>
+#include <utility>
+#include <vector>
 #include "Face.hpp"
 #include "Line.hpp"
 #include "Point.hpp"
+#include "Transform.hpp"
 #include "../Containers/DynamicSet.hpp"
+#include "../Errors/NonAffineTransformException.hpp"
+#include "../Errors/SingularTransformException.hpp"
+#include "../Tools/AreaKernel.hpp"
 #include "../Tools/Box.hpp"
+#include "../Tools/CompensatedSum.hpp"
+#include "../Tools/Parallel.hpp"
+#include "../Tools/Unroll.hpp"
 #include "Model.hpp"
 using namespace std;
 using namespace C3w::Containers;
@@ -25,8 +36,8 @@ namespace C3w {
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Model<N>::Model(string Name): Name(Name) {}
+template <size_t N, typename T>
+Model<N, T>::Model(string Name): Name(Name) {}
 
 /**********************************************************************
 【函数名称】 构造函数
@@ -38,13 +49,47 @@ Model<N>::Model(string Name): Name(Name) {}
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Model<N>::Model(
+template <size_t N, typename T>
+Model<N, T>::Model(
     string Name, 
-    const DynamicSet<Line<N>>& Lines, 
-    const DynamicSet<Face<N>>& Faces
+    const DynamicSet<Line<N, T>>& Lines, 
+    const DynamicSet<Face<N, T>>& Faces
 ): Name(Name), Lines(Lines), Faces(Faces) {}
 
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用分量类型不同的模型初始化 Model 类型实例，
+    例如将导入的双精度模型转换为单精度以减少内存占用。
+【参数】
+    Other: 分量类型为 U 的模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+template <typename U>
+Model<N, T>::Model(const Model<N, U>& Other): Name(Other.Name) {
+    vector<Line<N, T>> NewLines;
+    NewLines.reserve(Other.Lines.Count());
+    for (auto& ALine: Other.Lines) {
+        NewLines.push_back(Line<N, T>(
+            Point<N, T>(ALine.Start),
+            Point<N, T>(ALine.End)
+        ));
+    }
+    vector<Face<N, T>> NewFaces;
+    NewFaces.reserve(Other.Faces.Count());
+    for (auto& AFace: Other.Faces) {
+        NewFaces.push_back(Face<N, T>(
+            Point<N, T>(AFace.First),
+            Point<N, T>(AFace.Second),
+            Point<N, T>(AFace.Third)
+        ));
+    }
+    // 与 ApplyInplace 相同，逐点转换后的元素视为仍然互不相同，不再逐个查重
+    Lines = DynamicSet<Line<N, T>>::FromDistinct(move(NewLines));
+    Faces = DynamicSet<Face<N, T>>::FromDistinct(move(NewFaces));
+}
+
 /**********************************************************************
 【函数名称】 Merged
 【函数功能】 将两个模型融合为一个。
@@ -56,13 +101,13 @@ Model<N>::Model(
     融合后的模型。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Model<N> Model<N>::Merged(
-    const Model<N>& First, 
-    const Model<N>& Second, 
+template <size_t N, typename T>
+Model<N, T> Model<N, T>::Merged(
+    const Model<N, T>& First, 
+    const Model<N, T>& Second, 
     string Name
 ) {
-    return Model<N>(
+    return Model<N, T>(
         Name,
         First.Lines | Second.Lines,
         First.Faces | Second.Faces
@@ -77,9 +122,9 @@ Model<N> Model<N>::Merged(
     包含模型中所有点的集合。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-DynamicSet<Point<N>> Model<N>::CollectPoints() const {
-    DynamicSet<Point<N>> Points;
+template <size_t N, typename T>
+DynamicSet<Point<N, T>> Model<N, T>::CollectPoints() const {
+    DynamicSet<Point<N, T>> Points;
     for (auto& Line: Lines) {
         for (auto& point: Line.Points) {
             Points.TryAdd(point);
@@ -93,6 +138,30 @@ DynamicSet<Point<N>> Model<N>::CollectPoints() const {
     return Points;
 }
 
+/**********************************************************************
+【函数名称】 ForEachPoint
+【函数功能】 按顺序访问模型中所有元素的点，先线段后面。
+    不分配内存，被多个元素共享的点会被访问多次。
+【参数】
+    Function: 对每个点调用的函数，参数为 const Point<N, T>&。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+template <typename F>
+void Model<N, T>::ForEachPoint(F Function) const {
+    for (auto& Line: Lines) {
+        for (auto& point: Line.Points) {
+            Function(point);
+        }
+    }
+    for (auto& Face: Faces) {
+        for (auto& point: Face.Points) {
+            Function(point);
+        }
+    }
+}
+
 /**********************************************************************
 【函数名称】 GetBoundingBox
 【函数功能】 获取能包含此模型中所有元素的最小长方体。
@@ -101,9 +170,184 @@ DynamicSet<Point<N>> Model<N>::CollectPoints() const {
     能包含此模型中所有元素的最小长方体。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Tools::Box<N> Model<N>::GetBoundingBox() const {
-    return Tools::Box<N>::GetBoundingBoxOf(CollectPoints());
+template <size_t N, typename T>
+Tools::Box<N> Model<N, T>::GetBoundingBox() const {
+    // 重复的点不影响包围盒，直接遍历而不经过 CollectPoints 的查重
+    if (Lines.Count() == 0 && Faces.Count() == 0) {
+        return Tools::Box<N>();
+    }
+    array<double, N> MinCoords;
+    MinCoords.fill(numeric_limits<double>::max());
+    array<double, N> MaxCoords;
+    MaxCoords.fill(numeric_limits<double>::lowest());
+    ForEachPoint([&MinCoords, &MaxCoords](const Point<N, T>& APoint) {
+        Tools::Unroll<N>::For([&APoint, &MinCoords, &MaxCoords](size_t i) {
+            double rValue = APoint.GetComponentUnchecked(i);
+            if (rValue < MinCoords[i]) {
+                MinCoords[i] = rValue;
+            }
+            if (rValue > MaxCoords[i]) {
+                MaxCoords[i] = rValue;
+            }
+        });
+    });
+    return Tools::Box<N>(Point<N>(MinCoords), Point<N>(MaxCoords));
+}
+
+/**********************************************************************
+【函数名称】 GetFaceAreas
+【函数功能】 求每个面的面积。在多个线程中将面复制为结构数组，
+    再以 AreaKernel 的批量版本计算。
+【参数】 无
+【返回值】
+    与 Faces 顺序相同的面积数组，可用于按面积加权的采样。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+vector<double> Model<N, T>::GetFaceAreas() const {
+    using Kernel = Tools::AreaKernel<N>;
+    vector<double> Areas(Faces.Count());
+    Tools::Parallel::For(
+        Faces.Count(),
+        [this, &Areas](size_t Begin, size_t End) {
+            ForEachFaceBatch(Begin, End, [&Areas](
+                const typename Kernel::Batch& ABatch,
+                size_t Offset,
+                size_t Count
+            ) {
+                Kernel::GetAreas(ABatch, Count, Areas.data() + Offset);
+            });
+        }
+    );
+    return Areas;
+}
+
+/**********************************************************************
+【函数名称】 GetTotalArea
+【函数功能】 求所有面的面积之和，计算方式同 GetFaceAreas，
+    不分配与面数成正比的内存，各批的和使用补偿求和。
+【参数】 无
+【返回值】
+    所有面的面积之和。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+double Model<N, T>::GetTotalArea() const {
+    using Kernel = Tools::AreaKernel<N>;
+    auto Map = [this](size_t Begin, size_t End) {
+        Tools::CompensatedSum Sum;
+        array<double, Kernel::BATCH_SIZE> Areas;
+        ForEachFaceBatch(Begin, End, [&Sum, &Areas](
+            const typename Kernel::Batch& ABatch,
+            size_t,
+            size_t Count
+        ) {
+            Kernel::GetAreas(ABatch, Count, Areas.data());
+            // 批内直接求和，只对各批的和做补偿求和，避免逐项补偿的依赖链
+            double rBatchSum = 0;
+            for (size_t i = 0; i < Count; i++) {
+                rBatchSum += Areas[i];
+            }
+            Sum += rBatchSum;
+        });
+        return Sum;
+    };
+    auto Combine = [](
+        const Tools::CompensatedSum& Left,
+        const Tools::CompensatedSum& Right
+    ) {
+        Tools::CompensatedSum Sum(Left);
+        Sum += Right;
+        return Sum;
+    };
+    return Tools::Parallel::Reduce(
+        Faces.Count(),
+        Tools::CompensatedSum(),
+        Map,
+        Combine
+    ).GetValue();
+}
+
+/**********************************************************************
+【函数名称】 ApplyInplace
+【函数功能】 对模型中所有元素的点作用变换，直接修改这些点。
+    元素较多时使用多个线程，不分配额外的内存。
+【参数】
+    ATransform: 要作用的变换。
+【返回值】 无
+    如果变换不是仿射变换，抛出 NonAffineTransformException。
+    如果变换不可逆，抛出 SingularTransformException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void Model<N, T>::ApplyInplace(const Transform<N>& ATransform) {
+    // 可逆的仿射变换是单射，不同的点、元素变换后仍然不同，
+    // 因此只需检查一次，之后可以跳过集合的唯一性检查；
+    // 透视除法可能除以 0，也可能使点重合，不予接受
+    if (!ATransform.IsAffine()) {
+        throw Errors::NonAffineTransformException();
+    }
+    if (!ATransform.IsInvertible()) {
+        throw Errors::SingularTransformException(ATransform.Determinant());
+    }
+    auto PointFunction = [&ATransform](Point<N, T>& APoint) {
+        ATransform.ApplyAffineInplace(APoint);
+    };
+    // 每个线程处理互不重叠的区间
+    Tools::Parallel::For(
+        Lines.Count(), 
+        [this, &PointFunction](size_t Begin, size_t End) {
+            Lines.TransformInplace([&PointFunction](Line<N, T>& ALine) {
+                ALine.Points.TransformInplace(PointFunction);
+            }, Begin, End);
+        }
+    );
+    Tools::Parallel::For(
+        Faces.Count(), 
+        [this, &PointFunction](size_t Begin, size_t End) {
+            Faces.TransformInplace([&PointFunction](Face<N, T>& AFace) {
+                AFace.Points.TransformInplace(PointFunction);
+            }, Begin, End);
+        }
+    );
+}
+
+/**********************************************************************
+【函数名称】 ForEachFaceBatch
+【函数功能】 将 [Begin, End) 区间内的面按 AreaKernel::BATCH_SIZE
+    分批复制为结构数组，并对每一批调用函数。
+【参数】
+    Begin: 第一个面的下标。
+    End: 最后一个面的下一个下标。
+    Function: 形如 void(const Batch&, size_t Offset, size_t Count)
+        的函数，Offset 为该批第一个面的下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+template <typename F>
+void Model<N, T>::ForEachFaceBatch(size_t Begin, size_t End, F Function) const {
+    using Kernel = Tools::AreaKernel<N>;
+    // 每个线程一批，约 3 × N × 2KB，放在栈上
+    typename Kernel::Batch ABatch;
+    // 区间已由调用者保证有效，使用迭代器避免逐个检查下标
+    auto FaceIterator = Faces.begin() + Begin;
+    for (size_t ullOffset = Begin; ullOffset < End;) {
+        size_t ullCount = End - ullOffset;
+        if (ullCount > Kernel::BATCH_SIZE) {
+            ullCount = Kernel::BATCH_SIZE;
+        }
+        for (size_t i = 0; i < ullCount; i++, ++FaceIterator) {
+            auto& AFace = *FaceIterator;
+            Tools::Unroll<N>::For([&ABatch, &AFace, i](size_t k) {
+                ABatch[0][k][i] = AFace.First.GetComponentUnchecked(k);
+                ABatch[1][k][i] = AFace.Second.GetComponentUnchecked(k);
+                ABatch[2][k][i] = AFace.Third.GetComponentUnchecked(k);
+            });
+        }
+        Function(ABatch, ullOffset, ullCount);
+        ullOffset += ullCount;
+    }
 }
 
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <string>
 #include "Vector.hpp"
+#include "../Tools/Constexpr.hpp"
 using namespace std;
 
 namespace C3w {
@@ -18,7 +19,7 @@ namespace C3w {
 【类名】 Point
 【功能】 定义一个维数为 N 的点。
 【接口说明】 
-    继承于 C3w::Vector<double, N>:
+    继承于 C3w::Vector<T, N>:
         继承全部接口。
         隐藏基类的向量独有的接口。
         重写 ToString。
@@ -30,6 +31,7 @@ namespace C3w {
         默认构造函数，初始化分量全部为 0 的点。
         接受一个向量的构造函数。
         拷贝构造函数。
+        接受分量类型不同的点的转换构造函数。
     属性：
         Distance: 求相同维度点之间的距离。
         GeneralDistance: 求不同维度点之间的广义距离（升维）。
@@ -41,28 +43,29 @@ namespace C3w {
         Add: 点和向量的加法。
         Subtract: 点和点、点和向量的减法。
     操作符：
-        operator- (unary): 同 Negate。
-        operator+: 同 Add。
         operator+=: 同基类 AddInplace。
-        operator-: 同 Subtract。
         operator-=: 同基类 SubtractInplace。
         operator=: 默认赋值运算符。
+    表达式运算符（见 Expression.hpp）：
+        operator- (unary)、点与向量的 operator+/-
+        返回结果为点的 Expression，两点之差返回结果为向量的 Expression。
+        点不参与数乘与内积。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
-template <size_t N>
-class Point: public Vector<double, N> {
+template <size_t N, typename T = double>
+class Point: public Vector<T, N> {
     public:
         // 成员
 
         // 原点。
-        static const Point<N> ORIGIN;
+        static const Point<N, T> ORIGIN;
         // 分量全部为 NaN 的点。
-        static const Point<N> VOID;
+        static const Point<N, T> VOID;
 
         // 构造函数
 
         // 使用基类构造函数
-        using Vector<double, N>::Vector;
+        using Vector<T, N>::Vector;
         // 如果没有此构造函数，g++ 可以通过，但 msvc 报错。
         /**********************************************************************
         【函数名称】 构造函数
@@ -80,7 +83,7 @@ class Point: public Vector<double, N> {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        explicit Point(const Vector<double, N>& AVector);
+        C3W_CONSTEXPR explicit Point(const Vector<T, N>& AVector);
         /**********************************************************************
         【函数名称】 拷贝构造函数
         【函数功能】 使用另一 Point 初始化 Point 类的实例。
@@ -89,7 +92,17 @@ class Point: public Vector<double, N> {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Point(const Point<N>& Other) = default;
+        Point(const Point<N, T>& Other) = default;
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用分量类型不同的点初始化 Point 类的实例。
+        【参数】
+            Other: 分量类型为 U 的点，各分量经 static_cast 转换。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename U>
+        C3W_CONSTEXPR explicit Point(const Point<N, U>& Other);
 
         // 属性
 
@@ -103,7 +116,10 @@ class Point: public Vector<double, N> {
             两点之间的直线距离。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static double Distance(const Point<N>& Left, const Point<N>& Right);
+        static double Distance(
+            const Point<N, T>& Left,
+            const Point<N, T>& Right
+        );
         /**********************************************************************
         【函数名称】 Distance
         【函数功能】 求自身与另一点之间的直线距离。
@@ -113,7 +129,7 @@ class Point: public Vector<double, N> {
             两点之间的直线距离。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        double Distance(const Point<N>& Other) const;
+        double Distance(const Point<N, T>& Other) const;
         /**********************************************************************
         【函数名称】 GeneralDistance
         【函数功能】 求两个点之间的广义直线距离。
@@ -126,8 +142,8 @@ class Point: public Vector<double, N> {
         **********************************************************************/
         template <size_t M>
         static double GeneralDistance(
-            const Point<N>& Left, 
-            const Point<M>& Right
+            const Point<N, T>& Left, 
+            const Point<M, T>& Right
         );
         /**********************************************************************
         【函数名称】 GeneralDistance
@@ -139,7 +155,7 @@ class Point: public Vector<double, N> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         template <size_t M>
-        double GeneralDistance(const Point<M>& Other) const;
+        double GeneralDistance(const Point<M, T>& Other) const;
 
         // 操作
 
@@ -151,7 +167,7 @@ class Point: public Vector<double, N> {
             自身是否含有 NaN 分量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool IsVoid() const;
+        C3W_CONSTEXPR bool IsVoid() const;
         /**********************************************************************
         【函数名称】 Project
         【函数功能】 将自身从 N 维投影至更低的 M 维。
@@ -161,7 +177,7 @@ class Point: public Vector<double, N> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         template <size_t M>
-        Point<M> Project() const;
+        Point<M, T> Project() const;
         /**********************************************************************
         【函数名称】 Promote
         【函数功能】 将自身从 N 维升至更高的 M 维。
@@ -172,7 +188,7 @@ class Point: public Vector<double, N> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         template <size_t M>
-        Point<M> Promote(double Padder = 0) const;
+        Point<M, T> Promote(T Padder = 0) const;
         /**********************************************************************
         【函数名称】 Negate
         【函数功能】 反转此点并存为新的点。
@@ -181,7 +197,7 @@ class Point: public Vector<double, N> {
             反转后的点。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Point<N> Negate() const;
+        C3W_CONSTEXPR Point<N, T> Negate() const;
         /**********************************************************************
         【函数名称】 Negate
         【函数功能】 反转给定点并存为新的点。
@@ -191,7 +207,7 @@ class Point: public Vector<double, N> {
             反转后的点。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Point<N> Negate(const Point<N>& APoint);
+        static C3W_CONSTEXPR Point<N, T> Negate(const Point<N, T>& APoint);
         /**********************************************************************
         【函数名称】 Add
         【函数功能】 将自身与一向量相加并存储为新的点。
@@ -201,7 +217,7 @@ class Point: public Vector<double, N> {
             点与向量相加形成的新的点。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Point<N> Add(const Vector<double, N>& Delta) const;
+        C3W_CONSTEXPR Point<N, T> Add(const Vector<T, N>& Delta) const;
         /**********************************************************************
         【函数名称】 Add
         【函数功能】 将点与一向量相加并存储为新的点。
@@ -212,9 +228,9 @@ class Point: public Vector<double, N> {
             点与向量相加形成的新的点。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Point<N> Add(
-            const Point<N>& APoint, 
-            const Vector<double, N>& Delta
+        static C3W_CONSTEXPR Point<N, T> Add(
+            const Point<N, T>& APoint, 
+            const Vector<T, N>& Delta
         );
         /**********************************************************************
         【函数名称】 Subtract
@@ -225,7 +241,7 @@ class Point: public Vector<double, N> {
             点与向量相减形成的新的点。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Point<N> Subtract(const Vector<double, N>& Delta) const;
+        C3W_CONSTEXPR Point<N, T> Subtract(const Vector<T, N>& Delta) const;
         /**********************************************************************
         【函数名称】 Subtract
         【函数功能】 将自身与另一点相减并存储为向量。
@@ -235,7 +251,7 @@ class Point: public Vector<double, N> {
             点与点相减形成的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector<double, N> Subtract(const Point<N>& Other) const;
+        C3W_CONSTEXPR Vector<T, N> Subtract(const Point<N, T>& Other) const;
         /**********************************************************************
         【函数名称】 Subtract
         【函数功能】 将点与一向量相减并存储为新的点。
@@ -246,9 +262,9 @@ class Point: public Vector<double, N> {
             点与向量相减形成的新的点。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Point<N> Subtract(
-            const Point<N>& APoint,
-            const Vector<double, N>& Delta
+        static C3W_CONSTEXPR Point<N, T> Subtract(
+            const Point<N, T>& APoint,
+            const Vector<T, N>& Delta
         );
         /**********************************************************************
         【函数名称】 Subtract
@@ -260,32 +276,13 @@ class Point: public Vector<double, N> {
             点与点相减形成的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Vector<double, N> Subtract(
-            const Point<N>& Left,
-            const Point<N>& Right
+        static C3W_CONSTEXPR Vector<T, N> Subtract(
+            const Point<N, T>& Left,
+            const Point<N, T>& Right
         );
 
         // 操作符
         
-        /**********************************************************************
-        【函数名称】 operator-
-        【函数功能】 反转此点并存为新的点。
-        【参数】 无
-        【返回值】 
-            反转后的点。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        Point<N> operator-() const;
-        /**********************************************************************
-        【函数名称】 operator+
-        【函数功能】 将自身与一向量相加并存储为新的点。
-        【参数】 
-            Delta: 相加的向量。
-        【返回值】 
-            点与向量相加形成的新的点。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        Point<N> operator+(const Vector<double, N>& Delta) const;
         /**********************************************************************
         【函数名称】 operator+=
         【函数功能】 将自身与一向量相加。
@@ -295,27 +292,7 @@ class Point: public Vector<double, N> {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Point<N>& operator+=(const Vector<double, N>& Delta);
-        /**********************************************************************
-        【函数名称】 operator-
-        【函数功能】 将自身与一向量相减并存储为新的点。
-        【参数】 
-            Delta: 相减的向量。
-        【返回值】 
-            点与向量相减形成的新的点。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        Point<N> operator-(const Vector<double, N>& Delta) const;
-        /**********************************************************************
-        【函数名称】 operator-
-        【函数功能】 将自身与另一点相减并存储为向量。
-        【参数】 
-            Other: 相减的点。
-        【返回值】 
-            点与点相减形成的向量。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        Vector<double, N> operator-(const Point<N>& Other) const;
+        C3W_CONSTEXPR Point<N, T>& operator+=(const Vector<T, N>& Delta);
         /**********************************************************************
         【函数名称】 operator-=
         【函数功能】 将自身与一向量相减并存储为新的点。
@@ -325,7 +302,7 @@ class Point: public Vector<double, N> {
             点与向量相减形成的新的点。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Point<N>& operator-=(const Vector<double, N>& Delta);
+        C3W_CONSTEXPR Point<N, T>& operator-=(const Vector<T, N>& Delta);
         /**********************************************************************
         【函数名称】 operator=
         【函数功能】 将另一点赋值于自身。
@@ -335,7 +312,7 @@ class Point: public Vector<double, N> {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Point<N>& operator=(const Point<N>& Other) = default;
+        Point<N, T>& operator=(const Point<N, T>& Other) = default;
 
         // 格式化
         
@@ -349,6 +326,10 @@ class Point: public Vector<double, N> {
         **********************************************************************/
         string ToString() const override;
 
+        // 虚析构函数
+        // 显式声明，否则 g++ 在常量求值时可能找不到隐式析构函数的定义。
+        virtual ~Point() = default;
+
         // 继承基类的函数：
         // GetComponent
         // SetComponent
@@ -362,15 +343,14 @@ class Point: public Vector<double, N> {
 
     private:
         // 隐藏向量独有的函数
-        using Vector<double, N>::IsParallel;
-        using Vector<double, N>::IsPerpendicular;
-        using Vector<double, N>::MultiplyInplace;
-        using Vector<double, N>::Multiply;
-        using Vector<double, N>::InnerProduct;
-        using Vector<double, N>::operator*;
-        using Vector<double, N>::operator*=;
-        using Vector<double, N>::Module;
-        using Vector<double, N>::ZERO;
+        using Vector<T, N>::IsParallel;
+        using Vector<T, N>::IsPerpendicular;
+        using Vector<T, N>::MultiplyInplace;
+        using Vector<T, N>::Multiply;
+        using Vector<T, N>::InnerProduct;
+        using Vector<T, N>::operator*=;
+        using Vector<T, N>::Module;
+        using Vector<T, N>::ZERO;
 };
 
 }
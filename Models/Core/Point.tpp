@@ -7,19 +7,23 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <limits>
 #include <string>
 #include "Point.hpp"
+#include "../Tools/Unroll.hpp"
 using namespace std;
 
 namespace C3w {
 
 // 原点。
-template <size_t N>
-const Point<N> Point<N>::ORIGIN { Point<N>() };
+template <size_t N, typename T>
+C3W_CONSTEXPR const Point<N, T> Point<N, T>::ORIGIN { Point<N, T>() };
 
 // 分量全部为 NaN 的点。
-template <size_t N>
-const Point<N> Point<N>::VOID { Point<N>(nan("")) };
+template <size_t N, typename T>
+C3W_CONSTEXPR const Point<N, T> Point<N, T>::VOID {
+    Point<N, T>(numeric_limits<T>::quiet_NaN())
+};
 
 /**********************************************************************
 【函数名称】 构造函数
@@ -29,8 +33,27 @@ const Point<N> Point<N>::VOID { Point<N>(nan("")) };
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N>::Point(const Vector<double, N>& AVector): Vector<double, N>(AVector) {}
+template <size_t N, typename T>
+C3W_CONSTEXPR Point<N, T>::Point(
+    const Vector<T, N>& AVector
+): Vector<T, N>(AVector) {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用分量类型不同的点初始化 Point 类的实例。
+【参数】
+    Other: 分量类型为 U 的点，各分量经 static_cast 转换。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+template <typename U>
+C3W_CONSTEXPR Point<N, T>::Point(const Point<N, U>& Other) {
+    Tools::Unroll<N>::For([this, &Other](size_t i) {
+        this->GetComponentUnchecked(i) =
+            static_cast<T>(Other.GetComponentUnchecked(i));
+    });
+}
 
 /**********************************************************************
 【函数名称】 Distance
@@ -42,9 +65,19 @@ Point<N>::Point(const Vector<double, N>& AVector): Vector<double, N>(AVector) {}
     两点之间的直线距离。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-double Point<N>::Distance(const Point<N>& Left, const Point<N>& Right) {
-    return (Left - Right).Module();
+template <size_t N, typename T>
+double Point<N, T>::Distance(
+    const Point<N, T>& Left,
+    const Point<N, T>& Right
+) {
+    // 分量先提升为 double 再求差，单精度的点也以双精度累加
+    double rSquareSum = 0;
+    Tools::Unroll<N>::For([&rSquareSum, &Left, &Right](size_t i) {
+        double rDelta = static_cast<double>(Left.GetComponentUnchecked(i)) -
+            static_cast<double>(Right.GetComponentUnchecked(i));
+        rSquareSum += rDelta * rDelta;
+    });
+    return sqrt(rSquareSum);
 }
 
 /**********************************************************************
@@ -56,8 +89,8 @@ double Point<N>::Distance(const Point<N>& Left, const Point<N>& Right) {
     两点之间的直线距离。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-double Point<N>::Distance(const Point<N>& Other) const {
+template <size_t N, typename T>
+double Point<N, T>::Distance(const Point<N, T>& Other) const {
     return Distance(*this, Other);
 }
 
@@ -71,11 +104,14 @@ double Point<N>::Distance(const Point<N>& Other) const {
     两点之间的直线距离。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
+template <size_t N, typename T>
 template <size_t M>
-double Point<N>::GeneralDistance(const Point<N>& Left, const Point<M>& Right) {
+double Point<N, T>::GeneralDistance(
+    const Point<N, T>& Left,
+    const Point<M, T>& Right
+) {
     constexpr size_t ullMaxDimension = max(M, N);
-    return Point<ullMaxDimension>::Distance(
+    return Point<ullMaxDimension, T>::Distance(
         Left.template Promote<ullMaxDimension>(),
         Right.template Promote<ullMaxDimension>()
     );
@@ -90,9 +126,9 @@ double Point<N>::GeneralDistance(const Point<N>& Left, const Point<M>& Right) {
     两点之间的直线距离。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
+template <size_t N, typename T>
 template <size_t M>
-double Point<N>::GeneralDistance(const Point<M>& Other) const {
+double Point<N, T>::GeneralDistance(const Point<M, T>& Other) const {
     return GeneralDistance(*this, Other);
 }
 
@@ -104,14 +140,13 @@ double Point<N>::GeneralDistance(const Point<M>& Other) const {
     自身是否含有 NaN 分量。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-bool Point<N>::IsVoid() const {
-    for (size_t i = 0; i < N; i++) {
-        if (isnan(this->GetComponent(i))) {
-            return true;
-        }
-    }
-    return false;
+template <size_t N, typename T>
+C3W_CONSTEXPR bool Point<N, T>::IsVoid() const {
+    return !Tools::Unroll<N>::All([this](size_t i) {
+        // NaN 不等于自身，isnan 在 C++23 之前不是 constexpr
+        T rValue = this->GetComponentUnchecked(i);
+        return rValue == rValue;
+    });
 }
 
 /**********************************************************************
@@ -122,20 +157,20 @@ bool Point<N>::IsVoid() const {
     一个 M 维的点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
+template <size_t N, typename T>
 template <size_t M>
-Point<M> Point<N>::Project() const {
+Point<M, T> Point<N, T>::Project() const {
     static_assert(M <= N, "Cannot project to a higher dimension.");
     if (M == N) {
         // 直接返回 *this，节省一次复制
         // 必须强制转换，否则 M != N 时编译不通过
-        return *reinterpret_cast<const Point<M>*>(this);
+        return *reinterpret_cast<const Point<M, T>*>(this);
     }
-    array<double, M> Components;
-    for (size_t i = 0; i < M; i++) {
-        Components[i] = this->GetComponent(i);
-    }
-    return Point<M>(Components);
+    array<T, M> Components;
+    Tools::Unroll<M>::For([this, &Components](size_t i) {
+        Components[i] = this->GetComponentUnchecked(i);
+    });
+    return Point<M, T>(Components);
 }
 
 /**********************************************************************
@@ -147,25 +182,21 @@ Point<M> Point<N>::Project() const {
     一个 M 维的点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
+template <size_t N, typename T>
 template <size_t M>
-Point<M> Point<N>::Promote(double Padder) const {
+Point<M, T> Point<N, T>::Promote(T Padder) const {
     static_assert(M >= N, "Cannot promote to a lower dimension.");
     if (M == N) {
         // 直接返回 *this，节省一次复制
         // 必须强制转换，否则 M != N 时编译不通过
-        return *reinterpret_cast<const Point<M>*>(this);
-    }
-    array<double, M> Components;
-    for (size_t i = 0; i < M; i++) {
-        if (i < N) {
-            Components[i] = this->GetComponent(i);
-        }
-        else {
-            Components[i] = Padder;
-        }
+        return *reinterpret_cast<const Point<M, T>*>(this);
     }
-    return Point<M>(Components);
+    array<T, M> Components;
+    Components.fill(Padder);
+    Tools::Unroll<N>::For([this, &Components](size_t i) {
+        Components[i] = this->GetComponentUnchecked(i);
+    });
+    return Point<M, T>(Components);
 }
 
 /**********************************************************************
@@ -176,8 +207,8 @@ Point<M> Point<N>::Promote(double Padder) const {
     反转后的点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N> Point<N>::Negate() const {
+template <size_t N, typename T>
+C3W_CONSTEXPR Point<N, T> Point<N, T>::Negate() const {
     return Negate(*this);
 }
 
@@ -190,9 +221,9 @@ Point<N> Point<N>::Negate() const {
     反转后的点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N> Point<N>::Negate(const Point<N>& APoint) {
-    return Point<N>(Vector<double, N>::Negate(APoint));
+template <size_t N, typename T>
+C3W_CONSTEXPR Point<N, T> Point<N, T>::Negate(const Point<N, T>& APoint) {
+    return Point<N, T>(Vector<T, N>::Negate(APoint));
 }
 
 /**********************************************************************
@@ -204,8 +235,8 @@ Point<N> Point<N>::Negate(const Point<N>& APoint) {
     点与向量相加形成的新的点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N> Point<N>::Add(const Vector<double, N>& Delta) const {
+template <size_t N, typename T>
+C3W_CONSTEXPR Point<N, T> Point<N, T>::Add(const Vector<T, N>& Delta) const {
     return Add(*this, Delta);
 }
 
@@ -219,12 +250,12 @@ Point<N> Point<N>::Add(const Vector<double, N>& Delta) const {
     点与向量相加形成的新的点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N> Point<N>::Add(
-    const Point<N>& APoint, 
-    const Vector<double, N>& Delta
+template <size_t N, typename T>
+C3W_CONSTEXPR Point<N, T> Point<N, T>::Add(
+    const Point<N, T>& APoint, 
+    const Vector<T, N>& Delta
 ) {
-    return Point<N>(Vector<double, N>::Add(APoint, Delta));
+    return Point<N, T>(Vector<T, N>::Add(APoint, Delta));
 }
 
 /**********************************************************************
@@ -236,8 +267,10 @@ Point<N> Point<N>::Add(
     点与向量相减形成的新的点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N> Point<N>::Subtract(const Vector<double, N>& Delta) const {
+template <size_t N, typename T>
+C3W_CONSTEXPR Point<N, T> Point<N, T>::Subtract(
+    const Vector<T, N>& Delta
+) const {
     return Subtract(*this, Delta);
 }
 
@@ -250,8 +283,10 @@ Point<N> Point<N>::Subtract(const Vector<double, N>& Delta) const {
     点与点相减形成的向量。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Vector<double, N> Point<N>::Subtract(const Point<N>& Other) const {
+template <size_t N, typename T>
+C3W_CONSTEXPR Vector<T, N> Point<N, T>::Subtract(
+    const Point<N, T>& Other
+) const {
     return Subtract(*this, Other);
 }
 
@@ -265,12 +300,12 @@ Vector<double, N> Point<N>::Subtract(const Point<N>& Other) const {
     点与向量相减形成的新的点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N> Point<N>::Subtract(
-    const Point<N>& APoint,
-    const Vector<double, N>& Delta
+template <size_t N, typename T>
+C3W_CONSTEXPR Point<N, T> Point<N, T>::Subtract(
+    const Point<N, T>& APoint,
+    const Vector<T, N>& Delta
 ) {
-    return Point<N>(Vector<double, N>::Subtract(APoint, Delta));
+    return Point<N, T>(Vector<T, N>::Subtract(APoint, Delta));
 }
 
 /**********************************************************************
@@ -283,39 +318,12 @@ Point<N> Point<N>::Subtract(
     点与点相减形成的向量。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Vector<double, N> Point<N>::Subtract(
-    const Point<N>& Left,
-    const Point<N>& Right
+template <size_t N, typename T>
+C3W_CONSTEXPR Vector<T, N> Point<N, T>::Subtract(
+    const Point<N, T>& Left,
+    const Point<N, T>& Right
 ) {
-    return Vector<double, N>::Subtract(Left, Right);
-}
-
-/**********************************************************************
-【函数名称】 operator-
-【函数功能】 反转此点并存为新的点。
-【参数】 无
-【返回值】 
-    反转后的点。
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <size_t N>
-Point<N> Point<N>::operator-() const {
-    return Negate();
-}
-
-/**********************************************************************
-【函数名称】 operator+
-【函数功能】 将自身与一向量相加并存储为新的点。
-【参数】 
-    Delta: 相加的向量。
-【返回值】 
-    点与向量相加形成的新的点。
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <size_t N>
-Point<N> Point<N>::operator+(const Vector<double, N>& Delta) const {
-    return Add(Delta);
+    return Vector<T, N>::Subtract(Left, Right);
 }
 
 /**********************************************************************
@@ -327,40 +335,12 @@ Point<N> Point<N>::operator+(const Vector<double, N>& Delta) const {
     自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N>& Point<N>::operator+=(const Vector<double, N>& Delta) {
-    Vector<double, N>::operator+=(Delta);
+template <size_t N, typename T>
+C3W_CONSTEXPR Point<N, T>& Point<N, T>::operator+=(const Vector<T, N>& Delta) {
+    Vector<T, N>::operator+=(Delta);
     return *this;
 }
 
-/**********************************************************************
-【函数名称】 operator-
-【函数功能】 将自身与一向量相减并存储为新的点。
-【参数】 
-    Delta: 相减的向量。
-【返回值】 
-    点与向量相减形成的新的点。
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <size_t N>
-Point<N> Point<N>::operator-(const Vector<double, N>& Delta) const {
-    return Subtract(Delta);
-}
-
-/**********************************************************************
-【函数名称】 operator-
-【函数功能】 将自身与另一点相减并存储为向量。
-【参数】 
-    Other: 相减的点。
-【返回值】 
-    点与点相减形成的向量。
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <size_t N>
-Vector<double, N> Point<N>::operator-(const Point<N>& Other) const {
-    return Subtract(Other);
-}
-
 /**********************************************************************
 【函数名称】 operator-=
 【函数功能】 将自身与一向量相减并存储为新的点。
@@ -370,9 +350,9 @@ Vector<double, N> Point<N>::operator-(const Point<N>& Other) const {
     点与向量相减形成的新的点。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-Point<N>& Point<N>::operator-=(const Vector<double, N>& Delta) {
-    Vector<double, N>::operator-=(Delta);
+template <size_t N, typename T>
+C3W_CONSTEXPR Point<N, T>& Point<N, T>::operator-=(const Vector<T, N>& Delta) {
+    Vector<T, N>::operator-=(Delta);
     return *this;
 }
 
@@ -384,9 +364,9 @@ Point<N>& Point<N>::operator-=(const Vector<double, N>& Delta) {
     此对象的字符串表达形式。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-string Point<N>::ToString() const {
-    string String = Vector<double, N>::ToString();
+template <size_t N, typename T>
+string Point<N, T>::ToString() const {
+    string String = Vector<T, N>::ToString();
     String[0] = '(';
     String[String.size() - 1] = ')';
     return String;
@@ -0,0 +1,354 @@
+/*************************************************************************
+【文件名】 Transform.hpp
+【功能模块和目的】 Transform 类定义了一个 N 维的齐次坐标变换。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef TRANSFORM_HPP
+#define TRANSFORM_HPP
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include "Point.hpp"
+#include "Vector.hpp"
+#include "../Tools/Constexpr.hpp"
+#include "../Tools/Representable.hpp"
+using namespace std;
+
+namespace C3w {
+
+/*************************************************************************
+【类名】 Transform
+【功能】 以 (N+1)×(N+1) 的齐次矩阵表示一个 N 维的变换。
+【接口说明】
+    继承于 C3w::Tools::Representable:
+        实现 ToString。
+    成员：
+        DIMENSION: 表示维数。
+        IDENTITY: 恒等变换。
+    构造与析构：
+        默认构造函数，创建恒等变换。
+        接受齐次矩阵的构造函数。
+        拷贝构造函数。
+        Translation: 创建平移变换。
+        Scaling: 创建以定点为中心的缩放变换。
+        Rotation: 创建在坐标平面内的旋转变换，三维时可绕任意轴旋转。
+        虚析构函数。
+    访问器：
+        GetElement: 获取矩阵元素。
+        SetElement: 设置矩阵元素。
+    属性：
+        IsAffine: 判断是否为仿射变换（最后一行为 0, ..., 0, 1）。
+        Determinant: 求齐次矩阵的行列式。
+        IsInvertible: 判断变换是否可逆，近似奇异的变换视为不可逆。
+    操作：
+        Compose: 复合两个变换。
+        Apply: 将变换作用于点并存为新的点。
+        ApplyInplace: 将变换作用于点。
+        ApplyAffineInplace: 将已知为仿射的变换作用于点。
+    操作符：
+        operator*: 同 Compose 或 Apply。
+        operator==/!=: 矩阵的逐元素比较。
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N>
+class Transform: public Tools::Representable {
+    public:
+        // 内嵌类型
+
+        // 齐次矩阵类型
+        using Matrix = array<array<double, N + 1>, N + 1>;
+
+        // 成员
+
+        // 变换的维度，与模板中 N 相等。
+        static constexpr size_t DIMENSION { N };
+        // 恒等变换。
+        static const Transform<N> IDENTITY;
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化恒等变换。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR Transform();
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用齐次矩阵初始化 Transform 对象。
+        【参数】
+            AMatrix: (N+1)×(N+1) 的齐次矩阵，按行存储。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR explicit Transform(const Matrix& AMatrix);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 Transform 初始化 Transform 对象。
+        【参数】
+            Other: 另一个变换。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Transform(const Transform<N>& Other) = default;
+        /**********************************************************************
+        【函数名称】 Translation
+        【函数功能】 创建平移变换。
+        【参数】
+            Delta: 移动的方向和长度。
+        【返回值】
+            平移变换。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static C3W_CONSTEXPR Transform<N> Translation(
+            const Vector<double, N>& Delta
+        );
+        /**********************************************************************
+        【函数名称】 Scaling
+        【函数功能】 创建以定点为中心的缩放变换。
+        【参数】
+            Ref: 参考点。
+            Ratio: 缩放的比例。
+        【返回值】
+            缩放变换。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static C3W_CONSTEXPR Transform<N> Scaling(
+            const Point<N>& Ref,
+            double Ratio
+        );
+        /**********************************************************************
+        【函数名称】 Rotation
+        【函数功能】 创建以原点为中心，在第 Axis1、Axis2 坐标轴张成的平面内，
+            从 Axis1 转向 Axis2 的旋转变换。
+        【参数】
+            Axis1: 第一个坐标轴的下标。
+            Axis2: 第二个坐标轴的下标。
+            Angle: 旋转的弧度。
+        【返回值】
+            旋转变换。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Transform<N> Rotation(size_t Axis1, size_t Axis2, double Angle);
+        /**********************************************************************
+        【函数名称】 Rotation
+        【函数功能】 创建绕过原点的轴按右手定则旋转的变换，仅用于三维。
+        【参数】
+            Axis: 旋转轴的方向，无需归一化。
+            Angle: 旋转的弧度。
+        【返回值】
+            旋转变换。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Transform<N> Rotation(
+            const Vector<double, N>& Axis,
+            double Angle
+        );
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 GetElement
+        【函数功能】 获取齐次矩阵中指定位置的元素。
+        【参数】
+            Row: 行下标。
+            Column: 列下标。
+        【返回值】
+            指定位置的元素。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR double GetElement(size_t Row, size_t Column) const;
+        /**********************************************************************
+        【函数名称】 SetElement
+        【函数功能】 设置齐次矩阵中指定位置的元素。
+        【参数】
+            Row: 行下标。
+            Column: 列下标。
+            Value: 新的值。
+        【返回值】 无
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR void SetElement(size_t Row, size_t Column, double Value);
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 IsAffine
+        【函数功能】 判断此变换是否为仿射变换。
+        【参数】 无
+        【返回值】
+            齐次矩阵最后一行是否为 (0, ..., 0, 1)。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR bool IsAffine() const;
+        /**********************************************************************
+        【函数名称】 Determinant
+        【函数功能】 求齐次矩阵的行列式。
+        【参数】 无
+        【返回值】
+            齐次矩阵的行列式。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        double Determinant() const;
+        /**********************************************************************
+        【函数名称】 IsInvertible
+        【函数功能】 判断此变换是否可逆。不可逆的变换可能使不同的点重合。
+            以 Hadamard 比值判断：行列式的绝对值除以各列（或各行）长度之积，
+            比值在 [0, 1] 之间，且不随任一列（或行）的缩放而改变，
+            因此 diag(1, 1, 1000) 等非均匀缩放不会被误判。
+            取按列与按行两个比值中的较大者，先旋转后缩放与先缩放后旋转
+            都能正确判断；仿射变换只考虑线性部分，其他变换考虑整个矩阵。
+            比值不超过 EPSILON，或行列式不是有限值时视为近似奇异。
+        【参数】 无
+        【返回值】
+            此变换是否可逆。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsInvertible() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Compose
+        【函数功能】 将自身与另一变换复合，结果先作用 Other，再作用自身。
+        【参数】
+            Other: 另一个变换。
+        【返回值】
+            复合后的变换。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR Transform<N> Compose(const Transform<N>& Other) const;
+        /**********************************************************************
+        【函数名称】 Compose
+        【函数功能】 复合两个变换，结果先作用 Right，再作用 Left。
+        【参数】
+            Left: 后作用的变换。
+            Right: 先作用的变换。
+        【返回值】
+            复合后的变换。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static C3W_CONSTEXPR Transform<N> Compose(
+            const Transform<N>& Left,
+            const Transform<N>& Right
+        );
+        /**********************************************************************
+        【函数名称】 Apply
+        【函数功能】 将此变换作用于点并存为新的点。
+        【参数】
+            APoint: 要变换的点，分量类型任意，以 double 计算。
+        【返回值】
+            变换后的点。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename T>
+        C3W_CONSTEXPR Point<N, T> Apply(const Point<N, T>& APoint) const;
+        /**********************************************************************
+        【函数名称】 ApplyInplace
+        【函数功能】 将此变换作用于点，直接修改该点。
+        【参数】
+            APoint: 要变换的点，分量类型任意，以 double 计算。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename T>
+        C3W_CONSTEXPR void ApplyInplace(Point<N, T>& APoint) const;
+        /**********************************************************************
+        【函数名称】 ApplyAffineInplace
+        【函数功能】 将此变换作用于点，直接修改该点。不检查是否为仿射
+            变换，也不做透视除法，供批量变换时在循环外检查一次。
+        【参数】
+            APoint: 要变换的点，分量类型任意，以 double 计算。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename T>
+        C3W_CONSTEXPR void ApplyAffineInplace(Point<N, T>& APoint) const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator*
+        【函数功能】 同 Compose。
+        【参数】
+            Other: 先作用的变换。
+        【返回值】
+            复合后的变换。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR Transform<N> operator*(const Transform<N>& Other) const;
+        /**********************************************************************
+        【函数名称】 operator*
+        【函数功能】 同 Apply。
+        【参数】
+            APoint: 要变换的点。
+        【返回值】
+            变换后的点。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename T>
+        C3W_CONSTEXPR Point<N, T> operator*(const Point<N, T>& APoint) const;
+        /**********************************************************************
+        【函数名称】 operator==
+        【函数功能】 判断两变换的矩阵是否逐元素相等。
+        【参数】
+            Other: 另一个变换。
+        【返回值】
+            两变换是否相等。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR bool operator==(const Transform<N>& Other) const;
+        /**********************************************************************
+        【函数名称】 operator!=
+        【函数功能】 判断两变换的矩阵是否不等。
+        【参数】
+            Other: 另一个变换。
+        【返回值】
+            两变换是否不等。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR bool operator!=(const Transform<N>& Other) const;
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将其他变换赋值给自身。
+        【参数】
+            Other: 从之取值的变换。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Transform<N>& operator=(const Transform<N>& Other) = default;
+
+        // 格式化
+
+        /**********************************************************************
+        【函数名称】 ToString
+        【函数功能】 返回此对象的字符串表达形式。
+        【参数】 无
+        【返回值】
+            此对象的字符串表达形式。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        string ToString() const override;
+
+        // 虚析构函数
+        virtual ~Transform() = default;
+
+    private:
+        // 齐次矩阵，按行存储
+        Matrix m_Matrix;
+};
+
+}
+
+#include "Transform.tpp"
+
+#endif
\ No newline at end of file
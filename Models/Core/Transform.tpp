@@ -0,0 +1,534 @@
+/*************************************************************************
+【文件名】 Transform.tpp
+【功能模块和目的】 为 Transform.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <utility>
+#include "Point.hpp"
+#include "Transform.hpp"
+#include "Vector.hpp"
+#include "../Errors/IndexOverflowException.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+// 恒等变换。
+template <size_t N>
+C3W_CONSTEXPR const Transform<N> Transform<N>::IDENTITY { Transform<N>() };
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化恒等变换。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR Transform<N>::Transform() {
+    for (size_t i = 0; i <= N; i++) {
+        m_Matrix[i].fill(0);
+        m_Matrix[i][i] = 1;
+    }
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用齐次矩阵初始化 Transform 对象。
+【参数】
+    AMatrix: (N+1)×(N+1) 的齐次矩阵，按行存储。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR Transform<N>::Transform(
+    const Matrix& AMatrix
+): m_Matrix(AMatrix) {}
+
+/**********************************************************************
+【函数名称】 Translation
+【函数功能】 创建平移变换。
+【参数】
+    Delta: 移动的方向和长度。
+【返回值】
+    平移变换。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR Transform<N> Transform<N>::Translation(
+    const Vector<double, N>& Delta
+) {
+    Transform<N> Result;
+    for (size_t i = 0; i < N; i++) {
+        Result.m_Matrix[i][N] = Delta[i];
+    }
+    return Result;
+}
+
+/**********************************************************************
+【函数名称】 Scaling
+【函数功能】 创建以定点为中心的缩放变换。
+【参数】
+    Ref: 参考点。
+    Ratio: 缩放的比例。
+【返回值】
+    缩放变换。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR Transform<N> Transform<N>::Scaling(
+    const Point<N>& Ref,
+    double Ratio
+) {
+    // p' = Ref + (p - Ref) * Ratio = Ratio * p + (1 - Ratio) * Ref
+    Transform<N> Result;
+    for (size_t i = 0; i < N; i++) {
+        Result.m_Matrix[i][i] = Ratio;
+        Result.m_Matrix[i][N] = (1 - Ratio) * Ref[i];
+    }
+    return Result;
+}
+
+/**********************************************************************
+【函数名称】 Rotation
+【函数功能】 创建以原点为中心，在第 Axis1、Axis2 坐标轴张成的平面内，
+    从 Axis1 转向 Axis2 的旋转变换。
+【参数】
+    Axis1: 第一个坐标轴的下标。
+    Axis2: 第二个坐标轴的下标。
+    Angle: 旋转的弧度。
+【返回值】
+    旋转变换。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+Transform<N> Transform<N>::Rotation(size_t Axis1, size_t Axis2, double Angle) {
+    if (Axis1 >= N) {
+        throw IndexOverflowException(Axis1, N);
+    }
+    if (Axis2 >= N) {
+        throw IndexOverflowException(Axis2, N);
+    }
+    Transform<N> Result;
+    if (Axis1 == Axis2) {
+        return Result;
+    }
+    double rCos = cos(Angle);
+    double rSin = sin(Angle);
+    Result.m_Matrix[Axis1][Axis1] = rCos;
+    Result.m_Matrix[Axis1][Axis2] = -rSin;
+    Result.m_Matrix[Axis2][Axis1] = rSin;
+    Result.m_Matrix[Axis2][Axis2] = rCos;
+    return Result;
+}
+
+/**********************************************************************
+【函数名称】 Rotation
+【函数功能】 创建绕过原点的轴按右手定则旋转的变换，仅用于三维。
+【参数】
+    Axis: 旋转轴的方向，无需归一化。
+    Angle: 旋转的弧度。
+【返回值】
+    旋转变换。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+Transform<N> Transform<N>::Rotation(
+    const Vector<double, N>& Axis,
+    double Angle
+) {
+    static_assert(N == 3, "Axis rotation is only defined in 3 dimensions.");
+    Transform<N> Result;
+    double rModule = Axis.Module();
+    if (rModule == 0) {
+        return Result;
+    }
+    // Rodrigues 旋转公式：R = cI + s[k]x + (1 - c)kk^T
+    double rX = Axis[0] / rModule;
+    double rY = Axis[1] / rModule;
+    double rZ = Axis[2] / rModule;
+    double rCos = cos(Angle);
+    double rSin = sin(Angle);
+    double rVersine = 1 - rCos;
+    Result.m_Matrix[0][0] = rVersine * rX * rX + rCos;
+    Result.m_Matrix[0][1] = rVersine * rX * rY - rSin * rZ;
+    Result.m_Matrix[0][2] = rVersine * rX * rZ + rSin * rY;
+    Result.m_Matrix[1][0] = rVersine * rX * rY + rSin * rZ;
+    Result.m_Matrix[1][1] = rVersine * rY * rY + rCos;
+    Result.m_Matrix[1][2] = rVersine * rY * rZ - rSin * rX;
+    Result.m_Matrix[2][0] = rVersine * rX * rZ - rSin * rY;
+    Result.m_Matrix[2][1] = rVersine * rY * rZ + rSin * rX;
+    Result.m_Matrix[2][2] = rVersine * rZ * rZ + rCos;
+    return Result;
+}
+
+/**********************************************************************
+【函数名称】 GetElement
+【函数功能】 获取齐次矩阵中指定位置的元素。
+【参数】
+    Row: 行下标。
+    Column: 列下标。
+【返回值】
+    指定位置的元素。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR double Transform<N>::GetElement(size_t Row, size_t Column) const {
+    if (Row > N) {
+        throw IndexOverflowException(Row, N + 1);
+    }
+    if (Column > N) {
+        throw IndexOverflowException(Column, N + 1);
+    }
+    return m_Matrix[Row][Column];
+}
+
+/**********************************************************************
+【函数名称】 SetElement
+【函数功能】 设置齐次矩阵中指定位置的元素。
+【参数】
+    Row: 行下标。
+    Column: 列下标。
+    Value: 新的值。
+【返回值】 无
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR void Transform<N>::SetElement(
+    size_t Row,
+    size_t Column,
+    double Value
+) {
+    if (Row > N) {
+        throw IndexOverflowException(Row, N + 1);
+    }
+    if (Column > N) {
+        throw IndexOverflowException(Column, N + 1);
+    }
+    m_Matrix[Row][Column] = Value;
+}
+
+/**********************************************************************
+【函数名称】 IsAffine
+【函数功能】 判断此变换是否为仿射变换。
+【参数】 无
+【返回值】
+    齐次矩阵最后一行是否为 (0, ..., 0, 1)。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR bool Transform<N>::IsAffine() const {
+    for (size_t j = 0; j < N; j++) {
+        if (m_Matrix[N][j] != 0) {
+            return false;
+        }
+    }
+    return m_Matrix[N][N] == 1;
+}
+
+/**********************************************************************
+【函数名称】 Determinant
+【函数功能】 求齐次矩阵的行列式。
+【参数】 无
+【返回值】
+    齐次矩阵的行列式。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+double Transform<N>::Determinant() const {
+    // 列主元高斯消元
+    Matrix Work = m_Matrix;
+    double rDeterminant = 1;
+    for (size_t k = 0; k <= N; k++) {
+        size_t ullPivot = k;
+        for (size_t i = k + 1; i <= N; i++) {
+            if (fabs(Work[i][k]) > fabs(Work[ullPivot][k])) {
+                ullPivot = i;
+            }
+        }
+        if (Work[ullPivot][k] == 0) {
+            return 0;
+        }
+        if (ullPivot != k) {
+            swap(Work[ullPivot], Work[k]);
+            rDeterminant = -rDeterminant;
+        }
+        rDeterminant *= Work[k][k];
+        for (size_t i = k + 1; i <= N; i++) {
+            double rFactor = Work[i][k] / Work[k][k];
+            for (size_t j = k; j <= N; j++) {
+                Work[i][j] -= rFactor * Work[k][j];
+            }
+        }
+    }
+    return rDeterminant;
+}
+
+/**********************************************************************
+【函数名称】 IsInvertible
+【函数功能】 判断此变换是否可逆。不可逆的变换可能使不同的点重合。
+    以 Hadamard 比值判断：行列式的绝对值除以各列（或各行）长度之积，
+    比值在 [0, 1] 之间，且不随任一列（或行）的缩放而改变，
+    因此 diag(1, 1, 1000) 等非均匀缩放不会被误判。
+    取按列与按行两个比值中的较大者，先旋转后缩放与先缩放后旋转
+    都能正确判断；仿射变换只考虑线性部分，其他变换考虑整个矩阵。
+    比值不超过 EPSILON，或行列式不是有限值时视为近似奇异。
+【参数】 无
+【返回值】
+    此变换是否可逆。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+bool Transform<N>::IsInvertible() const {
+    // 仿射变换最后一行为 (0, ..., 0, 1)，齐次矩阵与线性部分的行列式相等
+    double rDeterminant = fabs(Determinant());
+    if (!isfinite(rDeterminant) || rDeterminant == 0) {
+        return false;
+    }
+    // 仿射变换的平移部分不影响行列式，不计入各列与各行的长度
+    size_t ullSize = IsAffine() ? N : N + 1;
+    double rColumnProduct = 1;
+    double rRowProduct = 1;
+    for (size_t i = 0; i < ullSize; i++) {
+        double rColumnSquare = 0;
+        double rRowSquare = 0;
+        for (size_t j = 0; j < ullSize; j++) {
+            rColumnSquare += m_Matrix[j][i] * m_Matrix[j][i];
+            rRowSquare += m_Matrix[i][j] * m_Matrix[i][j];
+        }
+        rColumnProduct *= sqrt(rColumnSquare);
+        rRowProduct *= sqrt(rRowSquare);
+    }
+    // 行列式非 0 时各列与各行的长度都不为 0
+    double rRatio = max(
+        rDeterminant / rColumnProduct,
+        rDeterminant / rRowProduct
+    );
+    return rRatio > Vector<double, N>::EPSILON;
+}
+
+/**********************************************************************
+【函数名称】 Compose
+【函数功能】 将自身与另一变换复合，结果先作用 Other，再作用自身。
+【参数】
+    Other: 另一个变换。
+【返回值】
+    复合后的变换。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR Transform<N> Transform<N>::Compose(
+    const Transform<N>& Other
+) const {
+    return Compose(*this, Other);
+}
+
+/**********************************************************************
+【函数名称】 Compose
+【函数功能】 复合两个变换，结果先作用 Right，再作用 Left。
+【参数】
+    Left: 后作用的变换。
+    Right: 先作用的变换。
+【返回值】
+    复合后的变换。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR Transform<N> Transform<N>::Compose(
+    const Transform<N>& Left,
+    const Transform<N>& Right
+) {
+    Matrix Product;
+    for (size_t i = 0; i <= N; i++) {
+        for (size_t j = 0; j <= N; j++) {
+            double rSum = 0;
+            for (size_t k = 0; k <= N; k++) {
+                rSum += Left.m_Matrix[i][k] * Right.m_Matrix[k][j];
+            }
+            Product[i][j] = rSum;
+        }
+    }
+    return Transform<N>(Product);
+}
+
+/**********************************************************************
+【函数名称】 Apply
+【函数功能】 将此变换作用于点并存为新的点。
+【参数】
+    APoint: 要变换的点，分量类型任意，以 double 计算。
+【返回值】
+    变换后的点。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename T>
+C3W_CONSTEXPR Point<N, T> Transform<N>::Apply(
+    const Point<N, T>& APoint
+) const {
+    Point<N, T> Result(APoint);
+    ApplyInplace(Result);
+    return Result;
+}
+
+/**********************************************************************
+【函数名称】 ApplyInplace
+【函数功能】 将此变换作用于点，直接修改该点。
+【参数】
+    APoint: 要变换的点，分量类型任意，以 double 计算。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename T>
+C3W_CONSTEXPR void Transform<N>::ApplyInplace(Point<N, T>& APoint) const {
+    // 仿射变换的齐次分量恒为 1，无需透视除法
+    if (IsAffine()) {
+        ApplyAffineInplace(APoint);
+        return;
+    }
+    // 先复制分量，使循环的次数与下标在编译期确定，便于编译器向量化
+    array<double, N> Source;
+    for (size_t j = 0; j < N; j++) {
+        Source[j] = APoint[j];
+    }
+    double rW = m_Matrix[N][N];
+    for (size_t j = 0; j < N; j++) {
+        rW += m_Matrix[N][j] * Source[j];
+    }
+    // 以 double 计算后再转换为点的分量类型
+    for (size_t i = 0; i < N; i++) {
+        double rSum = m_Matrix[i][N];
+        for (size_t j = 0; j < N; j++) {
+            rSum += m_Matrix[i][j] * Source[j];
+        }
+        APoint.GetComponentUnchecked(i) = static_cast<T>(rSum / rW);
+    }
+}
+
+/**********************************************************************
+【函数名称】 ApplyAffineInplace
+【函数功能】 将此变换作用于点，直接修改该点。不检查是否为仿射
+    变换，也不做透视除法，供批量变换时在循环外检查一次。
+【参数】
+    APoint: 要变换的点，分量类型任意，以 double 计算。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename T>
+C3W_CONSTEXPR void Transform<N>::ApplyAffineInplace(
+    Point<N, T>& APoint
+) const {
+    // 先复制分量，使循环的次数与下标在编译期确定，便于编译器向量化
+    array<double, N> Source;
+    for (size_t j = 0; j < N; j++) {
+        Source[j] = APoint[j];
+    }
+    // 以 double 计算后再转换为点的分量类型
+    for (size_t i = 0; i < N; i++) {
+        double rSum = m_Matrix[i][N];
+        for (size_t j = 0; j < N; j++) {
+            rSum += m_Matrix[i][j] * Source[j];
+        }
+        APoint.GetComponentUnchecked(i) = static_cast<T>(rSum);
+    }
+}
+
+/**********************************************************************
+【函数名称】 operator*
+【函数功能】 同 Compose。
+【参数】
+    Other: 先作用的变换。
+【返回值】
+    复合后的变换。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR Transform<N> Transform<N>::operator*(
+    const Transform<N>& Other
+) const {
+    return Compose(Other);
+}
+
+/**********************************************************************
+【函数名称】 operator*
+【函数功能】 同 Apply。
+【参数】
+    APoint: 要变换的点。
+【返回值】
+    变换后的点。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename T>
+C3W_CONSTEXPR Point<N, T> Transform<N>::operator*(
+    const Point<N, T>& APoint
+) const {
+    return Apply(APoint);
+}
+
+/**********************************************************************
+【函数名称】 operator==
+【函数功能】 判断两变换的矩阵是否逐元素相等。
+【参数】
+    Other: 另一个变换。
+【返回值】
+    两变换是否相等。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR bool Transform<N>::operator==(const Transform<N>& Other) const {
+    return m_Matrix == Other.m_Matrix;
+}
+
+/**********************************************************************
+【函数名称】 operator!=
+【函数功能】 判断两变换的矩阵是否不等。
+【参数】
+    Other: 另一个变换。
+【返回值】
+    两变换是否不等。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+C3W_CONSTEXPR bool Transform<N>::operator!=(const Transform<N>& Other) const {
+    return m_Matrix != Other.m_Matrix;
+}
+
+/**********************************************************************
+【函数名称】 ToString
+【函数功能】 返回此对象的字符串表达形式。
+【参数】 无
+【返回值】
+    此对象的字符串表达形式。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+string Transform<N>::ToString() const {
+    ostringstream Stream;
+    Stream << "[";
+    for (size_t i = 0; i <= N; i++) {
+        Stream << "[";
+        for (size_t j = 0; j < N; j++) {
+            Stream << m_Matrix[i][j] << ", ";
+        }
+        Stream << m_Matrix[i][N] << "]";
+        if (i < N) {
+            Stream << ", ";
+        }
+    }
+    Stream << "]";
+    return Stream.str();
+}
+
+}
\ No newline at end of file
@@ -12,7 +12,10 @@
 #include <initializer_list>
 #include <iostream>
 #include <string>
+#include "Expression.hpp"
+#include "../Tools/Constexpr.hpp"
 #include "../Tools/Representable.hpp"
+#include "../Tools/Unroll.hpp"
 using namespace std;
 
 namespace C3w { 
@@ -36,6 +39,7 @@ namespace C3w {
         虚析构函数。
     访问器：
         GetComponent: 返回分量常/可变引用。
+        GetComponentUnchecked: 不检查下标，返回分量常/可变引用。
         SetComponent: 设置分量。
         SetAllComponents: 设置所有分量。
     属性：
@@ -51,12 +55,15 @@ namespace C3w {
         InnerProduct: 向量内积。
     操作符：
         operator[]: 同 GetComponent。
-        operator- (unary): 同 Negate。
-        operator+(=): 同 Add(Inplace)。
-        operator-(=): 同 Subtract(Inplace)。
-        operator*(=): 同 Multiply(Inplace)。
+        operator+=: 同 AddInplace。
+        operator-=: 同 SubtractInplace。
+        operator*=: 同 MultiplyInplace。
         operator==/!=: 同 IsEqual 的编码比较。
         operator=: 默认赋值运算符。 
+    表达式运算符（见 Expression.hpp）：
+        operator- (unary)、operator+、operator-、与标量的 operator*
+        返回延迟求值的 Expression，可隐式转换为 Vector。
+        两向量间的 operator* 求内积。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 template <typename T, size_t N>
@@ -68,7 +75,8 @@ class Vector: public Tools::Representable {
         // 向量的维度，与模板中 N 相等。
         static constexpr size_t DIMENSION { N };
         // 用作浮点数比较的范围
-        // 由于 T 可能没有 constexpr 构造，不使用 constexpr
+        // 由于 T 可能没有 constexpr 构造，类内不使用 constexpr，
+        // C++20 及以上在类外以 constexpr 定义
         static const T EPSILON;
         // 零向量。
         static const Vector<T, N> ZERO;
@@ -82,7 +90,7 @@ class Vector: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector();
+        C3W_CONSTEXPR Vector();
         /**********************************************************************
         【函数名称】 构造函数
         【函数功能】 初始化分量全部为 "Filler" 的 Vector 对象。
@@ -91,7 +99,7 @@ class Vector: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector(T Filler);
+        C3W_CONSTEXPR Vector(T Filler);
         /**********************************************************************
         【函数名称】 构造函数
         【函数功能】 使用初始化列表初始化 Vector 对象。
@@ -100,7 +108,7 @@ class Vector: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector(initializer_list<T> Components);
+        C3W_CONSTEXPR Vector(initializer_list<T> Components);
         /**********************************************************************
         【函数名称】 构造函数
         【函数功能】 使用分量数组初始化 Vector 对象。
@@ -109,7 +117,7 @@ class Vector: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        explicit Vector(const array<T, N>& Components);
+        C3W_CONSTEXPR explicit Vector(const array<T, N>& Components);
         /**********************************************************************
         【函数名称】 拷贝构造函数
         【函数功能】 使用另一 Vector 初始化 Vector 对象。
@@ -132,7 +140,7 @@ class Vector: public Tools::Representable {
             如果下标越界，抛出 IndexOverflowException。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        const T& GetComponent(size_t Index) const;
+        C3W_CONSTEXPR const T& GetComponent(size_t Index) const;
         /**********************************************************************
         【函数名称】 GetComponent
         【函数功能】 返回指定下标处的分量。
@@ -143,7 +151,29 @@ class Vector: public Tools::Representable {
             如果下标越界，抛出 IndexOverflowException。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        T& GetComponent(size_t Index);
+        C3W_CONSTEXPR T& GetComponent(size_t Index);
+        /**********************************************************************
+        【函数名称】 GetComponentUnchecked
+        【函数功能】 返回指定下标处的分量，不检查下标。
+            仅用于下标已知小于 N 的内部循环。
+        【参数】 
+            Index: 要获取分量的下标，必须小于 N。
+        【返回值】 
+            对指定下标处的分量的常引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR const T& GetComponentUnchecked(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetComponentUnchecked
+        【函数功能】 返回指定下标处的分量，不检查下标。
+            仅用于下标已知小于 N 的内部循环。
+        【参数】 
+            Index: 要获取分量的下标，必须小于 N。
+        【返回值】 
+            对指定下标处的分量的可变引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        C3W_CONSTEXPR T& GetComponentUnchecked(size_t Index);
         /**********************************************************************
         【函数名称】 SetComponent
         【函数功能】 设置指定下标处的分量。
@@ -155,7 +185,7 @@ class Vector: public Tools::Representable {
             如果下标越界，抛出 IndexOverflowException。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void SetComponent(size_t Index, const T& Value);
+        C3W_CONSTEXPR void SetComponent(size_t Index, const T& Value);
         /**********************************************************************
         【函数名称】 SetAllComponents
         【函数功能】 使用数组设置所有分量。
@@ -164,7 +194,7 @@ class Vector: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void SetAllComponents(const array<T, N>& Components);
+        C3W_CONSTEXPR void SetAllComponents(const array<T, N>& Components);
 
         // 属性
 
@@ -189,7 +219,10 @@ class Vector: public Tools::Representable {
             自身和指定向量是否相等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool IsEqual(const Vector<T, N>& Other, bool Exact = true) const;
+        C3W_CONSTEXPR bool IsEqual(
+            const Vector<T, N>& Other,
+            bool Exact = true
+        ) const;
         /**********************************************************************
         【函数名称】 IsEqual
         【函数功能】 判断两个向量是否相等。
@@ -201,7 +234,7 @@ class Vector: public Tools::Representable {
             两个向量是否相等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static bool IsEqual(
+        static C3W_CONSTEXPR bool IsEqual(
             const Vector<T, N>& Left, 
             const Vector<T, N>& Right,
             bool Exact = true
@@ -215,7 +248,7 @@ class Vector: public Tools::Representable {
             自身和指定向量是否平行。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool IsParallel(const Vector<T, N>& Other) const;
+        C3W_CONSTEXPR bool IsParallel(const Vector<T, N>& Other) const;
         /**********************************************************************
         【函数名称】 IsParallel
         【函数功能】 判断两个向量是否平行。
@@ -226,7 +259,7 @@ class Vector: public Tools::Representable {
             两个向量是否平行。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static bool IsParallel(
+        static C3W_CONSTEXPR bool IsParallel(
             const Vector<T, N>& Left, 
             const Vector<T, N>& Right
         );
@@ -239,7 +272,7 @@ class Vector: public Tools::Representable {
             自身和指定向量是否垂直。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool IsPerpendicular(const Vector<T, N>& Other) const;
+        C3W_CONSTEXPR bool IsPerpendicular(const Vector<T, N>& Other) const;
         /**********************************************************************
         【函数名称】 IsPerpendicular
         【函数功能】 判断两个向量是否垂直。
@@ -250,7 +283,7 @@ class Vector: public Tools::Representable {
             两个向量是否垂直。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static bool IsPerpendicular(
+        static C3W_CONSTEXPR bool IsPerpendicular(
             const Vector<T, N>& Left,
             const Vector<T, N>& Right
         );
@@ -261,7 +294,7 @@ class Vector: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void NegateInplace();
+        C3W_CONSTEXPR void NegateInplace();
         /**********************************************************************
         【函数名称】 Negate
         【函数功能】 反转此向量并存为新的向量。
@@ -270,7 +303,7 @@ class Vector: public Tools::Representable {
             反转后的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector<T, N> Negate() const;
+        C3W_CONSTEXPR Vector<T, N> Negate() const;
         /**********************************************************************
         【函数名称】 Negate
         【函数功能】 反转给定向量并存为新的向量。
@@ -280,7 +313,7 @@ class Vector: public Tools::Representable {
             反转后的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Vector<T, N> Negate(const Vector<T, N>& AVector);
+        static C3W_CONSTEXPR Vector<T, N> Negate(const Vector<T, N>& AVector);
         /**********************************************************************
         【函数名称】 AddInplace
         【函数功能】 将自身加以另一个向量。
@@ -289,7 +322,7 @@ class Vector: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void AddInplace(const Vector<T, N>& Other);
+        C3W_CONSTEXPR void AddInplace(const Vector<T, N>& Other);
         /**********************************************************************
         【函数名称】 Add
         【函数功能】 将自身与另一向量相加并存储为新的向量。
@@ -299,7 +332,7 @@ class Vector: public Tools::Representable {
             两向量相加形成的新的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector<T, N> Add(const Vector<T, N>& Other) const;
+        C3W_CONSTEXPR Vector<T, N> Add(const Vector<T, N>& Other) const;
         /**********************************************************************
         【函数名称】 Add
         【函数功能】 将两个向量相加并存储为新的向量。
@@ -310,7 +343,7 @@ class Vector: public Tools::Representable {
             两向量相加形成的新的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Vector<T, N> Add(
+        static C3W_CONSTEXPR Vector<T, N> Add(
             const Vector<T, N>& Left, 
             const Vector<T, N>& Right
         );
@@ -322,7 +355,7 @@ class Vector: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void SubtractInplace(const Vector<T, N>& Other);
+        C3W_CONSTEXPR void SubtractInplace(const Vector<T, N>& Other);
         /**********************************************************************
         【函数名称】 Subtract
         【函数功能】 将自身与另一向量相减并存储为新的向量。
@@ -332,7 +365,7 @@ class Vector: public Tools::Representable {
             两向量相减形成的新的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector<T, N> Subtract(const Vector<T, N>& Other) const;
+        C3W_CONSTEXPR Vector<T, N> Subtract(const Vector<T, N>& Other) const;
         /**********************************************************************
         【函数名称】 Subtract
         【函数功能】 将两个向量相减并存储为新的向量。
@@ -343,7 +376,7 @@ class Vector: public Tools::Representable {
             两向量相减形成的新的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Vector<T, N> Subtract(
+        static C3W_CONSTEXPR Vector<T, N> Subtract(
             const Vector<T, N>& Left, 
             const Vector<T, N>& Right
         );
@@ -355,7 +388,7 @@ class Vector: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void MultiplyInplace(T Factor);
+        C3W_CONSTEXPR void MultiplyInplace(T Factor);
         /**********************************************************************
         【函数名称】 Multiply
         【函数功能】 将自身与标量数乘。
@@ -365,7 +398,7 @@ class Vector: public Tools::Representable {
             数乘形成的新的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector<T, N> Multiply(T Factor) const;
+        C3W_CONSTEXPR Vector<T, N> Multiply(T Factor) const;
         /**********************************************************************
         【函数名称】 Multiply
         【函数功能】 将向量与标量数乘。
@@ -376,7 +409,10 @@ class Vector: public Tools::Representable {
             数乘形成的新的向量。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static Vector<T, N> Multiply(const Vector<T, N> AVector, T Factor);
+        static C3W_CONSTEXPR Vector<T, N> Multiply(
+            const Vector<T, N> AVector,
+            T Factor
+        );
         /**********************************************************************
         【函数名称】 InnerProduct
         【函数功能】 将自身和另一向量做内积。
@@ -385,7 +421,7 @@ class Vector: public Tools::Representable {
         【返回值】 与另一向量的内积。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        T InnerProduct(const Vector<T, N>& Other);
+        C3W_CONSTEXPR T InnerProduct(const Vector<T, N>& Other);
         /**********************************************************************
         【函数名称】 InnerProduct
         【函数功能】 将两个向量做内积。
@@ -396,7 +432,7 @@ class Vector: public Tools::Representable {
             两向量的内积。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static T InnerProduct(
+        static C3W_CONSTEXPR T InnerProduct(
             const Vector<T, N>& Left, 
             const Vector<T, N>& Right
         );
@@ -412,7 +448,7 @@ class Vector: public Tools::Representable {
             分量的常引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        const T& operator[](size_t Index) const;
+        C3W_CONSTEXPR const T& operator[](size_t Index) const;
         /**********************************************************************
         【函数名称】 operator[]
         【函数功能】 通过下标访问分量。
@@ -422,64 +458,27 @@ class Vector: public Tools::Representable {
             分量的可变引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        T& operator[](size_t Index);
-        /**********************************************************************
-        【函数名称】 operator-
-        【函数功能】 反转此向量并存为新的向量。
-        【参数】 无
-        【返回值】 
-            反转后的向量。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        Vector<T, N> operator-() const;
-        /**********************************************************************
-        【函数名称】 operator+
-        【函数功能】 将自身与另一个向量的和存储为新的向量。
-        【参数】 
-            Other: 另一个向量。
-        【返回值】
-            自身与另一向量相加形成的新的向量。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        Vector<T, N> operator+(const Vector<T, N>& Other) const;
+        C3W_CONSTEXPR T& operator[](size_t Index);
         /**********************************************************************
         【函数名称】 operator+=
         【函数功能】 将自身加以另一个向量。
         【参数】 
             Other: 另一个向量。
-        【返回值】 无
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        Vector<T, N>& operator+=(const Vector<T, N>& Other);
-        /**********************************************************************
-        【函数名称】 operator-
-        【函数功能】 将自身与另一个向量的差存储为新的向量。
-        【参数】 
-            Other: 另一个向量。
-        【返回值】
-            自身与另一向量相减形成的新的向量。
+        【返回值】 
+            自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector<T, N> operator-(const Vector<T, N>& Other) const;
+        C3W_CONSTEXPR Vector<T, N>& operator+=(const Vector<T, N>& Other);
         /**********************************************************************
         【函数名称】 operator-=
         【函数功能】 将自身减去另一个向量。
         【参数】 
             Other: 另一个向量。
-        【返回值】 无
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        Vector<T, N>& operator-=(const Vector<T, N>& Other);
-        /**********************************************************************
-        【函数名称】 operator*
-        【函数功能】 将自身做数乘。
-        【参数】 
-            Factor: 要数乘的标量。
         【返回值】 
-            数乘得到的新的向量。
+            自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector<T, N> operator*(T Factor) const;
+        C3W_CONSTEXPR Vector<T, N>& operator-=(const Vector<T, N>& Other);
         /**********************************************************************
         【函数名称】 operator*=
         【函数功能】 将自身做数乘。
@@ -489,29 +488,7 @@ class Vector: public Tools::Representable {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Vector<T, N>& operator*=(T Factor);
-        /**********************************************************************
-        【函数名称】 operator*
-        【函数功能】 将自身和另一向量做内积。
-        【参数】 
-            Other: 另一个向量。
-        【返回值】 与另一向量的内积。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        T operator*(const Vector<T, N>& Other) const;
-        // 将所有模板实现声明为友元
-        /**********************************************************************
-        【函数名称】 operator*
-        【函数功能】 将向量与标量数乘。
-        【参数】 
-            AVector: 要数乘的向量。
-            Factor: 要数乘的标量。
-        【返回值】 
-            数乘形成的新的向量。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        template <typename U, size_t M>
-        friend Vector<U, M> operator*(U Factor, const Vector<U, M>& AVector);
+        C3W_CONSTEXPR Vector<T, N>& operator*=(T Factor);
         /**********************************************************************
         【函数名称】 operator==
         【函数功能】 判断自身是否和指定的向量相等。
@@ -521,7 +498,7 @@ class Vector: public Tools::Representable {
             自身和指定向量是否相等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool operator==(const Vector<T, N>& Other) const;
+        C3W_CONSTEXPR bool operator==(const Vector<T, N>& Other) const;
         /**********************************************************************
         【函数名称】 operator!=
         【函数功能】 判断自身是否和指定的向量不等。
@@ -531,7 +508,7 @@ class Vector: public Tools::Representable {
             自身和指定向量是否不等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool operator!=(const Vector<T, N>& Other) const;
+        C3W_CONSTEXPR bool operator!=(const Vector<T, N>& Other) const;
         /**********************************************************************
         【函数名称】 operator=
         【函数功能】 将其他向量赋值给自身。
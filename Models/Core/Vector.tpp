@@ -15,6 +15,7 @@
 #include <type_traits>
 #include "../Errors/IndexOverflowException.hpp"
 #include "../Errors/InvalidSizeException.hpp"
+#include "../Tools/Unroll.hpp"
 #include "Vector.hpp"
 using namespace std;
 using namespace C3w::Errors;
@@ -23,11 +24,13 @@ namespace C3w {
 
 // 浮点数比较的范围
 template <typename T, size_t N>
-const T Vector<T, N>::EPSILON { is_floating_point<T>::value ? 1e-6 : 0 };
+C3W_CONSTEXPR const T Vector<T, N>::EPSILON {
+    is_floating_point<T>::value ? 1e-6 : 0
+};
 
 // 零向量。
 template <typename T, size_t N>
-const Vector<T, N> Vector<T, N>::ZERO { Vector<T, N>() };
+C3W_CONSTEXPR const Vector<T, N> Vector<T, N>::ZERO { Vector<T, N>() };
 
 /**********************************************************************
 【函数名称】 构造函数
@@ -37,7 +40,7 @@ const Vector<T, N> Vector<T, N>::ZERO { Vector<T, N>() };
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N>::Vector(): Vector(0) {}
+C3W_CONSTEXPR Vector<T, N>::Vector(): Vector(0) {}
 
 /**********************************************************************
 【函数名称】 构造函数
@@ -48,7 +51,7 @@ Vector<T, N>::Vector(): Vector(0) {}
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N>::Vector(T Filler) {
+C3W_CONSTEXPR Vector<T, N>::Vector(T Filler) {
     m_Components.fill(Filler);
 }
 
@@ -61,7 +64,7 @@ Vector<T, N>::Vector(T Filler) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N>::Vector(initializer_list<T> Components) {
+C3W_CONSTEXPR Vector<T, N>::Vector(initializer_list<T> Components) {
     if (Components.size() != N) {
         throw InvalidSizeException(Components.size(), N);
     }
@@ -77,7 +80,7 @@ Vector<T, N>::Vector(initializer_list<T> Components) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N>::Vector(const array<T, N>& Components)
+C3W_CONSTEXPR Vector<T, N>::Vector(const array<T, N>& Components)
     : m_Components(Components) {}
 
 /**********************************************************************
@@ -91,7 +94,7 @@ Vector<T, N>::Vector(const array<T, N>& Components)
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-const T& Vector<T, N>::GetComponent(size_t Index) const {
+C3W_CONSTEXPR const T& Vector<T, N>::GetComponent(size_t Index) const {
     if (Index >= N) {
         throw IndexOverflowException(Index, N);
     }
@@ -109,13 +112,45 @@ const T& Vector<T, N>::GetComponent(size_t Index) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-T& Vector<T, N>::GetComponent(size_t Index) {
+C3W_CONSTEXPR T& Vector<T, N>::GetComponent(size_t Index) {
     if (Index >= N) {
         throw IndexOverflowException(Index, N);
     }
     return m_Components[Index];
 }
 
+/**********************************************************************
+【函数名称】 GetComponentUnchecked
+【函数功能】 返回指定下标处的分量，不检查下标。
+    仅用于下标已知小于 N 的内部循环。
+【参数】 
+    Index: 要获取分量的下标，必须小于 N。
+【返回值】 
+    对指定下标处的分量的常引用。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T, size_t N>
+C3W_CONSTEXPR inline const T& Vector<T, N>::GetComponentUnchecked(
+    size_t Index
+) const {
+    return m_Components[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetComponentUnchecked
+【函数功能】 返回指定下标处的分量，不检查下标。
+    仅用于下标已知小于 N 的内部循环。
+【参数】 
+    Index: 要获取分量的下标，必须小于 N。
+【返回值】 
+    对指定下标处的分量的可变引用。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T, size_t N>
+C3W_CONSTEXPR inline T& Vector<T, N>::GetComponentUnchecked(size_t Index) {
+    return m_Components[Index];
+}
+
 /**********************************************************************
 【函数名称】 SetComponent
 【函数功能】 设置指定下标处的分量。
@@ -126,7 +161,7 @@ T& Vector<T, N>::GetComponent(size_t Index) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-void Vector<T, N>::SetComponent(size_t Index, const T& Value) {
+C3W_CONSTEXPR void Vector<T, N>::SetComponent(size_t Index, const T& Value) {
     if (Index >= N) {
         throw IndexOverflowException(Index, N);
     }
@@ -142,7 +177,9 @@ void Vector<T, N>::SetComponent(size_t Index, const T& Value) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-void Vector<T, N>::SetAllComponents(const array<T, N>& Components) {
+C3W_CONSTEXPR void Vector<T, N>::SetAllComponents(
+    const array<T, N>& Components
+) {
     m_Components = Components;
 }
 
@@ -156,9 +193,9 @@ void Vector<T, N>::SetAllComponents(const array<T, N>& Components) {
 template <typename T, size_t N>
 T Vector<T, N>::Module() const {
     T SquareSum = 0;
-    for (size_t i = 0; i < N; i++) {
-        SquareSum += pow(m_Components[i], 2);
-    }
+    Tools::Unroll<N>::For([this, &SquareSum](size_t i) {
+        SquareSum += m_Components[i] * m_Components[i];
+    });
     return sqrt(SquareSum);
 }
 
@@ -172,7 +209,10 @@ T Vector<T, N>::Module() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-bool Vector<T, N>::IsEqual(const Vector<T, N>& Other, bool Exact) const {
+C3W_CONSTEXPR bool Vector<T, N>::IsEqual(
+    const Vector<T, N>& Other,
+    bool Exact
+) const {
     return IsEqual(*this, Other, Exact);
 }
 
@@ -187,7 +227,7 @@ bool Vector<T, N>::IsEqual(const Vector<T, N>& Other, bool Exact) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-bool Vector<T, N>::IsEqual(
+C3W_CONSTEXPR bool Vector<T, N>::IsEqual(
     const Vector<T, N>& Left, 
     const Vector<T, N>& Right,
     bool Exact
@@ -196,12 +236,11 @@ bool Vector<T, N>::IsEqual(
         return Left.m_Components == Right.m_Components;
     }
     else {
-        for (size_t i = 0; i < N; i++) {
-            if (fabs(Left[i] - Right[i]) > EPSILON) {
-                return false;
-            }
-        }
-        return true;
+        // fabs 在 C++23 之前不是 constexpr，改为比较两侧
+        return Tools::Unroll<N>::All([&Left, &Right](size_t i) {
+            T Difference = Left.m_Components[i] - Right.m_Components[i];
+            return -EPSILON <= Difference && Difference <= EPSILON;
+        });
     }
 }
 
@@ -215,7 +254,7 @@ bool Vector<T, N>::IsEqual(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-bool Vector<T, N>::IsParallel(const Vector<T, N>& Other) const {
+C3W_CONSTEXPR bool Vector<T, N>::IsParallel(const Vector<T, N>& Other) const {
     return IsParallel(*this, Other);
 }
 
@@ -230,7 +269,7 @@ bool Vector<T, N>::IsParallel(const Vector<T, N>& Other) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-bool Vector<T, N>::IsParallel(
+C3W_CONSTEXPR bool Vector<T, N>::IsParallel(
     const Vector<T, N>& Left, 
     const Vector<T, N>& Right
 ) {
@@ -238,12 +277,11 @@ bool Vector<T, N>::IsParallel(
         return true;
     }
     // 由于一些数据类型对除法不封闭，只能使用乘法。
-    for (size_t i = 1; i < N; i++) {
-        if (Left[0] * Right[i] != Right[0] * Left[i]) {
-            return false;
-        }
-    }
-    return true;
+    auto& L = Left.m_Components;
+    auto& R = Right.m_Components;
+    return Tools::Unroll<N>::All([&L, &R](size_t i) {
+        return L[0] * R[i] == R[0] * L[i];
+    });
 }
 
 /**********************************************************************
@@ -256,7 +294,9 @@ bool Vector<T, N>::IsParallel(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-bool Vector<T, N>::IsPerpendicular(const Vector<T, N>& Other) const {
+C3W_CONSTEXPR bool Vector<T, N>::IsPerpendicular(
+    const Vector<T, N>& Other
+) const {
     return IsPerpendicular(*this, Other);
 }
 
@@ -271,11 +311,12 @@ bool Vector<T, N>::IsPerpendicular(const Vector<T, N>& Other) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-bool Vector<T, N>::IsPerpendicular(
+C3W_CONSTEXPR bool Vector<T, N>::IsPerpendicular(
     const Vector<T, N>& Left,
     const Vector<T, N>& Right
 ) {
-    return fabs(InnerProduct(Left, Right)) <= EPSILON;
+    T Product = InnerProduct(Left, Right);
+    return -EPSILON <= Product && Product <= EPSILON;
 }
 
 /**********************************************************************
@@ -286,7 +327,7 @@ bool Vector<T, N>::IsPerpendicular(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-void Vector<T, N>::NegateInplace() {
+C3W_CONSTEXPR void Vector<T, N>::NegateInplace() {
     for (auto& component: m_Components) {
         component = -component;
     }
@@ -301,7 +342,7 @@ void Vector<T, N>::NegateInplace() {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::Negate() const {
+C3W_CONSTEXPR Vector<T, N> Vector<T, N>::Negate() const {
     return Negate(*this);
 }
 
@@ -315,11 +356,11 @@ Vector<T, N> Vector<T, N>::Negate() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::Negate(const Vector<T, N>& AVector) {
+C3W_CONSTEXPR Vector<T, N> Vector<T, N>::Negate(const Vector<T, N>& AVector) {
     Vector<T, N> Result;
-    for (size_t i = 0; i < N; i++) {
-        Result[i] = -AVector[i];
-    }
+    Tools::Unroll<N>::For([&Result, &AVector](size_t i) {
+        Result.m_Components[i] = -AVector.m_Components[i];
+    });
     return Result;
 }
 
@@ -332,10 +373,10 @@ Vector<T, N> Vector<T, N>::Negate(const Vector<T, N>& AVector) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-void Vector<T, N>::AddInplace(const Vector<T, N>& Other) {
-    for (size_t i = 0; i < N; i++) {
-        m_Components[i] += Other[i];
-    }
+C3W_CONSTEXPR void Vector<T, N>::AddInplace(const Vector<T, N>& Other) {
+    Tools::Unroll<N>::For([this, &Other](size_t i) {
+        m_Components[i] += Other.m_Components[i];
+    });
 }
 
 /**********************************************************************
@@ -348,7 +389,7 @@ void Vector<T, N>::AddInplace(const Vector<T, N>& Other) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::Add(const Vector<T, N>& Other) const {
+C3W_CONSTEXPR Vector<T, N> Vector<T, N>::Add(const Vector<T, N>& Other) const {
     return Add(*this, Other);
 }
 
@@ -363,14 +404,14 @@ Vector<T, N> Vector<T, N>::Add(const Vector<T, N>& Other) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::Add(
+C3W_CONSTEXPR Vector<T, N> Vector<T, N>::Add(
     const Vector<T, N>& Left, 
     const Vector<T, N>& Right
 ) {
     Vector<T, N> Result;
-    for (size_t i = 0; i < N; i++) {
-        Result[i] = Left[i] + Right[i];
-    }
+    Tools::Unroll<N>::For([&Result, &Left, &Right](size_t i) {
+        Result.m_Components[i] = Left.m_Components[i] + Right.m_Components[i];
+    });
     return Result;
 }
 
@@ -383,10 +424,10 @@ Vector<T, N> Vector<T, N>::Add(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-void Vector<T, N>::SubtractInplace(const Vector<T, N>& Other) {
-    for (size_t i = 0; i < N; i++) {
-        m_Components[i] -= Other[i];
-    }
+C3W_CONSTEXPR void Vector<T, N>::SubtractInplace(const Vector<T, N>& Other) {
+    Tools::Unroll<N>::For([this, &Other](size_t i) {
+        m_Components[i] -= Other.m_Components[i];
+    });
 }
 
 /**********************************************************************
@@ -399,7 +440,9 @@ void Vector<T, N>::SubtractInplace(const Vector<T, N>& Other) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::Subtract(const Vector<T, N>& Other) const {
+C3W_CONSTEXPR Vector<T, N> Vector<T, N>::Subtract(
+    const Vector<T, N>& Other
+) const {
     return Subtract(*this, Other);
 }
 
@@ -414,14 +457,14 @@ Vector<T, N> Vector<T, N>::Subtract(const Vector<T, N>& Other) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::Subtract(
+C3W_CONSTEXPR Vector<T, N> Vector<T, N>::Subtract(
     const Vector<T, N>& Left, 
     const Vector<T, N>& Right
 ) {
     Vector<T, N> Result;
-    for (size_t i = 0; i < N; i++) {
-        Result[i] = Left[i] - Right[i];
-    }
+    Tools::Unroll<N>::For([&Result, &Left, &Right](size_t i) {
+        Result.m_Components[i] = Left.m_Components[i] - Right.m_Components[i];
+    });
     return Result;
 }
 
@@ -434,7 +477,7 @@ Vector<T, N> Vector<T, N>::Subtract(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-void Vector<T, N>::MultiplyInplace(T Factor) {
+C3W_CONSTEXPR void Vector<T, N>::MultiplyInplace(T Factor) {
     for (auto& component: m_Components) {
         component *= Factor;
     }
@@ -450,7 +493,7 @@ void Vector<T, N>::MultiplyInplace(T Factor) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::Multiply(T Factor) const {
+C3W_CONSTEXPR Vector<T, N> Vector<T, N>::Multiply(T Factor) const {
     return Multiply(*this, Factor);
 }
 
@@ -465,11 +508,14 @@ Vector<T, N> Vector<T, N>::Multiply(T Factor) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::Multiply(const Vector<T, N> AVector, T Factor) {
+C3W_CONSTEXPR Vector<T, N> Vector<T, N>::Multiply(
+    const Vector<T, N> AVector,
+    T Factor
+) {
     Vector<T, N> Result;
-    for (size_t i = 0; i < N; i++) {
-        Result[i] = AVector[i] * Factor;
-    }
+    Tools::Unroll<N>::For([&Result, &AVector, &Factor](size_t i) {
+        Result.m_Components[i] = AVector.m_Components[i] * Factor;
+    });
     return Result;
 }
 
@@ -482,7 +528,7 @@ Vector<T, N> Vector<T, N>::Multiply(const Vector<T, N> AVector, T Factor) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-T Vector<T, N>::InnerProduct(const Vector<T, N>& Other) {
+C3W_CONSTEXPR T Vector<T, N>::InnerProduct(const Vector<T, N>& Other) {
     return InnerProduct(*this, Other);
 }
 
@@ -497,14 +543,14 @@ T Vector<T, N>::InnerProduct(const Vector<T, N>& Other) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-T Vector<T, N>::InnerProduct(
+C3W_CONSTEXPR T Vector<T, N>::InnerProduct(
     const Vector<T, N>& Left, 
     const Vector<T, N>& Right
 ) {
     T Result = 0;
-    for (size_t i = 0; i < N; i++) {
-        Result += Left[i] * Right[i];
-    }
+    Tools::Unroll<N>::For([&Result, &Left, &Right](size_t i) {
+        Result += Left.m_Components[i] * Right.m_Components[i];
+    });
     return Result;
 }
 
@@ -518,7 +564,7 @@ T Vector<T, N>::InnerProduct(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-const T& Vector<T, N>::operator[](size_t Index) const {
+C3W_CONSTEXPR const T& Vector<T, N>::operator[](size_t Index) const {
     return GetComponent(Index);
 }
 
@@ -532,62 +578,25 @@ const T& Vector<T, N>::operator[](size_t Index) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-T& Vector<T, N>::operator[](size_t Index) {
+C3W_CONSTEXPR T& Vector<T, N>::operator[](size_t Index) {
     return GetComponent(Index);
 }
 
-/**********************************************************************
-【函数名称】 operator-
-【函数功能】 反转此向量并存为新的向量。
-【参数】 无
-【返回值】 
-    反转后的向量。
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::operator-() const {
-    return Negate();
-}
-
-/**********************************************************************
-【函数名称】 operator+
-【函数功能】 将自身与另一个向量的和存储为新的向量。
-【参数】 
-    Other: 另一个向量。
-【返回值】
-    自身与另一向量相加形成的新的向量。
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::operator+(const Vector<T, N>& Other) const {
-    return Add(Other);
-}
-
 /**********************************************************************
 【函数名称】 operator+=
 【函数功能】 将自身加以另一个向量。
 【参数】 
     Other: 另一个向量。
-【返回值】 无
+【返回值】 
+    自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N>& Vector<T, N>::operator+=(const Vector<T, N>& Other) {
+C3W_CONSTEXPR Vector<T, N>& Vector<T, N>::operator+=(
+    const Vector<T, N>& Other
+) {
     AddInplace(Other);
-}
-
-/**********************************************************************
-【函数名称】 operator-
-【函数功能】 将自身与另一个向量的差存储为新的向量。
-【参数】 
-    Other: 另一个向量。
-【返回值】
-    自身与另一向量相减形成的新的向量。
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::operator-(const Vector<T, N>& Other) const {
-    return Subtract(Other);
+    return *this;
 }
 
 /**********************************************************************
@@ -595,26 +604,16 @@ Vector<T, N> Vector<T, N>::operator-(const Vector<T, N>& Other) const {
 【函数功能】 将自身减去另一个向量。
 【参数】 
     Other: 另一个向量。
-【返回值】 无
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <typename T, size_t N>
-Vector<T, N>& Vector<T, N>::operator-=(const Vector<T, N>& Other) {
-    SubtractInplace(Other);
-}
-
-/**********************************************************************
-【函数名称】 operator*
-【函数功能】 将自身做数乘。
-【参数】 
-    Factor: 要数乘的标量。
 【返回值】 
-    数乘得到的新的向量。
+    自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N> Vector<T, N>::operator*(T Factor) const {
-    return Multiply(Factor);
+C3W_CONSTEXPR Vector<T, N>& Vector<T, N>::operator-=(
+    const Vector<T, N>& Other
+) {
+    SubtractInplace(Other);
+    return *this;
 }
 
 /**********************************************************************
@@ -627,24 +626,11 @@ Vector<T, N> Vector<T, N>::operator*(T Factor) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-Vector<T, N>& Vector<T, N>::operator*=(T Factor) {
+C3W_CONSTEXPR Vector<T, N>& Vector<T, N>::operator*=(T Factor) {
     MultiplyInplace(Factor);
     return *this;
 }
 
-/**********************************************************************
-【函数名称】 operator*
-【函数功能】 将自身和另一向量做内积。
-【参数】 
-    Other: 另一个向量。
-【返回值】 与另一向量的内积。
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <typename T, size_t N>
-T Vector<T, N>::operator*(const Vector<T, N>& Other) const {
-    return InnerProduct(Other);
-}
-
 /**********************************************************************
 【函数名称】 operator==
 【函数功能】 判断自身是否和指定的向量相等。
@@ -655,7 +641,7 @@ T Vector<T, N>::operator*(const Vector<T, N>& Other) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-bool Vector<T, N>::operator==(const Vector<T, N>& Other) const {
+C3W_CONSTEXPR bool Vector<T, N>::operator==(const Vector<T, N>& Other) const {
     return IsEqual(Other);
 }
 
@@ -669,7 +655,7 @@ bool Vector<T, N>::operator==(const Vector<T, N>& Other) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-bool Vector<T, N>::operator!=(const Vector<T, N>& Other) const {
+C3W_CONSTEXPR bool Vector<T, N>::operator!=(const Vector<T, N>& Other) const {
     return !IsEqual(Other);
 }
 
@@ -692,19 +678,4 @@ string Vector<T, N>::ToString() const {
     return Stream.str();
 }
 
-/**********************************************************************
-【函数名称】 operator*
-【函数功能】 将向量与标量数乘。
-【参数】 
-    AVector: 要数乘的向量。
-    Factor: 要数乘的标量。
-【返回值】 
-    数乘形成的新的向量。
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <typename U, size_t M>
-Vector<U, M> operator*(U Factor, const Vector<U, M>& AVector) {
-    return AVector.Multiply(Factor);
-}
-
 }
\ No newline at end of file
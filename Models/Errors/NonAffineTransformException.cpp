@@ -0,0 +1,27 @@
+/*************************************************************************
+【文件名】 NonAffineTransformException.cpp
+【功能模块和目的】 为 NonAffineTransformException.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <stdexcept>
+#include "NonAffineTransformException.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Errors {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 以默认信息初始化异常。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+NonAffineTransformException::NonAffineTransformException()
+    : logic_error("transform is not affine") {}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+/*************************************************************************
+【文件名】 NonAffineTransformException.hpp
+【功能模块和目的】 定义对模型作用非仿射变换时抛出的异常。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef NON_AFFINE_TRANSFORM_EXCEPTION_HPP
+#define NON_AFFINE_TRANSFORM_EXCEPTION_HPP
+
+#include <stdexcept>
+using namespace std;
+
+namespace C3w {
+
+namespace Errors {
+
+/**************************************************************************
+【类名】 NonAffineTransformException
+【功能】 对模型作用非仿射变换时抛出的异常。
+    透视除法可能产生无穷大或非数，也可能使不同的点重合，
+    破坏集合中元素互不相同的约束。
+【接口说明】 无
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class NonAffineTransformException: public logic_error {
+    public:
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以默认信息初始化异常。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        NonAffineTransformException();
+};
+
+}
+
+}
+
+
+#endif
\ No newline at end of file
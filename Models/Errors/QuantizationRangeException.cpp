@@ -0,0 +1,33 @@
+/*************************************************************************
+【文件名】 QuantizationRangeException.cpp
+【功能模块和目的】 为 QuantizationRangeException.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <stdexcept>
+#include <string>
+#include "QuantizationRangeException.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Errors {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 以默认信息初始化异常。
+【参数】
+    Point: 超出范围的点的字符串表达形式。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+QuantizationRangeException::QuantizationRangeException(string Point)
+    : out_of_range(
+        string("point ")
+        + Point
+        + string(" lies outside the quantization bounds")
+    ) {}
+
+}
+
+}
\ No newline at end of file
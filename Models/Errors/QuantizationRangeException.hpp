@@ -0,0 +1,41 @@
+/*************************************************************************
+【文件名】 QuantizationRangeException.hpp
+【功能模块和目的】 定义量化的点超出量化范围时抛出的异常。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef QUANTIZATION_RANGE_EXCEPTION_HPP
+#define QUANTIZATION_RANGE_EXCEPTION_HPP
+
+#include <stdexcept>
+#include <string>
+using namespace std;
+
+namespace C3w {
+
+namespace Errors {
+
+/*************************************************************************
+【类名】 QuantizationRangeException
+【功能】 要量化的点位于量化范围之外时抛出的异常。
+【接口说明】 无
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class QuantizationRangeException: public out_of_range {
+    public:
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以默认信息初始化异常。
+        【参数】
+            Point: 超出范围的点的字符串表达形式。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        QuantizationRangeException(string Point);
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
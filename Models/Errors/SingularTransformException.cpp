@@ -0,0 +1,33 @@
+/*************************************************************************
+【文件名】 SingularTransformException.cpp
+【功能模块和目的】 为 SingularTransformException.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <stdexcept>
+#include <string>
+#include "SingularTransformException.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Errors {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 以默认信息初始化异常。
+【参数】
+    Determinant: 变换矩阵的行列式。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+SingularTransformException::SingularTransformException(double Determinant)
+    : logic_error(
+        string("transform is not invertible (determinant ")
+        + to_string(Determinant)
+        + string(")")
+    ) {}
+
+}
+
+}
\ No newline at end of file
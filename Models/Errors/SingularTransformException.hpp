@@ -0,0 +1,42 @@
+/*************************************************************************
+【文件名】 SingularTransformException.hpp
+【功能模块和目的】 定义对模型作用不可逆变换时抛出的异常。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef SINGULAR_TRANSFORM_EXCEPTION_HPP
+#define SINGULAR_TRANSFORM_EXCEPTION_HPP
+
+#include <stdexcept>
+using namespace std;
+
+namespace C3w {
+
+namespace Errors {
+
+/**************************************************************************
+【类名】 SingularTransformException
+【功能】 对模型作用不可逆变换时抛出的异常。
+    不可逆变换可能使不同的点重合，破坏集合中元素互不相同的约束。
+【接口说明】 无
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class SingularTransformException: public logic_error {
+    public:
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以默认信息初始化异常。
+        【参数】
+            Determinant: 变换矩阵的行列式。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        SingularTransformException(double Determinant);
+};
+
+}
+
+}
+
+
+#endif
\ No newline at end of file
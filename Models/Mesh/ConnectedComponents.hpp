@@ -0,0 +1,205 @@
+/*************************************************************************
+【文件名】 ConnectedComponents.hpp
+【功能模块和目的】 ConnectedComponents 类求网格的连通分量。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef CONNECTED_COMPONENTS_HPP
+#define CONNECTED_COMPONENTS_HPP
+
+#include <cstddef>
+#include <vector>
+#include "IndexedMesh.hpp"
+#include "../Core/Model.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 ConnectedComponents
+【功能】 以共享顶点为连通关系，为网格中的每个顶点、线段和面标记连通分量。
+    使用 C3w::Tools::UnionFind 在多个线程中同时合并，
+    分量按其中最小的顶点下标排序编号，结果与线程调度无关。
+【接口说明】 
+    成员：
+        DIMENSION: 表示维数。
+    构造与析构：
+        接受 IndexedMesh 的构造函数，求连通分量。
+        拷贝构造函数。
+    属性：
+        GetComponentCount: 获取连通分量的个数。
+    访问器：
+        GetVertexComponent(s): 获取顶点所在的分量。
+        GetLineComponent(s): 获取线段所在的分量。
+        GetFaceComponent(s): 获取面所在的分量。
+    操作：
+        Split: 将网格按分量拆分为多个模型。
+        SplitModel: 求模型的连通分量并拆分。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N>
+class ConnectedComponents final {
+    public:
+        // 成员
+
+        // 维数
+        static constexpr size_t DIMENSION { N };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 求网格的连通分量。
+        【参数】
+            AMesh: 共享顶点的网格。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit ConnectedComponents(const IndexedMesh<N>& AMesh);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一结果初始化 ConnectedComponents 对象。
+        【参数】
+            Other: 另一个结果。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        ConnectedComponents(const ConnectedComponents<N>& Other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetComponentCount
+        【函数功能】 获取连通分量的个数。
+        【参数】 无
+        【返回值】
+            连通分量的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetComponentCount() const;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 GetVertexComponent
+        【函数功能】 获取顶点所在的分量。
+        【参数】
+            Index: 顶点的下标。
+        【返回值】
+            分量的编号。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetVertexComponent(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetVertexComponents
+        【函数功能】 获取每个顶点所在的分量。
+        【参数】 无
+        【返回值】
+            以顶点下标排列的分量编号。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<size_t>& GetVertexComponents() const;
+        /**********************************************************************
+        【函数名称】 GetLineComponent
+        【函数功能】 获取线段所在的分量。
+        【参数】
+            Index: 线段的下标。
+        【返回值】
+            分量的编号。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetLineComponent(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetLineComponents
+        【函数功能】 获取每条线段所在的分量。
+        【参数】 无
+        【返回值】
+            以线段下标排列的分量编号。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<size_t>& GetLineComponents() const;
+        /**********************************************************************
+        【函数名称】 GetFaceComponent
+        【函数功能】 获取面所在的分量。
+        【参数】
+            Index: 面的下标。
+        【返回值】
+            分量的编号。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetFaceComponent(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetFaceComponents
+        【函数功能】 获取每个面所在的分量。
+        【参数】 无
+        【返回值】
+            以面下标排列的分量编号。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<size_t>& GetFaceComponents() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Split
+        【函数功能】 遍历一次网格，将每个分量中的元素放入单独的模型。
+            第 i 个模型的名称为原名称加上 "_i"。
+        【参数】
+            AMesh: 构造时使用的网格。
+        【返回值】
+            以分量编号排列的模型。
+            如果网格的元素个数与构造时不同，抛出 InvalidSizeException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        vector<Model<N>> Split(const IndexedMesh<N>& AMesh) const;
+        /**********************************************************************
+        【函数名称】 SplitModel
+        【函数功能】 求模型的连通分量，并将每个分量放入单独的模型。
+        【参数】
+            AModel: 要拆分的模型。
+        【返回值】
+            以分量编号排列的模型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static vector<Model<N>> SplitModel(const Model<N>& AModel);
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将其他结果赋值给自身。
+        【参数】
+            Other: 从之取值的结果。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        ConnectedComponents<N>& operator=(
+            const ConnectedComponents<N>& Other
+        ) = default;
+
+    private:
+        // 分量的个数
+        size_t m_ullComponentCount { 0 };
+        // 每个顶点所在的分量
+        vector<size_t> m_VertexComponents;
+        // 每条线段所在的分量
+        vector<size_t> m_LineComponents;
+        // 每个面所在的分量
+        vector<size_t> m_FaceComponents;
+};
+
+}
+
+}
+
+#include "ConnectedComponents.tpp"
+
+#endif
\ No newline at end of file
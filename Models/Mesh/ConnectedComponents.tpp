@@ -0,0 +1,279 @@
+/*************************************************************************
+【文件名】 ConnectedComponents.tpp
+【功能模块和目的】 为 ConnectedComponents.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ConnectedComponents.hpp"
+#include "IndexedMesh.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Model.hpp"
+#include "../Containers/DynamicSet.hpp"
+#include "../Errors/IndexOverflowException.hpp"
+#include "../Errors/InvalidSizeException.hpp"
+#include "../Tools/Parallel.hpp"
+#include "../Tools/UnionFind.hpp"
+using namespace std;
+using namespace C3w::Containers;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Mesh {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 求网格的连通分量。
+【参数】
+    AMesh: 共享顶点的网格。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+ConnectedComponents<N>::ConnectedComponents(const IndexedMesh<N>& AMesh)
+    : m_VertexComponents(AMesh.GetVertexCount()),
+      m_LineComponents(AMesh.GetLineCount()),
+      m_FaceComponents(AMesh.GetFaceCount()) {
+    size_t ullVertexCount = AMesh.GetVertexCount();
+    auto& Lines = AMesh.GetLines();
+    auto& Faces = AMesh.GetFaces();
+    Tools::UnionFind Sets(ullVertexCount);
+    // 合并每个元素的顶点
+    Tools::Parallel::For(
+        Lines.size(), 
+        [&Lines, &Sets](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                Sets.Unite(Lines[i][0], Lines[i][1]);
+            }
+        }
+    );
+    Tools::Parallel::For(
+        Faces.size(), 
+        [&Faces, &Sets](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                Sets.Unite(Faces[i][0], Faces[i][1]);
+                Sets.Unite(Faces[i][0], Faces[i][2]);
+            }
+        }
+    );
+    // 暂存每个顶点的根
+    Tools::Parallel::For(
+        ullVertexCount, 
+        [this, &Sets](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                m_VertexComponents[i] = Sets.Find(i);
+            }
+        }
+    );
+    // 根是集合中最小的下标，顺序遍历时总先遇到根，可以直接改写为编号
+    for (size_t i = 0; i < ullVertexCount; i++) {
+        size_t ullRoot = m_VertexComponents[i];
+        m_VertexComponents[i] = ullRoot == i 
+            ? m_ullComponentCount++ 
+            : m_VertexComponents[ullRoot];
+    }
+    Tools::Parallel::For(
+        Lines.size(), 
+        [this, &Lines](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                m_LineComponents[i] = m_VertexComponents[Lines[i][0]];
+            }
+        }
+    );
+    Tools::Parallel::For(
+        Faces.size(), 
+        [this, &Faces](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                m_FaceComponents[i] = m_VertexComponents[Faces[i][0]];
+            }
+        }
+    );
+}
+
+/**********************************************************************
+【函数名称】 GetComponentCount
+【函数功能】 获取连通分量的个数。
+【参数】 无
+【返回值】
+    连通分量的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+size_t ConnectedComponents<N>::GetComponentCount() const {
+    return m_ullComponentCount;
+}
+
+/**********************************************************************
+【函数名称】 GetVertexComponent
+【函数功能】 获取顶点所在的分量。
+【参数】
+    Index: 顶点的下标。
+【返回值】
+    分量的编号。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+size_t ConnectedComponents<N>::GetVertexComponent(size_t Index) const {
+    if (Index >= m_VertexComponents.size()) {
+        throw IndexOverflowException(Index, m_VertexComponents.size());
+    }
+    return m_VertexComponents[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetVertexComponents
+【函数功能】 获取每个顶点所在的分量。
+【参数】 无
+【返回值】
+    以顶点下标排列的分量编号。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+const vector<size_t>& ConnectedComponents<N>::GetVertexComponents() const {
+    return m_VertexComponents;
+}
+
+/**********************************************************************
+【函数名称】 GetLineComponent
+【函数功能】 获取线段所在的分量。
+【参数】
+    Index: 线段的下标。
+【返回值】
+    分量的编号。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+size_t ConnectedComponents<N>::GetLineComponent(size_t Index) const {
+    if (Index >= m_LineComponents.size()) {
+        throw IndexOverflowException(Index, m_LineComponents.size());
+    }
+    return m_LineComponents[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetLineComponents
+【函数功能】 获取每条线段所在的分量。
+【参数】 无
+【返回值】
+    以线段下标排列的分量编号。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+const vector<size_t>& ConnectedComponents<N>::GetLineComponents() const {
+    return m_LineComponents;
+}
+
+/**********************************************************************
+【函数名称】 GetFaceComponent
+【函数功能】 获取面所在的分量。
+【参数】
+    Index: 面的下标。
+【返回值】
+    分量的编号。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+size_t ConnectedComponents<N>::GetFaceComponent(size_t Index) const {
+    if (Index >= m_FaceComponents.size()) {
+        throw IndexOverflowException(Index, m_FaceComponents.size());
+    }
+    return m_FaceComponents[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetFaceComponents
+【函数功能】 获取每个面所在的分量。
+【参数】 无
+【返回值】
+    以面下标排列的分量编号。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+const vector<size_t>& ConnectedComponents<N>::GetFaceComponents() const {
+    return m_FaceComponents;
+}
+
+/**********************************************************************
+【函数名称】 Split
+【函数功能】 遍历一次网格，将每个分量中的元素放入单独的模型。
+    第 i 个模型的名称为原名称加上 "_i"。
+【参数】
+    AMesh: 构造时使用的网格。
+【返回值】
+    以分量编号排列的模型。
+    如果网格的元素个数与构造时不同，抛出 InvalidSizeException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+vector<Model<N>> ConnectedComponents<N>::Split(
+    const IndexedMesh<N>& AMesh
+) const {
+    if (AMesh.GetLineCount() != m_LineComponents.size()) {
+        throw InvalidSizeException(
+            AMesh.GetLineCount(), 
+            m_LineComponents.size()
+        );
+    }
+    if (AMesh.GetFaceCount() != m_FaceComponents.size()) {
+        throw InvalidSizeException(
+            AMesh.GetFaceCount(), 
+            m_FaceComponents.size()
+        );
+    }
+    auto& Vertices = AMesh.GetVertices();
+    auto& Lines = AMesh.GetLines();
+    auto& Faces = AMesh.GetFaces();
+    vector<vector<Line<N>>> ComponentLines(m_ullComponentCount);
+    vector<vector<Face<N>>> ComponentFaces(m_ullComponentCount);
+    for (size_t i = 0; i < Lines.size(); i++) {
+        ComponentLines[m_LineComponents[i]].emplace_back(
+            Vertices[Lines[i][0]], 
+            Vertices[Lines[i][1]]
+        );
+    }
+    for (size_t i = 0; i < Faces.size(); i++) {
+        ComponentFaces[m_FaceComponents[i]].emplace_back(
+            Vertices[Faces[i][0]], 
+            Vertices[Faces[i][1]], 
+            Vertices[Faces[i][2]]
+        );
+    }
+    vector<Model<N>> Models;
+    Models.reserve(m_ullComponentCount);
+    for (size_t i = 0; i < m_ullComponentCount; i++) {
+        // 元素来自同一个模型，本就互不相同
+        Models.emplace_back(
+            AMesh.GetName() + "_" + to_string(i),
+            DynamicSet<Line<N>>::FromDistinct(move(ComponentLines[i])),
+            DynamicSet<Face<N>>::FromDistinct(move(ComponentFaces[i]))
+        );
+    }
+    return Models;
+}
+
+/**********************************************************************
+【函数名称】 SplitModel
+【函数功能】 求模型的连通分量，并将每个分量放入单独的模型。
+【参数】
+    AModel: 要拆分的模型。
+【返回值】
+    以分量编号排列的模型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+vector<Model<N>> ConnectedComponents<N>::SplitModel(const Model<N>& AModel) {
+    IndexedMesh<N> AMesh(AModel);
+    return ConnectedComponents<N>(AMesh).Split(AMesh);
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,628 @@
+/*************************************************************************
+【文件名】 ConvexHull.cpp
+【功能模块和目的】 为 ConvexHull.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "ConvexHull.hpp"
+#include "../Containers/DynamicSet.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/Parallel.hpp"
+using namespace std;
+using namespace C3w::Containers;
+
+namespace C3w {
+
+namespace Mesh {
+
+/**********************************************************************
+【函数名称】 GatherPoints
+【函数功能】 按顺序收集模型中所有元素的点，不去除重复。
+【参数】
+    AModel: 模型。
+【返回值】
+    所有元素的点。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+vector<Point<N>> ConvexHull::GatherPoints(const Model<N>& AModel) {
+    // 重复的点不影响凸包，无需像 CollectPoints 一样逐个查重
+    vector<Point<N>> Points;
+    Points.reserve(AModel.Lines.Count() * 2 + AModel.Faces.Count() * 3);
+    for (auto& ALine: AModel.Lines) {
+        for (auto& APoint: ALine.Points) {
+            Points.push_back(APoint);
+        }
+    }
+    for (auto& AFace: AModel.Faces) {
+        for (auto& APoint: AFace.Points) {
+            Points.push_back(APoint);
+        }
+    }
+    return Points;
+}
+
+/**********************************************************************
+【函数名称】 GetHullOf
+【函数功能】 求二维点集的凸包。
+【参数】
+    Points: 点集，可以包含重复的点。
+【返回值】
+    凸包顶点的下标，按逆时针顺序排列。
+    所有点共线时只包含两个端点，所有点重合时只包含一个点。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+vector<size_t> ConvexHull::GetHullOf(const vector<Point<2>>& Points) {
+    size_t ullCount = Points.size();
+    vector<size_t> Hull;
+    if (ullCount == 0) {
+        return Hull;
+    }
+    // 按 (x, y) 的字典序比较
+    auto Less = [&Points](size_t Left, size_t Right) {
+        return Points[Left][0] < Points[Right][0]
+            || (
+                Points[Left][0] == Points[Right][0]
+                && Points[Left][1] < Points[Right][1]
+            );
+    };
+    // 字典序最小与最大的点一定是凸包的顶点
+    using Extremes = array<size_t, 2>;
+    Extremes Ends = Tools::Parallel::Reduce(
+        ullCount,
+        Extremes {{ 0, 0 }},
+        [&Less](size_t Begin, size_t End) {
+            Extremes Result {{ 0, 0 }};
+            if (Begin < End) {
+                Result = {{ Begin, Begin }};
+            }
+            for (size_t i = Begin; i < End; i++) {
+                if (Less(i, Result[0])) {
+                    Result[0] = i;
+                }
+                if (Less(Result[1], i)) {
+                    Result[1] = i;
+                }
+            }
+            return Result;
+        },
+        [&Less](const Extremes& Left, const Extremes& Right) {
+            return Extremes {{
+                Less(Right[0], Left[0]) ? Right[0] : Left[0],
+                Less(Left[1], Right[1]) ? Right[1] : Left[1]
+            }};
+        }
+    );
+    size_t A = Ends[0];
+    size_t B = Ends[1];
+    Hull.push_back(A);
+    if (!Less(A, B)) {
+        return Hull;
+    }
+    // 并行地将点划分到直线 AB 的两侧
+    vector<signed char> Sides(ullCount);
+    Tools::Parallel::For(
+        ullCount,
+        [&Points, &Sides, A, B](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                double rCross = Cross(Points[A], Points[B], Points[i]);
+                Sides[i] = rCross > 0 ? 1 : (rCross < 0 ? -1 : 0);
+            }
+        }
+    );
+    vector<size_t> Lower;
+    vector<size_t> Upper;
+    for (size_t i = 0; i < ullCount; i++) {
+        if (Sides[i] < 0) {
+            Lower.push_back(i);
+        }
+        else if (Sides[i] > 0) {
+            Upper.push_back(i);
+        }
+    }
+    FindHull(Points, Lower, A, B, Hull);
+    Hull.push_back(B);
+    FindHull(Points, Upper, B, A, Hull);
+    return Hull;
+}
+
+/**********************************************************************
+【函数名称】 GetHullOf
+【函数功能】 求三维点集的凸包。
+【参数】
+    Points: 点集，可以包含重复的点。
+【返回值】
+    凸包的三角形面，每个面为三个点的下标，从外侧看为逆时针。
+    所有点共面时为空。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+vector<array<size_t, 3>> ConvexHull::GetHullOf(
+    const vector<Point<3>>& Points
+) {
+    size_t ullCount = Points.size();
+    vector<array<size_t, 3>> Result;
+    if (ullCount < 4) {
+        return Result;
+    }
+    vector<Position> Positions(ullCount);
+    Tools::Parallel::For(
+        ullCount,
+        [&Points, &Positions](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                Positions[i] = {{ Points[i][0], Points[i][1], Points[i][2] }};
+            }
+        }
+    );
+    // 各坐标轴上的最小、最大点
+    using Extremes = array<size_t, 6>;
+    Extremes Ends = Tools::Parallel::Reduce(
+        ullCount,
+        Extremes(),
+        [&Positions](size_t Begin, size_t End) {
+            Extremes Result {};
+            if (Begin < End) {
+                Result.fill(Begin);
+            }
+            for (size_t i = Begin; i < End; i++) {
+                for (size_t j = 0; j < 3; j++) {
+                    if (Positions[i][j] < Positions[Result[2 * j]][j]) {
+                        Result[2 * j] = i;
+                    }
+                    if (Positions[i][j] > Positions[Result[2 * j + 1]][j]) {
+                        Result[2 * j + 1] = i;
+                    }
+                }
+            }
+            return Result;
+        },
+        [&Positions](const Extremes& Left, const Extremes& Right) {
+            Extremes Result = Left;
+            for (size_t j = 0; j < 3; j++) {
+                if (Positions[Right[2 * j]][j] < Positions[Left[2 * j]][j]) {
+                    Result[2 * j] = Right[2 * j];
+                }
+                if (
+                    Positions[Right[2 * j + 1]][j]
+                    > Positions[Left[2 * j + 1]][j]
+                ) {
+                    Result[2 * j + 1] = Right[2 * j + 1];
+                }
+            }
+            return Result;
+        }
+    );
+    // 距离的容差与坐标的量级成正比
+    double rScale = 0;
+    for (size_t j = 0; j < 3; j++) {
+        rScale += max(
+            fabs(Positions[Ends[2 * j]][j]),
+            fabs(Positions[Ends[2 * j + 1]][j])
+        );
+    }
+    double rEpsilon = 3 * numeric_limits<double>::epsilon() * rScale;
+    auto Difference = [&Positions](size_t From, size_t To) {
+        return Position {{
+            Positions[To][0] - Positions[From][0],
+            Positions[To][1] - Positions[From][1],
+            Positions[To][2] - Positions[From][2]
+        }};
+    };
+    auto CrossProduct = [](const Position& Left, const Position& Right) {
+        return Position {{
+            Left[1] * Right[2] - Left[2] * Right[1],
+            Left[2] * Right[0] - Left[0] * Right[2],
+            Left[0] * Right[1] - Left[1] * Right[0]
+        }};
+    };
+    auto Dot = [](const Position& Left, const Position& Right) {
+        return Left[0] * Right[0] + Left[1] * Right[1] + Left[2] * Right[2];
+    };
+    // 并行求使 Distance 最大的点
+    auto Farthest = [ullCount](function<double(size_t)> Distance) {
+        using Candidate = pair<double, size_t>;
+        return Tools::Parallel::Reduce(
+            ullCount,
+            Candidate(-1, 0),
+            [&Distance](size_t Begin, size_t End) {
+                Candidate Best(-1, 0);
+                for (size_t i = Begin; i < End; i++) {
+                    double rDistance = Distance(i);
+                    if (rDistance > Best.first) {
+                        Best = Candidate(rDistance, i);
+                    }
+                }
+                return Best;
+            },
+            [](const Candidate& Left, const Candidate& Right) {
+                return Right.first > Left.first ? Right : Left;
+            }
+        );
+    };
+    // 初始单纯形：相距最远的两个极值点，离其连线最远的点，离其平面最远的点
+    size_t I0 = Ends[0];
+    size_t I1 = Ends[1];
+    double rBest = -1;
+    for (size_t i = 0; i < Ends.size(); i++) {
+        for (size_t j = i + 1; j < Ends.size(); j++) {
+            Position Delta = Difference(Ends[i], Ends[j]);
+            double rLength = Dot(Delta, Delta);
+            if (rLength > rBest) {
+                rBest = rLength;
+                I0 = Ends[i];
+                I1 = Ends[j];
+            }
+        }
+    }
+    if (sqrt(rBest) <= rEpsilon) {
+        return Result;
+    }
+    Position Axis = Difference(I0, I1);
+    auto Third = Farthest([&](size_t Index) {
+        Position Normal = CrossProduct(Axis, Difference(I0, Index));
+        return Dot(Normal, Normal);
+    });
+    if (sqrt(Third.first / Dot(Axis, Axis)) <= rEpsilon) {
+        return Result;
+    }
+    size_t I2 = Third.second;
+    Position Normal = CrossProduct(Axis, Difference(I0, I2));
+    double rNormalLength = sqrt(Dot(Normal, Normal));
+    auto Fourth = Farthest([&](size_t Index) {
+        return fabs(Dot(Normal, Difference(I0, Index)));
+    });
+    if (Fourth.first / rNormalLength <= rEpsilon) {
+        return Result;
+    }
+    size_t I3 = Fourth.second;
+
+    // 点到面的有向距离
+    auto Distance = [&Positions, &Dot](const HullFace& AFace, size_t Index) {
+        return Dot(AFace.Normal, Positions[Index]) - AFace.rOffset;
+    };
+    vector<HullFace> Faces;
+    array<size_t, 4> Simplex {{ I0, I1, I2, I3 }};
+    for (size_t i = 0; i < 4; i++) {
+        array<size_t, 3> Indices;
+        for (size_t j = 0, k = 0; j < 4; j++) {
+            if (j != i) {
+                Indices[k++] = Simplex[j];
+            }
+        }
+        HullFace AFace = MakeFace(Positions, Indices[0], Indices[1], Indices[2]);
+        // 保证剩余的顶点位于面的内侧
+        if (Distance(AFace, Simplex[i]) > 0) {
+            AFace = MakeFace(Positions, Indices[0], Indices[2], Indices[1]);
+        }
+        Faces.push_back(AFace);
+    }
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t k = 0; k < 3; k++) {
+            size_t ullFrom = Faces[i].Vertices[k];
+            size_t ullTo = Faces[i].Vertices[(k + 1) % 3];
+            for (size_t j = 0; j < 4; j++) {
+                for (size_t m = 0; m < 3; m++) {
+                    if (
+                        Faces[j].Vertices[m] == ullTo
+                        && Faces[j].Vertices[(m + 1) % 3] == ullFrom
+                    ) {
+                        Faces[i].Neighbors[k] = j;
+                    }
+                }
+            }
+        }
+    }
+    // 并行地将每个点划分到它位于其外侧的第一个面，内部的点被丢弃
+    const unsigned char INSIDE = 4;
+    vector<unsigned char> Owners(ullCount, INSIDE);
+    Tools::Parallel::For(
+        ullCount,
+        [&Faces, &Owners, &Distance, rEpsilon](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                for (unsigned char j = 0; j < INSIDE; j++) {
+                    if (Distance(Faces[j], i) > rEpsilon) {
+                        Owners[i] = j;
+                        break;
+                    }
+                }
+            }
+        }
+    );
+    for (auto ullIndex: Simplex) {
+        Owners[ullIndex] = INSIDE;
+    }
+    for (size_t i = 0; i < ullCount; i++) {
+        if (Owners[i] != INSIDE) {
+            Faces[Owners[i]].Outside.push_back(i);
+        }
+    }
+
+    vector<size_t> Pending { 0, 1, 2, 3 };
+    vector<size_t> Visible;
+    vector<size_t> Stack;
+    // 地平线上的边：起点、终点与不可见一侧的面
+    vector<array<size_t, 3>> Horizon;
+    // 新面按地平线边的起点索引
+    unordered_map<size_t, size_t> StartAt;
+    size_t ullVisit = 0;
+    while (!Pending.empty()) {
+        size_t ullFace = Pending.back();
+        Pending.pop_back();
+        if (Faces[ullFace].bRemoved || Faces[ullFace].Outside.empty()) {
+            continue;
+        }
+        // 离此面最远的外侧点一定是凸包的顶点
+        size_t ullApex = Faces[ullFace].Outside[0];
+        double rApexDistance = -1;
+        for (auto ullIndex: Faces[ullFace].Outside) {
+            double rDistance = Distance(Faces[ullFace], ullIndex);
+            if (rDistance > rApexDistance) {
+                rApexDistance = rDistance;
+                ullApex = ullIndex;
+            }
+        }
+        // 从此面出发寻找所有可见面，并记录地平线
+        ullVisit++;
+        Visible.clear();
+        Horizon.clear();
+        Faces[ullFace].ullVisit = ullVisit;
+        Stack.assign(1, ullFace);
+        while (!Stack.empty()) {
+            size_t ullCurrent = Stack.back();
+            Stack.pop_back();
+            Visible.push_back(ullCurrent);
+            for (size_t k = 0; k < 3; k++) {
+                size_t ullNeighbor = Faces[ullCurrent].Neighbors[k];
+                if (Faces[ullNeighbor].ullVisit == ullVisit) {
+                    continue;
+                }
+                if (Distance(Faces[ullNeighbor], ullApex) > rEpsilon) {
+                    Faces[ullNeighbor].ullVisit = ullVisit;
+                    Stack.push_back(ullNeighbor);
+                }
+                else {
+                    Horizon.push_back({{
+                        Faces[ullCurrent].Vertices[k],
+                        Faces[ullCurrent].Vertices[(k + 1) % 3],
+                        ullNeighbor
+                    }});
+                }
+            }
+        }
+        // 以地平线上的每条边与新顶点构成新面
+        size_t ullFirstNew = Faces.size();
+        StartAt.clear();
+        for (auto& Edge: Horizon) {
+            size_t ullNew = Faces.size();
+            HullFace AFace = MakeFace(Positions, Edge[0], Edge[1], ullApex);
+            AFace.Neighbors[0] = Edge[2];
+            HullFace& Outer = Faces[Edge[2]];
+            for (size_t k = 0; k < 3; k++) {
+                if (Outer.Vertices[k] == Edge[1]) {
+                    Outer.Neighbors[k] = ullNew;
+                }
+            }
+            StartAt[Edge[0]] = ullNew;
+            Faces.push_back(move(AFace));
+        }
+        for (size_t i = ullFirstNew; i < Faces.size(); i++) {
+            size_t ullNext = StartAt.at(Faces[i].Vertices[1]);
+            Faces[i].Neighbors[1] = ullNext;
+            Faces[ullNext].Neighbors[2] = i;
+        }
+        // 将可见面外侧的点重新划分到新面
+        for (auto ullRemoved: Visible) {
+            Faces[ullRemoved].bRemoved = true;
+            for (auto ullIndex: Faces[ullRemoved].Outside) {
+                if (ullIndex == ullApex) {
+                    continue;
+                }
+                for (size_t i = ullFirstNew; i < Faces.size(); i++) {
+                    if (Distance(Faces[i], ullIndex) > rEpsilon) {
+                        Faces[i].Outside.push_back(ullIndex);
+                        break;
+                    }
+                }
+            }
+            vector<size_t>().swap(Faces[ullRemoved].Outside);
+        }
+        for (size_t i = ullFirstNew; i < Faces.size(); i++) {
+            if (!Faces[i].Outside.empty()) {
+                Pending.push_back(i);
+            }
+        }
+    }
+    for (auto& AFace: Faces) {
+        if (!AFace.bRemoved) {
+            Result.push_back(AFace.Vertices);
+        }
+    }
+    return Result;
+}
+
+/**********************************************************************
+【函数名称】 GetConvexHullOf
+【函数功能】 求二维模型中所有点的凸包。
+【参数】
+    AModel: 模型。
+【返回值】
+    以凸包的边为线段的模型，名称为原名称加 "_hull"。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Model<2> ConvexHull::GetConvexHullOf(const Model<2>& AModel) {
+    vector<Point<2>> Points = GatherPoints(AModel);
+    vector<size_t> Hull = GetHullOf(Points);
+    vector<Line<2>> Lines;
+    if (Hull.size() == 2) {
+        Lines.emplace_back(Points[Hull[0]], Points[Hull[1]]);
+    }
+    else if (Hull.size() > 2) {
+        for (size_t i = 0; i < Hull.size(); i++) {
+            Lines.emplace_back(
+                Points[Hull[i]],
+                Points[Hull[(i + 1) % Hull.size()]]
+            );
+        }
+    }
+    return Model<2>(
+        AModel.Name + "_hull",
+        DynamicSet<Line<2>>::FromDistinct(move(Lines)),
+        DynamicSet<Face<2>>()
+    );
+}
+
+/**********************************************************************
+【函数名称】 GetConvexHullOf
+【函数功能】 求三维模型中所有点的凸包。
+【参数】
+    AModel: 模型。
+【返回值】
+    以凸包的三角形为面的模型，名称为原名称加 "_hull"。
+    所有点共面时不含面。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Model<3> ConvexHull::GetConvexHullOf(const Model<3>& AModel) {
+    vector<Point<3>> Points = GatherPoints(AModel);
+    vector<Face<3>> Faces;
+    for (auto& Indices: GetHullOf(Points)) {
+        Faces.emplace_back(
+            Points[Indices[0]],
+            Points[Indices[1]],
+            Points[Indices[2]]
+        );
+    }
+    return Model<3>(
+        AModel.Name + "_hull",
+        DynamicSet<Line<3>>(),
+        DynamicSet<Face<3>>::FromDistinct(move(Faces))
+    );
+}
+
+/**********************************************************************
+【函数名称】 Cross
+【函数功能】 求二维向量 OA 与 OB 的叉积。
+【参数】
+    O, A, B: 三个点。
+【返回值】
+    叉积，B 在有向线段 OA 左侧时为正。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+double ConvexHull::Cross(
+    const Point<2>& O,
+    const Point<2>& A,
+    const Point<2>& B
+) {
+    return (A[0] - O[0]) * (B[1] - O[1]) - (A[1] - O[1]) * (B[0] - O[0]);
+}
+
+/**********************************************************************
+【函数名称】 FindHull
+【函数功能】 二维 QuickHull 的递归步骤，按顺序输出 P 与 Q 之间的凸包顶点。
+【参数】
+    Points: 点集。
+    Subset: 位于有向线段 PQ 右侧的点的下标。
+    P: 起点的下标。
+    Q: 终点的下标。
+    Hull: 输出凸包顶点的下标，不含 P 与 Q。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ConvexHull::FindHull(
+    const vector<Point<2>>& Points,
+    const vector<size_t>& Subset,
+    size_t P,
+    size_t Q,
+    vector<size_t>& Hull
+) {
+    if (Subset.empty()) {
+        return;
+    }
+    // 离 PQ 最远的点 C 是凸包的顶点，三角形 PCQ 内的点被丢弃
+    size_t C = Subset[0];
+    double rBest = 0;
+    for (auto ullIndex: Subset) {
+        double rDistance = -Cross(Points[P], Points[Q], Points[ullIndex]);
+        if (rDistance > rBest) {
+            rBest = rDistance;
+            C = ullIndex;
+        }
+    }
+    vector<size_t> Left;
+    vector<size_t> Right;
+    for (auto ullIndex: Subset) {
+        if (Cross(Points[P], Points[C], Points[ullIndex]) < 0) {
+            Left.push_back(ullIndex);
+        }
+        else if (Cross(Points[C], Points[Q], Points[ullIndex]) < 0) {
+            Right.push_back(ullIndex);
+        }
+    }
+    FindHull(Points, Left, P, C, Hull);
+    Hull.push_back(C);
+    FindHull(Points, Right, C, Q, Hull);
+}
+
+/**********************************************************************
+【函数名称】 MakeFace
+【函数功能】 创建一个三维凸包的面并求其平面。
+【参数】
+    Positions: 点的坐标。
+    A, B, C: 三个顶点的下标。
+【返回值】
+    新的面，相邻面均为未设置。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ConvexHull::HullFace ConvexHull::MakeFace(
+    const vector<Position>& Positions,
+    size_t A,
+    size_t B,
+    size_t C
+) {
+    HullFace AFace;
+    AFace.Vertices = {{ A, B, C }};
+    AFace.Neighbors.fill(numeric_limits<size_t>::max());
+    const Position& PA = Positions[A];
+    const Position& PB = Positions[B];
+    const Position& PC = Positions[C];
+    double rX1 = PB[0] - PA[0];
+    double rY1 = PB[1] - PA[1];
+    double rZ1 = PB[2] - PA[2];
+    double rX2 = PC[0] - PA[0];
+    double rY2 = PC[1] - PA[1];
+    double rZ2 = PC[2] - PA[2];
+    AFace.Normal = {{
+        rY1 * rZ2 - rZ1 * rY2,
+        rZ1 * rX2 - rX1 * rZ2,
+        rX1 * rY2 - rY1 * rX2
+    }};
+    double rLength = sqrt(
+        AFace.Normal[0] * AFace.Normal[0]
+        + AFace.Normal[1] * AFace.Normal[1]
+        + AFace.Normal[2] * AFace.Normal[2]
+    );
+    if (rLength > 0) {
+        for (auto& rComponent: AFace.Normal) {
+            rComponent /= rLength;
+        }
+    }
+    AFace.rOffset = AFace.Normal[0] * PA[0]
+        + AFace.Normal[1] * PA[1]
+        + AFace.Normal[2] * PA[2];
+    AFace.bRemoved = false;
+    AFace.ullVisit = 0;
+    return AFace;
+}
+
+}
+
+}
\ No newline at end of file
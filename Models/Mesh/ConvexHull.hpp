@@ -0,0 +1,182 @@
+/*************************************************************************
+【文件名】 ConvexHull.hpp
+【功能模块和目的】 ConvexHull 类使用 QuickHull 算法求二维、三维点集的凸包。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef CONVEX_HULL_HPP
+#define CONVEX_HULL_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 ConvexHull
+【功能】 静态类，使用 QuickHull 算法求凸包。
+    先以多个线程求出极值点与初始单纯形，并将所有点并行划分到
+    初始单纯形各边/面的外侧，位于内部的点（通常是绝大多数）直接丢弃，
+    之后对剩余的点顺序执行 QuickHull。
+    与凸包的边/面共线/共面（在舍入误差以内）的点不作为凸包的顶点。
+【接口说明】
+    构造函数：
+        私有默认构造函数。
+    操作：
+        GetHullOf: 求点集的凸包，返回下标。
+        GetConvexHullOf: 求模型中所有点的凸包，返回新的模型。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class ConvexHull final {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 GetHullOf
+        【函数功能】 求二维点集的凸包。
+        【参数】
+            Points: 点集，可以包含重复的点。
+        【返回值】
+            凸包顶点的下标，按逆时针顺序排列。
+            所有点共线时只包含两个端点，所有点重合时只包含一个点。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static vector<size_t> GetHullOf(const vector<Point<2>>& Points);
+        /**********************************************************************
+        【函数名称】 GetHullOf
+        【函数功能】 求三维点集的凸包。
+        【参数】
+            Points: 点集，可以包含重复的点。
+        【返回值】
+            凸包的三角形面，每个面为三个点的下标，从外侧看为逆时针。
+            所有点共面时为空。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static vector<array<size_t, 3>> GetHullOf(
+            const vector<Point<3>>& Points
+        );
+        /**********************************************************************
+        【函数名称】 GetConvexHullOf
+        【函数功能】 求二维模型中所有点的凸包。
+        【参数】
+            AModel: 模型。
+        【返回值】
+            以凸包的边为线段的模型，名称为原名称加 "_hull"。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Model<2> GetConvexHullOf(const Model<2>& AModel);
+        /**********************************************************************
+        【函数名称】 GetConvexHullOf
+        【函数功能】 求三维模型中所有点的凸包。
+        【参数】
+            AModel: 模型。
+        【返回值】
+            以凸包的三角形为面的模型，名称为原名称加 "_hull"。
+            所有点共面时不含面。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Model<3> GetConvexHullOf(const Model<3>& AModel);
+
+    private:
+        // 三维坐标
+        using Position = array<double, 3>;
+
+        /**********************************************************************
+        【类名】 HullFace
+        【功能】 三维凸包构造过程中的一个面。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct HullFace {
+            // 三个顶点的下标，从外侧看为逆时针
+            array<size_t, 3> Vertices;
+            // 第 i 条边 (Vertices[i], Vertices[i+1]) 对面的相邻面
+            array<size_t, 3> Neighbors;
+            // 单位外法向
+            Position Normal;
+            // 平面方程的常数项，点 X 到面的有向距离为 Normal·X - rOffset
+            double rOffset;
+            // 位于此面外侧的点
+            vector<size_t> Outside;
+            // 是否已被删除
+            bool bRemoved;
+            // 求可见面时的访问标记
+            size_t ullVisit;
+        };
+
+        /**********************************************************************
+        【函数名称】 Cross
+        【函数功能】 求二维向量 OA 与 OB 的叉积。
+        【参数】
+            O, A, B: 三个点。
+        【返回值】
+            叉积，B 在有向线段 OA 左侧时为正。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static double Cross(
+            const Point<2>& O,
+            const Point<2>& A,
+            const Point<2>& B
+        );
+        /**********************************************************************
+        【函数名称】 FindHull
+        【函数功能】 二维 QuickHull 的递归步骤，按顺序输出 P 与 Q 之间的凸包顶点。
+        【参数】
+            Points: 点集。
+            Subset: 位于有向线段 PQ 右侧的点的下标。
+            P: 起点的下标。
+            Q: 终点的下标。
+            Hull: 输出凸包顶点的下标，不含 P 与 Q。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void FindHull(
+            const vector<Point<2>>& Points,
+            const vector<size_t>& Subset,
+            size_t P,
+            size_t Q,
+            vector<size_t>& Hull
+        );
+        /**********************************************************************
+        【函数名称】 MakeFace
+        【函数功能】 创建一个三维凸包的面并求其平面。
+        【参数】
+            Positions: 点的坐标。
+            A, B, C: 三个顶点的下标。
+        【返回值】
+            新的面，相邻面均为未设置。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static HullFace MakeFace(
+            const vector<Position>& Positions,
+            size_t A,
+            size_t B,
+            size_t C
+        );
+        /**********************************************************************
+        【函数名称】 GatherPoints
+        【函数功能】 按顺序收集模型中所有元素的点，不去除重复。
+        【参数】
+            AModel: 模型。
+        【返回值】
+            所有元素的点。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <size_t N>
+        static vector<Point<N>> GatherPoints(const Model<N>& AModel);
+
+        // 静态类，隐藏构造函数。
+        ConvexHull();
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,737 @@
+/*************************************************************************
+【文件名】 Decimator.cpp
+【功能模块和目的】 为 Decimator.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Decimator.hpp"
+#include "HalfEdgeMesh.hpp"
+#include "IndexedMesh.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+// 边界约束平面的权重。
+constexpr double Decimator::BOUNDARY_WEIGHT;
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 从网格初始化二次型、邻接关系与候选边。
+【参数】
+    AMesh: 要简化的网格。
+    APlacement: 新顶点的放置方式，默认为 OPTIMAL。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Decimator::Decimator(const IndexedMesh<3>& AMesh, Placement APlacement)
+    : m_Name(AMesh.GetName()),
+      m_Placement(APlacement),
+      m_Positions(AMesh.GetVertexCount()),
+      m_Quadrics(AMesh.GetVertexCount(), Quadric()),
+      m_Versions(AMesh.GetVertexCount(), 0),
+      m_RemovedVertices(AMesh.GetVertexCount(), false),
+      m_LockedVertices(AMesh.GetVertexCount(), false),
+      m_Lines(AMesh.GetLines()),
+      m_Faces(AMesh.GetFaces()),
+      m_RemovedFaces(AMesh.GetFaceCount(), false),
+      m_ullFaceCount(AMesh.GetFaceCount()),
+      m_RefStarts(AMesh.GetVertexCount() + 1, 0),
+      m_RefCounts(AMesh.GetVertexCount(), 0),
+      m_Refs(AMesh.GetFaceCount() * 3),
+      m_ullInitialRefCount(AMesh.GetFaceCount() * 3),
+      m_ullInitialCandidateCount(0),
+      m_Marks(AMesh.GetVertexCount(), 0),
+      m_ullMark(0),
+      m_rMaxError(0) {
+    size_t ullVertexCount = AMesh.GetVertexCount();
+    for (size_t i = 0; i < ullVertexCount; i++) {
+        auto& Vertex = AMesh.GetVertex(i);
+        m_Positions[i] = {{ Vertex[0], Vertex[1], Vertex[2] }};
+    }
+    for (auto& Indices: m_Lines) {
+        m_LockedVertices[Indices[0]] = true;
+        m_LockedVertices[Indices[1]] = true;
+    }
+    // 以面片的面积为权重累加平面
+    for (auto& Indices: m_Faces) {
+        Position Normal = GetNormal(
+            m_Positions[Indices[0]],
+            m_Positions[Indices[1]],
+            m_Positions[Indices[2]]
+        );
+        double rLength = sqrt(
+            Normal[0] * Normal[0] + Normal[1] * Normal[1] + Normal[2] * Normal[2]
+        );
+        if (rLength == 0) {
+            continue;
+        }
+        const Position& Origin = m_Positions[Indices[0]];
+        array<double, 4> Plane {{
+            Normal[0] / rLength,
+            Normal[1] / rLength,
+            Normal[2] / rLength,
+            0
+        }};
+        Plane[3] = -(
+            Plane[0] * Origin[0] + Plane[1] * Origin[1] + Plane[2] * Origin[2]
+        );
+        for (auto ullVertex: Indices) {
+            AddPlane(m_Quadrics[ullVertex], Plane, rLength / 2);
+        }
+    }
+    // 按顶点排列的相邻面列表
+    for (auto& Indices: m_Faces) {
+        for (auto ullVertex: Indices) {
+            m_RefCounts[ullVertex]++;
+        }
+    }
+    for (size_t i = 0; i < ullVertexCount; i++) {
+        m_RefStarts[i + 1] = m_RefStarts[i] + m_RefCounts[i];
+    }
+    m_RefStarts.pop_back();
+    vector<size_t> Filled(ullVertexCount, 0);
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        for (auto ullVertex: m_Faces[i]) {
+            m_Refs[m_RefStarts[ullVertex] + Filled[ullVertex]++] = i;
+        }
+    }
+    // 借助半边结构枚举每条边一次，并为边界边加入约束平面
+    HalfEdgeMesh Topology(AMesh);
+    for (size_t i = 0; i < Topology.GetHalfEdgeCount(); i++) {
+        size_t ullOrigin = Topology.GetOrigin(i);
+        size_t ullTarget = Topology.GetTarget(i);
+        size_t ullTwin = Topology.GetTwin(i);
+        if (ullTwin == HalfEdgeMesh::NONE) {
+            auto& Indices = m_Faces[HalfEdgeMesh::GetFace(i)];
+            Position FaceNormal = GetNormal(
+                m_Positions[Indices[0]],
+                m_Positions[Indices[1]],
+                m_Positions[Indices[2]]
+            );
+            const Position& A = m_Positions[ullOrigin];
+            const Position& B = m_Positions[ullTarget];
+            Position Edge {{ B[0] - A[0], B[1] - A[1], B[2] - A[2] }};
+            // 过边且垂直于面的平面
+            Position Normal {{
+                Edge[1] * FaceNormal[2] - Edge[2] * FaceNormal[1],
+                Edge[2] * FaceNormal[0] - Edge[0] * FaceNormal[2],
+                Edge[0] * FaceNormal[1] - Edge[1] * FaceNormal[0]
+            }};
+            double rLength = sqrt(
+                Normal[0] * Normal[0]
+                + Normal[1] * Normal[1]
+                + Normal[2] * Normal[2]
+            );
+            if (rLength > 0) {
+                array<double, 4> Plane {{
+                    Normal[0] / rLength,
+                    Normal[1] / rLength,
+                    Normal[2] / rLength,
+                    0
+                }};
+                Plane[3] = -(Plane[0] * A[0] + Plane[1] * A[1] + Plane[2] * A[2]);
+                double rWeight = BOUNDARY_WEIGHT * (
+                    Edge[0] * Edge[0] + Edge[1] * Edge[1] + Edge[2] * Edge[2]
+                );
+                AddPlane(m_Quadrics[ullOrigin], Plane, rWeight);
+                AddPlane(m_Quadrics[ullTarget], Plane, rWeight);
+            }
+        }
+        if (ullTwin == HalfEdgeMesh::NONE || i < ullTwin) {
+            PushCandidate(ullOrigin, ullTarget);
+        }
+    }
+    m_ullInitialCandidateCount = m_Heap.size();
+}
+
+/**********************************************************************
+【函数名称】 GetFaceCount
+【函数功能】 获取当前的面数。
+【参数】 无
+【返回值】
+    当前的面数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t Decimator::GetFaceCount() const {
+    return m_ullFaceCount;
+}
+
+/**********************************************************************
+【函数名称】 GetMaxError
+【函数功能】 获取已执行的折叠中的最大二次误差。
+【参数】 无
+【返回值】
+    最大二次误差。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+double Decimator::GetMaxError() const {
+    return m_rMaxError;
+}
+
+/**********************************************************************
+【函数名称】 Decimate
+【函数功能】 按误差从小到大折叠边，直到面数不超过目标、
+    最小的误差超过上限或没有可折叠的边。
+【参数】
+    TargetFaceCount: 目标面数。
+    MaxError: 允许的最大二次误差，默认不限制。
+【返回值】
+    简化后的面数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t Decimator::Decimate(size_t TargetFaceCount, double MaxError) {
+    auto Greater = [](const Candidate& Left, const Candidate& Right) {
+        return Left.Cost > Right.Cost;
+    };
+    while (m_ullFaceCount > TargetFaceCount && !m_Heap.empty()) {
+        if (m_Heap.size() > 2 * m_ullInitialCandidateCount) {
+            CompactHeap();
+            continue;
+        }
+        pop_heap(m_Heap.begin(), m_Heap.end(), Greater);
+        Candidate Top = m_Heap.back();
+        m_Heap.pop_back();
+        if (!IsCandidateValid(Top)) {
+            continue;
+        }
+        if (Top.Cost > MaxError) {
+            // 放回堆中，供之后以更大的上限继续简化
+            m_Heap.push_back(Top);
+            push_heap(m_Heap.begin(), m_Heap.end(), Greater);
+            break;
+        }
+        Position Target;
+        ComputeCollapse(Top.First, Top.Second, Target);
+        // 半边折叠时保留位置被选中的端点
+        if (
+            m_Placement == Placement::ENDPOINT
+            && Target == m_Positions[Top.Second]
+        ) {
+            swap(Top.First, Top.Second);
+        }
+        if (!CanCollapse(Top.First, Top.Second, Target)) {
+            continue;
+        }
+        Collapse(Top.First, Top.Second, Target);
+        m_rMaxError = max(m_rMaxError, Top.Cost);
+    }
+    return m_ullFaceCount;
+}
+
+/**********************************************************************
+【函数名称】 GetMesh
+【函数功能】 获取当前的网格，只保留仍被使用的顶点。
+【参数】 无
+【返回值】
+    当前的网格。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+IndexedMesh<3> Decimator::GetMesh() const {
+    vector<size_t> NewIndices(m_Positions.size(), HalfEdgeMesh::NONE);
+    vector<Point<3>> Vertices;
+    // 按原顺序为仍被使用的顶点重新编号
+    auto Remap = [&NewIndices, &Vertices, this](size_t Index) {
+        if (NewIndices[Index] == HalfEdgeMesh::NONE) {
+            NewIndices[Index] = Vertices.size();
+            Vertices.push_back(Point<3>({
+                m_Positions[Index][0],
+                m_Positions[Index][1],
+                m_Positions[Index][2]
+            }));
+        }
+        return NewIndices[Index];
+    };
+    vector<array<size_t, 2>> Lines;
+    vector<array<size_t, 3>> Faces;
+    Lines.reserve(m_Lines.size());
+    Faces.reserve(m_ullFaceCount);
+    for (auto& Indices: m_Lines) {
+        Lines.push_back({{ Remap(Indices[0]), Remap(Indices[1]) }});
+    }
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        if (m_RemovedFaces[i]) {
+            continue;
+        }
+        auto& Indices = m_Faces[i];
+        Faces.push_back({{
+            Remap(Indices[0]), Remap(Indices[1]), Remap(Indices[2])
+        }});
+    }
+    return IndexedMesh<3>(m_Name, move(Vertices), move(Lines), move(Faces));
+}
+
+/**********************************************************************
+【函数名称】 GetFaces
+【函数功能】 获取当前未被删除的面。
+    下标对应原网格的顶点，使用 ENDPOINT 放置方式时顶点坐标不变。
+【参数】 无
+【返回值】
+    当前的面。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+vector<array<size_t, 3>> Decimator::GetFaces() const {
+    vector<array<size_t, 3>> Faces;
+    Faces.reserve(m_ullFaceCount);
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        if (!m_RemovedFaces[i]) {
+            Faces.push_back(m_Faces[i]);
+        }
+    }
+    return Faces;
+}
+
+/**********************************************************************
+【函数名称】 Simplify
+【函数功能】 简化一个模型。
+【参数】
+    AModel: 要简化的模型。
+    TargetFaceCount: 目标面数。
+    MaxError: 允许的最大二次误差，默认不限制。
+【返回值】
+    简化后的模型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Model<3> Decimator::Simplify(
+    const Model<3>& AModel,
+    size_t TargetFaceCount,
+    double MaxError
+) {
+    Decimator ADecimator { IndexedMesh<3>(AModel) };
+    ADecimator.Decimate(TargetFaceCount, MaxError);
+    return ADecimator.GetMesh().ToModel();
+}
+
+/**********************************************************************
+【函数名称】 AddPlane
+【函数功能】 将平面 ax+by+cz+d=0 的距离平方乘以权重加入二次型。
+【参数】
+    AQuadric: 要修改的二次型。
+    Plane: 平面的系数 a, b, c, d，(a, b, c) 为单位向量。
+    Weight: 权重。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void Decimator::AddPlane(
+    Quadric& AQuadric,
+    const array<double, 4>& Plane,
+    double Weight
+) {
+    size_t ullIndex = 0;
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = i; j < 4; j++) {
+            AQuadric[ullIndex++] += Weight * Plane[i] * Plane[j];
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 Evaluate
+【函数功能】 求二次型在一点处的值。
+【参数】
+    AQuadric: 二次型。
+    APosition: 点的坐标。
+【返回值】
+    二次型的值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+double Decimator::Evaluate(const Quadric& AQuadric, const Position& APosition) {
+    double rX = APosition[0];
+    double rY = APosition[1];
+    double rZ = APosition[2];
+    return AQuadric[0] * rX * rX + 2 * AQuadric[1] * rX * rY
+        + 2 * AQuadric[2] * rX * rZ + 2 * AQuadric[3] * rX
+        + AQuadric[4] * rY * rY + 2 * AQuadric[5] * rY * rZ
+        + 2 * AQuadric[6] * rY
+        + AQuadric[7] * rZ * rZ + 2 * AQuadric[8] * rZ
+        + AQuadric[9];
+}
+
+/**********************************************************************
+【函数名称】 GetNormal
+【函数功能】 求三点构成的三角形的（未归一化的）法向量。
+【参数】
+    A, B, C: 三角形的三个顶点。
+【返回值】
+    (B-A)×(C-A)。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Decimator::Position Decimator::GetNormal(
+    const Position& A,
+    const Position& B,
+    const Position& C
+) {
+    double rX1 = B[0] - A[0];
+    double rY1 = B[1] - A[1];
+    double rZ1 = B[2] - A[2];
+    double rX2 = C[0] - A[0];
+    double rY2 = C[1] - A[1];
+    double rZ2 = C[2] - A[2];
+    return {{
+        rY1 * rZ2 - rZ1 * rY2,
+        rZ1 * rX2 - rX1 * rZ2,
+        rX1 * rY2 - rY1 * rX2
+    }};
+}
+
+/**********************************************************************
+【函数名称】 ComputeCollapse
+【函数功能】 求折叠一条边后新顶点的最优位置与误差。
+    二次型可逆时取其极小点，否则在两端点与中点中取误差最小者；
+    ENDPOINT 放置方式只在两端点中选取。
+【参数】
+    First: 第一个端点。
+    Second: 第二个端点。
+    Result: 输出新顶点的位置。
+【返回值】
+    折叠的误差。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+double Decimator::ComputeCollapse(
+    size_t First,
+    size_t Second,
+    Position& Result
+) const {
+    Quadric Sum;
+    for (size_t i = 0; i < Sum.size(); i++) {
+        Sum[i] = m_Quadrics[First][i] + m_Quadrics[Second][i];
+    }
+    // 解 A·x = -b，A 为二次型左上角的 3×3 部分
+    double rA = Sum[0], rB = Sum[1], rC = Sum[2];
+    double rE = Sum[4], rF = Sum[5], rI = Sum[7];
+    double rCofactor0 = rE * rI - rF * rF;
+    double rCofactor1 = rC * rF - rB * rI;
+    double rCofactor2 = rB * rF - rC * rE;
+    double rDeterminant = rA * rCofactor0 + rB * rCofactor1 + rC * rCofactor2;
+    double rScale = rA + rE + rI;
+    if (
+        m_Placement == Placement::OPTIMAL
+        && fabs(rDeterminant) > 1e-9 * rScale * rScale * rScale
+    ) {
+        double rCofactor4 = rA * rI - rC * rC;
+        double rCofactor5 = rB * rC - rA * rF;
+        double rCofactor8 = rA * rE - rB * rB;
+        double rX = -Sum[3], rY = -Sum[6], rZ = -Sum[8];
+        Result = {{
+            (rCofactor0 * rX + rCofactor1 * rY + rCofactor2 * rZ)
+                / rDeterminant,
+            (rCofactor1 * rX + rCofactor4 * rY + rCofactor5 * rZ)
+                / rDeterminant,
+            (rCofactor2 * rX + rCofactor5 * rY + rCofactor8 * rZ)
+                / rDeterminant
+        }};
+        return Evaluate(Sum, Result);
+    }
+    const Position& A = m_Positions[First];
+    const Position& B = m_Positions[Second];
+    array<Position, 3> Choices {{
+        A,
+        B,
+        {{ (A[0] + B[0]) / 2, (A[1] + B[1]) / 2, (A[2] + B[2]) / 2 }}
+    }};
+    size_t ullChoiceCount = m_Placement == Placement::ENDPOINT ? 2 : 3;
+    double rBest = numeric_limits<double>::infinity();
+    for (size_t i = 0; i < ullChoiceCount; i++) {
+        double rCost = Evaluate(Sum, Choices[i]);
+        if (rCost < rBest) {
+            rBest = rCost;
+            Result = Choices[i];
+        }
+    }
+    return rBest;
+}
+
+/**********************************************************************
+【函数名称】 PushCandidate
+【函数功能】 计算一条边的误差并加入堆。锁定的边不加入。
+【参数】
+    First: 第一个端点。
+    Second: 第二个端点。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void Decimator::PushCandidate(size_t First, size_t Second) {
+    if (m_LockedVertices[First] || m_LockedVertices[Second]) {
+        return;
+    }
+    Position Target;
+    m_Heap.push_back(Candidate {
+        /* .Cost          */ ComputeCollapse(First, Second, Target),
+        /* .First         */ First,
+        /* .Second        */ Second,
+        /* .FirstVersion  */ m_Versions[First],
+        /* .SecondVersion */ m_Versions[Second]
+    });
+    push_heap(
+        m_Heap.begin(),
+        m_Heap.end(),
+        [](const Candidate& Left, const Candidate& Right) {
+            return Left.Cost > Right.Cost;
+        }
+    );
+}
+
+/**********************************************************************
+【函数名称】 IsCandidateValid
+【函数功能】 判断堆中的候选边是否仍然有效。
+【参数】
+    ACandidate: 候选边。
+【返回值】
+    两端点均未被折叠且版本未变。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool Decimator::IsCandidateValid(const Candidate& ACandidate) const {
+    return !m_RemovedVertices[ACandidate.First]
+        && !m_RemovedVertices[ACandidate.Second]
+        && m_Versions[ACandidate.First] == ACandidate.FirstVersion
+        && m_Versions[ACandidate.Second] == ACandidate.SecondVersion;
+}
+
+/**********************************************************************
+【函数名称】 CanCollapse
+【函数功能】 判断折叠是否会产生非流形结构或使面翻转。
+【参数】
+    First: 保留的端点。
+    Second: 被删除的端点。
+    Target: 新顶点的位置。
+【返回值】
+    是否可以折叠。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool Decimator::CanCollapse(
+    size_t First,
+    size_t Second,
+    const Position& Target
+) {
+    // 连接条件：两端点的公共邻点恰好是同时包含两者的面的第三个顶点
+    size_t ullFirstMark = ++m_ullMark;
+    size_t ullSharedFaceCount = 0;
+    for (size_t i = 0; i < m_RefCounts[First]; i++) {
+        size_t ullFace = m_Refs[m_RefStarts[First] + i];
+        if (m_RemovedFaces[ullFace]) {
+            continue;
+        }
+        auto& Indices = m_Faces[ullFace];
+        if (
+            Indices[0] == Second || Indices[1] == Second || Indices[2] == Second
+        ) {
+            ullSharedFaceCount++;
+        }
+        for (auto ullVertex: Indices) {
+            m_Marks[ullVertex] = ullFirstMark;
+        }
+    }
+    // 第二个标记值用于避免重复计数
+    size_t ullSecondMark = ++m_ullMark;
+    size_t ullCommonCount = 0;
+    for (size_t i = 0; i < m_RefCounts[Second]; i++) {
+        size_t ullFace = m_Refs[m_RefStarts[Second] + i];
+        if (m_RemovedFaces[ullFace]) {
+            continue;
+        }
+        for (auto ullVertex: m_Faces[ullFace]) {
+            if (ullVertex == First || ullVertex == Second) {
+                continue;
+            }
+            if (m_Marks[ullVertex] == ullFirstMark) {
+                ullCommonCount++;
+                m_Marks[ullVertex] = ullSecondMark;
+            }
+        }
+    }
+    if (ullCommonCount != ullSharedFaceCount) {
+        return false;
+    }
+    return !IsFlipped(First, Second, Target) && !IsFlipped(Second, First, Target);
+}
+
+/**********************************************************************
+【函数名称】 IsFlipped
+【函数功能】 判断移动顶点后其相邻面是否翻转或退化。
+【参数】
+    Vertex: 要移动的顶点。
+    Other: 边的另一个端点，同时包含两者的面将被删除，不检查。
+    Target: 新的位置。
+【返回值】
+    是否有面翻转或退化。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool Decimator::IsFlipped(
+    size_t Vertex,
+    size_t Other,
+    const Position& Target
+) const {
+    for (size_t i = 0; i < m_RefCounts[Vertex]; i++) {
+        size_t ullFace = m_Refs[m_RefStarts[Vertex] + i];
+        if (m_RemovedFaces[ullFace]) {
+            continue;
+        }
+        auto& Indices = m_Faces[ullFace];
+        if (Indices[0] == Other || Indices[1] == Other || Indices[2] == Other) {
+            continue;
+        }
+        array<Position, 3> Corners;
+        for (size_t j = 0; j < 3; j++) {
+            Corners[j] = m_Positions[Indices[j]];
+        }
+        Position Before = GetNormal(Corners[0], Corners[1], Corners[2]);
+        for (size_t j = 0; j < 3; j++) {
+            if (Indices[j] == Vertex) {
+                Corners[j] = Target;
+            }
+        }
+        Position After = GetNormal(Corners[0], Corners[1], Corners[2]);
+        double rDot = Before[0] * After[0]
+            + Before[1] * After[1]
+            + Before[2] * After[2];
+        double rBefore = sqrt(
+            Before[0] * Before[0] + Before[1] * Before[1] + Before[2] * Before[2]
+        );
+        double rAfter = sqrt(
+            After[0] * After[0] + After[1] * After[1] + After[2] * After[2]
+        );
+        // 新的面退化，或法向偏转超过约 78 度
+        if (rAfter <= 1e-12 * rBefore || rDot < 0.2 * rBefore * rAfter) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**********************************************************************
+【函数名称】 Collapse
+【函数功能】 将 Second 折叠到 First，并更新邻接关系与候选边。
+【参数】
+    First: 保留的端点。
+    Second: 被删除的端点。
+    Target: 新顶点的位置。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void Decimator::Collapse(
+    size_t First,
+    size_t Second,
+    const Position& Target
+) {
+    for (size_t i = 0; i < m_Quadrics[First].size(); i++) {
+        m_Quadrics[First][i] += m_Quadrics[Second][i];
+    }
+    m_Positions[First] = Target;
+    m_RemovedVertices[Second] = true;
+    m_Versions[First]++;
+    m_Versions[Second]++;
+    // 新的相邻面列表追加在末尾
+    size_t ullStart = m_Refs.size();
+    for (auto ullVertex: { First, Second }) {
+        for (size_t i = 0; i < m_RefCounts[ullVertex]; i++) {
+            size_t ullFace = m_Refs[m_RefStarts[ullVertex] + i];
+            if (m_RemovedFaces[ullFace]) {
+                continue;
+            }
+            auto& Indices = m_Faces[ullFace];
+            bool bHasFirst = false;
+            bool bHasSecond = false;
+            for (auto& ullIndex: Indices) {
+                bHasFirst = bHasFirst || ullIndex == First;
+                bHasSecond = bHasSecond || ullIndex == Second;
+            }
+            if (bHasFirst && bHasSecond) {
+                // 包含整条边的面退化，删除
+                m_RemovedFaces[ullFace] = true;
+                m_ullFaceCount--;
+                continue;
+            }
+            for (auto& ullIndex: Indices) {
+                if (ullIndex == Second) {
+                    ullIndex = First;
+                }
+            }
+            m_Refs.push_back(ullFace);
+        }
+    }
+    m_RefStarts[First] = ullStart;
+    m_RefCounts[First] = m_Refs.size() - ullStart;
+    m_RefCounts[Second] = 0;
+    // 重新计算与 First 相连的边
+    size_t ullMark = ++m_ullMark;
+    m_Marks[First] = ullMark;
+    for (size_t i = 0; i < m_RefCounts[First]; i++) {
+        for (auto ullVertex: m_Faces[m_Refs[ullStart + i]]) {
+            if (m_Marks[ullVertex] != ullMark) {
+                m_Marks[ullVertex] = ullMark;
+                PushCandidate(First, ullVertex);
+            }
+        }
+    }
+    if (m_Refs.size() > 2 * m_ullInitialRefCount) {
+        CompactRefs();
+    }
+}
+
+/**********************************************************************
+【函数名称】 CompactRefs
+【函数功能】 重新排列 m_Refs，去除已删除的面与旧的列表。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void Decimator::CompactRefs() {
+    vector<size_t> Refs;
+    Refs.reserve(m_ullFaceCount * 3);
+    for (size_t i = 0; i < m_RefCounts.size(); i++) {
+        size_t ullStart = Refs.size();
+        for (size_t j = 0; j < m_RefCounts[i]; j++) {
+            size_t ullFace = m_Refs[m_RefStarts[i] + j];
+            if (!m_RemovedFaces[ullFace]) {
+                Refs.push_back(ullFace);
+            }
+        }
+        m_RefStarts[i] = ullStart;
+        m_RefCounts[i] = Refs.size() - ullStart;
+    }
+    m_Refs.swap(Refs);
+}
+
+/**********************************************************************
+【函数名称】 CompactHeap
+【函数功能】 清除堆中已失效的候选边并重新建堆。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void Decimator::CompactHeap() {
+    m_Heap.erase(
+        remove_if(
+            m_Heap.begin(),
+            m_Heap.end(),
+            [this](const Candidate& ACandidate) {
+                return !IsCandidateValid(ACandidate);
+            }
+        ),
+        m_Heap.end()
+    );
+    make_heap(
+        m_Heap.begin(),
+        m_Heap.end(),
+        [](const Candidate& Left, const Candidate& Right) {
+            return Left.Cost > Right.Cost;
+        }
+    );
+    // 有效的候选边不超过当前的边数，若仍然过多则放宽上限
+    m_ullInitialCandidateCount = max(m_ullInitialCandidateCount, m_Heap.size());
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,389 @@
+/*************************************************************************
+【文件名】 Decimator.hpp
+【功能模块和目的】 Decimator 类使用二次误差度量简化三维三角网格。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef DECIMATOR_HPP
+#define DECIMATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+#include "IndexedMesh.hpp"
+#include "../Core/Model.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 Decimator
+【功能】 基于二次误差度量（QEM）的边折叠简化。
+    每个顶点维护一个 4×4 对称二次型，表示到相邻平面距离的平方和，
+    边界边额外加入垂直于面的约束平面，避免边界收缩。
+    候选边保存在以误差为键的最小堆中，顶点改变后通过版本号使旧的候选失效，
+    堆中失效的项过多时整体清理，因此内存与网格大小成线性。
+    折叠前检查连接条件（不产生非流形）与法向翻转。
+    被线段引用的顶点保持不动。
+    使用 ENDPOINT 放置方式时新顶点总取某一端点，各层级可共享原顶点。
+【接口说明】
+    内嵌类型：
+        Placement: 新顶点的放置方式。
+    成员：
+        BOUNDARY_WEIGHT: 边界约束平面的权重。
+    构造与析构：
+        接受 IndexedMesh<3> 与放置方式的构造函数。
+        拷贝构造函数。
+    属性：
+        GetFaceCount: 获取当前的面数。
+        GetMaxError: 获取已执行的折叠中的最大误差。
+    操作：
+        Decimate: 折叠边直到达到目标面数或误差上限，可多次调用逐步简化。
+        GetMesh: 获取当前的网格。
+        GetFaces: 获取当前的面，下标对应原网格的顶点。
+        Simplify: 简化一个模型。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class Decimator final {
+    public:
+        // 内嵌类型
+
+        /**********************************************************************
+        【类名】 Placement
+        【功能】 折叠一条边后新顶点的放置方式。
+        【接口说明】 枚举，表示放置方式。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        enum class Placement {
+            // 二次型的极小点
+            OPTIMAL,
+            // 误差较小的端点（半边折叠）
+            ENDPOINT
+        };
+
+        // 成员
+
+        // 边界约束平面的权重
+        static constexpr double BOUNDARY_WEIGHT { 1000 };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 从网格初始化二次型、邻接关系与候选边。
+        【参数】
+            AMesh: 要简化的网格。
+            APlacement: 新顶点的放置方式，默认为 OPTIMAL。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit Decimator(
+            const IndexedMesh<3>& AMesh,
+            Placement APlacement = Placement::OPTIMAL
+        );
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一简化器初始化 Decimator 对象。
+        【参数】
+            Other: 另一个简化器。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Decimator(const Decimator& Other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetFaceCount
+        【函数功能】 获取当前的面数。
+        【参数】 无
+        【返回值】
+            当前的面数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetFaceCount() const;
+        /**********************************************************************
+        【函数名称】 GetMaxError
+        【函数功能】 获取已执行的折叠中的最大二次误差。
+        【参数】 无
+        【返回值】
+            最大二次误差。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        double GetMaxError() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Decimate
+        【函数功能】 按误差从小到大折叠边，直到面数不超过目标、
+            最小的误差超过上限或没有可折叠的边。
+        【参数】
+            TargetFaceCount: 目标面数。
+            MaxError: 允许的最大二次误差，默认不限制。
+        【返回值】
+            简化后的面数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t Decimate(
+            size_t TargetFaceCount,
+            double MaxError = numeric_limits<double>::infinity()
+        );
+        /**********************************************************************
+        【函数名称】 GetMesh
+        【函数功能】 获取当前的网格，只保留仍被使用的顶点。
+        【参数】 无
+        【返回值】
+            当前的网格。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        IndexedMesh<3> GetMesh() const;
+        /**********************************************************************
+        【函数名称】 GetFaces
+        【函数功能】 获取当前未被删除的面。
+            下标对应原网格的顶点，使用 ENDPOINT 放置方式时顶点坐标不变。
+        【参数】 无
+        【返回值】
+            当前的面。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        vector<array<size_t, 3>> GetFaces() const;
+        /**********************************************************************
+        【函数名称】 Simplify
+        【函数功能】 简化一个模型。
+        【参数】
+            AModel: 要简化的模型。
+            TargetFaceCount: 目标面数。
+            MaxError: 允许的最大二次误差，默认不限制。
+        【返回值】
+            简化后的模型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Model<3> Simplify(
+            const Model<3>& AModel,
+            size_t TargetFaceCount,
+            double MaxError = numeric_limits<double>::infinity()
+        );
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一简化器赋值给自身。
+        【参数】
+            Other: 从之取值的简化器。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Decimator& operator=(const Decimator& Other) = default;
+
+    private:
+        // 对称 4×4 二次型的上三角部分：
+        // aa ab ac ad bb bc bd cc cd dd
+        using Quadric = array<double, 10>;
+        // 三维坐标
+        using Position = array<double, 3>;
+
+        /**********************************************************************
+        【类名】 Candidate
+        【功能】 堆中的候选边。
+        【接口说明】 折叠误差，两端点及创建时两端点的版本号。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct Candidate {
+            // 折叠误差
+            double Cost;
+            // 第一个端点
+            size_t First;
+            // 第二个端点
+            size_t Second;
+            // 创建时第一个端点的版本
+            unsigned FirstVersion;
+            // 创建时第二个端点的版本
+            unsigned SecondVersion;
+        };
+
+        // 模型的名称
+        string m_Name;
+        // 新顶点的放置方式
+        Placement m_Placement;
+        // 顶点坐标
+        vector<Position> m_Positions;
+        // 顶点的二次型
+        vector<Quadric> m_Quadrics;
+        // 顶点的版本，每次改变时增加
+        vector<unsigned> m_Versions;
+        // 顶点是否已被折叠
+        vector<bool> m_RemovedVertices;
+        // 顶点是否被锁定（被线段引用）
+        vector<bool> m_LockedVertices;
+        // 线段
+        vector<array<size_t, 2>> m_Lines;
+        // 面
+        vector<array<size_t, 3>> m_Faces;
+        // 面是否已被删除
+        vector<bool> m_RemovedFaces;
+        // 当前的面数
+        size_t m_ullFaceCount;
+        // 每个顶点的相邻面在 m_Refs 中的起始位置
+        vector<size_t> m_RefStarts;
+        // 每个顶点的相邻面个数（含已删除的面）
+        vector<size_t> m_RefCounts;
+        // 顶点的相邻面，折叠后新的列表追加在末尾
+        vector<size_t> m_Refs;
+        // m_Refs 的初始长度，超过其两倍时整理
+        size_t m_ullInitialRefCount;
+        // 候选边构成的最小堆
+        vector<Candidate> m_Heap;
+        // 初始的候选边个数，堆超过其两倍时清理
+        size_t m_ullInitialCandidateCount;
+        // 求邻点集合时使用的标记
+        vector<size_t> m_Marks;
+        // 当前的标记值
+        size_t m_ullMark;
+        // 已执行的折叠中的最大误差
+        double m_rMaxError;
+
+        /**********************************************************************
+        【函数名称】 AddPlane
+        【函数功能】 将平面 ax+by+cz+d=0 的距离平方乘以权重加入二次型。
+        【参数】
+            AQuadric: 要修改的二次型。
+            Plane: 平面的系数 a, b, c, d，(a, b, c) 为单位向量。
+            Weight: 权重。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void AddPlane(
+            Quadric& AQuadric,
+            const array<double, 4>& Plane,
+            double Weight
+        );
+        /**********************************************************************
+        【函数名称】 Evaluate
+        【函数功能】 求二次型在一点处的值。
+        【参数】
+            AQuadric: 二次型。
+            APosition: 点的坐标。
+        【返回值】
+            二次型的值。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static double Evaluate(const Quadric& AQuadric, const Position& APosition);
+        /**********************************************************************
+        【函数名称】 GetNormal
+        【函数功能】 求三点构成的三角形的（未归一化的）法向量。
+        【参数】
+            A, B, C: 三角形的三个顶点。
+        【返回值】
+            (B-A)×(C-A)。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Position GetNormal(
+            const Position& A,
+            const Position& B,
+            const Position& C
+        );
+        /**********************************************************************
+        【函数名称】 ComputeCollapse
+        【函数功能】 求折叠一条边后新顶点的最优位置与误差。
+            二次型可逆时取其极小点，否则在两端点与中点中取误差最小者；
+            ENDPOINT 放置方式只在两端点中选取。
+        【参数】
+            First: 第一个端点。
+            Second: 第二个端点。
+            Result: 输出新顶点的位置。
+        【返回值】
+            折叠的误差。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        double ComputeCollapse(
+            size_t First,
+            size_t Second,
+            Position& Result
+        ) const;
+        /**********************************************************************
+        【函数名称】 PushCandidate
+        【函数功能】 计算一条边的误差并加入堆。锁定的边不加入。
+        【参数】
+            First: 第一个端点。
+            Second: 第二个端点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void PushCandidate(size_t First, size_t Second);
+        /**********************************************************************
+        【函数名称】 IsCandidateValid
+        【函数功能】 判断堆中的候选边是否仍然有效。
+        【参数】
+            ACandidate: 候选边。
+        【返回值】
+            两端点均未被折叠且版本未变。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsCandidateValid(const Candidate& ACandidate) const;
+        /**********************************************************************
+        【函数名称】 CanCollapse
+        【函数功能】 判断折叠是否会产生非流形结构或使面翻转。
+        【参数】
+            First: 保留的端点。
+            Second: 被删除的端点。
+            Target: 新顶点的位置。
+        【返回值】
+            是否可以折叠。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool CanCollapse(size_t First, size_t Second, const Position& Target);
+        /**********************************************************************
+        【函数名称】 IsFlipped
+        【函数功能】 判断移动顶点后其相邻面是否翻转或退化。
+        【参数】
+            Vertex: 要移动的顶点。
+            Other: 边的另一个端点，同时包含两者的面将被删除，不检查。
+            Target: 新的位置。
+        【返回值】
+            是否有面翻转或退化。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsFlipped(size_t Vertex, size_t Other, const Position& Target) const;
+        /**********************************************************************
+        【函数名称】 Collapse
+        【函数功能】 将 Second 折叠到 First，并更新邻接关系与候选边。
+        【参数】
+            First: 保留的端点。
+            Second: 被删除的端点。
+            Target: 新顶点的位置。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Collapse(size_t First, size_t Second, const Position& Target);
+        /**********************************************************************
+        【函数名称】 CompactRefs
+        【函数功能】 重新排列 m_Refs，去除已删除的面与旧的列表。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void CompactRefs();
+        /**********************************************************************
+        【函数名称】 CompactHeap
+        【函数功能】 清除堆中已失效的候选边并重新建堆。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void CompactHeap();
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
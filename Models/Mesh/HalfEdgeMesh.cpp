@@ -0,0 +1,356 @@
+/*************************************************************************
+【文件名】 HalfEdgeMesh.cpp
+【功能模块和目的】 为 HalfEdgeMesh.hpp 提供非模板实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "HalfEdgeMesh.hpp"
+#include "../Errors/IndexOverflowException.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Mesh {
+
+// 表示不存在的半边或面。
+constexpr size_t HalfEdgeMesh::NONE;
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 从面的顶点下标建立半边结构。只有方向相反的两条半边
+    互为对边；同一条边上的两条半边同向时，两个面的朝向不一致，
+    该边视为非流形边。
+【参数】
+    VertexCount: 顶点的个数。
+    Faces: 每个面的三个顶点下标。
+【返回值】 无
+    如果顶点下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+HalfEdgeMesh::HalfEdgeMesh(
+    size_t VertexCount, 
+    const vector<array<size_t, 3>>& Faces
+): m_Origins(Faces.size() * 3),
+   m_Twins(Faces.size() * 3, NONE),
+   m_NonManifold(Faces.size() * 3, false),
+   m_VertexHalfEdges(VertexCount, NONE),
+   m_Valences(VertexCount, 0) {
+    size_t ullHalfEdgeCount = m_Origins.size();
+    for (size_t i = 0; i < ullHalfEdgeCount; i++) {
+        size_t ullVertex = Faces[i / 3][i % 3];
+        if (ullVertex >= VertexCount) {
+            throw IndexOverflowException(ullVertex, VertexCount);
+        }
+        m_Origins[i] = ullVertex;
+    }
+    // 以无向边为键，记录第一条经过它的半边
+    unordered_map<pair<size_t, size_t>, size_t, EdgeHash> EdgeMap;
+    EdgeMap.reserve(ullHalfEdgeCount);
+    for (size_t i = 0; i < ullHalfEdgeCount; i++) {
+        size_t ullOrigin = GetOrigin(i);
+        size_t ullTarget = GetTarget(i);
+        auto Result = EdgeMap.emplace(
+            make_pair(min(ullOrigin, ullTarget), max(ullOrigin, ullTarget)),
+            i
+        );
+        if (Result.second) {
+            m_Valences[ullOrigin]++;
+            m_Valences[ullTarget]++;
+            continue;
+        }
+        size_t ullFirst = Result.first->second;
+        if (m_NonManifold[ullFirst]) {
+            // 第四个及以后的面
+            m_NonManifold[i] = true;
+            m_ullNonManifoldEdgeCount++;
+        }
+        else if (
+            m_Twins[ullFirst] == NONE &&
+            GetOrigin(ullFirst) == ullTarget &&
+            GetTarget(ullFirst) == ullOrigin
+        ) {
+            // 第二个面且方向相反，两条半边互为对边
+            m_Twins[ullFirst] = i;
+            m_Twins[i] = ullFirst;
+        }
+        else if (m_Twins[ullFirst] == NONE) {
+            // 第二个面但方向相同，两个面的朝向不一致，不能配对
+            m_NonManifold[ullFirst] = true;
+            m_NonManifold[i] = true;
+            m_ullNonManifoldEdgeCount += 2;
+        }
+        else {
+            // 第三个面，已配对的两条半边也不再有唯一的对边
+            size_t ullSecond = m_Twins[ullFirst];
+            m_Twins[ullFirst] = NONE;
+            m_Twins[ullSecond] = NONE;
+            m_NonManifold[ullFirst] = true;
+            m_NonManifold[ullSecond] = true;
+            m_NonManifold[i] = true;
+            m_ullNonManifoldEdgeCount += 3;
+        }
+    }
+    for (size_t i = 0; i < ullHalfEdgeCount; i++) {
+        bool bBoundary = IsBoundary(i);
+        if (bBoundary) {
+            m_ullBoundaryEdgeCount++;
+        }
+        size_t& ullVertexHalfEdge = m_VertexHalfEdges[GetOrigin(i)];
+        if (ullVertexHalfEdge == NONE || bBoundary) {
+            ullVertexHalfEdge = i;
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetVertexCount
+【函数功能】 获取顶点的个数。
+【参数】 无
+【返回值】
+    顶点的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetVertexCount() const {
+    return m_VertexHalfEdges.size();
+}
+
+/**********************************************************************
+【函数名称】 GetFaceCount
+【函数功能】 获取面的个数。
+【参数】 无
+【返回值】
+    面的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetFaceCount() const {
+    return m_Origins.size() / 3;
+}
+
+/**********************************************************************
+【函数名称】 GetHalfEdgeCount
+【函数功能】 获取半边的个数，等于面数的三倍。
+【参数】 无
+【返回值】
+    半边的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetHalfEdgeCount() const {
+    return m_Origins.size();
+}
+
+/**********************************************************************
+【函数名称】 GetBoundaryEdgeCount
+【函数功能】 获取边界边（只属于一个面的边）的个数。
+【参数】 无
+【返回值】
+    边界边的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetBoundaryEdgeCount() const {
+    return m_ullBoundaryEdgeCount;
+}
+
+/**********************************************************************
+【函数名称】 GetNonManifoldEdgeCount
+【函数功能】 获取位于非流形边上的半边个数。
+【参数】 无
+【返回值】
+    位于非流形边上的半边个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetNonManifoldEdgeCount() const {
+    return m_ullNonManifoldEdgeCount;
+}
+
+/**********************************************************************
+【函数名称】 GetOrigin
+【函数功能】 获取半边的起点。
+【参数】
+    HalfEdge: 半边的下标。
+【返回值】
+    半边起点的顶点下标。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetOrigin(size_t HalfEdge) const {
+    return m_Origins[HalfEdge];
+}
+
+/**********************************************************************
+【函数名称】 GetTarget
+【函数功能】 获取半边的终点。
+【参数】
+    HalfEdge: 半边的下标。
+【返回值】
+    半边终点的顶点下标。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetTarget(size_t HalfEdge) const {
+    return m_Origins[GetNext(HalfEdge)];
+}
+
+/**********************************************************************
+【函数名称】 GetFace
+【函数功能】 获取半边所在的面。
+【参数】
+    HalfEdge: 半边的下标。
+【返回值】
+    面的下标。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetFace(size_t HalfEdge) {
+    return HalfEdge / 3;
+}
+
+/**********************************************************************
+【函数名称】 GetHalfEdge
+【函数功能】 获取面的第 i 条半边，它从面的第 i 个顶点出发。
+【参数】
+    Face: 面的下标。
+    Corner: 顶点在面中的位置，取 0、1、2。
+【返回值】
+    半边的下标。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetHalfEdge(size_t Face, size_t Corner) {
+    return Face * 3 + Corner;
+}
+
+/**********************************************************************
+【函数名称】 GetNext
+【函数功能】 获取同一面内的下一条半边。
+【参数】
+    HalfEdge: 半边的下标。
+【返回值】
+    下一条半边的下标。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetNext(size_t HalfEdge) {
+    return HalfEdge % 3 == 2 ? HalfEdge - 2 : HalfEdge + 1;
+}
+
+/**********************************************************************
+【函数名称】 GetPrev
+【函数功能】 获取同一面内的上一条半边。
+【参数】
+    HalfEdge: 半边的下标。
+【返回值】
+    上一条半边的下标。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetPrev(size_t HalfEdge) {
+    return HalfEdge % 3 == 0 ? HalfEdge + 2 : HalfEdge - 1;
+}
+
+/**********************************************************************
+【函数名称】 GetTwin
+【函数功能】 获取同一条边上属于相邻面的半边。
+【参数】
+    HalfEdge: 半边的下标。
+【返回值】
+    对边的下标，边界边或非流形边返回 NONE。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetTwin(size_t HalfEdge) const {
+    return m_Twins[HalfEdge];
+}
+
+/**********************************************************************
+【函数名称】 GetAdjacentFace
+【函数功能】 获取面的第 i 条边另一侧的面。
+【参数】
+    Face: 面的下标。
+    Corner: 边的起点在面中的位置，取 0、1、2。
+【返回值】
+    相邻面的下标，边界边或非流形边返回 NONE。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetAdjacentFace(size_t Face, size_t Corner) const {
+    size_t ullTwin = m_Twins[GetHalfEdge(Face, Corner)];
+    return ullTwin == NONE ? NONE : GetFace(ullTwin);
+}
+
+/**********************************************************************
+【函数名称】 GetVertexHalfEdge
+【函数功能】 获取从顶点出发的一条半边。
+    如果顶点位于边界上，返回从它出发的边界半边，
+    这样沿 GetTwin(GetPrev(H)) 旋转即可遍历所有相邻的面。
+【参数】
+    Vertex: 顶点的下标。
+【返回值】
+    半边的下标，顶点不属于任何面时返回 NONE。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetVertexHalfEdge(size_t Vertex) const {
+    return m_VertexHalfEdges[Vertex];
+}
+
+/**********************************************************************
+【函数名称】 GetValence
+【函数功能】 获取顶点的度，即与之相连的不同边的条数。
+【参数】
+    Vertex: 顶点的下标。
+【返回值】
+    顶点的度。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::GetValence(size_t Vertex) const {
+    return m_Valences[Vertex];
+}
+
+/**********************************************************************
+【函数名称】 IsBoundary
+【函数功能】 判断半边是否位于边界上，即所在的边只属于一个面。
+【参数】
+    HalfEdge: 半边的下标。
+【返回值】
+    半边是否位于边界上。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool HalfEdgeMesh::IsBoundary(size_t HalfEdge) const {
+    return m_Twins[HalfEdge] == NONE && !m_NonManifold[HalfEdge];
+}
+
+/**********************************************************************
+【函数名称】 IsNonManifold
+【函数功能】 判断半边是否位于非流形边上，即所在的边属于三个以上的面，
+    或属于两个面但两条半边同向。
+【参数】
+    HalfEdge: 半边的下标。
+【返回值】
+    半边是否位于非流形边上。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool HalfEdgeMesh::IsNonManifold(size_t HalfEdge) const {
+    return m_NonManifold[HalfEdge];
+}
+
+/**********************************************************************
+【函数名称】 EdgeHash::operator()
+【函数功能】 求边的哈希值。
+【参数】
+    Edge: 较小与较大的端点下标。
+【返回值】
+    边的哈希值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t HalfEdgeMesh::EdgeHash::operator()(
+    const pair<size_t, size_t>& Edge
+) const {
+    hash<size_t> Hasher;
+    size_t ullSeed = Hasher(Edge.first);
+    ullSeed ^= Hasher(Edge.second) 
+        + 0x9e3779b97f4a7c15ULL + (ullSeed << 6) + (ullSeed >> 2);
+    return ullSeed;
+}
+
+}
+
+}
\ No newline at end of file
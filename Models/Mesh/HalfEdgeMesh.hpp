@@ -0,0 +1,340 @@
+/*************************************************************************
+【文件名】 HalfEdgeMesh.hpp
+【功能模块和目的】 HalfEdgeMesh 类以半边（角表）结构存储三角网格的拓扑。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef HALF_EDGE_MESH_HPP
+#define HALF_EDGE_MESH_HPP
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "IndexedMesh.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 HalfEdgeMesh
+【功能】 三角网格的紧凑半边结构。第 F 个面的三条半边下标为 3F、3F+1、3F+2，
+    半边 H 从 GetOrigin(H) 指向 GetTarget(H)，因此 Next、Prev、GetFace
+    均可由下标直接算出，只需存储顶点与对边两个数组。
+【接口说明】 
+    成员：
+        NONE: 表示不存在的半边或面。
+    构造与析构：
+        默认构造函数，创建空的结构。
+        接受顶点个数与面的顶点下标的构造函数，以哈希表配对半边，时间为线性。
+        接受 IndexedMesh 的构造函数。
+        拷贝构造函数。
+    属性：
+        GetVertexCount: 获取顶点的个数。
+        GetFaceCount: 获取面的个数。
+        GetHalfEdgeCount: 获取半边的个数。
+        GetBoundaryEdgeCount: 获取边界边的个数。
+        GetNonManifoldEdgeCount: 获取非流形边上的半边个数。
+    访问器（均为 O(1)）：
+        GetOrigin/GetTarget: 获取半边的起点/终点。
+        GetFace: 获取半边所在的面。
+        GetHalfEdge: 获取面的第 i 条半边。
+        GetNext/GetPrev: 获取同一面内的下一条/上一条半边。
+        GetTwin: 获取对边，边界或非流形边返回 NONE。
+        GetAdjacentFace: 获取面的第 i 条边另一侧的面。
+        GetVertexHalfEdge: 获取从顶点出发的一条半边，边界顶点优先返回边界半边。
+        GetValence: 获取顶点的度（相连的边数）。
+        IsBoundary: 判断半边是否在边界上。
+        IsNonManifold: 判断半边是否在非流形边上（被三个以上的面共享，
+            或被两个朝向不一致的面共享）。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class HalfEdgeMesh final {
+    public:
+        // 成员
+
+        // 表示不存在的半边或面
+        static constexpr size_t NONE { static_cast<size_t>(-1) };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化空的半边结构。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        HalfEdgeMesh() = default;
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 从面的顶点下标建立半边结构。只有方向相反的两条半边
+            互为对边；同一条边上的两条半边同向时，两个面的朝向不一致，
+            该边视为非流形边。
+        【参数】
+            VertexCount: 顶点的个数。
+            Faces: 每个面的三个顶点下标。
+        【返回值】 无
+            如果顶点下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        HalfEdgeMesh(size_t VertexCount, const vector<array<size_t, 3>>& Faces);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 从 IndexedMesh 的面建立半边结构，忽略其中的线段。
+        【参数】
+            AMesh: 共享顶点的网格。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <size_t N>
+        explicit HalfEdgeMesh(const IndexedMesh<N>& AMesh);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一半边结构初始化半边结构。
+        【参数】
+            Other: 另一个半边结构。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        HalfEdgeMesh(const HalfEdgeMesh& Other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetVertexCount
+        【函数功能】 获取顶点的个数。
+        【参数】 无
+        【返回值】
+            顶点的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetVertexCount() const;
+        /**********************************************************************
+        【函数名称】 GetFaceCount
+        【函数功能】 获取面的个数。
+        【参数】 无
+        【返回值】
+            面的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetFaceCount() const;
+        /**********************************************************************
+        【函数名称】 GetHalfEdgeCount
+        【函数功能】 获取半边的个数，等于面数的三倍。
+        【参数】 无
+        【返回值】
+            半边的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetHalfEdgeCount() const;
+        /**********************************************************************
+        【函数名称】 GetBoundaryEdgeCount
+        【函数功能】 获取边界边（只属于一个面的边）的个数。
+        【参数】 无
+        【返回值】
+            边界边的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetBoundaryEdgeCount() const;
+        /**********************************************************************
+        【函数名称】 GetNonManifoldEdgeCount
+        【函数功能】 获取位于非流形边上的半边个数。
+        【参数】 无
+        【返回值】
+            位于非流形边上的半边个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetNonManifoldEdgeCount() const;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 GetOrigin
+        【函数功能】 获取半边的起点。
+        【参数】
+            HalfEdge: 半边的下标。
+        【返回值】
+            半边起点的顶点下标。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetOrigin(size_t HalfEdge) const;
+        /**********************************************************************
+        【函数名称】 GetTarget
+        【函数功能】 获取半边的终点。
+        【参数】
+            HalfEdge: 半边的下标。
+        【返回值】
+            半边终点的顶点下标。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetTarget(size_t HalfEdge) const;
+        /**********************************************************************
+        【函数名称】 GetFace
+        【函数功能】 获取半边所在的面。
+        【参数】
+            HalfEdge: 半边的下标。
+        【返回值】
+            面的下标。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static size_t GetFace(size_t HalfEdge);
+        /**********************************************************************
+        【函数名称】 GetHalfEdge
+        【函数功能】 获取面的第 i 条半边，它从面的第 i 个顶点出发。
+        【参数】
+            Face: 面的下标。
+            Corner: 顶点在面中的位置，取 0、1、2。
+        【返回值】
+            半边的下标。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static size_t GetHalfEdge(size_t Face, size_t Corner);
+        /**********************************************************************
+        【函数名称】 GetNext
+        【函数功能】 获取同一面内的下一条半边。
+        【参数】
+            HalfEdge: 半边的下标。
+        【返回值】
+            下一条半边的下标。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static size_t GetNext(size_t HalfEdge);
+        /**********************************************************************
+        【函数名称】 GetPrev
+        【函数功能】 获取同一面内的上一条半边。
+        【参数】
+            HalfEdge: 半边的下标。
+        【返回值】
+            上一条半边的下标。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static size_t GetPrev(size_t HalfEdge);
+        /**********************************************************************
+        【函数名称】 GetTwin
+        【函数功能】 获取同一条边上属于相邻面的半边。
+        【参数】
+            HalfEdge: 半边的下标。
+        【返回值】
+            对边的下标，边界边或非流形边返回 NONE。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetTwin(size_t HalfEdge) const;
+        /**********************************************************************
+        【函数名称】 GetAdjacentFace
+        【函数功能】 获取面的第 i 条边另一侧的面。
+        【参数】
+            Face: 面的下标。
+            Corner: 边的起点在面中的位置，取 0、1、2。
+        【返回值】
+            相邻面的下标，边界边或非流形边返回 NONE。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetAdjacentFace(size_t Face, size_t Corner) const;
+        /**********************************************************************
+        【函数名称】 GetVertexHalfEdge
+        【函数功能】 获取从顶点出发的一条半边。
+            如果顶点位于边界上，返回从它出发的边界半边，
+            这样沿 GetTwin(GetPrev(H)) 旋转即可遍历所有相邻的面。
+        【参数】
+            Vertex: 顶点的下标。
+        【返回值】
+            半边的下标，顶点不属于任何面时返回 NONE。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetVertexHalfEdge(size_t Vertex) const;
+        /**********************************************************************
+        【函数名称】 GetValence
+        【函数功能】 获取顶点的度，即与之相连的不同边的条数。
+        【参数】
+            Vertex: 顶点的下标。
+        【返回值】
+            顶点的度。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetValence(size_t Vertex) const;
+        /**********************************************************************
+        【函数名称】 IsBoundary
+        【函数功能】 判断半边是否位于边界上，即所在的边只属于一个面。
+        【参数】
+            HalfEdge: 半边的下标。
+        【返回值】
+            半边是否位于边界上。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsBoundary(size_t HalfEdge) const;
+        /**********************************************************************
+        【函数名称】 IsNonManifold
+        【函数功能】 判断半边是否位于非流形边上，即所在的边属于三个以上的面，
+            或属于两个面但两条半边同向。
+        【参数】
+            HalfEdge: 半边的下标。
+        【返回值】
+            半边是否位于非流形边上。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsNonManifold(size_t HalfEdge) const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将其他半边结构赋值给自身。
+        【参数】
+            Other: 从之取值的半边结构。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        HalfEdgeMesh& operator=(const HalfEdgeMesh& Other) = default;
+
+    private:
+        /*********************************************************************
+        【类名】 EdgeHash
+        【功能】 以两端点下标表示的无向边的哈希函数对象。
+        【接口说明】 
+            操作符：
+                operator(): 求边的哈希值。
+        【开发者及日期】 赵一彤 2024/7/24
+        *********************************************************************/
+        class EdgeHash final {
+            public:
+                /**************************************************************
+                【函数名称】 operator()
+                【函数功能】 求边的哈希值。
+                【参数】
+                    Edge: 较小与较大的端点下标。
+                【返回值】
+                    边的哈希值。
+                【开发者及日期】 赵一彤 2024/7/24
+                **************************************************************/
+                size_t operator()(const pair<size_t, size_t>& Edge) const;
+        };
+
+        // 每条半边的起点
+        vector<size_t> m_Origins;
+        // 每条半边的对边，不存在时为 NONE
+        vector<size_t> m_Twins;
+        // 每条半边是否位于非流形边上
+        vector<bool> m_NonManifold;
+        // 每个顶点出发的一条半边，不存在时为 NONE
+        vector<size_t> m_VertexHalfEdges;
+        // 每个顶点的度
+        vector<size_t> m_Valences;
+        // 边界边的个数
+        size_t m_ullBoundaryEdgeCount { 0 };
+        // 非流形边上的半边个数
+        size_t m_ullNonManifoldEdgeCount { 0 };
+};
+
+}
+
+}
+
+#include "HalfEdgeMesh.tpp"
+
+#endif
\ No newline at end of file
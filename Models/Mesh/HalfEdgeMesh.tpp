@@ -0,0 +1,30 @@
+/*************************************************************************
+【文件名】 HalfEdgeMesh.tpp
+【功能模块和目的】 为 HalfEdgeMesh.hpp 提供模板实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include "HalfEdgeMesh.hpp"
+#include "IndexedMesh.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 从 IndexedMesh 的面建立半边结构，忽略其中的线段。
+【参数】
+    AMesh: 共享顶点的网格。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+HalfEdgeMesh::HalfEdgeMesh(const IndexedMesh<N>& AMesh)
+    : HalfEdgeMesh(AMesh.GetVertexCount(), AMesh.GetFaces()) {}
+
+}
+
+}
\ No newline at end of file
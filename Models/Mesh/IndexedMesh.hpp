@@ -0,0 +1,242 @@
+/*************************************************************************
+【文件名】 IndexedMesh.hpp
+【功能模块和目的】 IndexedMesh 类以共享顶点加下标的形式存储模型。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef INDEXED_MESH_HPP
+#define INDEXED_MESH_HPP
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 IndexedMesh
+【功能】 将 Model<N> 中坐标精确相等的点合并为同一个顶点，
+    线段与面只存储顶点下标，所有数据保存在连续的数组中。
+【接口说明】 
+    成员：
+        DIMENSION: 表示维数。
+    构造与析构：
+        默认构造函数，创建空的网格。
+        接受模型的构造函数，以哈希表合并顶点，时间与元素个数成线性。
+        接受名称、顶点与下标数组的构造函数。
+        拷贝构造函数。
+    访问器：
+        GetName: 获取模型的名称。
+        GetVertex(Count/s): 获取顶点。
+        GetLine(Count/s): 获取线段的顶点下标。
+        GetFace(Count/s): 获取面的顶点下标。
+    操作：
+        ToModel: 转换回 Model<N>。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N>
+class IndexedMesh final {
+    public:
+        // 成员
+
+        // 维数
+        static constexpr size_t DIMENSION { N };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化空的网格。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        IndexedMesh() = default;
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 从模型初始化网格，坐标精确相等的点合并为同一个顶点。
+            顶点按首次出现的顺序编号，先遍历线段，再遍历面。
+        【参数】
+            AModel: 源模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit IndexedMesh(const Model<N>& AModel);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用名称、顶点与下标数组初始化网格。
+        【参数】
+            Name: 模型的名称。
+            Vertices: 互不相同的顶点。
+            Lines: 每条线段的两个顶点下标。
+            Faces: 每个面的三个顶点下标。
+        【返回值】 无
+            如果顶点下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        IndexedMesh(
+            string Name, 
+            vector<Point<N>> Vertices, 
+            vector<array<size_t, 2>> Lines, 
+            vector<array<size_t, 3>> Faces
+        );
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一网格初始化网格。
+        【参数】
+            Other: 另一个网格。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        IndexedMesh(const IndexedMesh<N>& Other) = default;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 GetName
+        【函数功能】 获取模型的名称。
+        【参数】 无
+        【返回值】
+            模型的名称。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const string& GetName() const;
+        /**********************************************************************
+        【函数名称】 GetVertexCount
+        【函数功能】 获取顶点的个数。
+        【参数】 无
+        【返回值】
+            顶点的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetVertexCount() const;
+        /**********************************************************************
+        【函数名称】 GetVertex
+        【函数功能】 获取指定下标的顶点。
+        【参数】
+            Index: 顶点的下标。
+        【返回值】
+            指定下标的顶点。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const Point<N>& GetVertex(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetVertices
+        【函数功能】 获取所有顶点组成的数组。
+        【参数】 无
+        【返回值】
+            所有顶点组成的数组。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<Point<N>>& GetVertices() const;
+        /**********************************************************************
+        【函数名称】 GetLineCount
+        【函数功能】 获取线段的个数。
+        【参数】 无
+        【返回值】
+            线段的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetLineCount() const;
+        /**********************************************************************
+        【函数名称】 GetLine
+        【函数功能】 获取指定下标的线段的两个顶点下标。
+        【参数】
+            Index: 线段的下标。
+        【返回值】
+            线段的两个顶点下标。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const array<size_t, 2>& GetLine(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetLines
+        【函数功能】 获取所有线段的顶点下标组成的数组。
+        【参数】 无
+        【返回值】
+            所有线段的顶点下标组成的数组。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<array<size_t, 2>>& GetLines() const;
+        /**********************************************************************
+        【函数名称】 GetFaceCount
+        【函数功能】 获取面的个数。
+        【参数】 无
+        【返回值】
+            面的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetFaceCount() const;
+        /**********************************************************************
+        【函数名称】 GetFace
+        【函数功能】 获取指定下标的面的三个顶点下标。
+        【参数】
+            Index: 面的下标。
+        【返回值】
+            面的三个顶点下标。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const array<size_t, 3>& GetFace(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetFaces
+        【函数功能】 获取所有面的顶点下标组成的数组。
+        【参数】 无
+        【返回值】
+            所有面的顶点下标组成的数组。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<array<size_t, 3>>& GetFaces() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 ToModel
+        【函数功能】 将网格转换回模型。
+        【参数】 无
+        【返回值】
+            与网格内容相同的模型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Model<N> ToModel() const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将其他网格赋值给自身。
+        【参数】
+            Other: 从之取值的网格。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        IndexedMesh<N>& operator=(const IndexedMesh<N>& Other) = default;
+
+    private:
+        // 模型的名称
+        string m_Name;
+        // 顶点
+        vector<Point<N>> m_Vertices;
+        // 线段的顶点下标
+        vector<array<size_t, 2>> m_Lines;
+        // 面的顶点下标
+        vector<array<size_t, 3>> m_Faces;
+};
+
+}
+
+}
+
+#include "IndexedMesh.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,289 @@
+/*************************************************************************
+【文件名】 IndexedMesh.tpp
+【功能模块和目的】 为 IndexedMesh.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "IndexedMesh.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Containers/DynamicSet.hpp"
+#include "../Errors/IndexOverflowException.hpp"
+#include "../Tools/PointEqual.hpp"
+#include "../Tools/PointHash.hpp"
+using namespace std;
+using namespace C3w::Containers;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Mesh {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 从模型初始化网格，坐标精确相等的点合并为同一个顶点。
+    顶点按首次出现的顺序编号，先遍历线段，再遍历面。
+【参数】
+    AModel: 源模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+IndexedMesh<N>::IndexedMesh(const Model<N>& AModel): m_Name(AModel.Name) {
+    size_t ullLineCount = AModel.Lines.Count();
+    size_t ullFaceCount = AModel.Faces.Count();
+    // 哈希与比较都是精确的，容差内但不相等的点不合并，与 CollectPoints 一致
+    unordered_map<
+        Point<N>, 
+        size_t, 
+        Tools::PointHash<N>, 
+        Tools::PointEqual<N>
+    > VertexMap;
+    VertexMap.reserve(ullLineCount * 2 + ullFaceCount * 3);
+    m_Lines.reserve(ullLineCount);
+    m_Faces.reserve(ullFaceCount);
+    // 查找顶点，不存在时添加，返回顶点下标
+    auto Weld = [this, &VertexMap](const Point<N>& APoint) {
+        auto Result = VertexMap.emplace(APoint, m_Vertices.size());
+        if (Result.second) {
+            m_Vertices.push_back(APoint);
+        }
+        return Result.first->second;
+    };
+    for (auto& ALine: AModel.Lines) {
+        m_Lines.push_back({{ Weld(ALine[0]), Weld(ALine[1]) }});
+    }
+    for (auto& AFace: AModel.Faces) {
+        m_Faces.push_back({{ 
+            Weld(AFace[0]), Weld(AFace[1]), Weld(AFace[2]) 
+        }});
+    }
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用名称、顶点与下标数组初始化网格。
+【参数】
+    Name: 模型的名称。
+    Vertices: 互不相同的顶点。
+    Lines: 每条线段的两个顶点下标。
+    Faces: 每个面的三个顶点下标。
+【返回值】 无
+    如果顶点下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+IndexedMesh<N>::IndexedMesh(
+    string Name, 
+    vector<Point<N>> Vertices, 
+    vector<array<size_t, 2>> Lines, 
+    vector<array<size_t, 3>> Faces
+): m_Name(move(Name)), 
+   m_Vertices(move(Vertices)), 
+   m_Lines(move(Lines)), 
+   m_Faces(move(Faces)) {
+    size_t ullVertexCount = m_Vertices.size();
+    for (auto& Indices: m_Lines) {
+        for (auto ullIndex: Indices) {
+            if (ullIndex >= ullVertexCount) {
+                throw IndexOverflowException(ullIndex, ullVertexCount);
+            }
+        }
+    }
+    for (auto& Indices: m_Faces) {
+        for (auto ullIndex: Indices) {
+            if (ullIndex >= ullVertexCount) {
+                throw IndexOverflowException(ullIndex, ullVertexCount);
+            }
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetName
+【函数功能】 获取模型的名称。
+【参数】 无
+【返回值】
+    模型的名称。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+const string& IndexedMesh<N>::GetName() const {
+    return m_Name;
+}
+
+/**********************************************************************
+【函数名称】 GetVertexCount
+【函数功能】 获取顶点的个数。
+【参数】 无
+【返回值】
+    顶点的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+size_t IndexedMesh<N>::GetVertexCount() const {
+    return m_Vertices.size();
+}
+
+/**********************************************************************
+【函数名称】 GetVertex
+【函数功能】 获取指定下标的顶点。
+【参数】
+    Index: 顶点的下标。
+【返回值】
+    指定下标的顶点。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+const Point<N>& IndexedMesh<N>::GetVertex(size_t Index) const {
+    if (Index >= m_Vertices.size()) {
+        throw IndexOverflowException(Index, m_Vertices.size());
+    }
+    return m_Vertices[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetVertices
+【函数功能】 获取所有顶点组成的数组。
+【参数】 无
+【返回值】
+    所有顶点组成的数组。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+const vector<Point<N>>& IndexedMesh<N>::GetVertices() const {
+    return m_Vertices;
+}
+
+/**********************************************************************
+【函数名称】 GetLineCount
+【函数功能】 获取线段的个数。
+【参数】 无
+【返回值】
+    线段的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+size_t IndexedMesh<N>::GetLineCount() const {
+    return m_Lines.size();
+}
+
+/**********************************************************************
+【函数名称】 GetLine
+【函数功能】 获取指定下标的线段的两个顶点下标。
+【参数】
+    Index: 线段的下标。
+【返回值】
+    线段的两个顶点下标。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+const array<size_t, 2>& IndexedMesh<N>::GetLine(size_t Index) const {
+    if (Index >= m_Lines.size()) {
+        throw IndexOverflowException(Index, m_Lines.size());
+    }
+    return m_Lines[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetLines
+【函数功能】 获取所有线段的顶点下标组成的数组。
+【参数】 无
+【返回值】
+    所有线段的顶点下标组成的数组。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+const vector<array<size_t, 2>>& IndexedMesh<N>::GetLines() const {
+    return m_Lines;
+}
+
+/**********************************************************************
+【函数名称】 GetFaceCount
+【函数功能】 获取面的个数。
+【参数】 无
+【返回值】
+    面的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+size_t IndexedMesh<N>::GetFaceCount() const {
+    return m_Faces.size();
+}
+
+/**********************************************************************
+【函数名称】 GetFace
+【函数功能】 获取指定下标的面的三个顶点下标。
+【参数】
+    Index: 面的下标。
+【返回值】
+    面的三个顶点下标。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+const array<size_t, 3>& IndexedMesh<N>::GetFace(size_t Index) const {
+    if (Index >= m_Faces.size()) {
+        throw IndexOverflowException(Index, m_Faces.size());
+    }
+    return m_Faces[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetFaces
+【函数功能】 获取所有面的顶点下标组成的数组。
+【参数】 无
+【返回值】
+    所有面的顶点下标组成的数组。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+const vector<array<size_t, 3>>& IndexedMesh<N>::GetFaces() const {
+    return m_Faces;
+}
+
+/**********************************************************************
+【函数名称】 ToModel
+【函数功能】 将网格转换回模型。
+【参数】 无
+【返回值】
+    与网格内容相同的模型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+Model<N> IndexedMesh<N>::ToModel() const {
+    vector<Line<N>> Lines;
+    vector<Face<N>> Faces;
+    Lines.reserve(m_Lines.size());
+    Faces.reserve(m_Faces.size());
+    for (auto& Indices: m_Lines) {
+        Lines.emplace_back(m_Vertices[Indices[0]], m_Vertices[Indices[1]]);
+    }
+    for (auto& Indices: m_Faces) {
+        Faces.emplace_back(
+            m_Vertices[Indices[0]], 
+            m_Vertices[Indices[1]], 
+            m_Vertices[Indices[2]]
+        );
+    }
+    // 网格来自一个模型，元素本就互不相同
+    return Model<N>(
+        m_Name,
+        DynamicSet<Line<N>>::FromDistinct(move(Lines)),
+        DynamicSet<Face<N>>::FromDistinct(move(Faces))
+    );
+}
+
+}
+
+}
\ No newline at end of file
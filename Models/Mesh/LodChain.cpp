@@ -0,0 +1,362 @@
+/*************************************************************************
+【文件名】 LodChain.cpp
+【功能模块和目的】 为 LodChain.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Decimator.hpp"
+#include "IndexedMesh.hpp"
+#include "LodChain.hpp"
+#include "VertexCache.hpp"
+#include "../Core/Point.hpp"
+#include "../Errors/IndexOverflowException.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Mesh {
+
+// 相邻层级面数之比的默认值
+constexpr double LodChain::DEFAULT_RATIO;
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 以最粗的层级初始化 LodChain 对象。
+【参数】
+    Name: 模型的名称。
+    Lines: 线段的顶点下标。
+    Vertices: 最粗层级使用的顶点。
+    Faces: 最粗层级的面的顶点下标。
+【返回值】 无
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+LodChain::LodChain(
+    string Name,
+    vector<array<size_t, 2>> Lines,
+    vector<Point<3>> Vertices,
+    vector<array<size_t, 3>> Faces
+): m_Name(move(Name)), m_Lines(move(Lines)) {
+    for (auto& Indices: m_Lines) {
+        for (auto ullIndex: Indices) {
+            if (ullIndex >= Vertices.size()) {
+                throw IndexOverflowException(ullIndex, Vertices.size());
+            }
+        }
+    }
+    AddLevel(move(Vertices), move(Faces));
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 从网格生成细节层级。最精细的层级即原网格，
+    每一层级的面数约为上一层级的 Ratio 倍，无法继续简化时提前停止。
+【参数】
+    AMesh: 原网格。
+    LevelCount: 最多生成的层级数，至少为 1。
+    Ratio: 相邻层级面数之比，默认为 DEFAULT_RATIO。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+LodChain::LodChain(
+    const IndexedMesh<3>& AMesh,
+    size_t LevelCount,
+    double Ratio
+): m_Name(AMesh.GetName()) {
+    vector<vector<array<size_t, 3>>> Levels { AMesh.GetFaces() };
+    if (LevelCount > 1) {
+        // 半边折叠不移动顶点，各层级的面都引用原网格的顶点
+        Decimator ADecimator(AMesh, Decimator::Placement::ENDPOINT);
+        while (Levels.size() < LevelCount) {
+            size_t ullCurrent = Levels.back().size();
+            size_t ullTarget = static_cast<size_t>(ullCurrent * Ratio);
+            if (ADecimator.Decimate(ullTarget) >= ullCurrent) {
+                break;
+            }
+            Levels.push_back(ADecimator.GetFaces());
+        }
+    }
+    reverse(Levels.begin(), Levels.end());
+    // 顶点首次出现的层级，线段的顶点属于最粗的层级
+    size_t ullLevelCount = Levels.size();
+    vector<size_t> FirstLevels(AMesh.GetVertexCount(), ullLevelCount);
+    for (auto& Indices: AMesh.GetLines()) {
+        FirstLevels[Indices[0]] = 0;
+        FirstLevels[Indices[1]] = 0;
+    }
+    for (size_t i = 0; i < ullLevelCount; i++) {
+        for (auto& Indices: Levels[i]) {
+            for (auto ullIndex: Indices) {
+                FirstLevels[ullIndex] = min(FirstLevels[ullIndex], i);
+            }
+        }
+    }
+    // 按层级做计数排序，同一层级内保持原顺序，未使用的顶点被丢弃
+    m_VertexCounts.assign(ullLevelCount, 0);
+    for (auto ullLevel: FirstLevels) {
+        if (ullLevel < ullLevelCount) {
+            m_VertexCounts[ullLevel]++;
+        }
+    }
+    vector<size_t> Offsets(ullLevelCount, 0);
+    for (size_t i = 1; i < ullLevelCount; i++) {
+        m_VertexCounts[i] += m_VertexCounts[i - 1];
+        Offsets[i] = m_VertexCounts[i - 1];
+    }
+    vector<size_t> NewIndices(FirstLevels.size(), 0);
+    m_Vertices.resize(m_VertexCounts.back());
+    for (size_t i = 0; i < FirstLevels.size(); i++) {
+        if (FirstLevels[i] < ullLevelCount) {
+            NewIndices[i] = Offsets[FirstLevels[i]]++;
+            m_Vertices[NewIndices[i]] = AMesh.GetVertex(i);
+        }
+    }
+    m_Lines.reserve(AMesh.GetLineCount());
+    for (auto& Indices: AMesh.GetLines()) {
+        m_Lines.push_back({{ NewIndices[Indices[0]], NewIndices[Indices[1]] }});
+    }
+    for (auto& Level: Levels) {
+        for (auto& Indices: Level) {
+            for (auto& ullIndex: Indices) {
+                ullIndex = NewIndices[ullIndex];
+            }
+        }
+    }
+    m_Levels = move(Levels);
+}
+
+/**********************************************************************
+【函数名称】 GetName
+【函数功能】 获取模型的名称。
+【参数】 无
+【返回值】
+    模型的名称。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+const string& LodChain::GetName() const {
+    return m_Name;
+}
+
+/**********************************************************************
+【函数名称】 GetLevelCount
+【函数功能】 获取层级数。
+【参数】 无
+【返回值】
+    层级数，第 0 层最粗。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t LodChain::GetLevelCount() const {
+    return m_Levels.size();
+}
+
+/**********************************************************************
+【函数名称】 GetVertexCount
+【函数功能】 获取某一层级使用的顶点数。
+【参数】
+    Level: 层级的下标。
+【返回值】
+    该层级使用的顶点数，即顶点数组的前缀长度。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t LodChain::GetVertexCount(size_t Level) const {
+    if (Level >= m_VertexCounts.size()) {
+        throw IndexOverflowException(Level, m_VertexCounts.size());
+    }
+    return m_VertexCounts[Level];
+}
+
+/**********************************************************************
+【函数名称】 GetVertex
+【函数功能】 获取指定下标的顶点。
+【参数】
+    Index: 顶点的下标。
+【返回值】
+    指定下标的顶点。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+const Point<3>& LodChain::GetVertex(size_t Index) const {
+    if (Index >= m_Vertices.size()) {
+        throw IndexOverflowException(Index, m_Vertices.size());
+    }
+    return m_Vertices[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetVertices
+【函数功能】 获取所有层级共享的顶点数组。
+【参数】 无
+【返回值】
+    顶点数组。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+const vector<Point<3>>& LodChain::GetVertices() const {
+    return m_Vertices;
+}
+
+/**********************************************************************
+【函数名称】 GetLines
+【函数功能】 获取线段的顶点下标。
+【参数】 无
+【返回值】
+    所有线段的顶点下标组成的数组。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+const vector<array<size_t, 2>>& LodChain::GetLines() const {
+    return m_Lines;
+}
+
+/**********************************************************************
+【函数名称】 GetFaceCount
+【函数功能】 获取某一层级的面数。
+【参数】
+    Level: 层级的下标。
+【返回值】
+    该层级的面数。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t LodChain::GetFaceCount(size_t Level) const {
+    return GetFaces(Level).size();
+}
+
+/**********************************************************************
+【函数名称】 GetFaces
+【函数功能】 获取某一层级的面的顶点下标。
+【参数】
+    Level: 层级的下标。
+【返回值】
+    该层级的面的顶点下标组成的数组。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+const vector<array<size_t, 3>>& LodChain::GetFaces(size_t Level) const {
+    if (Level >= m_Levels.size()) {
+        throw IndexOverflowException(Level, m_Levels.size());
+    }
+    return m_Levels[Level];
+}
+
+/**********************************************************************
+【函数名称】 AddLevel
+【函数功能】 追加一个更精细的层级。
+【参数】
+    Vertices: 此层级新增的顶点，追加在顶点数组末尾。
+    Faces: 此层级的面的顶点下标，可引用之前的所有顶点。
+【返回值】 无
+    如果下标越界，抛出 IndexOverflowException，此时自身不变。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void LodChain::AddLevel(
+    vector<Point<3>> Vertices,
+    vector<array<size_t, 3>> Faces
+) {
+    size_t ullVertexCount = m_Vertices.size() + Vertices.size();
+    for (auto& Indices: Faces) {
+        for (auto ullIndex: Indices) {
+            if (ullIndex >= ullVertexCount) {
+                throw IndexOverflowException(ullIndex, ullVertexCount);
+            }
+        }
+    }
+    m_Vertices.insert(m_Vertices.end(), Vertices.begin(), Vertices.end());
+    m_VertexCounts.push_back(ullVertexCount);
+    m_Levels.push_back(move(Faces));
+}
+
+/**********************************************************************
+【函数名称】 GetMesh
+【函数功能】 提取某一层级的网格，时间与该层级的大小成正比。
+【参数】
+    Level: 层级的下标。
+【返回值】
+    该层级的网格。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+IndexedMesh<3> LodChain::GetMesh(size_t Level) const {
+    size_t ullVertexCount = GetVertexCount(Level);
+    return IndexedMesh<3>(
+        m_Name,
+        vector<Point<3>>(
+            m_Vertices.begin(),
+            m_Vertices.begin() + ullVertexCount
+        ),
+        m_Lines,
+        m_Levels[Level]
+    );
+}
+
+/**********************************************************************
+【函数名称】 OptimizeVertexCache
+【函数功能】 使用 VertexCache 重排每一层级的面，再将每一层级新增的
+    顶点按首次被该层级的面使用的顺序重排。顶点不跨越层级移动，
+    因此逐层读入的性质保持不变。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void LodChain::OptimizeVertexCache() {
+    size_t ullVertexCount = m_Vertices.size();
+    vector<size_t> NewIndices(ullVertexCount, ullVertexCount);
+    size_t ullBegin = 0;
+    for (size_t i = 0; i < m_Levels.size(); i++) {
+        vector<array<size_t, 3>>& Faces = m_Levels[i];
+        vector<size_t> Order = VertexCache::GetFaceOrder(Faces, ullVertexCount);
+        vector<array<size_t, 3>> Reordered;
+        Reordered.reserve(Faces.size());
+        for (size_t ullFace: Order) {
+            Reordered.push_back(Faces[ullFace]);
+        }
+        Faces = move(Reordered);
+        // 只重排本层级新增的顶点，即 [ullBegin, ullEnd) 区间
+        size_t ullEnd = m_VertexCounts[i];
+        size_t ullNext = ullBegin;
+        for (auto& Indices: Faces) {
+            for (auto ullIndex: Indices) {
+                if (
+                    ullIndex >= ullBegin && 
+                    NewIndices[ullIndex] == ullVertexCount
+                ) {
+                    NewIndices[ullIndex] = ullNext++;
+                }
+            }
+        }
+        // 只被线段使用的顶点保持原有的相对顺序
+        for (size_t j = ullBegin; j < ullEnd; j++) {
+            if (NewIndices[j] == ullVertexCount) {
+                NewIndices[j] = ullNext++;
+            }
+        }
+        ullBegin = ullEnd;
+    }
+    vector<Point<3>> Vertices(ullVertexCount);
+    for (size_t i = 0; i < ullVertexCount; i++) {
+        Vertices[NewIndices[i]] = m_Vertices[i];
+    }
+    m_Vertices = move(Vertices);
+    for (auto& Indices: m_Lines) {
+        for (auto& ullIndex: Indices) {
+            ullIndex = NewIndices[ullIndex];
+        }
+    }
+    for (auto& Level: m_Levels) {
+        for (auto& Indices: Level) {
+            for (auto& ullIndex: Indices) {
+                ullIndex = NewIndices[ullIndex];
+            }
+        }
+    }
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,256 @@
+/*************************************************************************
+【文件名】 LodChain.hpp
+【功能模块和目的】 LodChain 类存储共享顶点缓冲的多级细节网格。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef LOD_CHAIN_HPP
+#define LOD_CHAIN_HPP
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "IndexedMesh.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 LodChain
+【功能】 由粗到细排列的多个细节层级，所有层级共享同一个顶点数组。
+    顶点按首次出现的层级排序，第 L 层只使用前 GetVertexCount(L) 个顶点，
+    因此提取任一层级的时间与该层级的大小成正比，
+    也可以先读入最粗的层级，再逐层追加顶点与面。
+    线段在所有层级中保持不变，其顶点属于最粗的层级。
+【接口说明】
+    成员：
+        DEFAULT_RATIO: 相邻层级面数之比的默认值。
+    构造与析构：
+        接受名称、线段与最粗层级的构造函数。
+        接受网格与层级数的构造函数，使用半边折叠逐级简化。
+        拷贝构造函数。
+    访问器：
+        GetName: 获取模型的名称。
+        GetLevelCount: 获取层级数。
+        GetVertexCount: 获取某一层级使用的顶点数。
+        GetVertex(es): 获取共享的顶点。
+        GetLines: 获取线段的顶点下标。
+        GetFaceCount: 获取某一层级的面数。
+        GetFaces: 获取某一层级的面的顶点下标。
+    操作：
+        AddLevel: 追加一个更精细的层级。
+        GetMesh: 提取某一层级的网格。
+        OptimizeVertexCache: 为 GPU 顶点缓存重排每一层级的面与新增顶点。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class LodChain final {
+    public:
+        // 成员
+
+        // 相邻层级面数之比的默认值
+        static constexpr double DEFAULT_RATIO { 0.5 };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以最粗的层级初始化 LodChain 对象。
+        【参数】
+            Name: 模型的名称。
+            Lines: 线段的顶点下标。
+            Vertices: 最粗层级使用的顶点。
+            Faces: 最粗层级的面的顶点下标。
+        【返回值】 无
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        LodChain(
+            string Name,
+            vector<array<size_t, 2>> Lines,
+            vector<Point<3>> Vertices,
+            vector<array<size_t, 3>> Faces
+        );
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 从网格生成细节层级。最精细的层级即原网格，
+            每一层级的面数约为上一层级的 Ratio 倍，无法继续简化时提前停止。
+        【参数】
+            AMesh: 原网格。
+            LevelCount: 最多生成的层级数，至少为 1。
+            Ratio: 相邻层级面数之比，默认为 DEFAULT_RATIO。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        LodChain(
+            const IndexedMesh<3>& AMesh,
+            size_t LevelCount,
+            double Ratio = DEFAULT_RATIO
+        );
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 LodChain 初始化 LodChain 对象。
+        【参数】
+            Other: 另一个细节层级链。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        LodChain(const LodChain& Other) = default;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 GetName
+        【函数功能】 获取模型的名称。
+        【参数】 无
+        【返回值】
+            模型的名称。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const string& GetName() const;
+        /**********************************************************************
+        【函数名称】 GetLevelCount
+        【函数功能】 获取层级数。
+        【参数】 无
+        【返回值】
+            层级数，第 0 层最粗。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetLevelCount() const;
+        /**********************************************************************
+        【函数名称】 GetVertexCount
+        【函数功能】 获取某一层级使用的顶点数。
+        【参数】
+            Level: 层级的下标。
+        【返回值】
+            该层级使用的顶点数，即顶点数组的前缀长度。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetVertexCount(size_t Level) const;
+        /**********************************************************************
+        【函数名称】 GetVertex
+        【函数功能】 获取指定下标的顶点。
+        【参数】
+            Index: 顶点的下标。
+        【返回值】
+            指定下标的顶点。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const Point<3>& GetVertex(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetVertices
+        【函数功能】 获取所有层级共享的顶点数组。
+        【参数】 无
+        【返回值】
+            顶点数组。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<Point<3>>& GetVertices() const;
+        /**********************************************************************
+        【函数名称】 GetLines
+        【函数功能】 获取线段的顶点下标。
+        【参数】 无
+        【返回值】
+            所有线段的顶点下标组成的数组。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<array<size_t, 2>>& GetLines() const;
+        /**********************************************************************
+        【函数名称】 GetFaceCount
+        【函数功能】 获取某一层级的面数。
+        【参数】
+            Level: 层级的下标。
+        【返回值】
+            该层级的面数。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetFaceCount(size_t Level) const;
+        /**********************************************************************
+        【函数名称】 GetFaces
+        【函数功能】 获取某一层级的面的顶点下标。
+        【参数】
+            Level: 层级的下标。
+        【返回值】
+            该层级的面的顶点下标组成的数组。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<array<size_t, 3>>& GetFaces(size_t Level) const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 AddLevel
+        【函数功能】 追加一个更精细的层级。
+        【参数】
+            Vertices: 此层级新增的顶点，追加在顶点数组末尾。
+            Faces: 此层级的面的顶点下标，可引用之前的所有顶点。
+        【返回值】 无
+            如果下标越界，抛出 IndexOverflowException，此时自身不变。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void AddLevel(
+            vector<Point<3>> Vertices,
+            vector<array<size_t, 3>> Faces
+        );
+        /**********************************************************************
+        【函数名称】 GetMesh
+        【函数功能】 提取某一层级的网格，时间与该层级的大小成正比。
+        【参数】
+            Level: 层级的下标。
+        【返回值】
+            该层级的网格。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        IndexedMesh<3> GetMesh(size_t Level) const;
+        /**********************************************************************
+        【函数名称】 OptimizeVertexCache
+        【函数功能】 使用 VertexCache 重排每一层级的面，再将每一层级新增的
+            顶点按首次被该层级的面使用的顺序重排。顶点不跨越层级移动，
+            因此逐层读入的性质保持不变。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void OptimizeVertexCache();
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一细节层级链赋值给自身。
+        【参数】
+            Other: 从之取值的细节层级链。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        LodChain& operator=(const LodChain& Other) = default;
+
+    private:
+        // 模型的名称
+        string m_Name;
+        // 所有层级共享的顶点，按首次出现的层级排序
+        vector<Point<3>> m_Vertices;
+        // 线段的顶点下标
+        vector<array<size_t, 2>> m_Lines;
+        // 每一层级使用的顶点数
+        vector<size_t> m_VertexCounts;
+        // 每一层级的面的顶点下标
+        vector<vector<array<size_t, 3>>> m_Levels;
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
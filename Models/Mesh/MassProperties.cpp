@@ -0,0 +1,149 @@
+/*************************************************************************
+【文件名】 MassProperties.cpp
+【功能模块和目的】 为 MassProperties.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include "MassProperties.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/CompensatedSum.hpp"
+#include "../Tools/Parallel.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+// 累加器中积分的个数。
+constexpr size_t MassProperties::INTEGRAL_COUNT;
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化体积为 0 的质量属性。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+MassProperties::MassProperties()
+    : Volume(0), Centroid(Point<3>::VOID), Inertia() {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用体积、质心与惯性张量初始化质量属性。
+【参数】
+    Volume: 体积。
+    Centroid: 质心。
+    Inertia: 关于质心的惯性张量。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+MassProperties::MassProperties(
+    double Volume, 
+    const Point<3>& Centroid, 
+    const Tensor& Inertia
+): Volume(Volume), Centroid(Centroid), Inertia(Inertia) {}
+
+/**********************************************************************
+【函数名称】 GetMassPropertiesOf
+【函数功能】 计算模型中的面所围实体的质量属性，忽略线段。
+【参数】
+    AModel: 闭合的三维模型。
+【返回值】
+    模型的质量属性。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+MassProperties MassProperties::GetMassPropertiesOf(const Model<3>& AModel) {
+    auto FacesBegin = AModel.Faces.begin();
+    // 对一个块内的面累加各积分
+    auto Map = [&FacesBegin](size_t Begin, size_t End) {
+        Accumulator Sums;
+        for (auto Iter = FacesBegin + Begin; Iter < FacesBegin + End; Iter++) {
+            const Point<3>& A = Iter->First;
+            const Point<3>& B = Iter->Second;
+            const Point<3>& C = Iter->Third;
+            // 以原点为顶点的有向四面体体积 A·(B×C)/6
+            double rVolume = (
+                A[0] * (B[1] * C[2] - B[2] * C[1])
+                + A[1] * (B[2] * C[0] - B[0] * C[2])
+                + A[2] * (B[0] * C[1] - B[1] * C[0])
+            ) / 6;
+            Sums[0] += rVolume;
+            array<double, 3> Sum;
+            for (size_t i = 0; i < 3; i++) {
+                Sum[i] = A[i] + B[i] + C[i];
+                // 四面体的质心为四个顶点的平均，其中原点为 0
+                Sums[1 + i] += rVolume * Sum[i] / 4;
+            }
+            // ∫xy dV = V/20 * (Σ 顶点 xy + (Σx)(Σy))
+            for (size_t i = 0; i < 3; i++) {
+                size_t j = (i + 1) % 3;
+                Sums[4 + i] += rVolume / 20 * (
+                    A[i] * A[i] + B[i] * B[i] + C[i] * C[i] + Sum[i] * Sum[i]
+                );
+                Sums[7 + i] += rVolume / 20 * (
+                    A[i] * A[j] + B[i] * B[j] + C[i] * C[j] + Sum[i] * Sum[j]
+                );
+            }
+        }
+        return Sums;
+    };
+    auto Combine = [](const Accumulator& Left, const Accumulator& Right) {
+        Accumulator Result = Left;
+        for (size_t i = 0; i < INTEGRAL_COUNT; i++) {
+            Result[i] += Right[i];
+        }
+        return Result;
+    };
+    Accumulator Sums = Tools::Parallel::Reduce(
+        AModel.Faces.Count(), 
+        Accumulator(), 
+        Map, 
+        Combine
+    );
+    array<double, INTEGRAL_COUNT> Integrals;
+    for (size_t i = 0; i < INTEGRAL_COUNT; i++) {
+        Integrals[i] = Sums[i].GetValue();
+    }
+    // 面朝内时所有积分同时变号
+    if (Integrals[0] < 0) {
+        for (auto& rIntegral: Integrals) {
+            rIntegral = -rIntegral;
+        }
+    }
+    double rVolume = Integrals[0];
+    if (rVolume == 0) {
+        return MassProperties();
+    }
+    Point<3> Centroid({ 
+        Integrals[1] / rVolume, 
+        Integrals[2] / rVolume, 
+        Integrals[3] / rVolume 
+    });
+    // 关于质心的二阶矩 ∫(x-cx)(y-cy) dV = ∫xy dV - V·cx·cy
+    Tensor Covariance;
+    for (size_t i = 0; i < 3; i++) {
+        size_t j = (i + 1) % 3;
+        Covariance[i][i] = 
+            Integrals[4 + i] - rVolume * Centroid[i] * Centroid[i];
+        Covariance[i][j] = 
+            Integrals[7 + i] - rVolume * Centroid[i] * Centroid[j];
+        Covariance[j][i] = Covariance[i][j];
+    }
+    // I = tr(C)·E - C
+    double rTrace = Covariance[0][0] + Covariance[1][1] + Covariance[2][2];
+    Tensor Inertia;
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            Inertia[i][j] = (i == j ? rTrace : 0) - Covariance[i][j];
+        }
+    }
+    return MassProperties(rVolume, Centroid, Inertia);
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+/*************************************************************************
+【文件名】 MassProperties.hpp
+【功能模块和目的】 MassProperties 类表示三维模型所围实体的体积、质心与惯性张量。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef MASS_PROPERTIES_HPP
+#define MASS_PROPERTIES_HPP
+
+#include <array>
+#include <cstddef>
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/CompensatedSum.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 MassProperties
+【功能】 表示闭合三维模型所围的均匀（密度为 1）实体的质量属性。
+    以原点为公共顶点，将每个面与原点构成的有向四面体的积分相加，
+    只需对 Faces 顺序遍历一次，并在多个线程中分块使用补偿求和。
+    模型需闭合且各面朝向一致，朝内的模型会被自动翻转为正的体积。
+【接口说明】 
+    成员：
+        Volume: 体积。
+        Centroid: 质心，体积为 0 时为 Point<3>::VOID。
+        Inertia: 关于质心、坐标轴方向的惯性张量。
+    构造与析构：
+        默认构造函数，体积与惯性张量均为 0。
+        接受体积、质心与惯性张量的构造函数。
+        拷贝构造函数。
+        GetMassPropertiesOf: 计算模型的质量属性。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class MassProperties final {
+    public:
+        // 内嵌类型
+
+        // 3×3 张量类型，按行存储
+        using Tensor = array<array<double, 3>, 3>;
+
+        // 成员
+
+        // 体积
+        double Volume;
+        // 质心
+        Point<3> Centroid;
+        // 关于质心的惯性张量
+        Tensor Inertia;
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化体积为 0 的质量属性。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        MassProperties();
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用体积、质心与惯性张量初始化质量属性。
+        【参数】
+            Volume: 体积。
+            Centroid: 质心。
+            Inertia: 关于质心的惯性张量。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        MassProperties(
+            double Volume, 
+            const Point<3>& Centroid, 
+            const Tensor& Inertia
+        );
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一质量属性初始化 MassProperties 对象。
+        【参数】
+            Other: 另一个质量属性。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        MassProperties(const MassProperties& Other) = default;
+        /**********************************************************************
+        【函数名称】 GetMassPropertiesOf
+        【函数功能】 计算模型中的面所围实体的质量属性，忽略线段。
+        【参数】
+            AModel: 闭合的三维模型。
+        【返回值】
+            模型的质量属性。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static MassProperties GetMassPropertiesOf(const Model<3>& AModel);
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一质量属性赋值给自身。
+        【参数】
+            Other: 从之取值的质量属性。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        MassProperties& operator=(const MassProperties& Other) = default;
+
+    private:
+        // 各积分在累加器中的位置：体积，一阶矩 x/y/z，二阶矩 xx/yy/zz/xy/yz/zx
+        static constexpr size_t INTEGRAL_COUNT { 10 };
+
+        // 并行求和时每个块的累加器
+        using Accumulator = array<Tools::CompensatedSum, INTEGRAL_COUNT>;
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,186 @@
+/*************************************************************************
+【文件名】 Normals.cpp
+【功能模块和目的】 为 Normals.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include "IndexedMesh.hpp"
+#include "Normals.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Vector.hpp"
+#include "../Errors/IndexOverflowException.hpp"
+#include "../Tools/Parallel.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Mesh {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 计算模型中面的法向，坐标相同的点视为同一顶点，
+    顶点按 IndexedMesh 的顺序编号。线段不影响结果。
+【参数】
+    AModel: 三维模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Normals::Normals(const Model<3>& AModel): Normals(IndexedMesh<3>(AModel)) {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 计算网格中面与顶点的法向。
+【参数】
+    AMesh: 三维网格。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Normals::Normals(const IndexedMesh<3>& AMesh)
+    : m_FaceNormals(AMesh.GetFaceCount()),
+    m_VertexNormals(AMesh.GetVertexCount(), Components {}),
+    m_Corners(AMesh.GetFaces()) {
+    auto& Vertices = AMesh.GetVertices();
+    // 各面的叉积互不相关，分块并行计算
+    Tools::Parallel::For(
+        m_Corners.size(),
+        [this, &Vertices](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                auto& A = Vertices[m_Corners[i][0]];
+                auto& B = Vertices[m_Corners[i][1]];
+                auto& C = Vertices[m_Corners[i][2]];
+                double rX1 = B[0] - A[0];
+                double rY1 = B[1] - A[1];
+                double rZ1 = B[2] - A[2];
+                double rX2 = C[0] - A[0];
+                double rY2 = C[1] - A[1];
+                double rZ2 = C[2] - A[2];
+                m_FaceNormals[i][0] = rY1 * rZ2 - rZ1 * rY2;
+                m_FaceNormals[i][1] = rZ1 * rX2 - rX1 * rZ2;
+                m_FaceNormals[i][2] = rX1 * rY2 - rY1 * rX2;
+            }
+        }
+    );
+    // 未归一化的叉积长度为两倍面积，直接累加即为面积加权
+    for (size_t i = 0; i < m_Corners.size(); i++) {
+        for (auto ullVertex: m_Corners[i]) {
+            for (size_t k = 0; k < 3; k++) {
+                m_VertexNormals[ullVertex][k] += m_FaceNormals[i][k];
+            }
+        }
+    }
+    Normalize(m_FaceNormals);
+    Normalize(m_VertexNormals);
+}
+
+/**********************************************************************
+【函数名称】 GetFaceCount
+【函数功能】 获取面的个数。
+【参数】 无
+【返回值】
+    面的个数，与源模型中面的个数相同。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t Normals::GetFaceCount() const {
+    return m_FaceNormals.size();
+}
+
+/**********************************************************************
+【函数名称】 GetFaceNormal
+【函数功能】 获取面的单位法向。
+【参数】
+    Index: 面的下标。
+【返回值】
+    面的单位法向，面积为 0 时为零向量。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Vector<double, 3> Normals::GetFaceNormal(size_t Index) const {
+    if (Index >= m_FaceNormals.size()) {
+        throw IndexOverflowException(Index, m_FaceNormals.size());
+    }
+    return Vector<double, 3>(m_FaceNormals[Index]);
+}
+
+/**********************************************************************
+【函数名称】 GetVertexCount
+【函数功能】 获取顶点的个数。
+【参数】 无
+【返回值】
+    合并坐标相同的点后顶点的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t Normals::GetVertexCount() const {
+    return m_VertexNormals.size();
+}
+
+/**********************************************************************
+【函数名称】 GetVertexNormal
+【函数功能】 获取顶点的面积加权单位法向。
+【参数】
+    Index: 顶点的下标。
+【返回值】
+    顶点的单位法向，相邻面的加权和为 0 时为零向量。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Vector<double, 3> Normals::GetVertexNormal(size_t Index) const {
+    if (Index >= m_VertexNormals.size()) {
+        throw IndexOverflowException(Index, m_VertexNormals.size());
+    }
+    return Vector<double, 3>(m_VertexNormals[Index]);
+}
+
+/**********************************************************************
+【函数名称】 GetCorners
+【函数功能】 获取面的三个顶点在顶点法向中的下标。
+【参数】
+    Index: 面的下标。
+【返回值】
+    三个顶点的下标，顺序与面中点的顺序相同。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+const array<size_t, 3>& Normals::GetCorners(size_t Index) const {
+    if (Index >= m_Corners.size()) {
+        throw IndexOverflowException(Index, m_Corners.size());
+    }
+    return m_Corners[Index];
+}
+
+/**********************************************************************
+【函数名称】 Normalize
+【函数功能】 在多个线程中将数组中的每个向量归一化，零向量保持不变。
+【参数】
+    Values: 要归一化的向量数组。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void Normals::Normalize(vector<Components>& Values) {
+    Tools::Parallel::For(
+        Values.size(),
+        [&Values](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                auto& Value = Values[i];
+                double rLength = sqrt(
+                    Value[0] * Value[0] + 
+                    Value[1] * Value[1] + 
+                    Value[2] * Value[2]
+                );
+                if (rLength > 0) {
+                    Value[0] /= rLength;
+                    Value[1] /= rLength;
+                    Value[2] /= rLength;
+                }
+            }
+        }
+    );
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+/*************************************************************************
+【文件名】 Normals.hpp
+【功能模块和目的】 Normals 类批量计算并存储三维模型的面法向与顶点法向。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef NORMALS_HPP
+#define NORMALS_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "IndexedMesh.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Vector.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 Normals
+【功能】 三维模型中每个面的单位法向与每个顶点的面积加权单位法向。
+    面法向在多个线程中分块计算，顶点法向为相邻面叉积（即两倍面积乘法向）
+    之和的归一化，所有结果存于连续数组中，可作为缓存重复使用。
+    面法向的方向由面的顶点顺序按右手定则确定，面积为 0 的面法向为零向量。
+【接口说明】
+    构造与析构：
+        默认构造函数，不含任何面与顶点。
+        接受模型的构造函数，合并坐标相同的点后计算。
+        接受网格的构造函数。
+        拷贝构造函数。
+    访问器：
+        GetFaceCount: 获取面的个数。
+        GetFaceNormal: 获取面的单位法向。
+        GetVertexCount: 获取顶点的个数。
+        GetVertexNormal: 获取顶点的单位法向。
+        GetCorners: 获取面的三个顶点在顶点法向中的下标。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class Normals final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化不含任何面与顶点的 Normals 对象。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Normals() = default;
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 计算模型中面的法向，坐标相同的点视为同一顶点，
+            顶点按 IndexedMesh 的顺序编号。线段不影响结果。
+        【参数】
+            AModel: 三维模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit Normals(const Model<3>& AModel);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 计算网格中面与顶点的法向。
+        【参数】
+            AMesh: 三维网格。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit Normals(const IndexedMesh<3>& AMesh);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 Normals 对象初始化 Normals 对象。
+        【参数】
+            Other: 另一 Normals 对象。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Normals(const Normals& Other) = default;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 GetFaceCount
+        【函数功能】 获取面的个数。
+        【参数】 无
+        【返回值】
+            面的个数，与源模型中面的个数相同。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetFaceCount() const;
+        /**********************************************************************
+        【函数名称】 GetFaceNormal
+        【函数功能】 获取面的单位法向。
+        【参数】
+            Index: 面的下标。
+        【返回值】
+            面的单位法向，面积为 0 时为零向量。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Vector<double, 3> GetFaceNormal(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetVertexCount
+        【函数功能】 获取顶点的个数。
+        【参数】 无
+        【返回值】
+            合并坐标相同的点后顶点的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetVertexCount() const;
+        /**********************************************************************
+        【函数名称】 GetVertexNormal
+        【函数功能】 获取顶点的面积加权单位法向。
+        【参数】
+            Index: 顶点的下标。
+        【返回值】
+            顶点的单位法向，相邻面的加权和为 0 时为零向量。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Vector<double, 3> GetVertexNormal(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetCorners
+        【函数功能】 获取面的三个顶点在顶点法向中的下标。
+        【参数】
+            Index: 面的下标。
+        【返回值】
+            三个顶点的下标，顺序与面中点的顺序相同。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const array<size_t, 3>& GetCorners(size_t Index) const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一 Normals 对象赋值给自身。
+        【参数】
+            Other: 从之取值的 Normals 对象。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Normals& operator=(const Normals& Other) = default;
+
+    private:
+        // 三维向量的分量
+        using Components = array<double, 3>;
+
+        // 面的单位法向
+        vector<Components> m_FaceNormals;
+        // 顶点的单位法向
+        vector<Components> m_VertexNormals;
+        // 每个面的三个顶点下标
+        vector<array<size_t, 3>> m_Corners;
+
+        /**********************************************************************
+        【函数名称】 Normalize
+        【函数功能】 在多个线程中将数组中的每个向量归一化，零向量保持不变。
+        【参数】
+            Values: 要归一化的向量数组。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void Normalize(vector<Components>& Values);
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
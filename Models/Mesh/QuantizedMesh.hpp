@@ -0,0 +1,377 @@
+/*************************************************************************
+【文件名】 QuantizedMesh.hpp
+【功能模块和目的】 QuantizedMesh 类以定点整数坐标紧凑地存储超大模型。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef QUANTIZED_MESH_HPP
+#define QUANTIZED_MESH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Core/Vector.hpp"
+#include "../Tools/Box.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 QuantizedMesh
+【功能】 以量化的定点坐标存储 N 维模型的网格，每个坐标轴 B 位。
+    量化范围为一个包围盒（整个模型或一个分块），
+    第 k 轴的坐标为 Origin[k] + Code[k] * Step[k]，
+    其中 Step[k] 为包围盒的边长除以 2^B - 1。
+    编码时就近取整，范围内每个坐标的误差不超过 Step[k] / 2。
+    顶点以整数编码精确比较并合并，因量化而退化或重复的元素被丢弃。
+    B 不超过 16 时每个分量占 2 字节，否则占 4 字节；
+    顶点下标为 32 位。几何计算在遍历时逐个解码，以 double 进行。
+【接口说明】
+    成员：
+        DIMENSION: 表示维数。
+        BITS: 每个坐标轴的位数。
+        MAX_CODE: 编码的最大值 2^B - 1。
+    内嵌类型：
+        Component: 一个坐标轴的编码。
+        Code: 一个顶点的编码。
+        VertexIndex: 顶点下标。
+    构造与析构：
+        默认构造函数，创建空的网格。
+        接受模型的构造函数，以模型的包围盒为量化范围。
+        接受模型与量化范围的构造函数，用于分块量化。
+        拷贝构造函数。
+    访问器：
+        GetName: 获取模型的名称。
+        GetOrigin: 获取量化范围的原点。
+        GetStep: 获取每个坐标轴的量化步长。
+        GetMaxError: 获取每个坐标轴的最大误差。
+        GetVertex(Count/Code): 获取顶点的个数、解码后的坐标或编码。
+        GetLine(Count/s): 获取线段的顶点下标。
+        GetFace(Count/s): 获取面的顶点下标。
+    操作：
+        Encode: 将点编码为整数坐标。
+        Decode: 将整数坐标解码为点。
+        GetBoundingBox: 求解码后顶点的包围盒。
+        GetTotalArea: 逐批解码并求所有面的面积之和。
+        ToModel: 解码并转换回 Model<N>。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N, size_t B = 16>
+class QuantizedMesh final {
+    static_assert(B >= 1 && B <= 32, "Bits per axis must be in [1, 32].");
+
+    public:
+        // 内嵌类型
+
+        // 一个坐标轴的编码
+        using Component = typename conditional<
+            B <= 16,
+            uint16_t,
+            uint32_t
+        >::type;
+        // 一个顶点的编码
+        using Code = array<Component, N>;
+        // 顶点下标，32 位以减少内存占用
+        using VertexIndex = uint32_t;
+
+        // 成员
+
+        // 维数
+        static constexpr size_t DIMENSION { N };
+        // 每个坐标轴的位数
+        static constexpr size_t BITS { B };
+        // 编码的最大值
+        static constexpr Component MAX_CODE {
+            static_cast<Component>((uint64_t(1) << B) - 1)
+        };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 创建空的网格。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        QuantizedMesh() = default;
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以模型的包围盒为量化范围，量化模型。
+        【参数】
+            AModel: 源模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit QuantizedMesh(const Model<N>& AModel);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以给定的范围量化模型，多个分块可以共用同一范围。
+            顶点按首次出现的顺序编号，先遍历线段，再遍历面。
+        【参数】
+            AModel: 源模型。
+            Bounds: 量化范围，两个顶点不必有序。
+        【返回值】 无
+            如果模型中有点位于范围之外，抛出 QuantizationRangeException。
+            如果顶点个数超过 32 位下标的范围，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        QuantizedMesh(const Model<N>& AModel, const Tools::Box<N>& Bounds);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一个网格初始化 QuantizedMesh 类型实例。
+        【参数】
+            Other: 另一个网格。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        QuantizedMesh(const QuantizedMesh<N, B>& Other) = default;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 GetName
+        【函数功能】 获取模型的名称。
+        【参数】 无
+        【返回值】
+            模型的名称。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const string& GetName() const;
+        /**********************************************************************
+        【函数名称】 GetOrigin
+        【函数功能】 获取量化范围的原点，即编码全部为 0 的点。
+        【参数】 无
+        【返回值】
+            量化范围的原点。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const Point<N>& GetOrigin() const;
+        /**********************************************************************
+        【函数名称】 GetStep
+        【函数功能】 获取每个坐标轴的量化步长。
+        【参数】 无
+        【返回值】
+            每个坐标轴上相邻编码之间的距离，范围在该轴上为 0 时为 0。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const Vector<double, N>& GetStep() const;
+        /**********************************************************************
+        【函数名称】 GetMaxError
+        【函数功能】 获取量化范围内每个坐标轴的最大误差。
+        【参数】 无
+        【返回值】
+            每个坐标轴的最大误差，为步长的一半。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Vector<double, N> GetMaxError() const;
+        /**********************************************************************
+        【函数名称】 GetVertexCount
+        【函数功能】 获取顶点的个数。
+        【参数】 无
+        【返回值】
+            顶点的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetVertexCount() const;
+        /**********************************************************************
+        【函数名称】 GetVertex
+        【函数功能】 获取解码后的顶点。
+        【参数】
+            Index: 顶点的下标。
+        【返回值】
+            指定下标的顶点。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Point<N> GetVertex(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetVertexCode
+        【函数功能】 获取顶点的编码。
+        【参数】
+            Index: 顶点的下标。
+        【返回值】
+            指定下标的顶点的编码。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const Code& GetVertexCode(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetLineCount
+        【函数功能】 获取线段的个数。
+        【参数】 无
+        【返回值】
+            线段的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetLineCount() const;
+        /**********************************************************************
+        【函数名称】 GetLine
+        【函数功能】 获取线段的顶点下标。
+        【参数】
+            Index: 线段的下标。
+        【返回值】
+            线段的两个顶点下标。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const array<VertexIndex, 2>& GetLine(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetLines
+        【函数功能】 获取所有线段的顶点下标。
+        【参数】 无
+        【返回值】
+            所有线段的顶点下标组成的数组。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<array<VertexIndex, 2>>& GetLines() const;
+        /**********************************************************************
+        【函数名称】 GetFaceCount
+        【函数功能】 获取面的个数。
+        【参数】 无
+        【返回值】
+            面的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetFaceCount() const;
+        /**********************************************************************
+        【函数名称】 GetFace
+        【函数功能】 获取面的顶点下标。
+        【参数】
+            Index: 面的下标。
+        【返回值】
+            面的三个顶点下标。
+            如果下标越界，抛出 IndexOverflowException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const array<VertexIndex, 3>& GetFace(size_t Index) const;
+        /**********************************************************************
+        【函数名称】 GetFaces
+        【函数功能】 获取所有面的顶点下标。
+        【参数】 无
+        【返回值】
+            所有面的顶点下标组成的数组。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const vector<array<VertexIndex, 3>>& GetFaces() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Encode
+        【函数功能】 将点就近编码为整数坐标。
+        【参数】
+            APoint: 要编码的点。
+        【返回值】
+            点的编码。
+            如果点位于量化范围之外，抛出 QuantizationRangeException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Code Encode(const Point<N>& APoint) const;
+        /**********************************************************************
+        【函数名称】 Decode
+        【函数功能】 将整数坐标解码为点。
+        【参数】
+            ACode: 点的编码。
+        【返回值】
+            解码后的点。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Point<N> Decode(const Code& ACode) const;
+        /**********************************************************************
+        【函数名称】 GetBoundingBox
+        【函数功能】 以整数比较求各轴编码的最值，再解码为包围盒。
+        【参数】 无
+        【返回值】
+            能包含所有解码后顶点的最小长方体。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Tools::Box<N> GetBoundingBox() const;
+        /**********************************************************************
+        【函数名称】 GetTotalArea
+        【函数功能】 逐批解码为结构数组，以 AreaKernel 求所有面的面积之和。
+            元素较多时使用多个线程，各批的和使用补偿求和。
+        【参数】 无
+        【返回值】
+            解码后所有面的面积之和。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        double GetTotalArea() const;
+        /**********************************************************************
+        【函数名称】 ToModel
+        【函数功能】 解码并转换回 Model<N>。
+        【参数】 无
+        【返回值】
+            与网格内容相同的模型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Model<N> ToModel() const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一个网格赋值于自身。
+        【参数】
+            Other: 从之取值的网格。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        QuantizedMesh<N, B>& operator=(
+            const QuantizedMesh<N, B>& Other
+        ) = default;
+
+    private:
+        /**********************************************************************
+        【类名】 CodeHash
+        【功能】 整数数组的哈希函数对象，用于合并顶点与去除重复元素。
+        【接口说明】
+            操作符：
+                operator(): 求数组的哈希值。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct CodeHash {
+            /******************************************************************
+            【函数名称】 operator()
+            【函数功能】 求整数数组的哈希值。
+            【参数】
+                Values: 整数数组。
+            【返回值】
+                数组的哈希值。
+            【开发者及日期】 赵一彤 2024/7/24
+            ******************************************************************/
+            template <typename U, size_t K>
+            size_t operator()(const array<U, K>& Values) const;
+        };
+
+        // 模型的名称
+        string m_Name;
+        // 量化范围的原点
+        Point<N> m_Origin;
+        // 每个坐标轴的量化步长
+        Vector<double, N> m_Step;
+        // 顶点的编码
+        vector<Code> m_Vertices;
+        // 线段的顶点下标
+        vector<array<VertexIndex, 2>> m_Lines;
+        // 面的顶点下标
+        vector<array<VertexIndex, 3>> m_Faces;
+};
+
+}
+
+}
+
+#include "QuantizedMesh.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,535 @@
+/*************************************************************************
+【文件名】 QuantizedMesh.tpp
+【功能模块和目的】 为 QuantizedMesh.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "QuantizedMesh.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Core/Vector.hpp"
+#include "../Containers/DynamicSet.hpp"
+#include "../Errors/IndexOverflowException.hpp"
+#include "../Errors/QuantizationRangeException.hpp"
+#include "../Tools/AreaKernel.hpp"
+#include "../Tools/Box.hpp"
+#include "../Tools/CompensatedSum.hpp"
+#include "../Tools/Parallel.hpp"
+#include "../Tools/Unroll.hpp"
+using namespace std;
+using namespace C3w::Containers;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Mesh {
+
+template <size_t N, size_t B>
+constexpr size_t QuantizedMesh<N, B>::DIMENSION;
+
+template <size_t N, size_t B>
+constexpr size_t QuantizedMesh<N, B>::BITS;
+
+template <size_t N, size_t B>
+constexpr typename QuantizedMesh<N, B>::Component
+QuantizedMesh<N, B>::MAX_CODE;
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 以模型的包围盒为量化范围，量化模型。
+【参数】
+    AModel: 源模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+QuantizedMesh<N, B>::QuantizedMesh(const Model<N>& AModel)
+    : QuantizedMesh(AModel, AModel.GetBoundingBox()) {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 以给定的范围量化模型，多个分块可以共用同一范围。
+    顶点按首次出现的顺序编号，先遍历线段，再遍历面。
+【参数】
+    AModel: 源模型。
+    Bounds: 量化范围，两个顶点不必有序。
+【返回值】 无
+    如果模型中有点位于范围之外，抛出 QuantizationRangeException。
+    如果顶点个数超过 32 位下标的范围，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+QuantizedMesh<N, B>::QuantizedMesh(
+    const Model<N>& AModel,
+    const Tools::Box<N>& Bounds
+): m_Name(AModel.Name) {
+    array<double, N> Origin;
+    array<double, N> Step;
+    Tools::Unroll<N>::For([&Bounds, &Origin, &Step](size_t k) {
+        double rFirst = Bounds.Vertex1.GetComponentUnchecked(k);
+        double rSecond = Bounds.Vertex2.GetComponentUnchecked(k);
+        Origin[k] = min(rFirst, rSecond);
+        Step[k] = (max(rFirst, rSecond) - Origin[k]) / MAX_CODE;
+    });
+    m_Origin = Point<N>(Origin);
+    m_Step = Vector<double, N>(Step);
+    size_t ullLineCount = AModel.Lines.Count();
+    size_t ullFaceCount = AModel.Faces.Count();
+    unordered_map<Code, VertexIndex, CodeHash> VertexMap;
+    VertexMap.reserve(ullLineCount * 2 + ullFaceCount * 3);
+    m_Lines.reserve(ullLineCount);
+    m_Faces.reserve(ullFaceCount);
+    // 以整数编码精确比较，查找顶点，不存在时添加，返回顶点下标
+    auto Weld = [this, &VertexMap](const Point<N>& APoint) {
+        size_t ullNewIndex = m_Vertices.size();
+        auto Result = VertexMap.emplace(
+            Encode(APoint),
+            static_cast<VertexIndex>(ullNewIndex)
+        );
+        if (Result.second) {
+            if (ullNewIndex > numeric_limits<VertexIndex>::max()) {
+                throw IndexOverflowException(
+                    ullNewIndex,
+                    size_t(numeric_limits<VertexIndex>::max()) + 1
+                );
+            }
+            m_Vertices.push_back(Result.first->first);
+        }
+        return Result.first->second;
+    };
+    // 量化可能使不同的点合并，按排序后的下标去除退化与重复的元素
+    unordered_set<array<VertexIndex, 2>, CodeHash> LineSet;
+    LineSet.reserve(ullLineCount);
+    for (auto& ALine: AModel.Lines) {
+        array<VertexIndex, 2> Indices {{ Weld(ALine[0]), Weld(ALine[1]) }};
+        array<VertexIndex, 2> Key(Indices);
+        sort(Key.begin(), Key.end());
+        if (Key[0] != Key[1] && LineSet.insert(Key).second) {
+            m_Lines.push_back(Indices);
+        }
+    }
+    unordered_set<array<VertexIndex, 3>, CodeHash> FaceSet;
+    FaceSet.reserve(ullFaceCount);
+    for (auto& AFace: AModel.Faces) {
+        array<VertexIndex, 3> Indices {{
+            Weld(AFace[0]), Weld(AFace[1]), Weld(AFace[2])
+        }};
+        array<VertexIndex, 3> Key(Indices);
+        sort(Key.begin(), Key.end());
+        if (
+            Key[0] != Key[1] && Key[1] != Key[2] &&
+            FaceSet.insert(Key).second
+        ) {
+            m_Faces.push_back(Indices);
+        }
+    }
+    m_Vertices.shrink_to_fit();
+    m_Lines.shrink_to_fit();
+    m_Faces.shrink_to_fit();
+}
+
+/**********************************************************************
+【函数名称】 GetName
+【函数功能】 获取模型的名称。
+【参数】 无
+【返回值】
+    模型的名称。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+const string& QuantizedMesh<N, B>::GetName() const {
+    return m_Name;
+}
+
+/**********************************************************************
+【函数名称】 GetOrigin
+【函数功能】 获取量化范围的原点，即编码全部为 0 的点。
+【参数】 无
+【返回值】
+    量化范围的原点。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+const Point<N>& QuantizedMesh<N, B>::GetOrigin() const {
+    return m_Origin;
+}
+
+/**********************************************************************
+【函数名称】 GetStep
+【函数功能】 获取每个坐标轴的量化步长。
+【参数】 无
+【返回值】
+    每个坐标轴上相邻编码之间的距离，范围在该轴上为 0 时为 0。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+const Vector<double, N>& QuantizedMesh<N, B>::GetStep() const {
+    return m_Step;
+}
+
+/**********************************************************************
+【函数名称】 GetMaxError
+【函数功能】 获取量化范围内每个坐标轴的最大误差。
+【参数】 无
+【返回值】
+    每个坐标轴的最大误差，为步长的一半。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+Vector<double, N> QuantizedMesh<N, B>::GetMaxError() const {
+    return m_Step * 0.5;
+}
+
+/**********************************************************************
+【函数名称】 GetVertexCount
+【函数功能】 获取顶点的个数。
+【参数】 无
+【返回值】
+    顶点的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+size_t QuantizedMesh<N, B>::GetVertexCount() const {
+    return m_Vertices.size();
+}
+
+/**********************************************************************
+【函数名称】 GetVertex
+【函数功能】 获取解码后的顶点。
+【参数】
+    Index: 顶点的下标。
+【返回值】
+    指定下标的顶点。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+Point<N> QuantizedMesh<N, B>::GetVertex(size_t Index) const {
+    return Decode(GetVertexCode(Index));
+}
+
+/**********************************************************************
+【函数名称】 GetVertexCode
+【函数功能】 获取顶点的编码。
+【参数】
+    Index: 顶点的下标。
+【返回值】
+    指定下标的顶点的编码。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+const typename QuantizedMesh<N, B>::Code&
+QuantizedMesh<N, B>::GetVertexCode(size_t Index) const {
+    if (Index >= m_Vertices.size()) {
+        throw IndexOverflowException(Index, m_Vertices.size());
+    }
+    return m_Vertices[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetLineCount
+【函数功能】 获取线段的个数。
+【参数】 无
+【返回值】
+    线段的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+size_t QuantizedMesh<N, B>::GetLineCount() const {
+    return m_Lines.size();
+}
+
+/**********************************************************************
+【函数名称】 GetLine
+【函数功能】 获取线段的顶点下标。
+【参数】
+    Index: 线段的下标。
+【返回值】
+    线段的两个顶点下标。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+const array<typename QuantizedMesh<N, B>::VertexIndex, 2>&
+QuantizedMesh<N, B>::GetLine(size_t Index) const {
+    if (Index >= m_Lines.size()) {
+        throw IndexOverflowException(Index, m_Lines.size());
+    }
+    return m_Lines[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetLines
+【函数功能】 获取所有线段的顶点下标。
+【参数】 无
+【返回值】
+    所有线段的顶点下标组成的数组。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+const vector<array<typename QuantizedMesh<N, B>::VertexIndex, 2>>&
+QuantizedMesh<N, B>::GetLines() const {
+    return m_Lines;
+}
+
+/**********************************************************************
+【函数名称】 GetFaceCount
+【函数功能】 获取面的个数。
+【参数】 无
+【返回值】
+    面的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+size_t QuantizedMesh<N, B>::GetFaceCount() const {
+    return m_Faces.size();
+}
+
+/**********************************************************************
+【函数名称】 GetFace
+【函数功能】 获取面的顶点下标。
+【参数】
+    Index: 面的下标。
+【返回值】
+    面的三个顶点下标。
+    如果下标越界，抛出 IndexOverflowException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+const array<typename QuantizedMesh<N, B>::VertexIndex, 3>&
+QuantizedMesh<N, B>::GetFace(size_t Index) const {
+    if (Index >= m_Faces.size()) {
+        throw IndexOverflowException(Index, m_Faces.size());
+    }
+    return m_Faces[Index];
+}
+
+/**********************************************************************
+【函数名称】 GetFaces
+【函数功能】 获取所有面的顶点下标。
+【参数】 无
+【返回值】
+    所有面的顶点下标组成的数组。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+const vector<array<typename QuantizedMesh<N, B>::VertexIndex, 3>>&
+QuantizedMesh<N, B>::GetFaces() const {
+    return m_Faces;
+}
+
+/**********************************************************************
+【函数名称】 Encode
+【函数功能】 将点就近编码为整数坐标。
+【参数】
+    APoint: 要编码的点。
+【返回值】
+    点的编码。
+    如果点位于量化范围之外，抛出 QuantizationRangeException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+typename QuantizedMesh<N, B>::Code QuantizedMesh<N, B>::Encode(
+    const Point<N>& APoint
+) const {
+    Code ACode;
+    Tools::Unroll<N>::For([this, &APoint, &ACode](size_t k) {
+        double rOffset = APoint.GetComponentUnchecked(k) -
+            m_Origin.GetComponentUnchecked(k);
+        double rStep = m_Step.GetComponentUnchecked(k);
+        // 范围在该轴上为 0 时只接受与原点重合的坐标
+        double rScaled = rStep == 0 ? rOffset * 2 : rOffset / rStep;
+        // 允许超出范围半个步长，取整后的误差仍不超过半个步长；
+        // 写成否定形式以便同时拒绝 NaN
+        if (!(rScaled >= -0.5 && rScaled <= MAX_CODE + 0.5)) {
+            throw QuantizationRangeException(APoint.ToString());
+        }
+        double rRounded = floor(rScaled + 0.5);
+        ACode[k] = rRounded > MAX_CODE ?
+            MAX_CODE : static_cast<Component>(rRounded);
+    });
+    return ACode;
+}
+
+/**********************************************************************
+【函数名称】 Decode
+【函数功能】 将整数坐标解码为点。
+【参数】
+    ACode: 点的编码。
+【返回值】
+    解码后的点。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+Point<N> QuantizedMesh<N, B>::Decode(const Code& ACode) const {
+    array<double, N> Coords;
+    Tools::Unroll<N>::For([this, &ACode, &Coords](size_t k) {
+        Coords[k] = m_Origin.GetComponentUnchecked(k) +
+            ACode[k] * m_Step.GetComponentUnchecked(k);
+    });
+    return Point<N>(Coords);
+}
+
+/**********************************************************************
+【函数名称】 GetBoundingBox
+【函数功能】 以整数比较求各轴编码的最值，再解码为包围盒。
+【参数】 无
+【返回值】
+    能包含所有解码后顶点的最小长方体。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+Tools::Box<N> QuantizedMesh<N, B>::GetBoundingBox() const {
+    if (m_Vertices.empty()) {
+        return Tools::Box<N>();
+    }
+    Code MinCode;
+    MinCode.fill(MAX_CODE);
+    Code MaxCode;
+    MaxCode.fill(0);
+    for (auto& ACode: m_Vertices) {
+        Tools::Unroll<N>::For([&ACode, &MinCode, &MaxCode](size_t k) {
+            if (ACode[k] < MinCode[k]) {
+                MinCode[k] = ACode[k];
+            }
+            if (ACode[k] > MaxCode[k]) {
+                MaxCode[k] = ACode[k];
+            }
+        });
+    }
+    return Tools::Box<N>(Decode(MinCode), Decode(MaxCode));
+}
+
+/**********************************************************************
+【函数名称】 GetTotalArea
+【函数功能】 逐批解码为结构数组，以 AreaKernel 求所有面的面积之和。
+    元素较多时使用多个线程，各批的和使用补偿求和。
+【参数】 无
+【返回值】
+    解码后所有面的面积之和。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+double QuantizedMesh<N, B>::GetTotalArea() const {
+    using Kernel = Tools::AreaKernel<N>;
+    auto Map = [this](size_t Begin, size_t End) {
+        Tools::CompensatedSum Sum;
+        typename Kernel::Batch ABatch;
+        array<double, Kernel::BATCH_SIZE> Areas;
+        for (size_t ullOffset = Begin; ullOffset < End;) {
+            size_t ullCount = min(End - ullOffset, Kernel::BATCH_SIZE);
+            for (size_t i = 0; i < ullCount; i++) {
+                auto& Indices = m_Faces[ullOffset + i];
+                for (size_t c = 0; c < 3; c++) {
+                    auto& ACode = m_Vertices[Indices[c]];
+                    // 面积与平移无关，解码时省略原点，减小舍入误差
+                    Tools::Unroll<N>::For([&](size_t k) {
+                        ABatch[c][k][i] =
+                            ACode[k] * m_Step.GetComponentUnchecked(k);
+                    });
+                }
+            }
+            Kernel::GetAreas(ABatch, ullCount, Areas.data());
+            double rBatchSum = 0;
+            for (size_t i = 0; i < ullCount; i++) {
+                rBatchSum += Areas[i];
+            }
+            Sum += rBatchSum;
+            ullOffset += ullCount;
+        }
+        return Sum;
+    };
+    auto Combine = [](
+        const Tools::CompensatedSum& Left,
+        const Tools::CompensatedSum& Right
+    ) {
+        Tools::CompensatedSum Sum(Left);
+        Sum += Right;
+        return Sum;
+    };
+    return Tools::Parallel::Reduce(
+        m_Faces.size(),
+        Tools::CompensatedSum(),
+        Map,
+        Combine
+    ).GetValue();
+}
+
+/**********************************************************************
+【函数名称】 ToModel
+【函数功能】 解码并转换回 Model<N>。
+【参数】 无
+【返回值】
+    与网格内容相同的模型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+Model<N> QuantizedMesh<N, B>::ToModel() const {
+    // 每个顶点只解码一次
+    vector<Point<N>> Vertices;
+    Vertices.reserve(m_Vertices.size());
+    for (auto& ACode: m_Vertices) {
+        Vertices.push_back(Decode(ACode));
+    }
+    vector<Line<N>> Lines;
+    vector<Face<N>> Faces;
+    Lines.reserve(m_Lines.size());
+    Faces.reserve(m_Faces.size());
+    for (auto& Indices: m_Lines) {
+        Lines.emplace_back(Vertices[Indices[0]], Vertices[Indices[1]]);
+    }
+    for (auto& Indices: m_Faces) {
+        Faces.emplace_back(
+            Vertices[Indices[0]],
+            Vertices[Indices[1]],
+            Vertices[Indices[2]]
+        );
+    }
+    // 构造时已去除退化与重复的元素
+    return Model<N>(
+        m_Name,
+        DynamicSet<Line<N>>::FromDistinct(move(Lines)),
+        DynamicSet<Face<N>>::FromDistinct(move(Faces))
+    );
+}
+
+/**********************************************************************
+【函数名称】 operator()
+【函数功能】 求整数数组的哈希值。
+【参数】
+    Values: 整数数组。
+【返回值】
+    数组的哈希值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, size_t B>
+template <typename U, size_t K>
+size_t QuantizedMesh<N, B>::CodeHash::operator()(
+    const array<U, K>& Values
+) const {
+    hash<U> Hasher;
+    size_t ullSeed = 0;
+    for (size_t i = 0; i < K; i++) {
+        ullSeed ^= Hasher(Values[i])
+            + 0x9e3779b97f4a7c15ULL + (ullSeed << 6) + (ullSeed >> 2);
+    }
+    return ullSeed;
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,182 @@
+/*************************************************************************
+【文件名】 SpatialOrder.hpp
+【功能模块和目的】 SpatialOrder 类沿 Morton 曲线重排网格的顶点与元素。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef SPATIAL_ORDER_HPP
+#define SPATIAL_ORDER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "IndexedMesh.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Containers/DynamicSet.hpp"
+#include "../Tools/Box.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 SpatialOrder
+【功能】 将点在包围盒内量化为每轴 BITS 位的整数，逐位交错得到 Morton 码，
+    即 Z 序曲线上的位置。按 Morton 码以 C3w::Tools::RadixSort 并行排序
+    顶点与元素（元素使用其重心），使空间上相邻的数据在内存中也相邻。
+    排序是稳定的，Morton 码相同的元素保持原有的相对顺序。
+【接口说明】
+    成员：
+        DIMENSION: 表示维数。
+        BITS: 每轴量化的位数。
+    构造函数：
+        私有默认构造函数。
+    操作：
+        GetCode: 求点的 Morton 码。
+        ReorderInplace: 重排模型的线段与面。
+        Reorder: 重排共享顶点网格的顶点与元素，并重映射下标。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N>
+class SpatialOrder final {
+    public:
+        // 成员
+
+        // 维数
+        static constexpr size_t DIMENSION { N };
+        // 每轴量化的位数，N 轴共用 64 位，且不超过 32 位
+        static constexpr size_t BITS { 64 / N < 32 ? 64 / N : 32 };
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 GetCode
+        【函数功能】 将点在包围盒内量化，并逐位交错各轴得到 Morton 码。
+        【参数】
+            APoint: 点。
+            Bounds: 量化范围，范围外的分量截断到边界。
+        【返回值】
+            点的 Morton 码，第 i 轴的第 b 位位于第 b × N + i 位。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static uint64_t GetCode(
+            const Point<N>& APoint,
+            const Tools::Box<N>& Bounds
+        );
+        /**********************************************************************
+        【函数名称】 ReorderInplace
+        【函数功能】 在模型的包围盒内，按重心的 Morton 码重排线段与面。
+        【参数】
+            AModel: 要重排的模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename T>
+        static void ReorderInplace(Model<N, T>& AModel);
+        /**********************************************************************
+        【函数名称】 ReorderInplace
+        【函数功能】 在模型的包围盒内，按重心的 Morton 码重排线段与面，
+            并输出重排使用的顺序，供调用者同步与元素对应的数据。
+        【参数】
+            AModel: 要重排的模型。
+            LineOrder: 输出，第 i 个元素为重排后第 i 条线段的原下标。
+            FaceOrder: 输出，第 i 个元素为重排后第 i 个面的原下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename T>
+        static void ReorderInplace(
+            Model<N, T>& AModel,
+            vector<size_t>& LineOrder,
+            vector<size_t>& FaceOrder
+        );
+        /**********************************************************************
+        【函数名称】 Reorder
+        【函数功能】 按 Morton 码重排网格的顶点，重映射线段与面的下标，
+            再按重心的 Morton 码重排线段与面。
+        【参数】
+            AMesh: 共享顶点的网格。
+        【返回值】
+            重排后的网格，与原网格表示同一模型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static IndexedMesh<N> Reorder(const IndexedMesh<N>& AMesh);
+
+    private:
+        // 静态类，隐藏构造函数。
+        SpatialOrder();
+
+        /**********************************************************************
+        【函数名称】 GetElementOrder
+        【函数功能】 并行地求每个元素重心的 Morton 码，并排序。
+        【参数】
+            Elements: 线段或面的集合。
+            Bounds: 量化范围。
+        【返回值】
+            排序后每个位置上元素的原下标。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename E>
+        static vector<size_t> GetElementOrder(
+            const Containers::DynamicSet<E>& Elements,
+            const Tools::Box<N>& Bounds
+        );
+        /**********************************************************************
+        【函数名称】 GetIndexedOrder
+        【函数功能】 并行地求每个下标元素重心的 Morton 码，并排序。
+        【参数】
+            Vertices: 顶点。
+            Elements: 每个元素的 S 个顶点下标。
+            Bounds: 量化范围。
+        【返回值】
+            排序后每个位置上元素的原下标。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <size_t S>
+        static vector<size_t> GetIndexedOrder(
+            const vector<Point<N>>& Vertices,
+            const vector<array<size_t, S>>& Elements,
+            const Tools::Box<N>& Bounds
+        );
+        /**********************************************************************
+        【函数名称】 Permute
+        【函数功能】 按顺序重排元素。
+        【参数】
+            Elements: 原元素。
+            Order: 第 i 个元素为结果中第 i 个元素的原下标。
+        【返回值】
+            重排后的元素。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename E>
+        static vector<E> Permute(
+            const vector<E>& Elements,
+            const vector<size_t>& Order
+        );
+        /**********************************************************************
+        【函数名称】 Permute
+        【函数功能】 按顺序重排集合中的元素，不再检查元素是否重复。
+        【参数】
+            Elements: 原集合。
+            Order: 第 i 个元素为结果中第 i 个元素的原下标。
+        【返回值】
+            重排后的集合。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename E>
+        static Containers::DynamicSet<E> Permute(
+            const Containers::DynamicSet<E>& Elements,
+            const vector<size_t>& Order
+        );
+};
+
+}
+
+}
+
+#include "SpatialOrder.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,326 @@
+/*************************************************************************
+【文件名】 SpatialOrder.tpp
+【功能模块和目的】 为 SpatialOrder.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "IndexedMesh.hpp"
+#include "SpatialOrder.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Containers/DynamicSet.hpp"
+#include "../Tools/Box.hpp"
+#include "../Tools/Parallel.hpp"
+#include "../Tools/RadixSort.hpp"
+#include "../Tools/Unroll.hpp"
+using namespace std;
+using namespace C3w::Containers;
+
+namespace C3w {
+
+namespace Mesh {
+
+// 维数
+template <size_t N>
+constexpr size_t SpatialOrder<N>::DIMENSION;
+// 每轴量化的位数
+template <size_t N>
+constexpr size_t SpatialOrder<N>::BITS;
+
+/**********************************************************************
+【函数名称】 GetCode
+【函数功能】 将点在包围盒内量化，并逐位交错各轴得到 Morton 码。
+【参数】
+    APoint: 点。
+    Bounds: 量化范围，范围外的分量截断到边界。
+【返回值】
+    点的 Morton 码，第 i 轴的第 b 位位于第 b × N + i 位。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+uint64_t SpatialOrder<N>::GetCode(
+    const Point<N>& APoint,
+    const Tools::Box<N>& Bounds
+) {
+    const double rMaxCell = static_cast<double>((uint64_t(1) << BITS) - 1);
+    array<uint64_t, N> Cells;
+    Tools::Unroll<N>::For([&](size_t i) {
+        double rLow = Bounds.Vertex1.GetComponentUnchecked(i);
+        double rHigh = Bounds.Vertex2.GetComponentUnchecked(i);
+        if (rHigh < rLow) {
+            swap(rLow, rHigh);
+        }
+        double rRatio = 0;
+        if (rHigh > rLow) {
+            rRatio = (APoint.GetComponentUnchecked(i) - rLow) / (rHigh - rLow);
+        }
+        // 写作取反的比较，使 NaN 也落在下界
+        if (!(rRatio > 0)) {
+            rRatio = 0;
+        }
+        else if (rRatio > 1) {
+            rRatio = 1;
+        }
+        Cells[i] = static_cast<uint64_t>(rRatio * rMaxCell + 0.5);
+    });
+    uint64_t ullCode = 0;
+    for (size_t b = 0; b < BITS; b++) {
+        for (size_t i = 0; i < N; i++) {
+            ullCode |= ((Cells[i] >> b) & 1) << (b * N + i);
+        }
+    }
+    return ullCode;
+}
+
+/**********************************************************************
+【函数名称】 ReorderInplace
+【函数功能】 在模型的包围盒内，按重心的 Morton 码重排线段与面。
+【参数】
+    AModel: 要重排的模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename T>
+void SpatialOrder<N>::ReorderInplace(Model<N, T>& AModel) {
+    vector<size_t> LineOrder;
+    vector<size_t> FaceOrder;
+    ReorderInplace(AModel, LineOrder, FaceOrder);
+}
+
+/**********************************************************************
+【函数名称】 ReorderInplace
+【函数功能】 在模型的包围盒内，按重心的 Morton 码重排线段与面，
+    并输出重排使用的顺序，供调用者同步与元素对应的数据。
+【参数】
+    AModel: 要重排的模型。
+    LineOrder: 输出，第 i 个元素为重排后第 i 条线段的原下标。
+    FaceOrder: 输出，第 i 个元素为重排后第 i 个面的原下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename T>
+void SpatialOrder<N>::ReorderInplace(
+    Model<N, T>& AModel,
+    vector<size_t>& LineOrder,
+    vector<size_t>& FaceOrder
+) {
+    Tools::Box<N> Bounds = AModel.GetBoundingBox();
+    LineOrder = GetElementOrder(AModel.Lines, Bounds);
+    FaceOrder = GetElementOrder(AModel.Faces, Bounds);
+    AModel.Lines = Permute(AModel.Lines, LineOrder);
+    AModel.Faces = Permute(AModel.Faces, FaceOrder);
+}
+
+/**********************************************************************
+【函数名称】 Reorder
+【函数功能】 按 Morton 码重排网格的顶点，重映射线段与面的下标，
+    再按重心的 Morton 码重排线段与面。
+【参数】
+    AMesh: 共享顶点的网格。
+【返回值】
+    重排后的网格，与原网格表示同一模型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+IndexedMesh<N> SpatialOrder<N>::Reorder(const IndexedMesh<N>& AMesh) {
+    const vector<Point<N>>& Vertices = AMesh.GetVertices();
+    size_t ullVertexCount = Vertices.size();
+    // 顶点的包围盒，同时包含所有元素的重心
+    array<double, N> MinCoords;
+    MinCoords.fill(numeric_limits<double>::max());
+    array<double, N> MaxCoords;
+    MaxCoords.fill(numeric_limits<double>::lowest());
+    for (auto& AVertex: Vertices) {
+        Tools::Unroll<N>::For([&](size_t i) {
+            double rValue = AVertex.GetComponentUnchecked(i);
+            if (rValue < MinCoords[i]) {
+                MinCoords[i] = rValue;
+            }
+            if (rValue > MaxCoords[i]) {
+                MaxCoords[i] = rValue;
+            }
+        });
+    }
+    Tools::Box<N> Bounds;
+    if (ullVertexCount > 0) {
+        Bounds = Tools::Box<N>(Point<N>(MinCoords), Point<N>(MaxCoords));
+    }
+    vector<uint64_t> Codes(ullVertexCount);
+    Tools::Parallel::For(
+        ullVertexCount,
+        [&Vertices, &Codes, &Bounds](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                Codes[i] = GetCode(Vertices[i], Bounds);
+            }
+        }
+    );
+    vector<size_t> VertexOrder = Tools::RadixSort::GetOrder(Codes);
+    vector<size_t> NewIndices(ullVertexCount);
+    for (size_t i = 0; i < ullVertexCount; i++) {
+        NewIndices[VertexOrder[i]] = i;
+    }
+    vector<Point<N>> NewVertices = Permute(Vertices, VertexOrder);
+    vector<array<size_t, 2>> Lines(AMesh.GetLines());
+    for (auto& ALine: Lines) {
+        for (auto& ullIndex: ALine) {
+            ullIndex = NewIndices[ullIndex];
+        }
+    }
+    vector<array<size_t, 3>> Faces(AMesh.GetFaces());
+    for (auto& AFace: Faces) {
+        for (auto& ullIndex: AFace) {
+            ullIndex = NewIndices[ullIndex];
+        }
+    }
+    vector<size_t> LineOrder = GetIndexedOrder(NewVertices, Lines, Bounds);
+    vector<size_t> FaceOrder = GetIndexedOrder(NewVertices, Faces, Bounds);
+    return IndexedMesh<N>(
+        AMesh.GetName(),
+        move(NewVertices),
+        Permute(Lines, LineOrder),
+        Permute(Faces, FaceOrder)
+    );
+}
+
+/**********************************************************************
+【函数名称】 GetElementOrder
+【函数功能】 并行地求每个元素重心的 Morton 码，并排序。
+【参数】
+    Elements: 线段或面的集合。
+    Bounds: 量化范围。
+【返回值】
+    排序后每个位置上元素的原下标。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename E>
+vector<size_t> SpatialOrder<N>::GetElementOrder(
+    const DynamicSet<E>& Elements,
+    const Tools::Box<N>& Bounds
+) {
+    vector<uint64_t> Codes(Elements.Count());
+    Tools::Parallel::For(
+        Codes.size(),
+        [&Elements, &Codes, &Bounds](size_t Begin, size_t End) {
+            // 区间已由 Parallel 保证有效，使用迭代器避免逐个检查下标
+            auto ElementIterator = Elements.begin() + Begin;
+            for (size_t i = Begin; i < End; i++, ++ElementIterator) {
+                array<double, N> Sum {};
+                double rCount = 0;
+                for (auto& APoint: ElementIterator->Points) {
+                    Tools::Unroll<N>::For([&Sum, &APoint](size_t k) {
+                        Sum[k] += APoint.GetComponentUnchecked(k);
+                    });
+                    rCount++;
+                }
+                Tools::Unroll<N>::For([&Sum, rCount](size_t k) {
+                    Sum[k] /= rCount;
+                });
+                Codes[i] = GetCode(Point<N>(Sum), Bounds);
+            }
+        }
+    );
+    return Tools::RadixSort::GetOrder(Codes);
+}
+
+/**********************************************************************
+【函数名称】 GetIndexedOrder
+【函数功能】 并行地求每个下标元素重心的 Morton 码，并排序。
+【参数】
+    Vertices: 顶点。
+    Elements: 每个元素的 S 个顶点下标。
+    Bounds: 量化范围。
+【返回值】
+    排序后每个位置上元素的原下标。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <size_t S>
+vector<size_t> SpatialOrder<N>::GetIndexedOrder(
+    const vector<Point<N>>& Vertices,
+    const vector<array<size_t, S>>& Elements,
+    const Tools::Box<N>& Bounds
+) {
+    vector<uint64_t> Codes(Elements.size());
+    Tools::Parallel::For(
+        Codes.size(),
+        [&Vertices, &Elements, &Codes, &Bounds](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                array<double, N> Sum {};
+                for (size_t ullIndex: Elements[i]) {
+                    const Point<N>& AVertex = Vertices[ullIndex];
+                    Tools::Unroll<N>::For([&Sum, &AVertex](size_t k) {
+                        Sum[k] += AVertex.GetComponentUnchecked(k);
+                    });
+                }
+                Tools::Unroll<N>::For([&Sum](size_t k) {
+                    Sum[k] /= S;
+                });
+                Codes[i] = GetCode(Point<N>(Sum), Bounds);
+            }
+        }
+    );
+    return Tools::RadixSort::GetOrder(Codes);
+}
+
+/**********************************************************************
+【函数名称】 Permute
+【函数功能】 按顺序重排元素。
+【参数】
+    Elements: 原元素。
+    Order: 第 i 个元素为结果中第 i 个元素的原下标。
+【返回值】
+    重排后的元素。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename E>
+vector<E> SpatialOrder<N>::Permute(
+    const vector<E>& Elements,
+    const vector<size_t>& Order
+) {
+    vector<E> Result;
+    Result.reserve(Order.size());
+    for (size_t ullIndex: Order) {
+        Result.push_back(Elements[ullIndex]);
+    }
+    return Result;
+}
+
+/**********************************************************************
+【函数名称】 Permute
+【函数功能】 按顺序重排集合中的元素，不再检查元素是否重复。
+【参数】
+    Elements: 原集合。
+    Order: 第 i 个元素为结果中第 i 个元素的原下标。
+【返回值】
+    重排后的集合。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename E>
+DynamicSet<E> SpatialOrder<N>::Permute(
+    const DynamicSet<E>& Elements,
+    const vector<size_t>& Order
+) {
+    vector<E> Result;
+    Result.reserve(Order.size());
+    auto ElementIterator = Elements.begin();
+    for (size_t ullIndex: Order) {
+        Result.push_back(ElementIterator[ullIndex]);
+    }
+    // 重排不改变元素，原集合中互不相同，因此跳过查重
+    return DynamicSet<E>::FromDistinct(move(Result));
+}
+
+}
+
+}
\ No newline at end of file
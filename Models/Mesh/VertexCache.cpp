@@ -0,0 +1,371 @@
+/*************************************************************************
+【文件名】 VertexCache.cpp
+【功能模块和目的】 为 VertexCache.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "IndexedMesh.hpp"
+#include "VertexCache.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+// 模拟的 LRU 缓存大小
+constexpr size_t VertexCache::CACHE_SIZE;
+// 求 ACMR/ATVR 时模拟的 FIFO 缓存的默认大小
+constexpr size_t VertexCache::FIFO_SIZE;
+
+/**********************************************************************
+【函数名称】 GetFaceOrder
+【函数功能】 使用 Forsyth 算法求面的输出顺序。
+【参数】
+    Faces: 每个面的三个顶点下标。
+    VertexCount: 顶点的个数，所有下标都小于此值。
+【返回值】
+    面的顺序，第 i 个元素为第 i 个输出的面的原下标。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+vector<size_t> VertexCache::GetFaceOrder(
+    const vector<array<size_t, 3>>& Faces,
+    size_t VertexCount
+) {
+    const size_t NONE = numeric_limits<size_t>::max();
+    size_t ullFaceCount = Faces.size();
+    // 以压缩行存储每个顶点的相邻面，前 Valences[v] 个为未输出的面
+    vector<size_t> Valences(VertexCount, 0);
+    for (auto& AFace: Faces) {
+        for (size_t ullVertex: AFace) {
+            Valences[ullVertex]++;
+        }
+    }
+    vector<size_t> Offsets(VertexCount + 1, 0);
+    for (size_t i = 0; i < VertexCount; i++) {
+        Offsets[i + 1] = Offsets[i] + Valences[i];
+    }
+    vector<size_t> Adjacency(Offsets.back());
+    vector<size_t> Cursors(Offsets.begin(), Offsets.end() - 1);
+    for (size_t i = 0; i < ullFaceCount; i++) {
+        for (size_t ullVertex: Faces[i]) {
+            Adjacency[Cursors[ullVertex]++] = i;
+        }
+    }
+    vector<size_t> CachePositions(VertexCount, CACHE_SIZE);
+    vector<double> VertexScores(VertexCount);
+    for (size_t i = 0; i < VertexCount; i++) {
+        VertexScores[i] = GetVertexScore(CACHE_SIZE, Valences[i]);
+    }
+    vector<double> FaceScores(ullFaceCount);
+    vector<bool> Emitted(ullFaceCount, false);
+    auto GetFaceScore = [&Faces, &VertexScores](size_t Face) {
+        return VertexScores[Faces[Face][0]] +
+            VertexScores[Faces[Face][1]] +
+            VertexScores[Faces[Face][2]];
+    };
+    // 第一个面取全局得分最高者，此后只在缓存的相邻面中选择
+    size_t ullBest = NONE;
+    double rBestScore = numeric_limits<double>::lowest();
+    for (size_t i = 0; i < ullFaceCount; i++) {
+        FaceScores[i] = GetFaceScore(i);
+        if (FaceScores[i] > rBestScore) {
+            rBestScore = FaceScores[i];
+            ullBest = i;
+        }
+    }
+    vector<size_t> Order;
+    Order.reserve(ullFaceCount);
+    // 缓存中的顶点，加上刚输出的面的三个顶点后再截断
+    vector<size_t> Cache;
+    vector<size_t> NewCache;
+    Cache.reserve(CACHE_SIZE + 3);
+    NewCache.reserve(CACHE_SIZE + 3);
+    size_t ullScan = 0;
+    for (size_t ullEmitted = 0; ullEmitted < ullFaceCount; ullEmitted++) {
+        // 缓存中没有候选面，按原顺序取下一个未输出的面
+        if (ullBest == NONE) {
+            while (Emitted[ullScan]) {
+                ullScan++;
+            }
+            ullBest = ullScan;
+        }
+        Order.push_back(ullBest);
+        Emitted[ullBest] = true;
+        // 从三个顶点的未输出面中移除此面
+        for (size_t ullVertex: Faces[ullBest]) {
+            size_t ullBegin = Offsets[ullVertex];
+            size_t ullEnd = ullBegin + Valences[ullVertex];
+            for (size_t i = ullBegin; i < ullEnd; i++) {
+                if (Adjacency[i] == ullBest) {
+                    swap(Adjacency[i], Adjacency[ullEnd - 1]);
+                    Valences[ullVertex]--;
+                    break;
+                }
+            }
+        }
+        // 面的顶点移到缓存最前，其余顶点依次后移
+        const array<size_t, 3>& BestFace = Faces[ullBest];
+        NewCache.clear();
+        for (size_t ullVertex: BestFace) {
+            if (find(
+                NewCache.begin(), NewCache.end(), ullVertex
+            ) == NewCache.end()) {
+                NewCache.push_back(ullVertex);
+            }
+        }
+        for (size_t ullVertex: Cache) {
+            if (
+                ullVertex != BestFace[0] && 
+                ullVertex != BestFace[1] && 
+                ullVertex != BestFace[2]
+            ) {
+                NewCache.push_back(ullVertex);
+            }
+        }
+        for (size_t i = 0; i < NewCache.size(); i++) {
+            size_t ullVertex = NewCache[i];
+            CachePositions[ullVertex] = i < CACHE_SIZE ? i : CACHE_SIZE;
+            VertexScores[ullVertex] = GetVertexScore(
+                CachePositions[ullVertex],
+                Valences[ullVertex]
+            );
+        }
+        // 被移出缓存的顶点的得分也已改变，一并更新其相邻面
+        ullBest = NONE;
+        rBestScore = numeric_limits<double>::lowest();
+        for (size_t i = 0; i < NewCache.size(); i++) {
+            size_t ullVertex = NewCache[i];
+            size_t ullBegin = Offsets[ullVertex];
+            size_t ullEnd = ullBegin + Valences[ullVertex];
+            for (size_t j = ullBegin; j < ullEnd; j++) {
+                size_t ullFace = Adjacency[j];
+                FaceScores[ullFace] = GetFaceScore(ullFace);
+                if (i < CACHE_SIZE && FaceScores[ullFace] > rBestScore) {
+                    rBestScore = FaceScores[ullFace];
+                    ullBest = ullFace;
+                }
+            }
+        }
+        if (NewCache.size() > CACHE_SIZE) {
+            NewCache.resize(CACHE_SIZE);
+        }
+        swap(Cache, NewCache);
+    }
+    return Order;
+}
+
+/**********************************************************************
+【函数名称】 Optimize
+【函数功能】 重排网格的面，再按首次被面使用的顺序重排顶点。
+    只被线段使用的顶点排在最后，线段的顺序不变。
+【参数】
+    AMesh: 共享顶点的网格。
+【返回值】
+    重排后的网格，与原网格表示同一模型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+IndexedMesh<3> VertexCache::Optimize(const IndexedMesh<3>& AMesh) {
+    vector<size_t> FaceOrder;
+    return Optimize(AMesh, FaceOrder);
+}
+
+/**********************************************************************
+【函数名称】 Optimize
+【函数功能】 重排网格的面与顶点，并输出面的顺序，
+    供调用者同步与面对应的数据。
+【参数】
+    AMesh: 共享顶点的网格。
+    FaceOrder: 输出，第 i 个元素为重排后第 i 个面的原下标。
+【返回值】
+    重排后的网格，与原网格表示同一模型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+IndexedMesh<3> VertexCache::Optimize(
+    const IndexedMesh<3>& AMesh,
+    vector<size_t>& FaceOrder
+) {
+    const size_t NONE = numeric_limits<size_t>::max();
+    size_t ullVertexCount = AMesh.GetVertexCount();
+    FaceOrder = GetFaceOrder(AMesh.GetFaces(), ullVertexCount);
+    vector<size_t> NewIndices(ullVertexCount, NONE);
+    vector<Point<3>> Vertices;
+    Vertices.reserve(ullVertexCount);
+    auto Remap = [&AMesh, &NewIndices, &Vertices, NONE](size_t Index) {
+        if (NewIndices[Index] == NONE) {
+            NewIndices[Index] = Vertices.size();
+            Vertices.push_back(AMesh.GetVertex(Index));
+        }
+        return NewIndices[Index];
+    };
+    vector<array<size_t, 3>> Faces;
+    Faces.reserve(FaceOrder.size());
+    for (size_t ullFace: FaceOrder) {
+        auto& AFace = AMesh.GetFace(ullFace);
+        // 列表初始化保证从左到右求值
+        Faces.push_back({{ 
+            Remap(AFace[0]), Remap(AFace[1]), Remap(AFace[2]) 
+        }});
+    }
+    vector<array<size_t, 2>> Lines;
+    Lines.reserve(AMesh.GetLineCount());
+    for (auto& ALine: AMesh.GetLines()) {
+        Lines.push_back({{ Remap(ALine[0]), Remap(ALine[1]) }});
+    }
+    return IndexedMesh<3>(
+        AMesh.GetName(),
+        move(Vertices),
+        move(Lines),
+        move(Faces)
+    );
+}
+
+/**********************************************************************
+【函数名称】 GetAcmr
+【函数功能】 以 FIFO 缓存模拟绘制，求每个面平均的缓存未命中数。
+【参数】
+    Faces: 每个面的三个顶点下标。
+    CacheSize: FIFO 缓存的大小，默认为 FIFO_SIZE。
+【返回值】
+    ACMR，介于 0.5 左右的理想值与 3 之间；没有面时为 0。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+double VertexCache::GetAcmr(
+    const vector<array<size_t, 3>>& Faces,
+    size_t CacheSize
+) {
+    if (Faces.empty()) {
+        return 0;
+    }
+    size_t ullUsedCount = 0;
+    size_t ullMissCount = GetMissCount(Faces, CacheSize, ullUsedCount);
+    return static_cast<double>(ullMissCount) / Faces.size();
+}
+
+/**********************************************************************
+【函数名称】 GetAtvr
+【函数功能】 以 FIFO 缓存模拟绘制，求每个被使用的顶点平均的变换次数。
+【参数】
+    Faces: 每个面的三个顶点下标。
+    CacheSize: FIFO 缓存的大小，默认为 FIFO_SIZE。
+【返回值】
+    ATVR，理想值为 1；没有面时为 0。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+double VertexCache::GetAtvr(
+    const vector<array<size_t, 3>>& Faces,
+    size_t CacheSize
+) {
+    if (Faces.empty()) {
+        return 0;
+    }
+    size_t ullUsedCount = 0;
+    size_t ullMissCount = GetMissCount(Faces, CacheSize, ullUsedCount);
+    return static_cast<double>(ullMissCount) / ullUsedCount;
+}
+
+/**********************************************************************
+【函数名称】 GetVertexScore
+【函数功能】 求顶点的得分，得分使用查找表。
+【参数】
+    CachePosition: 顶点在缓存中的位置，不在缓存中时为 CACHE_SIZE。
+    Valence: 顶点尚未输出的相邻面数。
+【返回值】
+    顶点的得分，没有未输出的相邻面时为 -1。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+double VertexCache::GetVertexScore(size_t CachePosition, size_t Valence) {
+    // Forsyth 原文给出的参数
+    constexpr double CACHE_DECAY_POWER = 1.5;
+    constexpr double LAST_FACE_SCORE = 0.75;
+    constexpr double VALENCE_BOOST_SCALE = 2.0;
+    constexpr double VALENCE_BOOST_POWER = 0.5;
+    constexpr size_t VALENCE_TABLE_SIZE = 64;
+    // 刚输出的面的三个顶点得分固定，鼓励离开而非反复使用它们
+    static const array<double, CACHE_SIZE + 1> CacheScores = []() {
+        array<double, CACHE_SIZE + 1> Scores;
+        for (size_t i = 0; i < CACHE_SIZE; i++) {
+            Scores[i] = i < 3
+                ? LAST_FACE_SCORE
+                : pow(
+                    1.0 - (i - 3.0) / (CACHE_SIZE - 3.0),
+                    CACHE_DECAY_POWER
+                );
+        }
+        Scores[CACHE_SIZE] = 0;
+        return Scores;
+    }();
+    // 剩余面少的顶点得分高，使孤立的面尽早输出
+    static const array<double, VALENCE_TABLE_SIZE> ValenceScores = []() {
+        array<double, VALENCE_TABLE_SIZE> Scores;
+        Scores[0] = 0;
+        for (size_t i = 1; i < VALENCE_TABLE_SIZE; i++) {
+            Scores[i] = VALENCE_BOOST_SCALE * pow(
+                static_cast<double>(i),
+                -VALENCE_BOOST_POWER
+            );
+        }
+        return Scores;
+    }();
+    if (Valence == 0) {
+        return -1;
+    }
+    double rValenceScore = Valence < VALENCE_TABLE_SIZE
+        ? ValenceScores[Valence]
+        : VALENCE_BOOST_SCALE * pow(
+            static_cast<double>(Valence),
+            -VALENCE_BOOST_POWER
+        );
+    return CacheScores[CachePosition] + rValenceScore;
+}
+
+/**********************************************************************
+【函数名称】 GetMissCount
+【函数功能】 以 FIFO 缓存模拟绘制，求缓存未命中的总数。
+【参数】
+    Faces: 每个面的三个顶点下标。
+    CacheSize: FIFO 缓存的大小。
+    UsedCount: 输出，被面使用的不同顶点的个数。
+【返回值】
+    缓存未命中的总数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t VertexCache::GetMissCount(
+    const vector<array<size_t, 3>>& Faces,
+    size_t CacheSize,
+    size_t& UsedCount
+) {
+    size_t ullVertexCount = 0;
+    for (auto& AFace: Faces) {
+        for (size_t ullVertex: AFace) {
+            ullVertexCount = max(ullVertexCount, ullVertex + 1);
+        }
+    }
+    // 记录每个顶点进入缓存时的未命中序号，0 表示从未进入
+    vector<size_t> Stamps(ullVertexCount, 0);
+    size_t ullMissCount = 0;
+    UsedCount = 0;
+    for (auto& AFace: Faces) {
+        for (size_t ullVertex: AFace) {
+            size_t ullStamp = Stamps[ullVertex];
+            if (ullStamp == 0) {
+                UsedCount++;
+            }
+            if (ullStamp == 0 || ullMissCount - ullStamp >= CacheSize) {
+                Stamps[ullVertex] = ++ullMissCount;
+            }
+        }
+    }
+    return ullMissCount;
+}
+
+}
+
+}
\ No newline at end of file
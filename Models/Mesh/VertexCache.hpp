@@ -0,0 +1,158 @@
+/*************************************************************************
+【文件名】 VertexCache.hpp
+【功能模块和目的】 VertexCache 类为 GPU 的顶点后变换缓存重排三角形与顶点。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef VERTEX_CACHE_HPP
+#define VERTEX_CACHE_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "IndexedMesh.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Mesh {
+
+/*************************************************************************
+【类名】 VertexCache
+【功能】 使用 Forsyth 的线性时间算法重排三角形：以 CACHE_SIZE 个顶点的
+    LRU 缓存模拟 GPU，顶点的得分由其在缓存中的位置与剩余的相邻面数决定，
+    每次输出与缓存中顶点相邻的面中得分最高者；缓存中没有候选面时，
+    按原顺序取下一个未输出的面。每输出一个面只更新缓存中顶点的相邻面，
+    总时间与面数成线性。顶点随后按首次被面使用的顺序重排，
+    使顶点数据的读取也是顺序的。
+【接口说明】
+    成员：
+        CACHE_SIZE: 模拟的 LRU 缓存大小。
+        FIFO_SIZE: 求 ACMR/ATVR 时模拟的 FIFO 缓存的默认大小。
+    构造函数：
+        私有默认构造函数。
+    操作：
+        GetFaceOrder: 求面的输出顺序。
+        Optimize: 重排网格的面与顶点。
+        GetAcmr: 求每个面平均的缓存未命中数。
+        GetAtvr: 求每个顶点平均的变换次数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class VertexCache final {
+    public:
+        // 成员
+
+        // 模拟的 LRU 缓存大小
+        static constexpr size_t CACHE_SIZE { 32 };
+        // 求 ACMR/ATVR 时模拟的 FIFO 缓存的默认大小
+        static constexpr size_t FIFO_SIZE { 16 };
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 GetFaceOrder
+        【函数功能】 使用 Forsyth 算法求面的输出顺序。
+        【参数】
+            Faces: 每个面的三个顶点下标。
+            VertexCount: 顶点的个数，所有下标都小于此值。
+        【返回值】
+            面的顺序，第 i 个元素为第 i 个输出的面的原下标。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static vector<size_t> GetFaceOrder(
+            const vector<array<size_t, 3>>& Faces,
+            size_t VertexCount
+        );
+        /**********************************************************************
+        【函数名称】 Optimize
+        【函数功能】 重排网格的面，再按首次被面使用的顺序重排顶点。
+            只被线段使用的顶点排在最后，线段的顺序不变。
+        【参数】
+            AMesh: 共享顶点的网格。
+        【返回值】
+            重排后的网格，与原网格表示同一模型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static IndexedMesh<3> Optimize(const IndexedMesh<3>& AMesh);
+        /**********************************************************************
+        【函数名称】 Optimize
+        【函数功能】 重排网格的面与顶点，并输出面的顺序，
+            供调用者同步与面对应的数据。
+        【参数】
+            AMesh: 共享顶点的网格。
+            FaceOrder: 输出，第 i 个元素为重排后第 i 个面的原下标。
+        【返回值】
+            重排后的网格，与原网格表示同一模型。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static IndexedMesh<3> Optimize(
+            const IndexedMesh<3>& AMesh,
+            vector<size_t>& FaceOrder
+        );
+        /**********************************************************************
+        【函数名称】 GetAcmr
+        【函数功能】 以 FIFO 缓存模拟绘制，求每个面平均的缓存未命中数。
+        【参数】
+            Faces: 每个面的三个顶点下标。
+            CacheSize: FIFO 缓存的大小，默认为 FIFO_SIZE。
+        【返回值】
+            ACMR，介于 0.5 左右的理想值与 3 之间；没有面时为 0。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static double GetAcmr(
+            const vector<array<size_t, 3>>& Faces,
+            size_t CacheSize = FIFO_SIZE
+        );
+        /**********************************************************************
+        【函数名称】 GetAtvr
+        【函数功能】 以 FIFO 缓存模拟绘制，求每个被使用的顶点平均的变换次数。
+        【参数】
+            Faces: 每个面的三个顶点下标。
+            CacheSize: FIFO 缓存的大小，默认为 FIFO_SIZE。
+        【返回值】
+            ATVR，理想值为 1；没有面时为 0。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static double GetAtvr(
+            const vector<array<size_t, 3>>& Faces,
+            size_t CacheSize = FIFO_SIZE
+        );
+
+    private:
+        // 静态类，隐藏构造函数。
+        VertexCache();
+
+        /**********************************************************************
+        【函数名称】 GetVertexScore
+        【函数功能】 求顶点的得分，得分使用查找表。
+        【参数】
+            CachePosition: 顶点在缓存中的位置，不在缓存中时为 CACHE_SIZE。
+            Valence: 顶点尚未输出的相邻面数。
+        【返回值】
+            顶点的得分，没有未输出的相邻面时为 -1。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static double GetVertexScore(size_t CachePosition, size_t Valence);
+        /**********************************************************************
+        【函数名称】 GetMissCount
+        【函数功能】 以 FIFO 缓存模拟绘制，求缓存未命中的总数。
+        【参数】
+            Faces: 每个面的三个顶点下标。
+            CacheSize: FIFO 缓存的大小。
+            UsedCount: 输出，被面使用的不同顶点的个数。
+        【返回值】
+            缓存未命中的总数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static size_t GetMissCount(
+            const vector<array<size_t, 3>>& Faces,
+            size_t CacheSize,
+            size_t& UsedCount
+        );
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*************************************************************************
+【文件名】 BinaryExporter.cpp
+【功能模块和目的】 为 BinaryExporter.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include "BinaryExporter.hpp"
+#include "BinaryFormat.hpp"
+#include "../ExportOptions.hpp"
+#include "../../Core/Model.hpp"
+#include "../../Mesh/IndexedMesh.hpp"
+#include "../../Mesh/LodChain.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Mesh;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/**********************************************************************
+【函数名称】 InnerExport
+【函数功能】 导出指定模型到输出流中。
+【参数】 
+    Stream: 输出流。
+    Model: 模型的引用。
+    Options: 导出选项。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void BinaryExporter::InnerExport(
+    ostream& Stream,
+    const Model<3>& Model,
+    const ExportOptions& Options
+) const {
+    LodChain Chain(
+        IndexedMesh<3>(Model),
+        Options.LodLevelCount,
+        Options.LodRatio
+    );
+    if (Options.bOptimizeVertexCache) {
+        Chain.OptimizeVertexCache();
+    }
+    BinaryFormat::Write(Stream, BinaryFormat::MAGIC);
+    BinaryFormat::Write(Stream, BinaryFormat::VERSION);
+    BinaryFormat::Write<uint64_t>(Stream, Chain.GetName().size());
+    Stream.write(Chain.GetName().data(), Chain.GetName().size());
+    BinaryFormat::Write<uint64_t>(Stream, Chain.GetLevelCount());
+
+    BinaryFormat::Write<uint64_t>(Stream, Chain.GetLines().size());
+    for (auto& Indices: Chain.GetLines()) {
+        BinaryFormat::Write<uint64_t>(Stream, Indices[0]);
+        BinaryFormat::Write<uint64_t>(Stream, Indices[1]);
+    }
+
+    // 每一层级只写入新增的顶点
+    size_t ullWritten = 0;
+    for (size_t i = 0; i < Chain.GetLevelCount(); i++) {
+        size_t ullVertexCount = Chain.GetVertexCount(i);
+        BinaryFormat::Write<uint64_t>(Stream, ullVertexCount - ullWritten);
+        for (; ullWritten < ullVertexCount; ullWritten++) {
+            auto& Vertex = Chain.GetVertex(ullWritten);
+            BinaryFormat::Write(Stream, Vertex[0]);
+            BinaryFormat::Write(Stream, Vertex[1]);
+            BinaryFormat::Write(Stream, Vertex[2]);
+        }
+        BinaryFormat::Write<uint64_t>(Stream, Chain.GetFaceCount(i));
+        for (auto& Indices: Chain.GetFaces(i)) {
+            BinaryFormat::Write<uint64_t>(Stream, Indices[0]);
+            BinaryFormat::Write<uint64_t>(Stream, Indices[1]);
+            BinaryFormat::Write<uint64_t>(Stream, Indices[2]);
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 IsBinary
+【函数功能】 判断是否以二进制方式打开文件。
+【参数】 无
+【返回值】
+    总是为真。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool BinaryExporter::IsBinary() const {
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 CanAppendDelta
+【函数功能】 判断是否可以在文件末尾追加 ModelDelta 记录。
+【参数】 无
+【返回值】
+    总是为真，BinaryImporter 导入时应用追加的记录。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool BinaryExporter::CanAppendDelta() const {
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 CanRoundTrip
+【函数功能】 判断以指定选项导出的文件再导入时能否还原模型。
+【参数】
+    Model: 要导出的模型。
+    Options: 导出选项。
+【返回值】
+    不优化顶点缓存时为真：最精细的层级保持面的原顺序，
+    坐标以 double 原样存储。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool BinaryExporter::CanRoundTrip(
+    const Model<3>& Model,
+    const ExportOptions& Options
+) const {
+    return !Options.bOptimizeVertexCache;
+}
+
+}
+
+}
+
+}
\ No newline at end of file
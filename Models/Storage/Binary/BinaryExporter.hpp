@@ -0,0 +1,99 @@
+/*************************************************************************
+【文件名】 BinaryExporter.hpp
+【功能模块和目的】 BinaryExporter 类定义了一个 .c3w 文件的导出器。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef BINARY_EXPORTER_HPP
+#define BINARY_EXPORTER_HPP
+
+#include <ostream>
+#include "../ExporterBase.hpp"
+#include "../ExportOptions.hpp"
+#include "../../Core/Model.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/*************************************************************************
+【类名】 BinaryExporter
+【功能】 定义一个 .c3w 文件的导出器。
+    按 ExportOptions 生成细节层级，由粗到细写入，读取时可先得到预览。
+【接口说明】 
+    继承于 C3w::Storage::ExporterBase<3>:
+        继承全部接口。
+        实现 InnerExport。
+        重写 IsBinary。
+        重写 CanAppendDelta。
+        重写 CanRoundTrip。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class BinaryExporter: public ExporterBase<3> {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 IsBinary
+        【函数功能】 判断是否以二进制方式打开文件。
+        【参数】 无
+        【返回值】
+            总是为真。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsBinary() const override;
+        /**********************************************************************
+        【函数名称】 CanAppendDelta
+        【函数功能】 判断是否可以在文件末尾追加 ModelDelta 记录。
+        【参数】 无
+        【返回值】
+            总是为真，BinaryImporter 导入时应用追加的记录。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool CanAppendDelta() const override;
+        /**********************************************************************
+        【函数名称】 CanRoundTrip
+        【函数功能】 判断以指定选项导出的文件再导入时能否还原模型。
+        【参数】
+            Model: 要导出的模型。
+            Options: 导出选项。
+        【返回值】
+            不优化顶点缓存时为真：最精细的层级保持面的原顺序，
+            坐标以 double 原样存储。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool CanRoundTrip(
+            const Model<3>& Model,
+            const ExportOptions& Options
+        ) const override;
+
+    protected:
+        /**********************************************************************
+        【函数名称】 InnerExport
+        【函数功能】 导出指定模型到输出流中。
+        【参数】 
+            Stream: 输出流。
+            Model: 模型的引用。
+            Options: 导出选项。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void InnerExport(
+            ostream& Stream, 
+            const Model<3>& Model,
+            const ExportOptions& Options
+        ) const override;
+};
+
+}
+
+}
+
+}
+
+#endif
\ No newline at end of file
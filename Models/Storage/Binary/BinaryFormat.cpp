@@ -0,0 +1,26 @@
+/*************************************************************************
+【文件名】 BinaryFormat.cpp
+【功能模块和目的】 为 BinaryFormat.hpp 提供非模板的实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstdint>
+#include "BinaryFormat.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+// 文件开头的标识
+constexpr uint32_t BinaryFormat::MAGIC;
+// 格式版本
+constexpr uint32_t BinaryFormat::VERSION;
+
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*************************************************************************
+【文件名】 BinaryFormat.hpp
+【功能模块和目的】 BinaryFormat 类定义了 .c3w 二进制文件的公共常量与读写函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef BINARY_FORMAT_HPP
+#define BINARY_FORMAT_HPP
+
+#include <cstdint>
+#include <iostream>
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/*************************************************************************
+【类名】 BinaryFormat
+【功能】 静态类，.c3w 文件的格式定义。
+    文件依次为：文件头（MAGIC, VERSION），名称，层级数，线段，
+    然后由粗到细存储每个细节层级新增的顶点与该层级的全部面。
+    整数与浮点数均以本机字节序存储。
+【接口说明】
+    成员：
+        MAGIC: 文件开头的标识。
+        VERSION: 格式版本。
+    构造函数：
+        私有默认构造函数。
+    操作：
+        Write: 写入一个定长的值。
+        Read: 读取一个定长的值。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class BinaryFormat final {
+    public:
+        // 成员
+
+        // 文件开头的标识
+        static constexpr uint32_t MAGIC { 0x00573343 };
+        // 格式版本
+        static constexpr uint32_t VERSION { 1 };
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Write
+        【函数功能】 以本机字节序写入一个定长的值。
+        【参数】
+            Stream: 输出流。
+            Value: 要写入的值。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename T>
+        static void Write(ostream& Stream, const T& Value);
+        /**********************************************************************
+        【函数名称】 Read
+        【函数功能】 以本机字节序读取一个定长的值。
+        【参数】
+            Stream: 输入流。
+        【返回值】
+            读取的值。
+            如果文件提前结束，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename T>
+        static T Read(istream& Stream);
+
+    private:
+        // 静态类，隐藏构造函数。
+        BinaryFormat();
+};
+
+}
+
+}
+
+}
+
+#include "BinaryFormat.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,59 @@
+/*************************************************************************
+【文件名】 BinaryFormat.tpp
+【功能模块和目的】 为 BinaryFormat.hpp 提供模板实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <iostream>
+#include <type_traits>
+#include "BinaryFormat.hpp"
+#include "../../Errors/FileFormatException.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/**********************************************************************
+【函数名称】 Write
+【函数功能】 以本机字节序写入一个定长的值。
+【参数】
+    Stream: 输出流。
+    Value: 要写入的值。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+void BinaryFormat::Write(ostream& Stream, const T& Value) {
+    static_assert(is_arithmetic<T>::value, "T must be arithmetic");
+    Stream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+}
+
+/**********************************************************************
+【函数名称】 Read
+【函数功能】 以本机字节序读取一个定长的值。
+【参数】
+    Stream: 输入流。
+【返回值】
+    读取的值。
+    如果文件提前结束，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T>
+T BinaryFormat::Read(istream& Stream) {
+    static_assert(is_arithmetic<T>::value, "T must be arithmetic");
+    T Value;
+    if (!Stream.read(reinterpret_cast<char*>(&Value), sizeof(T))) {
+        throw FileFormatException(0, "unexpected end of file");
+    }
+    return Value;
+}
+
+}
+
+}
+
+}
\ No newline at end of file
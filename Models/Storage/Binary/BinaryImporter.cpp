@@ -0,0 +1,389 @@
+/*************************************************************************
+【文件名】 BinaryImporter.cpp
+【功能模块和目的】 为 BinaryImporter.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BinaryFormat.hpp"
+#include "BinaryImporter.hpp"
+#include "../ImportVisitor.hpp"
+#include "../ModelDelta.hpp"
+#include "../../Core/Face.hpp"
+#include "../../Core/Line.hpp"
+#include "../../Core/Model.hpp"
+#include "../../Core/Point.hpp"
+#include "../../Errors/FileFormatException.hpp"
+#include "../../Errors/FileOpenException.hpp"
+#include "../../Errors/IndexOverflowException.hpp"
+#include "../../Mesh/IndexedMesh.hpp"
+#include "../../Mesh/LodChain.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Errors;
+using namespace C3w::Mesh;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/**********************************************************************
+【函数名称】 ImportLevels
+【函数功能】 由粗到细逐层导入细节层级，每读完一个层级回调一次。
+【参数】 
+    Path: 文件所在路径。
+    OnLevel: 形如 bool(const LodChain& Chain) 的函数，
+        Chain 包含已读入的层级，返回假时停止读取。
+【返回值】 无
+    如果文件无法打开，抛出 FileOpenException。
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void BinaryImporter::ImportLevels(
+    string Path,
+    function<bool(const LodChain&)> OnLevel
+) const {
+    ifstream Stream(Path, ios::in | ios::binary);
+    if (!Stream.is_open()) {
+        throw FileOpenException(Path);
+    }
+    ReadLevels(Stream, OnLevel);
+}
+
+/**********************************************************************
+【函数名称】 ImportLevels
+【函数功能】 从输入流的当前位置由粗到细逐层导入细节层级，
+    每读完一个层级回调一次。
+【参数】 
+    Stream: 输入流，不做换行符转换。
+    OnLevel: 形如 bool(const LodChain& Chain) 的函数，
+        Chain 包含已读入的层级，返回假时停止读取。
+【返回值】 无
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void BinaryImporter::ImportLevels(
+    istream& Stream,
+    function<bool(const LodChain&)> OnLevel
+) const {
+    ReadLevels(Stream, OnLevel);
+}
+
+/**********************************************************************
+【函数名称】 InnerImport
+【函数功能】 导入输入流中最精细的层级到模型中，
+    再依次应用层级之后追加的 ModelDelta 记录。
+【参数】 
+    Stream: 输入流。
+    Model: 模型的可变引用。
+【返回值】 无
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void BinaryImporter::InnerImport(istream& Stream, Model<3>& Model) const {
+    LodChain Chain = ReadLevels(
+        Stream, 
+        [](const LodChain&) { return true; }
+    );
+    Model = Chain.GetMesh(Chain.GetLevelCount() - 1).ToModel();
+    ModelDelta::ApplyAll(Stream, Model);
+}
+
+/**********************************************************************
+【函数名称】 InnerVisit
+【函数功能】 流式读取输入流，将所有顶点与最精细层级的线段、
+    面逐条交给访问者。只保留顶点表用于解析下标，
+    较粗层级的面读取后即丢弃。
+    层级之后追加了 ModelDelta 记录，或流不能定位而无法预先检查时，
+    先以 InnerImport 导入并应用记录，再将合并后的顶点与元素交给
+    访问者，此时不再包括未被元素使用的顶点。
+【参数】 
+    Stream: 输入流。
+    Visitor: 接收记录的访问者。
+【返回值】 无
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void BinaryImporter::InnerVisit(
+    istream& Stream,
+    ImportVisitor<3>& Visitor
+) const {
+    // 记录可能删除或修改任意元素，不能边读边交给访问者
+    if (HasDeltas(Stream)) {
+        Model<3> AModel;
+        InnerImport(Stream, AModel);
+        Visitor.VisitName(AModel.Name);
+        // 顶点引用网格中的数组，网格须在遍历期间存在
+        IndexedMesh<3> AMesh(AModel);
+        for (auto& Vertex: AMesh.GetVertices()) {
+            Visitor.VisitVertex(Vertex);
+        }
+        for (auto& ALine: AModel.Lines) {
+            Visitor.VisitLine(ALine);
+        }
+        for (auto& AFace: AModel.Faces) {
+            Visitor.VisitFace(AFace);
+        }
+        return;
+    }
+    string Name;
+    size_t ullLevelCount = 0;
+    vector<array<size_t, 2>> Lines;
+    ReadHeader(Stream, Name, ullLevelCount, Lines);
+    Visitor.VisitName(Name);
+    vector<Point<3>> Vertices;
+    auto GetVertex = [&Vertices](size_t Index) -> const Point<3>& {
+        if (Index >= Vertices.size()) {
+            throw FileFormatException(0, "index overflow");
+        }
+        return Vertices[Index];
+    };
+    for (size_t ullLevel = 0; ullLevel < ullLevelCount; ullLevel++) {
+        size_t ullVertexCount = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullVertexCount; i++) {
+            double rX = BinaryFormat::Read<double>(Stream);
+            double rY = BinaryFormat::Read<double>(Stream);
+            double rZ = BinaryFormat::Read<double>(Stream);
+            Vertices.push_back(Point<3>({ rX, rY, rZ }));
+            Visitor.VisitVertex(Vertices.back());
+        }
+        // 线段只使用最粗层级的顶点，读完最粗层级的顶点即可输出
+        if (ullLevel == 0) {
+            for (auto& Indices: Lines) {
+                Visitor.VisitLine(
+                    Line<3>(GetVertex(Indices[0]), GetVertex(Indices[1]))
+                );
+            }
+        }
+        bool bFinest = ullLevel + 1 == ullLevelCount;
+        size_t ullFaceCount = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullFaceCount; i++) {
+            array<size_t, 3> Indices;
+            for (auto& ullIndex: Indices) {
+                ullIndex = BinaryFormat::Read<uint64_t>(Stream);
+            }
+            if (bFinest) {
+                Visitor.VisitFace(
+                    Face<3>(
+                        GetVertex(Indices[0]),
+                        GetVertex(Indices[1]),
+                        GetVertex(Indices[2])
+                    )
+                );
+            }
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 IsBinary
+【函数功能】 判断是否以二进制方式打开文件。
+【参数】 无
+【返回值】
+    总是为真。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool BinaryImporter::IsBinary() const {
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 GetAppendedSize
+【函数功能】 获取层级之后追加的 ModelDelta 记录的字节数。
+【参数】 
+    Path: 文件所在路径。
+【返回值】
+    追加的记录的字节数。
+    如果文件无法打开，抛出 FileOpenException。
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t BinaryImporter::GetAppendedSize(string Path) const {
+    ifstream Stream(Path, ios::in | ios::binary);
+    if (!Stream.is_open()) {
+        throw FileOpenException(Path);
+    }
+    SkipLevels(Stream);
+    streamoff llEnd = Stream.tellg();
+    Stream.seekg(0, ios::end);
+    streamoff llSize = Stream.tellg();
+    // 损坏的个数可能使定位越过文件末尾
+    if (llEnd < 0 || llEnd > llSize) {
+        throw FileFormatException(0, "unexpected end of file");
+    }
+    return static_cast<size_t>(llSize - llEnd);
+}
+
+/**********************************************************************
+【函数名称】 ReadHeader
+【函数功能】 从流中读取层级之前的文件头。
+【参数】 
+    Stream: 输入流。
+    Name: 输出，模型的名称。
+    LevelCount: 输出，层级数，不为 0。
+    Lines: 输出，线段的顶点下标。
+【返回值】 无
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void BinaryImporter::ReadHeader(
+    istream& Stream,
+    string& Name,
+    size_t& LevelCount,
+    vector<array<size_t, 2>>& Lines
+) {
+    if (
+        BinaryFormat::Read<uint32_t>(Stream) != BinaryFormat::MAGIC
+        || BinaryFormat::Read<uint32_t>(Stream) != BinaryFormat::VERSION
+    ) {
+        throw FileFormatException(0, "not a c3w file");
+    }
+    // 逐个读取而不预先分配，避免损坏的长度导致过大的内存申请
+    Name.clear();
+    size_t ullNameLength = BinaryFormat::Read<uint64_t>(Stream);
+    for (size_t i = 0; i < ullNameLength; i++) {
+        Name.push_back(BinaryFormat::Read<char>(Stream));
+    }
+    LevelCount = BinaryFormat::Read<uint64_t>(Stream);
+    if (LevelCount == 0) {
+        throw FileFormatException(0, "no level of detail");
+    }
+    Lines.clear();
+    size_t ullLineCount = BinaryFormat::Read<uint64_t>(Stream);
+    for (size_t i = 0; i < ullLineCount; i++) {
+        size_t ullStart = BinaryFormat::Read<uint64_t>(Stream);
+        size_t ullEnd = BinaryFormat::Read<uint64_t>(Stream);
+        Lines.push_back({{ ullStart, ullEnd }});
+    }
+}
+
+/**********************************************************************
+【函数名称】 ReadLevels
+【函数功能】 从流中由粗到细读取细节层级。
+【参数】 
+    Stream: 输入流。
+    OnLevel: 每读完一个层级调用的函数，返回假时停止读取。
+【返回值】
+    已读入的细节层级。
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+LodChain BinaryImporter::ReadLevels(
+    istream& Stream,
+    function<bool(const LodChain&)> OnLevel
+) {
+    string Name;
+    size_t ullLevelCount = 0;
+    vector<array<size_t, 2>> Lines;
+    ReadHeader(Stream, Name, ullLevelCount, Lines);
+    // 读取一个层级新增的顶点与全部的面
+    auto ReadLevel = [&Stream](
+        vector<Point<3>>& Vertices,
+        vector<array<size_t, 3>>& Faces
+    ) {
+        size_t ullVertexCount = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullVertexCount; i++) {
+            double rX = BinaryFormat::Read<double>(Stream);
+            double rY = BinaryFormat::Read<double>(Stream);
+            double rZ = BinaryFormat::Read<double>(Stream);
+            Vertices.push_back(Point<3>({ rX, rY, rZ }));
+        }
+        size_t ullFaceCount = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullFaceCount; i++) {
+            array<size_t, 3> Indices;
+            for (auto& ullIndex: Indices) {
+                ullIndex = BinaryFormat::Read<uint64_t>(Stream);
+            }
+            Faces.push_back(Indices);
+        }
+    };
+    try {
+        vector<Point<3>> Vertices;
+        vector<array<size_t, 3>> Faces;
+        ReadLevel(Vertices, Faces);
+        LodChain Chain(move(Name), move(Lines), move(Vertices), move(Faces));
+        for (size_t i = 1; i < ullLevelCount && OnLevel(Chain); i++) {
+            Vertices.clear();
+            Faces.clear();
+            ReadLevel(Vertices, Faces);
+            Chain.AddLevel(move(Vertices), move(Faces));
+        }
+        if (Chain.GetLevelCount() == ullLevelCount) {
+            OnLevel(Chain);
+        }
+        return Chain;
+    }
+    catch (IndexOverflowException) {
+        throw FileFormatException(0, "index overflow");
+    }
+}
+
+/**********************************************************************
+【函数名称】 HasDeltas
+【函数功能】 判断层级之后是否追加了 ModelDelta 记录，
+    以 SkipLevels 跳过层级，完成后恢复流的位置。
+【参数】 
+    Stream: 输入流，位于文件头处。
+【返回值】
+    是否有追加的记录，流不能定位时为真。
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool BinaryImporter::HasDeltas(istream& Stream) {
+    istream::pos_type Start = Stream.tellg();
+    if (Start == istream::pos_type(-1)) {
+        return true;
+    }
+    SkipLevels(Stream);
+    bool bHasDeltas = Stream.peek() != istream::traits_type::eof();
+    Stream.clear();
+    Stream.seekg(Start);
+    return bHasDeltas;
+}
+
+/**********************************************************************
+【函数名称】 SkipLevels
+【函数功能】 跳过文件头与所有层级。只读取文件头与各层级的元素个数，
+    定长的数据直接定位跳过。
+【参数】 
+    Stream: 输入流，位于文件头处，须能定位。
+【返回值】 无
+    流停在层级之后，即第一条追加的记录处。
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void BinaryImporter::SkipLevels(istream& Stream) {
+    string Name;
+    size_t ullLevelCount = 0;
+    vector<array<size_t, 2>> Lines;
+    ReadHeader(Stream, Name, ullLevelCount, Lines);
+    // 损坏的个数使定位失败或越过文件末尾，之后的读取抛出异常
+    for (size_t ullLevel = 0; ullLevel < ullLevelCount; ullLevel++) {
+        size_t ullVertexCount = BinaryFormat::Read<uint64_t>(Stream);
+        Stream.seekg(
+            static_cast<istream::off_type>(ullVertexCount * 3 * sizeof(double)),
+            ios::cur
+        );
+        size_t ullFaceCount = BinaryFormat::Read<uint64_t>(Stream);
+        Stream.seekg(
+            static_cast<istream::off_type>(ullFaceCount * 3 * sizeof(uint64_t)),
+            ios::cur
+        );
+    }
+}
+
+}
+
+}
+
+}
\ No newline at end of file
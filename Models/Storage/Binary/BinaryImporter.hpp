@@ -0,0 +1,206 @@
+/*************************************************************************
+【文件名】 BinaryImporter.hpp
+【功能模块和目的】 BinaryImporter 类定义了一个 .c3w 文件的导入器。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef BINARY_IMPORTER_HPP
+#define BINARY_IMPORTER_HPP
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../ImporterBase.hpp"
+#include "../ImportVisitor.hpp"
+#include "../../Core/Model.hpp"
+#include "../../Mesh/LodChain.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/*************************************************************************
+【类名】 BinaryImporter
+【功能】 定义一个 .c3w 文件的导入器。
+    层级由粗到细存储，ImportLevels 每读完一个层级即回调一次，
+    调用者可以先显示最粗的预览，再随读取逐步细化。
+    增量保存的 ModelDelta 记录追加在层级之后，InnerImport 与 InnerVisit
+    应用这些记录；ImportLevels 读到的是最近一次完整保存的内容。
+【接口说明】 
+    继承于 C3w::Storage::ImporterBase<3>:
+        继承全部接口。
+        实现 InnerImport，导入最精细的层级并应用追加的记录。
+        实现 InnerVisit，流式读取最精细的层级，有追加的记录时
+            先导入再访问。
+        重写 IsBinary。
+        重写 GetAppendedSize。
+    操作：
+        ImportLevels: 从文件或输入流由粗到细逐层导入细节层级。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class BinaryImporter: public ImporterBase<3> {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 ImportLevels
+        【函数功能】 由粗到细逐层导入细节层级，每读完一个层级回调一次。
+        【参数】 
+            Path: 文件所在路径。
+            OnLevel: 形如 bool(const LodChain& Chain) 的函数，
+                Chain 包含已读入的层级，返回假时停止读取。
+        【返回值】 无
+            如果文件无法打开，抛出 FileOpenException。
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void ImportLevels(
+            string Path,
+            function<bool(const Mesh::LodChain&)> OnLevel
+        ) const;
+        /**********************************************************************
+        【函数名称】 ImportLevels
+        【函数功能】 从输入流的当前位置由粗到细逐层导入细节层级，
+            每读完一个层级回调一次。
+        【参数】 
+            Stream: 输入流，不做换行符转换。
+            OnLevel: 形如 bool(const LodChain& Chain) 的函数，
+                Chain 包含已读入的层级，返回假时停止读取。
+        【返回值】 无
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void ImportLevels(
+            istream& Stream,
+            function<bool(const Mesh::LodChain&)> OnLevel
+        ) const;
+        /**********************************************************************
+        【函数名称】 IsBinary
+        【函数功能】 判断是否以二进制方式打开文件。
+        【参数】 无
+        【返回值】
+            总是为真。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsBinary() const override;
+        /**********************************************************************
+        【函数名称】 GetAppendedSize
+        【函数功能】 获取层级之后追加的 ModelDelta 记录的字节数。
+        【参数】 
+            Path: 文件所在路径。
+        【返回值】
+            追加的记录的字节数。
+            如果文件无法打开，抛出 FileOpenException。
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetAppendedSize(string Path) const override;
+
+    protected:
+        /**********************************************************************
+        【函数名称】 InnerImport
+        【函数功能】 导入输入流中最精细的层级到模型中，
+            再依次应用层级之后追加的 ModelDelta 记录。
+        【参数】 
+            Stream: 输入流。
+            Model: 模型的可变引用。
+        【返回值】 无
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void InnerImport(istream& Stream, Model<3>& Model) const override;
+        /**********************************************************************
+        【函数名称】 InnerVisit
+        【函数功能】 流式读取输入流，将所有顶点与最精细层级的线段、
+            面逐条交给访问者。只保留顶点表用于解析下标，
+            较粗层级的面读取后即丢弃。
+            层级之后追加了 ModelDelta 记录，或流不能定位而无法预先检查时，
+            先以 InnerImport 导入并应用记录，再将合并后的顶点与元素交给
+            访问者，此时不再包括未被元素使用的顶点。
+        【参数】 
+            Stream: 输入流。
+            Visitor: 接收记录的访问者。
+        【返回值】 无
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void InnerVisit(
+            istream& Stream,
+            ImportVisitor<3>& Visitor
+        ) const override;
+
+    private:
+        /**********************************************************************
+        【函数名称】 ReadHeader
+        【函数功能】 从流中读取层级之前的文件头。
+        【参数】 
+            Stream: 输入流。
+            Name: 输出，模型的名称。
+            LevelCount: 输出，层级数，不为 0。
+            Lines: 输出，线段的顶点下标。
+        【返回值】 无
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void ReadHeader(
+            istream& Stream,
+            string& Name,
+            size_t& LevelCount,
+            vector<array<size_t, 2>>& Lines
+        );
+        /**********************************************************************
+        【函数名称】 ReadLevels
+        【函数功能】 从流中由粗到细读取细节层级。
+        【参数】 
+            Stream: 输入流。
+            OnLevel: 每读完一个层级调用的函数，返回假时停止读取。
+        【返回值】
+            已读入的细节层级。
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Mesh::LodChain ReadLevels(
+            istream& Stream,
+            function<bool(const Mesh::LodChain&)> OnLevel
+        );
+        /**********************************************************************
+        【函数名称】 HasDeltas
+        【函数功能】 判断层级之后是否追加了 ModelDelta 记录，
+            以 SkipLevels 跳过层级，完成后恢复流的位置。
+        【参数】 
+            Stream: 输入流，位于文件头处。
+        【返回值】
+            是否有追加的记录，流不能定位时为真。
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static bool HasDeltas(istream& Stream);
+        /**********************************************************************
+        【函数名称】 SkipLevels
+        【函数功能】 跳过文件头与所有层级。只读取文件头与各层级的元素个数，
+            定长的数据直接定位跳过。
+        【参数】 
+            Stream: 输入流，位于文件头处，须能定位。
+        【返回值】 无
+            流停在层级之后，即第一条追加的记录处。
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void SkipLevels(istream& Stream);
+};
+
+}
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,136 @@
+/*************************************************************************
+【文件名】 BoundingBoxVisitor.hpp
+【功能模块和目的】 BoundingBoxVisitor 类在流式导入时求模型的包围盒。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef BOUNDING_BOX_VISITOR_HPP
+#define BOUNDING_BOX_VISITOR_HPP
+
+#include <array>
+#include <cstddef>
+#include "ImportVisitor.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/Box.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 BoundingBoxVisitor
+【功能】 逐轴记录线段与面的点坐标的最小值与最大值，内存占用为常数。
+    与 Model::GetBoundingBox 一致，未被元素使用的顶点不计入。
+【接口说明】
+    继承于 C3w::Storage::ImportVisitor<N, T>:
+        重写 VisitLine、VisitFace。
+    构造与析构：
+        默认构造函数。
+        拷贝构造函数。
+    属性：
+        GetBoundingBox: 获取包围盒。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N, typename T = double>
+class BoundingBoxVisitor final: public ImportVisitor<N, T> {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化空的包围盒。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        BoundingBoxVisitor();
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一结果初始化 BoundingBoxVisitor 对象。
+        【参数】
+            Other: 另一个结果。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        BoundingBoxVisitor(const BoundingBoxVisitor<N, T>& Other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetBoundingBox
+        【函数功能】 获取能包含所有已接收元素的最小长方体。
+        【参数】 无
+        【返回值】
+            包围盒，未接收到元素时为 Box<N>()。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Tools::Box<N> GetBoundingBox() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 VisitLine
+        【函数功能】 将线段的点计入包围盒。
+        【参数】
+            ALine: 线段。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void VisitLine(const Line<N, T>& ALine) override;
+        /**********************************************************************
+        【函数名称】 VisitFace
+        【函数功能】 将面的点计入包围盒。
+        【参数】
+            AFace: 面。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void VisitFace(const Face<N, T>& AFace) override;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一结果赋值给自身。
+        【参数】
+            Other: 从之取值的结果。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        BoundingBoxVisitor<N, T>& operator=(
+            const BoundingBoxVisitor<N, T>& Other
+        ) = default;
+
+    private:
+        /**********************************************************************
+        【函数名称】 Include
+        【函数功能】 将一个点计入包围盒。
+        【参数】
+            APoint: 点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Include(const Point<N, T>& APoint);
+
+        // 是否已接收到元素
+        bool m_bEmpty { true };
+        // 每个坐标轴的最小值
+        array<double, N> m_MinCoords;
+        // 每个坐标轴的最大值
+        array<double, N> m_MaxCoords;
+};
+
+}
+
+}
+
+#include "BoundingBoxVisitor.tpp"
+
+#endif
\ No newline at end of file
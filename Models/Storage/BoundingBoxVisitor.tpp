@@ -0,0 +1,106 @@
+/*************************************************************************
+【文件名】 BoundingBoxVisitor.tpp
+【功能模块和目的】 为 BoundingBoxVisitor.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include "BoundingBoxVisitor.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/Box.hpp"
+#include "../Tools/Unroll.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化空的包围盒。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+BoundingBoxVisitor<N, T>::BoundingBoxVisitor() {
+    m_MinCoords.fill(numeric_limits<double>::max());
+    m_MaxCoords.fill(numeric_limits<double>::lowest());
+}
+
+/**********************************************************************
+【函数名称】 GetBoundingBox
+【函数功能】 获取能包含所有已接收元素的最小长方体。
+【参数】 无
+【返回值】
+    包围盒，未接收到元素时为 Box<N>()。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+Tools::Box<N> BoundingBoxVisitor<N, T>::GetBoundingBox() const {
+    if (m_bEmpty) {
+        return Tools::Box<N>();
+    }
+    return Tools::Box<N>(Point<N>(m_MinCoords), Point<N>(m_MaxCoords));
+}
+
+/**********************************************************************
+【函数名称】 VisitLine
+【函数功能】 将线段的点计入包围盒。
+【参数】
+    ALine: 线段。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void BoundingBoxVisitor<N, T>::VisitLine(const Line<N, T>& ALine) {
+    for (auto& APoint: ALine.Points) {
+        Include(APoint);
+    }
+}
+
+/**********************************************************************
+【函数名称】 VisitFace
+【函数功能】 将面的点计入包围盒。
+【参数】
+    AFace: 面。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void BoundingBoxVisitor<N, T>::VisitFace(const Face<N, T>& AFace) {
+    for (auto& APoint: AFace.Points) {
+        Include(APoint);
+    }
+}
+
+/**********************************************************************
+【函数名称】 Include
+【函数功能】 将一个点计入包围盒。
+【参数】
+    APoint: 点。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void BoundingBoxVisitor<N, T>::Include(const Point<N, T>& APoint) {
+    m_bEmpty = false;
+    Tools::Unroll<N>::For([this, &APoint](size_t i) {
+        double rValue = APoint.GetComponentUnchecked(i);
+        if (rValue < m_MinCoords[i]) {
+            m_MinCoords[i] = rValue;
+        }
+        if (rValue > m_MaxCoords[i]) {
+            m_MaxCoords[i] = rValue;
+        }
+    });
+}
+
+}
+
+}
\ No newline at end of file
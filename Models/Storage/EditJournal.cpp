@@ -0,0 +1,431 @@
+/*************************************************************************
+【文件名】 EditJournal.cpp
+【功能模块和目的】 为 EditJournal.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "EditJournal.hpp"
+#include "Binary/BinaryFormat.hpp"
+#include "../Errors/FileFormatException.hpp"
+#include "../Errors/FileOpenException.hpp"
+#include "../Tools/FileSync.hpp"
+using namespace std;
+using namespace C3w::Errors;
+using namespace C3w::Storage::Binary;
+using namespace C3w::Tools;
+
+namespace C3w {
+
+namespace Storage {
+
+// 文件开头的标识
+constexpr uint32_t EditJournal::MAGIC;
+// 日志文件相对于模型文件的后缀
+constexpr const char* EditJournal::SUFFIX;
+// 成组提交时收集记录的毫秒数
+constexpr size_t EditJournal::COMMIT_INTERVAL;
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 以初始记录原子地创建或替换日志文件，并启动提交线程。
+【参数】
+    Path: 日志文件的位置。
+    Records: 初始记录。
+【返回值】 无
+    如果文件无法写入，抛出 FileOpenException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+EditJournal::EditJournal(string Path, const vector<Record>& Records):
+    m_Path(Path), m_Records(Records) {
+    m_pFile = Open(Path, Records);
+    if (m_pFile == nullptr) {
+        throw FileOpenException(Path);
+    }
+    m_Thread = thread(&EditJournal::Run, this);
+}
+
+/**********************************************************************
+【函数名称】 析构函数
+【函数功能】 提交剩余的记录，并结束提交线程。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+EditJournal::~EditJournal() {
+    {
+        lock_guard<mutex> Lock(m_Mutex);
+        m_bStopping = true;
+        m_Condition.notify_all();
+    }
+    m_Thread.join();
+    if (m_pFile != nullptr) {
+        fclose(m_pFile);
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetPath
+【函数功能】 获取日志文件的位置。
+【参数】 无
+【返回值】
+    日志文件的位置。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+string EditJournal::GetPath() const {
+    lock_guard<mutex> Lock(m_Mutex);
+    return m_Path;
+}
+
+/**********************************************************************
+【函数名称】 GetRecordCount
+【函数功能】 获取日志中的记录数，包括尚未写入磁盘的记录。
+【参数】 无
+【返回值】
+    记录数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t EditJournal::GetRecordCount() const {
+    lock_guard<mutex> Lock(m_Mutex);
+    return m_Records.size();
+}
+
+/**********************************************************************
+【函数名称】 Append
+【函数功能】 编码并追加一条记录，由提交线程稍后写入磁盘。
+【参数】
+    ARecord: 要追加的记录。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void EditJournal::Append(const Record& ARecord) {
+    // 在锁外编码，持锁时间只有一次拷贝
+    string Data = Encode(ARecord);
+    lock_guard<mutex> Lock(m_Mutex);
+    m_Pending += Data;
+    m_Records.push_back(ARecord);
+    m_Condition.notify_all();
+}
+
+/**********************************************************************
+【函数名称】 Flush
+【函数功能】 立即提交并等待已追加的记录全部写入磁盘。
+【参数】 无
+【返回值】
+    自上次 Reset 以来的所有写入是否都成功。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool EditJournal::Flush() {
+    unique_lock<mutex> Lock(m_Mutex);
+    m_bFlushRequested = true;
+    m_Condition.notify_all();
+    m_Condition.wait(Lock, [this] {
+        return m_Pending.empty() && !m_bWriting;
+    });
+    m_bFlushRequested = false;
+    return !m_bFailed;
+}
+
+/**********************************************************************
+【函数名称】 Reset
+【函数功能】 提交剩余的记录，再以新的记录原子地替换日志文件。
+    位置改变时删除原来的日志文件。
+【参数】
+    Path: 新的日志文件的位置。
+    Records: 新的记录。
+【返回值】
+    是否成功，失败时日志保持不变。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool EditJournal::Reset(string Path, const vector<Record>& Records) {
+    Flush();
+    // 只有调用者的线程追加记录，此后提交线程保持空闲
+    lock_guard<mutex> Lock(m_Mutex);
+    // 部分平台上无法替换已打开的文件，因此先关闭
+    if (m_pFile != nullptr) {
+        fclose(m_pFile);
+    }
+    FILE* pFile = Open(Path, Records);
+    if (pFile == nullptr) {
+        // 替换是原子的，失败时原文件仍然完整
+        m_pFile = fopen(m_Path.c_str(), "ab");
+        if (m_pFile == nullptr) {
+            m_bFailed = true;
+        }
+        return false;
+    }
+    if (Path != m_Path) {
+        remove(m_Path.c_str());
+    }
+    m_pFile = pFile;
+    m_Path = Path;
+    m_Records = Records;
+    m_bFailed = false;
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Reset
+【函数功能】 提交剩余的记录，再只保留从第 First 条开始的记录。
+【参数】
+    Path: 新的日志文件的位置。
+    First: 保留的第一条记录的下标。
+【返回值】
+    是否成功，失败时日志保持不变。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool EditJournal::Reset(string Path, size_t First) {
+    vector<Record> Records;
+    {
+        lock_guard<mutex> Lock(m_Mutex);
+        First = min(First, m_Records.size());
+        Records.assign(m_Records.begin() + First, m_Records.end());
+    }
+    return Reset(Path, Records);
+}
+
+/**********************************************************************
+【函数名称】 Read
+【函数功能】 读取日志文件中完整且校验正确的记录，
+    遇到第一条不完整或校验失败的记录即停止。
+【参数】
+    Path: 日志文件的位置。
+【返回值】
+    读取的记录，文件不存在时为空。
+    如果文件不是日志文件或记录内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+vector<EditJournal::Record> EditJournal::Read(string Path) {
+    vector<Record> Records;
+    ifstream Stream(Path, ios::in | ios::binary);
+    if (!Stream.is_open()) {
+        return Records;
+    }
+    Stream.seekg(0, ios::end);
+    streamoff llRemaining = Stream.tellg();
+    Stream.seekg(0, ios::beg);
+    if (BinaryFormat::Read<uint32_t>(Stream) != MAGIC) {
+        throw FileFormatException(0, "not a journal file");
+    }
+    llRemaining -= sizeof(uint32_t);
+    while (llRemaining >= static_cast<streamoff>(2 * sizeof(uint32_t))) {
+        uint32_t ulSize = BinaryFormat::Read<uint32_t>(Stream);
+        uint32_t ulChecksum = BinaryFormat::Read<uint32_t>(Stream);
+        llRemaining -= 2 * sizeof(uint32_t);
+        // 崩溃时写了一半的记录，之后的内容都不可信
+        if (ulSize > llRemaining) {
+            break;
+        }
+        string Payload(ulSize, '\0');
+        Stream.read(&Payload[0], ulSize);
+        llRemaining -= ulSize;
+        if (GetChecksum(Payload) != ulChecksum) {
+            break;
+        }
+        Records.push_back(Decode(Payload));
+    }
+    return Records;
+}
+
+/**********************************************************************
+【函数名称】 Run
+【函数功能】 提交线程的主循环。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void EditJournal::Run() {
+    unique_lock<mutex> Lock(m_Mutex);
+    while (true) {
+        m_Condition.wait(Lock, [this] {
+            return !m_Pending.empty() || m_bStopping;
+        });
+        if (m_Pending.empty()) {
+            break;
+        }
+        // 等待一个提交间隔，让之后的记录进入同一批，共用一次写入磁盘
+        m_Condition.wait_for(
+            Lock,
+            chrono::milliseconds(COMMIT_INTERVAL),
+            [this] { return m_bFlushRequested || m_bStopping; }
+        );
+        string Batch;
+        swap(Batch, m_Pending);
+        m_bWriting = true;
+        FILE* pFile = m_pFile;
+        // 写入磁盘时不持锁，Append 可以继续放入下一批
+        Lock.unlock();
+        // Reset 失败且无法重新打开原文件时，之后的记录都无法写入
+        bool bWritten =
+            pFile != nullptr &&
+            fwrite(Batch.data(), 1, Batch.size(), pFile) == Batch.size() &&
+            FileSync::Sync(pFile);
+        Lock.lock();
+        m_bWriting = false;
+        if (!bWritten) {
+            m_bFailed = true;
+        }
+        m_Condition.notify_all();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Open
+【函数功能】 以记录原子地替换日志文件，并以追加方式打开。
+【参数】
+    Path: 日志文件的位置。
+    Records: 记录。
+【返回值】
+    打开的文件，失败时为空。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+FILE* EditJournal::Open(string Path, const vector<Record>& Records) {
+    ostringstream Stream;
+    BinaryFormat::Write(Stream, MAGIC);
+    for (auto& ARecord: Records) {
+        string Data = Encode(ARecord);
+        Stream.write(Data.data(), Data.size());
+    }
+    if (!FileSync::Replace(Path, Stream.str())) {
+        return nullptr;
+    }
+    return fopen(Path.c_str(), "ab");
+}
+
+/**********************************************************************
+【函数名称】 Encode
+【函数功能】 将记录编码为带长度与校验和的字节串。
+【参数】
+    ARecord: 记录。
+【返回值】
+    编码后的字节串。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+string EditJournal::Encode(const Record& ARecord) {
+    ostringstream Payload;
+    BinaryFormat::Write(Payload, static_cast<uint8_t>(ARecord.Op));
+    switch (ARecord.Op) {
+        case Operation::SET_NAME : {
+            BinaryFormat::Write<uint64_t>(Payload, ARecord.Name.size());
+            Payload.write(ARecord.Name.data(), ARecord.Name.size());
+            break;
+        }
+        case Operation::MODIFY_LINE :
+        case Operation::MODIFY_FACE : {
+            BinaryFormat::Write<uint64_t>(Payload, ARecord.Index);
+            BinaryFormat::Write<uint64_t>(Payload, ARecord.PointIndex);
+            break;
+        }
+        case Operation::REMOVE_LINE :
+        case Operation::REMOVE_FACE :
+        case Operation::SIMPLIFY : {
+            BinaryFormat::Write<uint64_t>(Payload, ARecord.Index);
+            break;
+        }
+        default : {
+            break;
+        }
+    }
+    // 坐标的个数由操作决定，不单独存储
+    for (double rCoordinate: ARecord.Coordinates) {
+        BinaryFormat::Write(Payload, rCoordinate);
+    }
+    string Data = Payload.str();
+    ostringstream Result;
+    BinaryFormat::Write<uint32_t>(Result, Data.size());
+    BinaryFormat::Write(Result, GetChecksum(Data));
+    Result.write(Data.data(), Data.size());
+    return Result.str();
+}
+
+/**********************************************************************
+【函数名称】 Decode
+【函数功能】 解码一条记录的载荷。
+【参数】
+    Payload: 载荷。
+【返回值】
+    解码得到的记录。
+    如果载荷无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+EditJournal::Record EditJournal::Decode(const string& Payload) {
+    istringstream Stream(Payload);
+    Record ARecord { Operation::REORDER, 0, 0, "", {} };
+    uint8_t Op = BinaryFormat::Read<uint8_t>(Stream);
+    if (Op > static_cast<uint8_t>(Operation::REORDER)) {
+        throw FileFormatException(0, "unknown journal operation");
+    }
+    ARecord.Op = static_cast<Operation>(Op);
+    size_t ullCoordinateCount = 0;
+    switch (ARecord.Op) {
+        case Operation::SET_NAME : {
+            size_t ullLength = BinaryFormat::Read<uint64_t>(Stream);
+            for (size_t i = 0; i < ullLength; i++) {
+                ARecord.Name.push_back(BinaryFormat::Read<char>(Stream));
+            }
+            break;
+        }
+        case Operation::ADD_LINE : {
+            ullCoordinateCount = 6;
+            break;
+        }
+        case Operation::ADD_FACE : {
+            ullCoordinateCount = 9;
+            break;
+        }
+        case Operation::MODIFY_LINE :
+        case Operation::MODIFY_FACE : {
+            ARecord.Index = BinaryFormat::Read<uint64_t>(Stream);
+            ARecord.PointIndex = BinaryFormat::Read<uint64_t>(Stream);
+            ullCoordinateCount = 3;
+            break;
+        }
+        case Operation::REMOVE_LINE :
+        case Operation::REMOVE_FACE :
+        case Operation::SIMPLIFY : {
+            ARecord.Index = BinaryFormat::Read<uint64_t>(Stream);
+            break;
+        }
+        default : {
+            break;
+        }
+    }
+    for (size_t i = 0; i < ullCoordinateCount; i++) {
+        ARecord.Coordinates.push_back(BinaryFormat::Read<double>(Stream));
+    }
+    return ARecord;
+}
+
+/**********************************************************************
+【函数名称】 GetChecksum
+【函数功能】 求 32 位 FNV-1a 校验和。
+【参数】
+    Data: 数据。
+【返回值】
+    校验和。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+uint32_t EditJournal::GetChecksum(const string& Data) {
+    uint32_t ulHash = 2166136261u;
+    for (char Byte: Data) {
+        ulHash ^= static_cast<uint8_t>(Byte);
+        ulHash *= 16777619u;
+    }
+    return ulHash;
+}
+
+}
+
+}
\ No newline at end of file
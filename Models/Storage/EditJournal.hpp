@@ -0,0 +1,308 @@
+/*************************************************************************
+【文件名】 EditJournal.hpp
+【功能模块和目的】 EditJournal 类定义了记录每次修改的预写日志。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef EDIT_JOURNAL_HPP
+#define EDIT_JOURNAL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 EditJournal
+【功能】 将对模型的每次修改追加到日志文件中，日志相对于模型文件
+    （包括增量保存的记录）存储，加载模型文件后依次重放即可恢复修改。
+    Append 只编码记录并放入内存中的缓冲区，由后台线程成组提交：
+    等待 COMMIT_INTERVAL 毫秒收集同一批的记录，一次写入并等待写入磁盘，
+    因此每次修改的代价为微秒级，崩溃时至多丢失最后一批记录。
+    文件以 MAGIC 开头，之后每条记录为载荷长度、载荷的 FNV-1a 校验和
+    与载荷；读取时遇到不完整或校验失败的记录即停止，
+    崩溃时写了一半的记录因此被丢弃。
+【接口说明】
+    内嵌类型：
+        Operation: 记录的修改操作。
+        Record: 一条记录。
+    成员：
+        MAGIC: 文件开头的标识。
+        SUFFIX: 日志文件相对于模型文件的后缀。
+        COMMIT_INTERVAL: 成组提交时收集记录的毫秒数。
+    构造与析构：
+        接受文件位置与初始记录的构造函数。
+        删除拷贝构造函数。
+        析构函数，提交剩余的记录。
+    属性：
+        GetPath: 获取日志文件的位置。
+        GetRecordCount: 获取日志中的记录数。
+    操作：
+        Append: 追加一条记录，不等待写入磁盘。
+        Flush: 等待已追加的记录全部写入磁盘。
+        Reset: 以新的记录原子地替换日志文件。
+        Read: 读取日志文件中完整的记录。
+    操作符：
+        删除赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class EditJournal final {
+    public:
+        // 内嵌类型
+
+        /**********************************************************************
+        【类名】 Operation
+        【功能】 记录的修改操作，与 ControllerBase 的修改函数一一对应。
+        【接口说明】 枚举，以一个字节存储。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        enum class Operation: uint8_t {
+            // 设置名称
+            SET_NAME,
+            // 添加线段
+            ADD_LINE,
+            // 修改线段的一个点
+            MODIFY_LINE,
+            // 删除线段
+            REMOVE_LINE,
+            // 添加面
+            ADD_FACE,
+            // 修改面的一个点
+            MODIFY_FACE,
+            // 删除面
+            REMOVE_FACE,
+            // 简化模型
+            SIMPLIFY,
+            // 重排模型
+            REORDER
+        };
+
+        /**********************************************************************
+        【类名】 Record
+        【功能】 日志中的一条记录。
+        【接口说明】 操作，元素下标（简化时为目标面数），点在元素中的下标，
+            名称，坐标；操作不使用的成员为空或 0。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct Record {
+            // 操作
+            Operation Op;
+            // 元素的下标，简化时为目标面数
+            size_t Index;
+            // 点在元素中的下标
+            size_t PointIndex;
+            // 名称
+            string Name;
+            // 坐标，添加时为所有点的坐标，修改时为一个点的坐标
+            vector<double> Coordinates;
+        };
+
+        // 成员
+
+        // 文件开头的标识
+        static constexpr uint32_t MAGIC { 0x4A573343 };
+        // 日志文件相对于模型文件的后缀
+        static constexpr const char* SUFFIX { ".wal" };
+        // 成组提交时收集记录的毫秒数
+        static constexpr size_t COMMIT_INTERVAL { 5 };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以初始记录原子地创建或替换日志文件，并启动提交线程。
+        【参数】
+            Path: 日志文件的位置。
+            Records: 初始记录，默认为空。
+        【返回值】 无
+            如果文件无法写入，抛出 FileOpenException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit EditJournal(
+            string Path,
+            const vector<Record>& Records = vector<Record>()
+        );
+        // 删除拷贝构造函数
+        EditJournal(const EditJournal& Other) = delete;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetPath
+        【函数功能】 获取日志文件的位置。
+        【参数】 无
+        【返回值】
+            日志文件的位置。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        string GetPath() const;
+        /**********************************************************************
+        【函数名称】 GetRecordCount
+        【函数功能】 获取日志中的记录数，包括尚未写入磁盘的记录。
+        【参数】 无
+        【返回值】
+            记录数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetRecordCount() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Append
+        【函数功能】 编码并追加一条记录，由提交线程稍后写入磁盘。
+        【参数】
+            ARecord: 要追加的记录。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Append(const Record& ARecord);
+        /**********************************************************************
+        【函数名称】 Flush
+        【函数功能】 立即提交并等待已追加的记录全部写入磁盘。
+        【参数】 无
+        【返回值】
+            自上次 Reset 以来的所有写入是否都成功。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool Flush();
+        /**********************************************************************
+        【函数名称】 Reset
+        【函数功能】 提交剩余的记录，再以新的记录原子地替换日志文件。
+            位置改变时删除原来的日志文件。
+        【参数】
+            Path: 新的日志文件的位置。
+            Records: 新的记录。
+        【返回值】
+            是否成功，失败时日志保持不变。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool Reset(string Path, const vector<Record>& Records);
+        /**********************************************************************
+        【函数名称】 Reset
+        【函数功能】 提交剩余的记录，再只保留从第 First 条开始的记录。
+        【参数】
+            Path: 新的日志文件的位置。
+            First: 保留的第一条记录的下标。
+        【返回值】
+            是否成功，失败时日志保持不变。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool Reset(string Path, size_t First);
+        /**********************************************************************
+        【函数名称】 Read
+        【函数功能】 读取日志文件中完整且校验正确的记录，
+            遇到第一条不完整或校验失败的记录即停止。
+        【参数】
+            Path: 日志文件的位置。
+        【返回值】
+            读取的记录，文件不存在时为空。
+            如果文件不是日志文件或记录内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static vector<Record> Read(string Path);
+
+        // 操作符
+
+        // 删除赋值运算符
+        EditJournal& operator=(const EditJournal& Other) = delete;
+
+        /**********************************************************************
+        【函数名称】 析构函数
+        【函数功能】 提交剩余的记录，并结束提交线程。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        ~EditJournal();
+
+    private:
+        // 日志文件的位置
+        string m_Path;
+        // 以追加方式打开的日志文件
+        FILE* m_pFile { nullptr };
+        // 自上次 Reset 以来的所有记录
+        vector<Record> m_Records;
+        // 已编码但尚未提交的数据
+        string m_Pending;
+        // 是否已请求立即提交
+        bool m_bFlushRequested { false };
+        // 是否正在写入一批数据
+        bool m_bWriting { false };
+        // 是否已请求结束提交线程
+        bool m_bStopping { false };
+        // 是否有写入失败
+        bool m_bFailed { false };
+        // 保护以上成员
+        mutable mutex m_Mutex;
+        // 通知提交线程与等待提交的线程
+        condition_variable m_Condition;
+        // 提交线程
+        thread m_Thread;
+
+        /**********************************************************************
+        【函数名称】 Run
+        【函数功能】 提交线程的主循环。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Run();
+        /**********************************************************************
+        【函数名称】 Open
+        【函数功能】 以记录原子地替换日志文件，并以追加方式打开。
+        【参数】
+            Path: 日志文件的位置。
+            Records: 记录。
+        【返回值】
+            打开的文件，失败时为空。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static FILE* Open(string Path, const vector<Record>& Records);
+        /**********************************************************************
+        【函数名称】 Encode
+        【函数功能】 将记录编码为带长度与校验和的字节串。
+        【参数】
+            ARecord: 记录。
+        【返回值】
+            编码后的字节串。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static string Encode(const Record& ARecord);
+        /**********************************************************************
+        【函数名称】 Decode
+        【函数功能】 解码一条记录的载荷。
+        【参数】
+            Payload: 载荷。
+        【返回值】
+            解码得到的记录。
+            如果载荷无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Record Decode(const string& Payload);
+        /**********************************************************************
+        【函数名称】 GetChecksum
+        【函数功能】 求 32 位 FNV-1a 校验和。
+        【参数】
+            Data: 数据。
+        【返回值】
+            校验和。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static uint32_t GetChecksum(const string& Data);
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
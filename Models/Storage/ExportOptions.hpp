@@ -0,0 +1,40 @@
+/*************************************************************************
+【文件名】 ExportOptions.hpp
+【功能模块和目的】 ExportOptions 结构体定义了导出模型时的选项。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef EXPORT_OPTIONS_HPP
+#define EXPORT_OPTIONS_HPP
+
+#include <cstddef>
+#include "../Mesh/LodChain.hpp"
+#include "../Mesh/Normals.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ExportOptions
+【功能】 导出模型时的选项，不支持某项选项的导出器忽略之。
+【接口说明】 简单数据类型，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+struct ExportOptions {
+    // 保存的细节层级数，为 1 时只保存原模型
+    size_t LodLevelCount { 1 };
+    // 相邻细节层级面数之比
+    double LodRatio { Mesh::LodChain::DEFAULT_RATIO };
+    // 已计算的法向，不拥有其所有权，为空时不导出法向
+    const Mesh::Normals* pNormals { nullptr };
+    // 是否为 GPU 顶点缓存重排面与顶点，见 Mesh::VertexCache
+    bool bOptimizeVertexCache { false };
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
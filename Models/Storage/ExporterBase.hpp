@@ -9,8 +9,10 @@
 
 #include <cstddef>
 #include <fstream>
+#include <ostream>
 #include <string>
 #include "../Core/Model.hpp"
+#include "ExportOptions.hpp"
 using namespace std;
 using namespace C3w;
 
@@ -20,16 +22,19 @@ namespace Storage {
 
 /*************************************************************************
 【类名】 ExporterBase
-【功能】 定义一个抽象的导出器。
+【功能】 定义一个抽象的导出器，导出维数为 N、点的分量类型为 T 的模型。
 【接口说明】
     构造与析构：
         虚析构函数。
     操作：
-        Export: 使用文件名导出一个模型。
-        InnerExport (protected): 使用文件流导出模型，纯虚函数。
+        Export: 使用文件名或输出流导出一个模型。
+        InnerExport (protected): 使用输出流导出模型，纯虚函数。
+        IsBinary: 是否应以二进制方式打开文件，默认为否。
+        CanAppendDelta: 是否可以在文件末尾追加增量记录，默认为否。
+        CanRoundTrip: 导出的文件再导入时能否还原模型，默认为否。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
-template <size_t N>
+template <size_t N, typename T = double>
 class ExporterBase {
     public:
         // 操作
@@ -40,10 +45,66 @@ class ExporterBase {
         【参数】 
             Path: 文件所在路径。
             Model: 模型的可变引用。
+            Options: 导出选项，默认为 ExportOptions()。
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void Export(string Path, const Model<N>& Model) const;
+        void Export(
+            string Path,
+            const Model<N, T>& Model,
+            const ExportOptions& Options = ExportOptions()
+        ) const;
+        /**********************************************************************
+        【函数名称】 Export
+        【函数功能】 导出指定模型到输出流的当前位置。二进制格式要求流
+            不做换行符转换。
+        【参数】 
+            Stream: 输出流。
+            Model: 模型的常引用。
+            Options: 导出选项，默认为 ExportOptions()。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Export(
+            ostream& Stream,
+            const Model<N, T>& Model,
+            const ExportOptions& Options = ExportOptions()
+        ) const;
+        /**********************************************************************
+        【函数名称】 IsBinary
+        【函数功能】 判断是否应以二进制方式打开文件。
+        【参数】 无
+        【返回值】
+            是否以二进制方式打开文件，默认为否。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual bool IsBinary() const;
+        /**********************************************************************
+        【函数名称】 CanAppendDelta
+        【函数功能】 判断是否可以在导出的文件末尾追加 ModelDelta 记录，
+            即对应的导入器会在读取时应用这些记录。
+        【参数】 无
+        【返回值】
+            是否可以追加记录，默认为否。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual bool CanAppendDelta() const;
+        /**********************************************************************
+        【函数名称】 CanRoundTrip
+        【函数功能】 判断以指定选项导出的文件再导入时，是否得到顺序相同的
+            全部线段与面。增量保存的记录与预写日志以下标引用基准中的元素，
+            只有能还原模型的文件才能作为增量保存的基准。
+        【参数】
+            Model: 要导出的模型。
+            Options: 导出选项。
+        【返回值】
+            能否还原模型，默认为否。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual bool CanRoundTrip(
+            const Model<N, T>& Model,
+            const ExportOptions& Options
+        ) const;
 
         // 虚析构函数
         virtual ~ExporterBase() = default;
@@ -51,16 +112,18 @@ class ExporterBase {
     protected:
         /**********************************************************************
         【函数名称】 InnerExport
-        【函数功能】 导出指定模型到文件流中。
+        【函数功能】 导出指定模型到输出流中。
         【参数】 
-            Stream: 已经打开的文件流。
+            Stream: 输出流。
             Model: 模型的常引用。
+            Options: 导出选项。
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         virtual void InnerExport(
-            ofstream& Stream,
-            const Model<N>& Model
+            ostream& Stream,
+            const Model<N, T>& Model,
+            const ExportOptions& Options
         ) const = 0;
 };
 
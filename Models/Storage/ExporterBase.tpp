@@ -6,9 +6,11 @@
 
 #include <cstddef>
 #include <fstream>
+#include <ostream>
 #include <string>
 #include "../Core/Model.hpp"
 #include "../Errors/FileOpenException.hpp"
+#include "ExportOptions.hpp"
 #include "ExporterBase.hpp"
 using namespace std;
 using namespace C3w;
@@ -24,17 +26,26 @@ namespace Storage {
 【参数】 
     Path: 文件所在路径。
     Model: 模型的可变引用。
+    Options: 导出选项，默认为 ExportOptions()。
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-void ExporterBase<N>::Export(string Path, const Model<N>& Model) const {
-    ofstream Stream(Path, ios::trunc);
+template <size_t N, typename T>
+void ExporterBase<N, T>::Export(
+    string Path,
+    const Model<N, T>& Model,
+    const ExportOptions& Options
+) const {
+    ios::openmode Mode = ios::out | ios::trunc;
+    if (IsBinary()) {
+        Mode |= ios::binary;
+    }
+    ofstream Stream(Path, Mode);
     if (!Stream.is_open()) {
         throw FileOpenException(Path);
     }
     try {
-        InnerExport(Stream, Model);
+        Export(Stream, Model, Options);
     }
     catch (...) {
         Stream.close();
@@ -42,6 +53,73 @@ void ExporterBase<N>::Export(string Path, const Model<N>& Model) const {
     }
 }
 
+/**********************************************************************
+【函数名称】 Export
+【函数功能】 导出指定模型到输出流的当前位置。二进制格式要求流
+    不做换行符转换。
+【参数】 
+    Stream: 输出流。
+    Model: 模型的常引用。
+    Options: 导出选项，默认为 ExportOptions()。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ExporterBase<N, T>::Export(
+    ostream& Stream,
+    const Model<N, T>& Model,
+    const ExportOptions& Options
+) const {
+    InnerExport(Stream, Model, Options);
+}
+
+/**********************************************************************
+【函数名称】 IsBinary
+【函数功能】 判断是否以二进制方式打开文件。
+【参数】 无
+【返回值】
+    是否以二进制方式打开文件，默认为否。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+bool ExporterBase<N, T>::IsBinary() const {
+    return false;
+}
+
+/**********************************************************************
+【函数名称】 CanAppendDelta
+【函数功能】 判断是否可以在导出的文件末尾追加 ModelDelta 记录，
+    即对应的导入器会在读取时应用这些记录。
+【参数】 无
+【返回值】
+    是否可以追加记录，默认为否。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+bool ExporterBase<N, T>::CanAppendDelta() const {
+    return false;
+}
+
+/**********************************************************************
+【函数名称】 CanRoundTrip
+【函数功能】 判断以指定选项导出的文件再导入时，是否得到顺序相同的
+    全部线段与面。增量保存的记录与预写日志以下标引用基准中的元素，
+    只有能还原模型的文件才能作为增量保存的基准。
+【参数】
+    Model: 要导出的模型。
+    Options: 导出选项。
+【返回值】
+    能否还原模型，默认为否。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+bool ExporterBase<N, T>::CanRoundTrip(
+    const Model<N, T>& Model,
+    const ExportOptions& Options
+) const {
+    return false;
+}
+
 }
 
 }
\ No newline at end of file
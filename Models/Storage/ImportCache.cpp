@@ -0,0 +1,329 @@
+/*************************************************************************
+【文件名】 ImportCache.cpp
+【功能模块和目的】 为 ImportCache.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <istream>
+#include <sstream>
+#include <string>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "ImportCache.hpp"
+#include "ExportOptions.hpp"
+#include "MemoryBuffer.hpp"
+#include "Binary/BinaryExporter.hpp"
+#include "Binary/BinaryFormat.hpp"
+#include "Binary/BinaryImporter.hpp"
+#include "../Core/Model.hpp"
+#include "../Errors/FileFormatException.hpp"
+#include "../Errors/FileOpenException.hpp"
+#include "../Tools/FileSync.hpp"
+#include "../Tools/MappedFile.hpp"
+using namespace std;
+using namespace C3w::Errors;
+using namespace C3w::Storage::Binary;
+using namespace C3w::Tools;
+
+namespace C3w {
+
+namespace Storage {
+
+// 快照开头的标识
+constexpr uint32_t ImportCache::MAGIC;
+// 快照文件的后缀
+constexpr const char* ImportCache::SUFFIX;
+// 解析前的名称，解析后不变表示文件未指定名称
+constexpr const char* ImportCache::UNSET_NAME;
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用缓存目录初始化 ImportCache 对象。
+【参数】
+    Directory: 存放快照的目录，必须已经存在。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ImportCache::ImportCache(string Directory): m_Directory(Directory) {}
+
+/**********************************************************************
+【函数名称】 GetDirectory
+【函数功能】 获取缓存目录。
+【参数】 无
+【返回值】
+    缓存目录。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+string ImportCache::GetDirectory() const {
+    return m_Directory;
+}
+
+/**********************************************************************
+【函数名称】 Import
+【函数功能】 源文件有未过期的快照时映射快照读取模型；否则调用 Parse
+    解析源文件，解析完整且期间源文件未被修改时写入快照。
+    文件未指定名称时，与不使用缓存时一样保留模型原有的名称。
+【参数】
+    Path: 源文件的位置。
+    AModel: 模型的可变引用。
+    Parse: 形如 bool(Model<3>& Parsed) 的函数，将源文件解析到
+        Parsed 中，返回结果是否完整（例如未被取消）。
+【返回值】
+    是否命中缓存。
+    Parse 抛出的异常原样传出。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ImportCache::Import(
+    string Path,
+    Model<3>& AModel,
+    function<bool(Model<3>&)> Parse
+) const {
+    SourceInfo Info { 0, 0, 0 };
+    // 源文件无法读取时交给 Parse 报告错误
+    bool bIdentified = Identify(Path, Info);
+    if (bIdentified && TryLoad(Path, Info, AModel)) {
+        return true;
+    }
+    string Name = AModel.Name;
+    AModel.Name = UNSET_NAME;
+    bool bComplete = Parse(AModel);
+    bool bHasName = AModel.Name != UNSET_NAME;
+    if (!bHasName) {
+        AModel.Name = Name;
+    }
+    if (bComplete && bIdentified) {
+        Store(Path, Info, AModel, bHasName);
+    }
+    return false;
+}
+
+/**********************************************************************
+【函数名称】 GetEntryPath
+【函数功能】 求源文件对应的快照文件的位置。
+【参数】
+    Path: 源文件的位置。
+【返回值】
+    快照文件的位置。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+string ImportCache::GetEntryPath(string Path) const {
+    ostringstream Stream;
+    Stream << m_Directory;
+    if (
+        !m_Directory.empty() &&
+        m_Directory.back() != '/' &&
+        m_Directory.back() != '\\'
+    ) {
+        Stream << '/';
+    }
+    // 不同路径哈希相同时共用一个快照，快照中的路径不符即视为过期
+    Stream << hex << setw(16) << setfill('0');
+    Stream << GetHash(Path.data(), Path.size()) << SUFFIX;
+    return Stream.str();
+}
+
+/**********************************************************************
+【函数名称】 TryLoad
+【函数功能】 读取未过期的快照，快照过期或损坏时将其删除。
+【参数】
+    Path: 源文件的位置。
+    Info: 源文件当前的信息。
+    AModel: 模型的可变引用，只在命中时修改。
+【返回值】
+    是否命中。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ImportCache::TryLoad(
+    string Path,
+    const SourceInfo& Info,
+    Model<3>& AModel
+) const {
+    string EntryPath = GetEntryPath(Path);
+    Model<3> Snapshot;
+    bool bValid = false;
+    bool bHasName = false;
+    try {
+        MappedFile Entry(EntryPath);
+        MemoryBuffer Buffer(Entry.GetData(), Entry.GetSize());
+        istream Stream(&Buffer);
+        if (BinaryFormat::Read<uint32_t>(Stream) != MAGIC) {
+            throw FileFormatException(0, "not a cache entry");
+        }
+        size_t ullLength = BinaryFormat::Read<uint64_t>(Stream);
+        if (ullLength > Entry.GetSize()) {
+            throw FileFormatException(0, "unexpected end of file");
+        }
+        string Source(ullLength, '\0');
+        Stream.read(&Source[0], ullLength);
+        SourceInfo Cached { 0, 0, 0 };
+        Cached.Size = BinaryFormat::Read<uint64_t>(Stream);
+        Cached.ModifiedTime = BinaryFormat::Read<int64_t>(Stream);
+        Cached.Hash = BinaryFormat::Read<uint64_t>(Stream);
+        bHasName = BinaryFormat::Read<uint8_t>(Stream) != 0;
+        bValid =
+            Source == Path &&
+            Cached.Size == Info.Size &&
+            Cached.ModifiedTime == Info.ModifiedTime &&
+            Cached.Hash == Info.Hash;
+        if (bValid) {
+            // 头部之后即为 .c3w 文件的内容，直接从映射中读取
+            size_t ullOffset = static_cast<size_t>(Stream.tellg());
+            BinaryImporter().Import(
+                Entry.GetData() + ullOffset,
+                Entry.GetSize() - ullOffset,
+                Snapshot
+            );
+        }
+    }
+    catch (FileOpenException) {
+        return false;
+    }
+    catch (FileFormatException) {
+        bValid = false;
+    }
+    // 映射已经解除，部分平台上此时才能删除文件
+    if (!bValid) {
+        remove(EntryPath.c_str());
+        return false;
+    }
+    string Name = AModel.Name;
+    AModel = Snapshot;
+    if (!bHasName) {
+        AModel.Name = Name;
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Store
+【函数功能】 源文件仍与解析前一致时，原子地写入快照。
+【参数】
+    Path: 源文件的位置。
+    Info: 解析前源文件的信息。
+    AModel: 解析得到的模型。
+    HasName: 文件是否指定了名称。
+【返回值】
+    是否写入。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ImportCache::Store(
+    string Path,
+    const SourceInfo& Info,
+    const Model<3>& AModel,
+    bool HasName
+) const {
+    // 解析期间源文件被修改时，模型可能与解析前的哈希不符
+    SourceInfo Current { 0, 0, 0 };
+    if (
+        !Stat(Path, Current) ||
+        Current.Size != Info.Size ||
+        Current.ModifiedTime != Info.ModifiedTime
+    ) {
+        return false;
+    }
+    ostringstream Stream;
+    BinaryFormat::Write(Stream, MAGIC);
+    BinaryFormat::Write<uint64_t>(Stream, Path.size());
+    Stream.write(Path.data(), Path.size());
+    BinaryFormat::Write(Stream, Info.Size);
+    BinaryFormat::Write(Stream, Info.ModifiedTime);
+    BinaryFormat::Write(Stream, Info.Hash);
+    BinaryFormat::Write<uint8_t>(Stream, HasName ? 1 : 0);
+    BinaryExporter().Export(Stream, AModel, ExportOptions());
+    // 其他进程可能同时读取快照，因此先写入临时文件再替换
+    return FileSync::Replace(GetEntryPath(Path), Stream.str());
+}
+
+/**********************************************************************
+【函数名称】 Stat
+【函数功能】 读取文件的字节数与修改时间。
+【参数】
+    Path: 文件的位置。
+    Info: 接收信息，不修改其中的哈希。
+【返回值】
+    是否成功。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ImportCache::Stat(string Path, SourceInfo& Info) {
+    // Windows 上 stat 的字节数只有 32 位
+#if defined(_WIN32)
+    struct _stat64 Status;
+    if (_stat64(Path.c_str(), &Status) != 0) {
+        return false;
+    }
+#else
+    struct stat Status;
+    if (stat(Path.c_str(), &Status) != 0) {
+        return false;
+    }
+#endif
+    Info.Size = static_cast<uint64_t>(Status.st_size);
+    Info.ModifiedTime = static_cast<int64_t>(Status.st_mtime);
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Identify
+【函数功能】 读取文件的字节数、修改时间，并映射文件求内容哈希。
+【参数】
+    Path: 文件的位置。
+    Info: 接收信息。
+【返回值】
+    是否成功。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ImportCache::Identify(string Path, SourceInfo& Info) {
+    if (!Stat(Path, Info)) {
+        return false;
+    }
+    try {
+        MappedFile Source(Path);
+        Info.Hash = GetHash(Source.GetData(), Source.GetSize());
+    }
+    catch (FileOpenException) {
+        return false;
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 GetHash
+【函数功能】 以 8 字节为单位求 64 位哈希，每个字约需一次乘法，
+    速度接近内存带宽。只用于发现修改，不抵抗刻意构造的碰撞。
+【参数】
+    Data: 数据的起始地址。
+    Size: 数据的字节数。
+【返回值】
+    哈希值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+uint64_t ImportCache::GetHash(const char* Data, size_t Size) {
+    const uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ull;
+    uint64_t ullHash = Size * MULTIPLIER;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= Size; i += sizeof(uint64_t)) {
+        // memcpy 避免未对齐访问，编译器将其优化为一次读取
+        uint64_t ullWord;
+        memcpy(&ullWord, Data + i, sizeof(uint64_t));
+        ullHash = (ullHash ^ ullWord) * MULTIPLIER;
+        ullHash ^= ullHash >> 32;
+    }
+    // 不足 8 字节的尾部补 0 后作为最后一个字
+    if (i < Size) {
+        uint64_t ullWord = 0;
+        memcpy(&ullWord, Data + i, Size - i);
+        ullHash = (ullHash ^ ullWord) * MULTIPLIER;
+        ullHash ^= ullHash >> 32;
+    }
+    return ullHash;
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,210 @@
+/*************************************************************************
+【文件名】 ImportCache.hpp
+【功能模块和目的】 ImportCache 类定义了导入结果的磁盘缓存。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef IMPORT_CACHE_HPP
+#define IMPORT_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "../Core/Model.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ImportCache
+【功能】 将解析文本文件得到的模型以 .c3w 格式的快照存放在缓存目录中，
+    之后再次导入同一文件时映射快照直接读取，不再解析文本。
+    每个源文件对应一个以其路径的哈希命名的快照，快照头部记录源文件的
+    路径、字节数、修改时间与内容哈希；字节数与修改时间不符时直接失效，
+    相符时再比较内容哈希，防止修改时间精度不足时读到过期的快照。
+    快照原子地写入，损坏或过期的快照被删除并重新导入。
+    文本格式的名称占一行，不含换行符，因此解析前将名称设为换行符，
+    解析后仍为换行符即表示文件未指定名称。
+    缓存只是加速手段，写入失败时静默忽略。
+【接口说明】
+    内嵌类型：
+        SourceInfo: 源文件的标识信息。
+    成员：
+        MAGIC: 快照开头的标识。
+        SUFFIX: 快照文件的后缀。
+        UNSET_NAME: 解析前的名称。
+    构造与析构：
+        接受缓存目录的构造函数。
+    属性：
+        GetDirectory: 获取缓存目录。
+    操作：
+        Import: 命中时从快照读取模型，否则解析源文件并写入快照。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class ImportCache final {
+    public:
+        // 内嵌类型
+
+        /**********************************************************************
+        【类名】 SourceInfo
+        【功能】 判断快照是否过期所用的源文件信息。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct SourceInfo {
+            // 字节数
+            uint64_t Size;
+            // 修改时间，自纪元起的秒数
+            int64_t ModifiedTime;
+            // 内容哈希
+            uint64_t Hash;
+        };
+
+        // 成员
+
+        // 快照开头的标识
+        static constexpr uint32_t MAGIC { 0x43573343 };
+        // 快照文件的后缀
+        static constexpr const char* SUFFIX { ".c3wcache" };
+        // 解析前的名称，解析后不变表示文件未指定名称
+        static constexpr const char* UNSET_NAME { "\n" };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用缓存目录初始化 ImportCache 对象。
+        【参数】
+            Directory: 存放快照的目录，必须已经存在。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit ImportCache(string Directory);
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetDirectory
+        【函数功能】 获取缓存目录。
+        【参数】 无
+        【返回值】
+            缓存目录。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        string GetDirectory() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Import
+        【函数功能】 源文件有未过期的快照时映射快照读取模型；否则调用 Parse
+            解析源文件，解析完整且期间源文件未被修改时写入快照。
+            文件未指定名称时，与不使用缓存时一样保留模型原有的名称。
+        【参数】
+            Path: 源文件的位置。
+            AModel: 模型的可变引用。
+            Parse: 形如 bool(Model<3>& Parsed) 的函数，将源文件解析到
+                Parsed 中，返回结果是否完整（例如未被取消）。
+        【返回值】
+            是否命中缓存。
+            Parse 抛出的异常原样传出。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool Import(
+            string Path,
+            Model<3>& AModel,
+            function<bool(Model<3>&)> Parse
+        ) const;
+
+    private:
+        // 存放快照的目录
+        string m_Directory;
+
+        /**********************************************************************
+        【函数名称】 GetEntryPath
+        【函数功能】 求源文件对应的快照文件的位置。
+        【参数】
+            Path: 源文件的位置。
+        【返回值】
+            快照文件的位置。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        string GetEntryPath(string Path) const;
+        /**********************************************************************
+        【函数名称】 TryLoad
+        【函数功能】 读取未过期的快照，快照过期或损坏时将其删除。
+        【参数】
+            Path: 源文件的位置。
+            Info: 源文件当前的信息。
+            AModel: 模型的可变引用，只在命中时修改。
+        【返回值】
+            是否命中。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool TryLoad(
+            string Path,
+            const SourceInfo& Info,
+            Model<3>& AModel
+        ) const;
+        /**********************************************************************
+        【函数名称】 Store
+        【函数功能】 源文件仍与解析前一致时，原子地写入快照。
+        【参数】
+            Path: 源文件的位置。
+            Info: 解析前源文件的信息。
+            AModel: 解析得到的模型。
+            HasName: 文件是否指定了名称。
+        【返回值】
+            是否写入。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool Store(
+            string Path,
+            const SourceInfo& Info,
+            const Model<3>& AModel,
+            bool HasName
+        ) const;
+        /**********************************************************************
+        【函数名称】 Stat
+        【函数功能】 读取文件的字节数与修改时间。
+        【参数】
+            Path: 文件的位置。
+            Info: 接收信息，不修改其中的哈希。
+        【返回值】
+            是否成功。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static bool Stat(string Path, SourceInfo& Info);
+        /**********************************************************************
+        【函数名称】 Identify
+        【函数功能】 读取文件的字节数、修改时间，并映射文件求内容哈希。
+        【参数】
+            Path: 文件的位置。
+            Info: 接收信息。
+        【返回值】
+            是否成功。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static bool Identify(string Path, SourceInfo& Info);
+        /**********************************************************************
+        【函数名称】 GetHash
+        【函数功能】 以 8 字节为单位求 64 位哈希，每个字约需一次乘法，
+            速度接近内存带宽。只用于发现修改，不抵抗刻意构造的碰撞。
+        【参数】
+            Data: 数据的起始地址。
+            Size: 数据的字节数。
+        【返回值】
+            哈希值。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static uint64_t GetHash(const char* Data, size_t Size);
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
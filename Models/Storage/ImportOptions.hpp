@@ -0,0 +1,29 @@
+/*************************************************************************
+【文件名】 ImportOptions.hpp
+【功能模块和目的】 ImportOptions 结构体定义了导入模型时的选项。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef IMPORT_OPTIONS_HPP
+#define IMPORT_OPTIONS_HPP
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ImportOptions
+【功能】 导入模型时的选项，由 ImporterBase 统一处理，与文件格式无关。
+【接口说明】 简单数据类型，无函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+struct ImportOptions {
+    // 是否在导入后沿 Morton 曲线重排线段与面，见 Mesh::SpatialOrder
+    bool bReorder { false };
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
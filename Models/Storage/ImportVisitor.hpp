@@ -0,0 +1,89 @@
+/*************************************************************************
+【文件名】 ImportVisitor.hpp
+【功能模块和目的】 ImportVisitor 类定义了流式导入时接收记录的访问者。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef IMPORT_VISITOR_HPP
+#define IMPORT_VISITOR_HPP
+
+#include <cstddef>
+#include <string>
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ImportVisitor
+【功能】 流式导入的访问者。导入器每解析出一条记录即调用对应的函数，
+    不构造完整的 Model<N, T>，访问者自行决定保留哪些数据。
+    所有函数默认什么也不做，子类只需重写关心的记录。
+【接口说明】
+    构造与析构：
+        虚析构函数。
+    操作：
+        VisitName: 接收模型的名称。
+        VisitVertex: 接收文件中的一个顶点。
+        VisitLine: 接收一条线段。
+        VisitFace: 接收一个面。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N, typename T = double>
+class ImportVisitor {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 VisitName
+        【函数功能】 接收模型的名称。
+        【参数】
+            Name: 模型的名称。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual void VisitName(const string& Name);
+        /**********************************************************************
+        【函数名称】 VisitVertex
+        【函数功能】 接收文件中的一个顶点，包括未被元素使用的顶点。
+        【参数】
+            Vertex: 顶点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual void VisitVertex(const Point<N, T>& Vertex);
+        /**********************************************************************
+        【函数名称】 VisitLine
+        【函数功能】 接收一条线段，其顶点已由下标解析为坐标。
+        【参数】
+            ALine: 线段。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual void VisitLine(const Line<N, T>& ALine);
+        /**********************************************************************
+        【函数名称】 VisitFace
+        【函数功能】 接收一个面，其顶点已由下标解析为坐标。
+        【参数】
+            AFace: 面。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual void VisitFace(const Face<N, T>& AFace);
+
+        // 虚析构函数
+        virtual ~ImportVisitor() = default;
+};
+
+}
+
+}
+
+#include "ImportVisitor.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,66 @@
+/*************************************************************************
+【文件名】 ImportVisitor.tpp
+【功能模块和目的】 为 ImportVisitor.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <string>
+#include "ImportVisitor.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/**********************************************************************
+【函数名称】 VisitName
+【函数功能】 接收模型的名称。
+【参数】
+    Name: 模型的名称。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ImportVisitor<N, T>::VisitName(const string&) {}
+
+/**********************************************************************
+【函数名称】 VisitVertex
+【函数功能】 接收文件中的一个顶点，包括未被元素使用的顶点。
+【参数】
+    Vertex: 顶点。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ImportVisitor<N, T>::VisitVertex(const Point<N, T>&) {}
+
+/**********************************************************************
+【函数名称】 VisitLine
+【函数功能】 接收一条线段，其顶点已由下标解析为坐标。
+【参数】
+    ALine: 线段。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ImportVisitor<N, T>::VisitLine(const Line<N, T>&) {}
+
+/**********************************************************************
+【函数名称】 VisitFace
+【函数功能】 接收一个面，其顶点已由下标解析为坐标。
+【参数】
+    AFace: 面。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ImportVisitor<N, T>::VisitFace(const Face<N, T>&) {}
+
+}
+
+}
\ No newline at end of file
@@ -9,8 +9,11 @@
 
 #include <cstddef>
 #include <fstream>
+#include <istream>
 #include <string>
 #include "../Core/Model.hpp"
+#include "ImportOptions.hpp"
+#include "ImportVisitor.hpp"
 using namespace std;
 using namespace C3w;
 
@@ -20,31 +23,132 @@ namespace Storage {
 
 /*************************************************************************
 【类名】 ImporterBase
-【功能】 定义一个抽象的导入器。
+【功能】 定义一个抽象的导入器，导入维数为 N、点的分量类型为 T 的模型。
 【接口说明】 
     构造与析构：
         虚析构函数。
     操作：
-        Import: 使用文件名导入一个模型。
-        InnerImport (protected): 使用文件流导入模型，纯虚函数。
+        Import: 使用文件名、输入流或内存数据导入一个模型，并按选项处理。
+        Visit: 使用文件名、输入流或内存数据流式导入，
+            将记录逐条交给访问者。
+        InnerImport (protected): 使用输入流导入模型，默认以 ModelBuilder
+            访问 InnerVisit 的结果。
+        InnerVisit (protected): 使用输入流流式导入，纯虚函数。
+        IsBinary: 是否应以二进制方式打开文件，默认为否。
+        GetAppendedSize: 获取文件末尾追加的增量记录的字节数，默认为 0。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
-template <size_t N>
+template <size_t N, typename T = double>
 class ImporterBase {
     public:
         // 操作
 
-        // 考虑子类实现，传引用作为参数而非直接返回 Model<N>。
+        // 考虑子类实现，传引用作为参数而非直接返回 Model<N, T>。
         /**********************************************************************
         【函数名称】 Import
         【函数功能】 导入指定文件到模型中。
         【参数】 
             Path: 文件所在路径。
             Model: 模型的可变引用。
+            Options: 导入选项，默认为 ImportOptions()。
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void Import(string Path, Model<N>& Model) const;
+        void Import(
+            string Path,
+            Model<N, T>& Model,
+            const ImportOptions& Options = ImportOptions()
+        ) const;
+        /**********************************************************************
+        【函数名称】 Import
+        【函数功能】 从输入流的当前位置导入模型。二进制格式要求流
+            不做换行符转换。
+        【参数】 
+            Stream: 输入流。
+            Model: 模型的可变引用。
+            Options: 导入选项，默认为 ImportOptions()。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Import(
+            istream& Stream,
+            Model<N, T>& Model,
+            const ImportOptions& Options = ImportOptions()
+        ) const;
+        /**********************************************************************
+        【函数名称】 Import
+        【函数功能】 从内存中的文件内容导入模型，直接读取而不复制数据。
+        【参数】 
+            Data: 文件内容的起始地址，导入期间必须有效。
+            Size: 文件内容的字节数。
+            Model: 模型的可变引用。
+            Options: 导入选项，默认为 ImportOptions()。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Import(
+            const char* Data,
+            size_t Size,
+            Model<N, T>& Model,
+            const ImportOptions& Options = ImportOptions()
+        ) const;
+        /**********************************************************************
+        【函数名称】 Visit
+        【函数功能】 流式导入指定文件，每解析出一条记录即交给访问者，
+            不构造完整的模型。
+        【参数】 
+            Path: 文件所在路径。
+            Visitor: 接收记录的访问者。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Visit(string Path, ImportVisitor<N, T>& Visitor) const;
+        /**********************************************************************
+        【函数名称】 Visit
+        【函数功能】 从输入流的当前位置流式导入，将记录逐条交给访问者。
+        【参数】 
+            Stream: 输入流。
+            Visitor: 接收记录的访问者。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Visit(istream& Stream, ImportVisitor<N, T>& Visitor) const;
+        /**********************************************************************
+        【函数名称】 Visit
+        【函数功能】 从内存中的文件内容流式导入，将记录逐条交给访问者，
+            直接读取而不复制数据。
+        【参数】 
+            Data: 文件内容的起始地址，导入期间必须有效。
+            Size: 文件内容的字节数。
+            Visitor: 接收记录的访问者。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Visit(
+            const char* Data,
+            size_t Size,
+            ImportVisitor<N, T>& Visitor
+        ) const;
+        /**********************************************************************
+        【函数名称】 IsBinary
+        【函数功能】 判断是否应以二进制方式打开文件。
+        【参数】 无
+        【返回值】
+            是否以二进制方式打开文件，默认为否。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual bool IsBinary() const;
+        /**********************************************************************
+        【函数名称】 GetAppendedSize
+        【函数功能】 获取文件末尾追加的 ModelDelta 记录的字节数，
+            用于区分完整保存的内容与之后增量保存的内容。
+        【参数】 
+            Path: 文件所在路径。
+        【返回值】
+            追加的记录的字节数，默认为 0，即不在文件末尾追加记录。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual size_t GetAppendedSize(string Path) const;
 
         // 虚析构函数
         virtual ~ImporterBase() = default;
@@ -52,14 +156,28 @@ class ImporterBase {
     protected:
         /**********************************************************************
         【函数名称】 InnerImport
-        【函数功能】 导入指定文件流到模型中。
+        【函数功能】 导入输入流到模型中，默认将 InnerVisit 解析出的
+            记录以 ModelBuilder 依次加入模型。
         【参数】 
-            Stream: 已经打开的文件流。
+            Stream: 输入流。
             Model: 模型的可变引用。
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        virtual void InnerImport(ifstream& Stream, Model<N>& Model) const = 0;
+        virtual void InnerImport(istream& Stream, Model<N, T>& Model) const;
+        /**********************************************************************
+        【函数名称】 InnerVisit
+        【函数功能】 流式导入输入流，将记录逐条交给访问者。
+        【参数】 
+            Stream: 输入流。
+            Visitor: 接收记录的访问者。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        virtual void InnerVisit(
+            istream& Stream,
+            ImportVisitor<N, T>& Visitor
+        ) const = 0;
 };
 
 }
@@ -6,10 +6,16 @@
 
 #include <cstddef>
 #include <fstream>
+#include <istream>
 #include <string>
 #include "../Errors/FileOpenException.hpp"
 #include "../Core/Model.hpp"
+#include "../Mesh/SpatialOrder.hpp"
 #include "ImporterBase.hpp"
+#include "ImportOptions.hpp"
+#include "ImportVisitor.hpp"
+#include "MemoryBuffer.hpp"
+#include "ModelBuilder.hpp"
 using namespace std;
 using namespace C3w;
 using namespace C3w::Errors;
@@ -24,17 +30,104 @@ namespace Storage {
 【参数】 
     Path: 文件所在路径。
     Model: 模型的可变引用。
+    Options: 导入选项。
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-void ImporterBase<N>::Import(string Path, Model<N>& Model) const {
-    ifstream Stream(Path, ios::in);
+template <size_t N, typename T>
+void ImporterBase<N, T>::Import(
+    string Path,
+    Model<N, T>& Model,
+    const ImportOptions& Options
+) const {
+    ios::openmode Mode = ios::in;
+    if (IsBinary()) {
+        Mode |= ios::binary;
+    }
+    ifstream Stream(Path, Mode);
+    if (!Stream.is_open()) {
+        throw FileOpenException(Path);
+    }
+    try {
+        Import(Stream, Model, Options);
+    }
+    catch (...) {
+        Stream.close();
+        throw;
+    }
+}
+
+/**********************************************************************
+【函数名称】 Import
+【函数功能】 从输入流的当前位置导入模型。二进制格式要求流
+    不做换行符转换。
+【参数】 
+    Stream: 输入流。
+    Model: 模型的可变引用。
+    Options: 导入选项。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ImporterBase<N, T>::Import(
+    istream& Stream,
+    Model<N, T>& Model,
+    const ImportOptions& Options
+) const {
+    InnerImport(Stream, Model);
+    if (Options.bReorder) {
+        Mesh::SpatialOrder<N>::ReorderInplace(Model);
+    }
+}
+
+/**********************************************************************
+【函数名称】 Import
+【函数功能】 从内存中的文件内容导入模型，直接读取而不复制数据。
+【参数】 
+    Data: 文件内容的起始地址，导入期间必须有效。
+    Size: 文件内容的字节数。
+    Model: 模型的可变引用。
+    Options: 导入选项。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ImporterBase<N, T>::Import(
+    const char* Data,
+    size_t Size,
+    Model<N, T>& Model,
+    const ImportOptions& Options
+) const {
+    MemoryBuffer Buffer(Data, Size);
+    istream Stream(&Buffer);
+    Import(Stream, Model, Options);
+}
+
+/**********************************************************************
+【函数名称】 Visit
+【函数功能】 流式导入指定文件，每解析出一条记录即交给访问者，
+    不构造完整的模型。
+【参数】 
+    Path: 文件所在路径。
+    Visitor: 接收记录的访问者。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ImporterBase<N, T>::Visit(
+    string Path,
+    ImportVisitor<N, T>& Visitor
+) const {
+    ios::openmode Mode = ios::in;
+    if (IsBinary()) {
+        Mode |= ios::binary;
+    }
+    ifstream Stream(Path, Mode);
     if (!Stream.is_open()) {
         throw FileOpenException(Path);
     }
     try {
-        InnerImport(Stream, Model);
+        InnerVisit(Stream, Visitor);
     }
     catch (...) {
         Stream.close();
@@ -42,6 +135,92 @@ void ImporterBase<N>::Import(string Path, Model<N>& Model) const {
     }
 }
 
+/**********************************************************************
+【函数名称】 Visit
+【函数功能】 从输入流的当前位置流式导入，将记录逐条交给访问者。
+【参数】 
+    Stream: 输入流。
+    Visitor: 接收记录的访问者。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ImporterBase<N, T>::Visit(
+    istream& Stream,
+    ImportVisitor<N, T>& Visitor
+) const {
+    InnerVisit(Stream, Visitor);
+}
+
+/**********************************************************************
+【函数名称】 Visit
+【函数功能】 从内存中的文件内容流式导入，将记录逐条交给访问者，
+    直接读取而不复制数据。
+【参数】 
+    Data: 文件内容的起始地址，导入期间必须有效。
+    Size: 文件内容的字节数。
+    Visitor: 接收记录的访问者。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ImporterBase<N, T>::Visit(
+    const char* Data,
+    size_t Size,
+    ImportVisitor<N, T>& Visitor
+) const {
+    MemoryBuffer Buffer(Data, Size);
+    istream Stream(&Buffer);
+    InnerVisit(Stream, Visitor);
+}
+
+/**********************************************************************
+【函数名称】 InnerImport
+【函数功能】 导入输入流到模型中，默认将 InnerVisit 解析出的
+    记录以 ModelBuilder 依次加入模型。
+【参数】 
+    Stream: 输入流。
+    Model: 模型的可变引用。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ImporterBase<N, T>::InnerImport(
+    istream& Stream,
+    Model<N, T>& Model
+) const {
+    ModelBuilder<N, T> Builder(Model);
+    InnerVisit(Stream, Builder);
+}
+
+/**********************************************************************
+【函数名称】 IsBinary
+【函数功能】 判断是否以二进制方式打开文件。
+【参数】 无
+【返回值】
+    是否以二进制方式打开文件，默认为否。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+bool ImporterBase<N, T>::IsBinary() const {
+    return false;
+}
+
+/**********************************************************************
+【函数名称】 GetAppendedSize
+【函数功能】 获取文件末尾追加的 ModelDelta 记录的字节数，
+    用于区分完整保存的内容与之后增量保存的内容。
+【参数】 
+    Path: 文件所在路径。
+【返回值】
+    追加的记录的字节数，默认为 0，即不在文件末尾追加记录。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+size_t ImporterBase<N, T>::GetAppendedSize(string Path) const {
+    return 0;
+}
+
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*************************************************************************
+【文件名】 MemoryBuffer.cpp
+【功能模块和目的】 为 MemoryBuffer.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <ios>
+#include <streambuf>
+#include "MemoryBuffer.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用一段内存初始化 MemoryBuffer 对象。
+【参数】
+    Data: 内存的起始地址。
+    Size: 内存的字节数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+MemoryBuffer::MemoryBuffer(const char* Data, size_t Size) {
+    // 只设置读取区，streambuf 不会经由读取区写入，去掉 const 是安全的
+    char* pBegin = const_cast<char*>(Data);
+    setg(pBegin, pBegin, pBegin + Size);
+}
+
+/**********************************************************************
+【函数名称】 seekoff
+【函数功能】 相对于起点、当前位置或终点移动读取位置。
+【参数】
+    Offset: 偏移量。
+    Direction: 偏移的基准。
+    Which: 要移动的位置，只支持读取位置。
+【返回值】
+    新的读取位置，越界或不支持时为 -1，此时位置不变。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+MemoryBuffer::pos_type MemoryBuffer::seekoff(
+    off_type Offset,
+    ios_base::seekdir Direction,
+    ios_base::openmode Which
+) {
+    if (!(Which & ios_base::in) || (Which & ios_base::out)) {
+        return pos_type(off_type(-1));
+    }
+    off_type llBase = 0;
+    if (Direction == ios_base::cur) {
+        llBase = gptr() - eback();
+    }
+    else if (Direction == ios_base::end) {
+        llBase = egptr() - eback();
+    }
+    off_type llTarget = llBase + Offset;
+    if (llTarget < 0 || llTarget > egptr() - eback()) {
+        return pos_type(off_type(-1));
+    }
+    setg(eback(), eback() + llTarget, egptr());
+    return pos_type(llTarget);
+}
+
+/**********************************************************************
+【函数名称】 seekpos
+【函数功能】 移动读取位置到指定位置。
+【参数】
+    Position: 相对于起点的位置。
+    Which: 要移动的位置，只支持读取位置。
+【返回值】
+    新的读取位置，越界或不支持时为 -1，此时位置不变。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+MemoryBuffer::pos_type MemoryBuffer::seekpos(
+    pos_type Position,
+    ios_base::openmode Which
+) {
+    return seekoff(off_type(Position), ios_base::beg, Which);
+}
+
+}
+
+}
\ No newline at end of file
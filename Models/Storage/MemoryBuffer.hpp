@@ -0,0 +1,94 @@
+/*************************************************************************
+【文件名】 MemoryBuffer.hpp
+【功能模块和目的】 MemoryBuffer 类将一段只读内存包装为输入流缓冲区。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef MEMORY_BUFFER_HPP
+#define MEMORY_BUFFER_HPP
+
+#include <cstddef>
+#include <ios>
+#include <streambuf>
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 MemoryBuffer
+【功能】 以一段只读内存作为 streambuf 的读取区，不复制数据，
+    供 istream 直接解析已在内存中的文件内容（映射的文件、
+    管道收到的数据、嵌入在其他容器中的数据等）。
+    不拥有内存的所有权，内存必须在使用期间保持有效。
+【接口说明】
+    继承于 std::streambuf:
+        重写 seekoff、seekpos，支持在读取区内定位。
+    构造与析构：
+        接受起始地址与字节数的构造函数。
+        删除拷贝构造函数。
+    操作符：
+        删除赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class MemoryBuffer final: public streambuf {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用一段内存初始化 MemoryBuffer 对象。
+        【参数】
+            Data: 内存的起始地址。
+            Size: 内存的字节数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        MemoryBuffer(const char* Data, size_t Size);
+        // 删除拷贝构造函数
+        MemoryBuffer(const MemoryBuffer& Other) = delete;
+
+        // 操作符
+
+        // 删除赋值运算符
+        MemoryBuffer& operator=(const MemoryBuffer& Other) = delete;
+
+    protected:
+        /**********************************************************************
+        【函数名称】 seekoff
+        【函数功能】 相对于起点、当前位置或终点移动读取位置。
+        【参数】
+            Offset: 偏移量。
+            Direction: 偏移的基准。
+            Which: 要移动的位置，只支持读取位置。
+        【返回值】
+            新的读取位置，越界或不支持时为 -1，此时位置不变。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        pos_type seekoff(
+            off_type Offset,
+            ios_base::seekdir Direction,
+            ios_base::openmode Which = ios_base::in
+        ) override;
+        /**********************************************************************
+        【函数名称】 seekpos
+        【函数功能】 移动读取位置到指定位置。
+        【参数】
+            Position: 相对于起点的位置。
+            Which: 要移动的位置，只支持读取位置。
+        【返回值】
+            新的读取位置，越界或不支持时为 -1，此时位置不变。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        pos_type seekpos(
+            pos_type Position,
+            ios_base::openmode Which = ios_base::in
+        ) override;
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
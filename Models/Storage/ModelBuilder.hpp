@@ -0,0 +1,102 @@
+/*************************************************************************
+【文件名】 ModelBuilder.hpp
+【功能模块和目的】 ModelBuilder 类将流式导入的记录收集到模型中。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef MODEL_BUILDER_HPP
+#define MODEL_BUILDER_HPP
+
+#include <cstddef>
+#include <string>
+#include "ImportVisitor.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Model.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ModelBuilder
+【功能】 将接收到的名称、线段与面依次加入模型，
+    ImporterBase::InnerImport 默认以此实现。
+【接口说明】
+    继承于 C3w::Storage::ImportVisitor<N, T>:
+        重写 VisitName、VisitLine、VisitFace。
+    构造与析构：
+        接受模型引用的构造函数。
+        删除拷贝构造函数。
+    操作符：
+        删除赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N, typename T = double>
+class ModelBuilder final: public ImportVisitor<N, T> {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用要填充的模型初始化 ModelBuilder 对象。
+        【参数】
+            AModel: 模型的可变引用，记录追加在已有元素之后。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit ModelBuilder(Model<N, T>& AModel);
+        // 删除拷贝构造函数
+        ModelBuilder(const ModelBuilder& Other) = delete;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 VisitName
+        【函数功能】 设置模型的名称。
+        【参数】
+            Name: 模型的名称。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void VisitName(const string& Name) override;
+        /**********************************************************************
+        【函数名称】 VisitLine
+        【函数功能】 向模型中添加一条线段。
+        【参数】
+            ALine: 线段。
+        【返回值】 无
+            如果线段已存在，抛出 CollectionException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void VisitLine(const Line<N, T>& ALine) override;
+        /**********************************************************************
+        【函数名称】 VisitFace
+        【函数功能】 向模型中添加一个面。
+        【参数】
+            AFace: 面。
+        【返回值】 无
+            如果面已存在，抛出 CollectionException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void VisitFace(const Face<N, T>& AFace) override;
+
+        // 操作符
+
+        // 删除赋值运算符
+        ModelBuilder& operator=(const ModelBuilder& Other) = delete;
+
+    private:
+        // 要填充的模型
+        Model<N, T>& m_Model;
+};
+
+}
+
+}
+
+#include "ModelBuilder.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+/*************************************************************************
+【文件名】 ModelBuilder.tpp
+【功能模块和目的】 为 ModelBuilder.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <string>
+#include "ModelBuilder.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Model.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用要填充的模型初始化 ModelBuilder 对象。
+【参数】
+    AModel: 模型的可变引用，记录追加在已有元素之后。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+ModelBuilder<N, T>::ModelBuilder(Model<N, T>& AModel): m_Model(AModel) {}
+
+/**********************************************************************
+【函数名称】 VisitName
+【函数功能】 设置模型的名称。
+【参数】
+    Name: 模型的名称。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ModelBuilder<N, T>::VisitName(const string& Name) {
+    m_Model.Name = Name;
+}
+
+/**********************************************************************
+【函数名称】 VisitLine
+【函数功能】 向模型中添加一条线段。
+【参数】
+    ALine: 线段。
+【返回值】 无
+    如果线段已存在，抛出 CollectionException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ModelBuilder<N, T>::VisitLine(const Line<N, T>& ALine) {
+    m_Model.Lines.Add(ALine);
+}
+
+/**********************************************************************
+【函数名称】 VisitFace
+【函数功能】 向模型中添加一个面。
+【参数】
+    AFace: 面。
+【返回值】 无
+    如果面已存在，抛出 CollectionException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void ModelBuilder<N, T>::VisitFace(const Face<N, T>& AFace) {
+    m_Model.Faces.Add(AFace);
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,327 @@
+/*************************************************************************
+【文件名】 ModelDelta.cpp
+【功能模块和目的】 为 ModelDelta.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "ModelDelta.hpp"
+#include "Binary/BinaryFormat.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Containers/DynamicSet.hpp"
+#include "../Errors/CollectionException.hpp"
+#include "../Errors/FileFormatException.hpp"
+#include "../Tools/PointHash.hpp"
+using namespace std;
+using namespace C3w::Containers;
+using namespace C3w::Errors;
+using namespace C3w::Storage::Binary;
+
+namespace C3w {
+
+namespace Storage {
+
+// 每条记录开头的标识
+constexpr uint32_t ModelDelta::MAGIC;
+// 附属文件的后缀
+constexpr const char* ModelDelta::JOURNAL_SUFFIX;
+
+/**********************************************************************
+【函数名称】 IsEmpty
+【函数功能】 判断记录是否不删除、修改或新建任何元素。
+【参数】 无
+【返回值】
+    记录是否不改变任何元素，名称不参与判断。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ModelDelta::IsEmpty() const {
+    return RemovedLines.empty() && ModifiedLines.empty() &&
+        CreatedLines.empty() && RemovedFaces.empty() &&
+        ModifiedFaces.empty() && CreatedFaces.empty();
+}
+
+/**********************************************************************
+【函数名称】 Apply
+【函数功能】 将记录应用到基准模型上。不逐对查重，只以哈希表检查
+    修改与新建后元素是否重复，代价与模型的元素数成线性。
+【参数】
+    AModel: 基准模型的可变引用。
+【返回值】 无
+    如果下标越界或不递增，或应用后元素重复，
+    抛出 FileFormatException，此时模型保持不变。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ModelDelta::Apply(Model<3>& AModel) const {
+    // 先求出两个集合，全部成功后再修改模型
+    DynamicSet<Line<3>> Lines = ApplyTo(
+        AModel.Lines,
+        RemovedLines,
+        ModifiedLines,
+        CreatedLines
+    );
+    DynamicSet<Face<3>> Faces = ApplyTo(
+        AModel.Faces,
+        RemovedFaces,
+        ModifiedFaces,
+        CreatedFaces
+    );
+    AModel.Lines = move(Lines);
+    AModel.Faces = move(Faces);
+    AModel.Name = Name;
+}
+
+/**********************************************************************
+【函数名称】 Write
+【函数功能】 向输出流写入记录，代价与记录的大小成线性。
+【参数】
+    Stream: 输出流。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ModelDelta::Write(ostream& Stream) const {
+    BinaryFormat::Write(Stream, MAGIC);
+    BinaryFormat::Write<uint64_t>(Stream, Name.size());
+    Stream.write(Name.data(), Name.size());
+    BinaryFormat::Write<uint64_t>(Stream, RemovedLines.size());
+    for (size_t ullIndex: RemovedLines) {
+        BinaryFormat::Write<uint64_t>(Stream, ullIndex);
+    }
+    BinaryFormat::Write<uint64_t>(Stream, ModifiedLines.size());
+    for (auto& Modified: ModifiedLines) {
+        BinaryFormat::Write<uint64_t>(Stream, Modified.first);
+        WritePoint(Stream, Modified.second.Start);
+        WritePoint(Stream, Modified.second.End);
+    }
+    BinaryFormat::Write<uint64_t>(Stream, CreatedLines.size());
+    for (auto& ALine: CreatedLines) {
+        WritePoint(Stream, ALine.Start);
+        WritePoint(Stream, ALine.End);
+    }
+    BinaryFormat::Write<uint64_t>(Stream, RemovedFaces.size());
+    for (size_t ullIndex: RemovedFaces) {
+        BinaryFormat::Write<uint64_t>(Stream, ullIndex);
+    }
+    BinaryFormat::Write<uint64_t>(Stream, ModifiedFaces.size());
+    for (auto& Modified: ModifiedFaces) {
+        BinaryFormat::Write<uint64_t>(Stream, Modified.first);
+        for (auto& APoint: Modified.second.Points) {
+            WritePoint(Stream, APoint);
+        }
+    }
+    BinaryFormat::Write<uint64_t>(Stream, CreatedFaces.size());
+    for (auto& AFace: CreatedFaces) {
+        for (auto& APoint: AFace.Points) {
+            WritePoint(Stream, APoint);
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 Read
+【函数功能】 从输入流读取一条记录。
+【参数】
+    Stream: 输入流。
+【返回值】
+    读取的记录。
+    如果记录无效、含有顶点重合的元素或提前结束，
+    抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ModelDelta ModelDelta::Read(istream& Stream) {
+    if (BinaryFormat::Read<uint32_t>(Stream) != MAGIC) {
+        throw FileFormatException(0, "not a delta record");
+    }
+    // 损坏的记录可能含有顶点重合的元素，构造时抛出 CollectionException
+    try {
+        // 逐个读取而不预先分配，避免损坏的长度导致过大的内存申请
+        ModelDelta Delta;
+        size_t ullNameLength = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullNameLength; i++) {
+            Delta.Name.push_back(BinaryFormat::Read<char>(Stream));
+        }
+        size_t ullCount = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullCount; i++) {
+            Delta.RemovedLines.push_back(BinaryFormat::Read<uint64_t>(Stream));
+        }
+        ullCount = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullCount; i++) {
+            size_t ullIndex = BinaryFormat::Read<uint64_t>(Stream);
+            Point<3> Start = ReadPoint(Stream);
+            Point<3> End = ReadPoint(Stream);
+            Delta.ModifiedLines.emplace_back(ullIndex, Line<3>(Start, End));
+        }
+        ullCount = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullCount; i++) {
+            Point<3> Start = ReadPoint(Stream);
+            Point<3> End = ReadPoint(Stream);
+            Delta.CreatedLines.emplace_back(Start, End);
+        }
+        ullCount = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullCount; i++) {
+            Delta.RemovedFaces.push_back(BinaryFormat::Read<uint64_t>(Stream));
+        }
+        ullCount = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullCount; i++) {
+            size_t ullIndex = BinaryFormat::Read<uint64_t>(Stream);
+            Point<3> Vertex1 = ReadPoint(Stream);
+            Point<3> Vertex2 = ReadPoint(Stream);
+            Point<3> Vertex3 = ReadPoint(Stream);
+            Delta.ModifiedFaces.emplace_back(
+                ullIndex,
+                Face<3>(Vertex1, Vertex2, Vertex3)
+            );
+        }
+        ullCount = BinaryFormat::Read<uint64_t>(Stream);
+        for (size_t i = 0; i < ullCount; i++) {
+            Point<3> Vertex1 = ReadPoint(Stream);
+            Point<3> Vertex2 = ReadPoint(Stream);
+            Point<3> Vertex3 = ReadPoint(Stream);
+            Delta.CreatedFaces.emplace_back(Vertex1, Vertex2, Vertex3);
+        }
+        return Delta;
+    }
+    catch (CollectionException) {
+        throw FileFormatException(0, "degenerate element");
+    }
+}
+
+/**********************************************************************
+【函数名称】 ApplyAll
+【函数功能】 依次读取并应用输入流中剩余的所有记录，直到流结束。
+【参数】
+    Stream: 输入流。
+    AModel: 基准模型的可变引用。
+【返回值】 无
+    如果记录无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ModelDelta::ApplyAll(istream& Stream, Model<3>& AModel) {
+    while (Stream.peek() != istream::traits_type::eof()) {
+        Read(Stream).Apply(AModel);
+    }
+}
+
+/**********************************************************************
+【函数名称】 WritePoint
+【函数功能】 以三个 double 写入一个点。
+【参数】
+    Stream: 输出流。
+    APoint: 要写入的点。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ModelDelta::WritePoint(ostream& Stream, const Point<3>& APoint) {
+    BinaryFormat::Write(Stream, APoint[0]);
+    BinaryFormat::Write(Stream, APoint[1]);
+    BinaryFormat::Write(Stream, APoint[2]);
+}
+
+/**********************************************************************
+【函数名称】 ReadPoint
+【函数功能】 读取以三个 double 存储的点。
+【参数】
+    Stream: 输入流。
+【返回值】
+    读取的点。
+    如果流提前结束，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Point<3> ModelDelta::ReadPoint(istream& Stream) {
+    double rX = BinaryFormat::Read<double>(Stream);
+    double rY = BinaryFormat::Read<double>(Stream);
+    double rZ = BinaryFormat::Read<double>(Stream);
+    return Point<3>({ rX, rY, rZ });
+}
+
+/**********************************************************************
+【函数名称】 ApplyTo
+【函数功能】 将一类元素的删除、修改、新建列表应用到集合上。
+【参数】
+    Elements: 基准集合。
+    Removed: 被删除元素在基准中的下标。
+    Modified: 被修改元素在删除后的下标与新值。
+    Created: 新建的元素。
+【返回值】
+    应用后的集合。
+    如果下标越界或不递增，或应用后元素重复，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename E>
+DynamicSet<E> ModelDelta::ApplyTo(
+    const DynamicSet<E>& Elements,
+    const vector<size_t>& Removed,
+    const vector<pair<size_t, E>>& Modified,
+    const vector<E>& Created
+) {
+    if (Removed.empty() && Modified.empty() && Created.empty()) {
+        return Elements;
+    }
+    for (size_t i = 0; i < Removed.size(); i++) {
+        if (
+            Removed[i] >= Elements.Count() ||
+            (i > 0 && Removed[i] <= Removed[i - 1])
+        ) {
+            throw FileFormatException(0, "index overflow");
+        }
+    }
+    vector<E> Result;
+    Result.reserve(Elements.Count() - Removed.size() + Created.size());
+    auto RemovedIterator = Removed.begin();
+    size_t ullIndex = 0;
+    for (auto& Element: Elements) {
+        if (RemovedIterator != Removed.end() && *RemovedIterator == ullIndex) {
+            ++RemovedIterator;
+        }
+        else {
+            Result.push_back(Element);
+        }
+        ullIndex++;
+    }
+    for (auto& Element: Modified) {
+        if (Element.first >= Result.size()) {
+            throw FileFormatException(0, "index overflow");
+        }
+        Result[Element.first] = Element.second;
+    }
+    Result.insert(Result.end(), Created.begin(), Created.end());
+    // 基准中的元素互不相同，只有修改或新建的元素可能与其他元素重复；
+    // 损坏的记录会破坏集合的约束，以哈希表在线性时间内检查
+    if (!Modified.empty() || !Created.empty()) {
+        auto GetHash = [](const E* pElement) {
+            Tools::PointHash<3> Hasher;
+            size_t ullSeed = 0;
+            for (auto& APoint: pElement->Points) {
+                ullSeed ^= Hasher(APoint) 
+                    + 0x9e3779b97f4a7c15ULL + (ullSeed << 6) + (ullSeed >> 2);
+            }
+            return ullSeed;
+        };
+        auto IsEqual = [](const E* pLeft, const E* pRight) {
+            return *pLeft == *pRight;
+        };
+        unordered_set<const E*, decltype(GetHash), decltype(IsEqual)> Seen(
+            Result.size(), 
+            GetHash, 
+            IsEqual
+        );
+        for (auto& Element: Result) {
+            if (!Seen.insert(&Element).second) {
+                throw FileFormatException(0, "duplicate element");
+            }
+        }
+    }
+    return DynamicSet<E>::FromDistinct(move(Result));
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+/*************************************************************************
+【文件名】 ModelDelta.hpp
+【功能模块和目的】 ModelDelta 类定义了两次保存之间模型的增量记录。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef MODEL_DELTA_HPP
+#define MODEL_DELTA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Containers/DynamicSet.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ModelDelta
+【功能】 记录一个三维模型相对于上一次保存（基准）的变化，
+    用于增量保存：.c3w 文件将记录追加在文件末尾，
+    其他格式将记录追加在 JOURNAL_SUFFIX 后缀的附属文件中。
+    应用记录时先删除 RemovedLines/RemovedFaces 中的基准元素，
+    剩余元素保持原有顺序，再按删除后的下标替换修改的元素，
+    最后在末尾添加新建的元素。
+    记录依次为：MAGIC，名称，线段的删除、修改、新建列表，
+    面的删除、修改、新建列表；各列表以元素个数开头，
+    点以三个 double 存储，字节序与 .c3w 文件相同。
+【接口说明】
+    成员：
+        MAGIC: 每条记录开头的标识。
+        JOURNAL_SUFFIX: 附属文件的后缀。
+        Name: 模型的名称。
+        RemovedLines, RemovedFaces: 被删除元素在基准中的下标，严格递增。
+        ModifiedLines, ModifiedFaces: 被修改元素在删除后的下标与新值。
+        CreatedLines, CreatedFaces: 新建的元素。
+    操作：
+        IsEmpty: 判断记录是否不改变任何元素。
+        Apply: 将记录应用到模型上。
+        Write: 向输出流写入记录。
+        Read: 从输入流读取一条记录。
+        ApplyAll: 依次应用输入流中剩余的所有记录。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class ModelDelta final {
+    public:
+        // 成员
+
+        // 每条记录开头的标识
+        static constexpr uint32_t MAGIC { 0x44573343 };
+        // 附属文件的后缀
+        static constexpr const char* JOURNAL_SUFFIX { ".delta" };
+        // 模型的名称
+        string Name;
+        // 被删除的线段在基准中的下标，严格递增
+        vector<size_t> RemovedLines;
+        // 被修改的线段在删除后的下标与新值
+        vector<pair<size_t, Line<3>>> ModifiedLines;
+        // 新建的线段
+        vector<Line<3>> CreatedLines;
+        // 被删除的面在基准中的下标，严格递增
+        vector<size_t> RemovedFaces;
+        // 被修改的面在删除后的下标与新值
+        vector<pair<size_t, Face<3>>> ModifiedFaces;
+        // 新建的面
+        vector<Face<3>> CreatedFaces;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 IsEmpty
+        【函数功能】 判断记录是否不删除、修改或新建任何元素。
+        【参数】 无
+        【返回值】
+            记录是否不改变任何元素，名称不参与判断。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsEmpty() const;
+        /**********************************************************************
+        【函数名称】 Apply
+        【函数功能】 将记录应用到基准模型上。不逐对查重，只以哈希表检查
+            修改与新建后元素是否重复，代价与模型的元素数成线性。
+        【参数】
+            AModel: 基准模型的可变引用。
+        【返回值】 无
+            如果下标越界或不递增，或应用后元素重复，
+            抛出 FileFormatException，此时模型保持不变。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Apply(Model<3>& AModel) const;
+        /**********************************************************************
+        【函数名称】 Write
+        【函数功能】 向输出流写入记录，代价与记录的大小成线性。
+        【参数】
+            Stream: 输出流。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Write(ostream& Stream) const;
+        /**********************************************************************
+        【函数名称】 Read
+        【函数功能】 从输入流读取一条记录。
+        【参数】
+            Stream: 输入流。
+        【返回值】
+            读取的记录。
+            如果记录无效、含有顶点重合的元素或提前结束，
+            抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static ModelDelta Read(istream& Stream);
+        /**********************************************************************
+        【函数名称】 ApplyAll
+        【函数功能】 依次读取并应用输入流中剩余的所有记录，直到流结束。
+        【参数】
+            Stream: 输入流。
+            AModel: 基准模型的可变引用。
+        【返回值】 无
+            如果记录无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void ApplyAll(istream& Stream, Model<3>& AModel);
+
+    private:
+        /**********************************************************************
+        【函数名称】 WritePoint
+        【函数功能】 以三个 double 写入一个点。
+        【参数】
+            Stream: 输出流。
+            APoint: 要写入的点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void WritePoint(ostream& Stream, const Point<3>& APoint);
+        /**********************************************************************
+        【函数名称】 ReadPoint
+        【函数功能】 读取以三个 double 存储的点。
+        【参数】
+            Stream: 输入流。
+        【返回值】
+            读取的点。
+            如果流提前结束，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Point<3> ReadPoint(istream& Stream);
+        /**********************************************************************
+        【函数名称】 ApplyTo
+        【函数功能】 将一类元素的删除、修改、新建列表应用到集合上。
+        【参数】
+            Elements: 基准集合。
+            Removed: 被删除元素在基准中的下标。
+            Modified: 被修改元素在删除后的下标与新值。
+            Created: 新建的元素。
+        【返回值】
+            应用后的集合。
+            如果下标越界或不递增，或应用后元素重复，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename E>
+        static Containers::DynamicSet<E> ApplyTo(
+            const Containers::DynamicSet<E>& Elements,
+            const vector<size_t>& Removed,
+            const vector<pair<size_t, E>>& Modified,
+            const vector<E>& Created
+        );
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -4,11 +4,20 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
-#include <fstream>
+#include <cstddef>
+#include <ostream>
+#include <utility>
+#include <vector>
 #include "../../Core/Model.hpp"
+#include "../../Mesh/IndexedMesh.hpp"
+#include "../../Mesh/VertexCache.hpp"
+#include "../ExportOptions.hpp"
+#include "../../Errors/InvalidSizeException.hpp"
 #include "ObjExporter.hpp"
 using namespace std;
 using namespace C3w;
+using namespace C3w::Errors;
+using namespace C3w::Mesh;
 using namespace C3w::Storage;
 
 namespace C3w {
@@ -19,46 +28,174 @@ namespace Obj {
 
 /**********************************************************************
 【函数名称】 InnerExport
-【函数功能】 导出指定模型到文件流中。
+【函数功能】 导出指定模型到输出流中。
 【参数】 
-    Stream: 已经打开的文件流。
+    Stream: 输出流。
     Model: 模型的引用。
+    Options: 导出选项，只使用其中的法向与是否优化顶点缓存。
 【返回值】 无
+    如果法向的面数与模型不同，抛出 InvalidSizeException。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 void ObjExporter::InnerExport(
-    ofstream& Stream,
-    const Model<3>& Model
+    ostream& Stream,
+    const Model<3>& Model,
+    const ExportOptions& Options
 ) const {
+    auto pNormals = Options.pNormals;
+    if (
+        pNormals != nullptr && 
+        pNormals->GetFaceCount() != Model.Faces.Count()
+    ) {
+        throw InvalidSizeException(
+            pNormals->GetFaceCount(),
+            Model.Faces.Count()
+        );
+    }
+
+    // 网格与 CollectPoints 都只合并精确相等的点，顶点及其顺序完全相同，
+    // 不优化顶点缓存时输出与逐个查找下标时一致，且查找下标为常数时间
+    IndexedMesh<3> AMesh(Model);
+    vector<size_t> FaceOrder;
+    if (Options.bOptimizeVertexCache) {
+        AMesh = VertexCache::Optimize(AMesh, FaceOrder);
+    }
+
     Stream << "g " << Model.Name << endl;
     
-    auto Points = Model.CollectPoints();
-    for (auto& Point: Points) {
+    for (auto& Point: AMesh.GetVertices()) {
         Stream << "v";
         Stream << " " << Point[0];
         Stream << " " << Point[1];
         Stream << " " << Point[2] << endl;
     }
 
-    for (auto& Line: Model.Lines) {
+    // 顶点法向按 Normals 中的顺序写出，面以 v//vn 引用
+    if (pNormals != nullptr) {
+        for (size_t i = 0; i < pNormals->GetVertexCount(); i++) {
+            auto Normal = pNormals->GetVertexNormal(i);
+            Stream << "vn";
+            Stream << " " << Normal[0];
+            Stream << " " << Normal[1];
+            Stream << " " << Normal[2] << endl;
+        }
+    }
+
+    // 相连的线段合并为折线 l a b c ...
+    for (auto& Polyline: GetPolylines(AMesh)) {
         Stream << "l";
-        for (auto& Point: Line.Points) {
-            Stream << " ";
-            Stream << Points.FindIndex(Point) + 1;
+        for (size_t ullIndex: Polyline) {
+            Stream << " " << ullIndex + 1;
         }
         Stream << endl;
     }
 
-    for (auto& Face: Model.Faces) {
+    for (size_t i = 0; i < AMesh.GetFaceCount(); i++) {
+        auto& Indices = AMesh.GetFace(i);
+        // 法向按模型中面的原下标存储
+        size_t ullFace = FaceOrder.empty() ? i : FaceOrder[i];
         Stream << "f";
-        for (auto& Point: Face.Points) {
+        for (size_t j = 0; j < 3; j++) {
             Stream << " ";
-            Stream << Points.FindIndex(Point) + 1;
+            Stream << Indices[j] + 1;
+            if (pNormals != nullptr) {
+                Stream << "//" << pNormals->GetCorners(ullFace)[j] + 1;
+            }
         }
         Stream << endl;
     }
 }
 
+/**********************************************************************
+【函数名称】 CanRoundTrip
+【函数功能】 判断以指定选项导出的文件再导入时能否还原模型。
+【参数】
+    Model: 要导出的模型。
+    Options: 导出选项。
+【返回值】
+    模型没有线段且不优化顶点缓存时为真。线段合并为折线后，
+    再导入时的顺序与方向可能改变。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ObjExporter::CanRoundTrip(
+    const Model<3>& Model,
+    const ExportOptions& Options
+) const {
+    return Model.Lines.Count() == 0 && !Options.bOptimizeVertexCache;
+}
+
+/**********************************************************************
+【函数名称】 GetPolylines
+【函数功能】 将相连的线段合并为尽量长的折线。先从相邻线段数为奇数的
+    顶点出发，每次沿任一未写出的线段前进，直到无路可走；剩余的线段
+    构成闭合的环，再从其中任一顶点出发。时间与线段数成线性。
+【参数】
+    AMesh: 共享顶点的网格。
+【返回值】
+    折线的顶点下标序列，每条线段恰好出现在一条折线中。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+vector<vector<size_t>> ObjExporter::GetPolylines(
+    const IndexedMesh<3>& AMesh
+) {
+    auto& Lines = AMesh.GetLines();
+    size_t ullVertexCount = AMesh.GetVertexCount();
+    // 以压缩行存储每个顶点的相邻线段
+    vector<size_t> Offsets(ullVertexCount + 1, 0);
+    for (auto& ALine: Lines) {
+        Offsets[ALine[0] + 1]++;
+        Offsets[ALine[1] + 1]++;
+    }
+    for (size_t i = 0; i < ullVertexCount; i++) {
+        Offsets[i + 1] += Offsets[i];
+    }
+    vector<size_t> Adjacency(Offsets.back());
+    vector<size_t> Cursors(Offsets.begin(), Offsets.end() - 1);
+    for (size_t i = 0; i < Lines.size(); i++) {
+        Adjacency[Cursors[Lines[i][0]]++] = i;
+        Adjacency[Cursors[Lines[i][1]]++] = i;
+    }
+    // 游标之前的相邻线段都已写出，每条线段只被跳过常数次
+    Cursors.assign(Offsets.begin(), Offsets.end() - 1);
+    vector<bool> Written(Lines.size(), false);
+    vector<vector<size_t>> Polylines;
+    auto Walk = [&](size_t Start) {
+        vector<size_t> Polyline { Start };
+        size_t ullCurrent = Start;
+        while (true) {
+            size_t& ullCursor = Cursors[ullCurrent];
+            while (
+                ullCursor < Offsets[ullCurrent + 1] && 
+                Written[Adjacency[ullCursor]]
+            ) {
+                ullCursor++;
+            }
+            if (ullCursor == Offsets[ullCurrent + 1]) {
+                break;
+            }
+            size_t ullLine = Adjacency[ullCursor];
+            Written[ullLine] = true;
+            ullCurrent = Lines[ullLine][0] == ullCurrent 
+                ? Lines[ullLine][1] 
+                : Lines[ullLine][0];
+            Polyline.push_back(ullCurrent);
+        }
+        if (Polyline.size() > 1) {
+            Polylines.push_back(move(Polyline));
+        }
+    };
+    // 折线的端点只能是奇数度的顶点，先从它们出发
+    for (size_t i = 0; i < ullVertexCount; i++) {
+        if ((Offsets[i + 1] - Offsets[i]) % 2 == 1) {
+            Walk(i);
+        }
+    }
+    for (auto& ALine: Lines) {
+        Walk(ALine[0]);
+    }
+    return Polylines;
+}
+
 }
 
 }
@@ -7,9 +7,13 @@
 #ifndef OBJ_EXPORTER_HPP
 #define OBJ_EXPORTER_HPP
 
-#include <fstream>
+#include <cstddef>
+#include <ostream>
+#include <vector>
 #include "../ExporterBase.hpp"
+#include "../ExportOptions.hpp"
 #include "../../Core/Model.hpp"
+#include "../../Mesh/IndexedMesh.hpp"
 using namespace std;
 using namespace C3w;
 using namespace C3w::Storage;
@@ -27,23 +31,62 @@ namespace Obj {
     继承于 C3w::Storage::ExporterBase<3>:
         继承全部接口。
         实现 InnerExport。
+        重写 CanRoundTrip。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 class ObjExporter: public ExporterBase<3> {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 CanRoundTrip
+        【函数功能】 判断以指定选项导出的文件再导入时能否还原模型。
+        【参数】
+            Model: 要导出的模型。
+            Options: 导出选项。
+        【返回值】
+            模型没有线段且不优化顶点缓存时为真。线段合并为折线后，
+            再导入时的顺序与方向可能改变。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool CanRoundTrip(
+            const Model<3>& Model,
+            const ExportOptions& Options
+        ) const override;
+
     protected:
         /**********************************************************************
         【函数名称】 InnerExport
-        【函数功能】 导出指定模型到文件流中。
+        【函数功能】 导出指定模型到输出流中。
         【参数】 
-            Stream: 已经打开的文件流。
+            Stream: 输出流。
             Model: 模型的引用。
+            Options: 导出选项，只使用其中的法向与是否优化顶点缓存。
         【返回值】 无
+            如果法向的面数与模型不同，抛出 InvalidSizeException。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         void InnerExport(
-            ofstream& Stream, 
-            const Model<3>& Model
+            ostream& Stream, 
+            const Model<3>& Model,
+            const ExportOptions& Options
         ) const override;
+
+    private:
+        /**********************************************************************
+        【函数名称】 GetPolylines
+        【函数功能】 将相连的线段合并为尽量长的折线。先从相邻线段数为奇数的
+            顶点出发，每次沿任一未写出的线段前进，直到无路可走；剩余的线段
+            构成闭合的环，再从其中任一顶点出发。时间与线段数成线性。
+        【参数】
+            AMesh: 共享顶点的网格。
+        【返回值】
+            折线的顶点下标序列，每条线段恰好出现在一条折线中。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static vector<vector<size_t>> GetPolylines(
+            const Mesh::IndexedMesh<3>& AMesh
+        );
 };
 
 }
@@ -4,12 +4,14 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
-#include <fstream>
+#include <cctype>
+#include <cstddef>
+#include <istream>
 #include <sstream>
 #include <string>
 #include <vector>
 #include "ObjImporter.hpp"
-#include "../../Core/Model.hpp"
+#include "../ImportVisitor.hpp"
 #include "../../Core/Point.hpp"
 #include "../../Core/Line.hpp"
 #include "../../Core/Face.hpp"
@@ -25,20 +27,24 @@ namespace Storage {
 namespace Obj {
 
 /**********************************************************************
-【函数名称】 InnerImport
-【函数功能】 导入指定文件流到模型中。
+【函数名称】 InnerVisit
+【函数功能】 逐行解析输入流，将记录逐条交给访问者。
+    只保留顶点表用于解析下标。
 【参数】 
-    Stream: 已经打开的文件流。
-    Model: 模型的可变引用。
+    Stream: 输入流。
+    Visitor: 接收记录的访问者。
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-void ObjImporter::InnerImport(ifstream& Stream, Model<3>& Model) const {
+void ObjImporter::InnerVisit(
+    istream& Stream,
+    ImportVisitor<3>& Visitor
+) const {
     vector<Point<3>> Points;
     unsigned int uLineNumber = 0;
-    while (!Stream.eof()) {
-        string LineString;
-        getline(Stream, LineString);
+    string LineString;
+    // 以读取是否成功为条件，使无法读取的流（如断开的管道）也能结束
+    while (getline(Stream, LineString)) {
         uLineNumber++;
         if (LineString.empty()) continue;
         istringstream LineStream(LineString);
@@ -50,10 +56,16 @@ void ObjImporter::InnerImport(ifstream& Stream, Model<3>& Model) const {
             }
             case 'g' : {
                 LineStream.ignore();
-                getline(LineStream, Model.Name);
+                string Name;
+                getline(LineStream, Name);
+                Visitor.VisitName(Name);
                 break;
             }
             case 'v' : {
+                // vn、vt 等其他顶点属性不影响模型，忽略
+                if (!isspace(LineStream.peek())) {
+                    break;
+                }
                 double x;
                 double y;
                 double z;
@@ -65,31 +77,51 @@ void ObjImporter::InnerImport(ifstream& Stream, Model<3>& Model) const {
                     );
                 }
                 Points.push_back(Point<3> { x, y, z });
+                Visitor.VisitVertex(Points.back());
                 break;
             }
             case 'l' : {
-                size_t ullIndices[2];
-                LineStream >> ullIndices[0] >> ullIndices[1];
-                if (LineStream.bad()) {
+                // 折线 l a b c ... 展开为线段 (a, b)、(b, c) ...
+                size_t ullPrevious = 0;
+                size_t ullCount = 0;
+                while (!(LineStream >> ws).eof()) {
+                    size_t ullIndex = ReadIndex(LineStream);
+                    if (LineStream.bad()) {
+                        throw FileFormatException(
+                            uLineNumber,
+                            "cannot parse indices"
+                        );
+                    }
+                    if (ullIndex == 0 || ullIndex > Points.size()) {
+                        throw FileFormatException(
+                            uLineNumber, 
+                            "index overflow"
+                        );
+                    }
+                    if (ullCount > 0) {
+                        Visitor.VisitLine(
+                            Line<3>(
+                                Points[ullPrevious - 1], 
+                                Points[ullIndex - 1]
+                            )
+                        );
+                    }
+                    ullPrevious = ullIndex;
+                    ullCount++;
+                }
+                if (ullCount < 2) {
                     throw FileFormatException(
                         uLineNumber,
                         "cannot parse indices"
                     );
                 }
-                if (
-                    (ullIndices[0] == 0 || ullIndices[0] > Points.size()) ||
-                    (ullIndices[1] == 0 || ullIndices[1] > Points.size())
-                ) {
-                    throw FileFormatException(uLineNumber, "index overflow");
-                }
-                Model.Lines.Add(
-                    Line<3>(Points[ullIndices[0]-1], Points[ullIndices[1]-1])
-                );
                 break;
             }
             case 'f' : {
                 size_t ullIndices[3];
-                LineStream >> ullIndices[0] >> ullIndices[1] >> ullIndices[2];
+                for (auto& ullIndex: ullIndices) {
+                    ullIndex = ReadIndex(LineStream);
+                }
                 if (LineStream.bad()) {
                     throw FileFormatException(
                         uLineNumber,
@@ -103,7 +135,7 @@ void ObjImporter::InnerImport(ifstream& Stream, Model<3>& Model) const {
                 ) {
                     throw FileFormatException(uLineNumber, "index overflow");
                 }
-                Model.Faces.Add(
+                Visitor.VisitFace(
                     Face<3>(
                         Points[ullIndices[0]-1], 
                         Points[ullIndices[1]-1], 
@@ -122,6 +154,30 @@ void ObjImporter::InnerImport(ifstream& Stream, Model<3>& Model) const {
     }
 }
 
+/**********************************************************************
+【函数名称】 ReadIndex
+【函数功能】 读取 l/f 记录中的一个顶点下标。下标后的 "/纹理/法向"
+    部分被跳过，法向在需要时重新计算。
+【参数】
+    LineStream: 当前行的字符串流。
+【返回值】
+    顶点下标（从 1 开始），无法解析时为 0。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t ObjImporter::ReadIndex(istringstream& LineStream) {
+    size_t ullIndex = 0;
+    if (!(LineStream >> ullIndex)) {
+        return 0;
+    }
+    while (
+        LineStream.peek() != char_traits<char>::eof() && 
+        !isspace(LineStream.peek())
+    ) {
+        LineStream.get();
+    }
+    return ullIndex;
+}
+
 }
 
 }
@@ -7,9 +7,11 @@
 #ifndef OBJ_IMPORTER_HPP
 #define OBJ_IMPORTER_HPP
 
-#include <fstream>
+#include <cstddef>
+#include <istream>
+#include <sstream>
 #include "../ImporterBase.hpp"
-#include "../../Core/Model.hpp"
+#include "../ImportVisitor.hpp"
 using namespace std;
 using namespace C3w;
 using namespace C3w::Storage;
@@ -26,21 +28,38 @@ namespace Obj {
 【接口说明】 
     继承于 C3w::Storage::ImporterBase<3>:
         继承全部接口。
-        实现 InnerImport。
+        实现 InnerVisit，InnerImport 使用默认实现。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 class ObjImporter: public ImporterBase<3> {
     protected:
         /**********************************************************************
-        【函数名称】 InnerImport
-        【函数功能】 导入指定文件流到模型中。
+        【函数名称】 InnerVisit
+        【函数功能】 逐行解析输入流，将记录逐条交给访问者。
+            只保留顶点表用于解析下标。
         【参数】 
-            Stream: 已经打开的文件流。
-            Model: 模型的可变引用。
+            Stream: 输入流。
+            Visitor: 接收记录的访问者。
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void InnerImport(ifstream& Stream, Model<3>& Model) const override;
+        void InnerVisit(
+            istream& Stream,
+            ImportVisitor<3>& Visitor
+        ) const override;
+
+    private:
+        /**********************************************************************
+        【函数名称】 ReadIndex
+        【函数功能】 读取 l/f 记录中的一个顶点下标。下标后的 "/纹理/法向"
+            部分被跳过，法向在需要时重新计算。
+        【参数】
+            LineStream: 当前行的字符串流。
+        【返回值】
+            顶点下标（从 1 开始），无法解析时为 0。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static size_t ReadIndex(istringstream& LineStream);
 };
 
 }
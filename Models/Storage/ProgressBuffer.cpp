@@ -0,0 +1,189 @@
+/*************************************************************************
+【文件名】 ProgressBuffer.cpp
+【功能模块和目的】 为 ProgressBuffer.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <functional>
+#include <streambuf>
+#include <utility>
+#include <vector>
+#include "ProgressBuffer.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+// 每块的字节数
+constexpr size_t ProgressBuffer::BUFFER_SIZE;
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用被包装的缓冲区与回调初始化 ProgressBuffer 对象。
+【参数】
+    Inner: 被包装的缓冲区，使用期间必须有效。
+    OnProgress: 形如 bool(size_t ProcessedBytes) 的函数，
+        返回假时取消，为空时从不取消。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ProgressBuffer::ProgressBuffer(
+    streambuf& Inner,
+    function<bool(size_t)> OnProgress
+): m_Inner(Inner),
+   m_OnProgress(move(OnProgress)),
+   m_Buffer(BUFFER_SIZE),
+   m_ullProcessedBytes(0),
+   m_bCancelled(false) {
+    // 读取区初始为空，第一次读取即调用 underflow
+    setg(m_Buffer.data(), m_Buffer.data(), m_Buffer.data());
+    setp(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+}
+
+/**********************************************************************
+【函数名称】 析构函数
+【函数功能】 写入剩余的数据。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ProgressBuffer::~ProgressBuffer() {
+    Flush();
+}
+
+/**********************************************************************
+【函数名称】 GetProcessedBytes
+【函数功能】 获取已从被包装缓冲区读入或向其写出的字节数。
+【参数】 无
+【返回值】
+    已处理的字节数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t ProgressBuffer::GetProcessedBytes() const {
+    return m_ullProcessedBytes;
+}
+
+/**********************************************************************
+【函数名称】 IsCancelled
+【函数功能】 判断回调是否已要求取消。
+【参数】 无
+【返回值】
+    是否已被取消。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ProgressBuffer::IsCancelled() const {
+    return m_bCancelled;
+}
+
+/**********************************************************************
+【函数名称】 underflow
+【函数功能】 从被包装的缓冲区读入下一块并报告进度。
+【参数】 无
+【返回值】
+    下一个字符，没有更多数据或已取消时为 traits_type::eof()。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ProgressBuffer::int_type ProgressBuffer::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+    if (m_bCancelled) {
+        return traits_type::eof();
+    }
+    streamsize llCount = m_Inner.sgetn(m_Buffer.data(), m_Buffer.size());
+    if (llCount <= 0) {
+        return traits_type::eof();
+    }
+    if (!Report(static_cast<size_t>(llCount))) {
+        return traits_type::eof();
+    }
+    setg(m_Buffer.data(), m_Buffer.data(), m_Buffer.data() + llCount);
+    return traits_type::to_int_type(*gptr());
+}
+
+/**********************************************************************
+【函数名称】 overflow
+【函数功能】 向被包装的缓冲区写出已缓存的一块并报告进度，
+    再缓存字符。
+【参数】
+    Char: 要写入的字符，为 traits_type::eof() 时只写出。
+【返回值】
+    成功时为非 traits_type::eof() 的值，
+    写出失败或已取消时为 traits_type::eof()。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ProgressBuffer::int_type ProgressBuffer::overflow(int_type Char) {
+    if (!Flush()) {
+        return traits_type::eof();
+    }
+    if (traits_type::eq_int_type(Char, traits_type::eof())) {
+        return traits_type::not_eof(Char);
+    }
+    *pptr() = traits_type::to_char_type(Char);
+    pbump(1);
+    return Char;
+}
+
+/**********************************************************************
+【函数名称】 sync
+【函数功能】 写出已缓存的数据并同步被包装的缓冲区。
+【参数】 无
+【返回值】
+    成功时为 0，失败或已取消时为 -1。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+int ProgressBuffer::sync() {
+    if (!Flush()) {
+        return -1;
+    }
+    return m_Inner.pubsync();
+}
+
+/**********************************************************************
+【函数名称】 Report
+【函数功能】 累计处理的字节数并调用回调。
+【参数】
+    Count: 本次处理的字节数。
+【返回值】
+    是否仍未被取消。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ProgressBuffer::Report(size_t Count) {
+    m_ullProcessedBytes += Count;
+    if (m_OnProgress && !m_OnProgress(m_ullProcessedBytes)) {
+        m_bCancelled = true;
+    }
+    return !m_bCancelled;
+}
+
+/**********************************************************************
+【函数名称】 Flush
+【函数功能】 向被包装的缓冲区写出已缓存的数据。
+【参数】 无
+【返回值】
+    是否全部写出且仍未被取消。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool ProgressBuffer::Flush() {
+    streamsize llCount = pptr() - pbase();
+    if (m_bCancelled) {
+        // 丢弃取消后缓存的数据
+        setp(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+        return false;
+    }
+    if (llCount == 0) {
+        return true;
+    }
+    streamsize llWritten = m_Inner.sputn(pbase(), llCount);
+    setp(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+    if (llWritten != llCount) {
+        return false;
+    }
+    return Report(static_cast<size_t>(llCount));
+}
+
+}
+
+}
\ No newline at end of file
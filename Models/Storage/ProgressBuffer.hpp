@@ -0,0 +1,173 @@
+/*************************************************************************
+【文件名】 ProgressBuffer.hpp
+【功能模块和目的】 ProgressBuffer 类统计经过另一流缓冲区的字节数，
+    并支持协作式取消。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef PROGRESS_BUFFER_HPP
+#define PROGRESS_BUFFER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <streambuf>
+#include <vector>
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ProgressBuffer
+【功能】 包装另一流缓冲区，以 BUFFER_SIZE 字节为单位读取或写入，
+    每读入或写出一块即以累计的字节数调用回调。回调返回假时视为取消：
+    读取方向此后总是报告文件结束，写入方向此后总是写入失败，
+    导入/导出器因而尽快结束，调用者再丢弃其结果。
+    同一对象只应用于一个方向。不拥有被包装缓冲区的所有权。
+【接口说明】
+    继承于 std::streambuf:
+        重写 underflow、overflow、sync。
+    成员：
+        BUFFER_SIZE: 每块的字节数。
+    构造与析构：
+        接受被包装缓冲区与回调的构造函数。
+        删除拷贝构造函数。
+        析构函数，写入剩余的数据。
+    属性：
+        GetProcessedBytes: 获取已读入或写出的字节数。
+        IsCancelled: 判断是否已被取消。
+    操作符：
+        删除赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class ProgressBuffer final: public streambuf {
+    public:
+        // 成员
+
+        // 每块的字节数
+        static constexpr size_t BUFFER_SIZE { 1 << 16 };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用被包装的缓冲区与回调初始化 ProgressBuffer 对象。
+        【参数】
+            Inner: 被包装的缓冲区，使用期间必须有效。
+            OnProgress: 形如 bool(size_t ProcessedBytes) 的函数，
+                返回假时取消，为空时从不取消。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        ProgressBuffer(
+            streambuf& Inner,
+            function<bool(size_t)> OnProgress
+        );
+        // 删除拷贝构造函数
+        ProgressBuffer(const ProgressBuffer& Other) = delete;
+        /**********************************************************************
+        【函数名称】 析构函数
+        【函数功能】 写入剩余的数据。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        ~ProgressBuffer();
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetProcessedBytes
+        【函数功能】 获取已从被包装缓冲区读入或向其写出的字节数。
+        【参数】 无
+        【返回值】
+            已处理的字节数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetProcessedBytes() const;
+        /**********************************************************************
+        【函数名称】 IsCancelled
+        【函数功能】 判断回调是否已要求取消。
+        【参数】 无
+        【返回值】
+            是否已被取消。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsCancelled() const;
+
+        // 操作符
+
+        // 删除赋值运算符
+        ProgressBuffer& operator=(const ProgressBuffer& Other) = delete;
+
+    protected:
+        /**********************************************************************
+        【函数名称】 underflow
+        【函数功能】 从被包装的缓冲区读入下一块并报告进度。
+        【参数】 无
+        【返回值】
+            下一个字符，没有更多数据或已取消时为 traits_type::eof()。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        int_type underflow() override;
+        /**********************************************************************
+        【函数名称】 overflow
+        【函数功能】 向被包装的缓冲区写出已缓存的一块并报告进度，
+            再缓存字符。
+        【参数】
+            Char: 要写入的字符，为 traits_type::eof() 时只写出。
+        【返回值】
+            成功时为非 traits_type::eof() 的值，
+            写出失败或已取消时为 traits_type::eof()。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        int_type overflow(int_type Char) override;
+        /**********************************************************************
+        【函数名称】 sync
+        【函数功能】 写出已缓存的数据并同步被包装的缓冲区。
+        【参数】 无
+        【返回值】
+            成功时为 0，失败或已取消时为 -1。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        int sync() override;
+
+    private:
+        // 被包装的缓冲区
+        streambuf& m_Inner;
+        // 进度回调
+        function<bool(size_t)> m_OnProgress;
+        // 读取或写入使用的块
+        vector<char> m_Buffer;
+        // 已处理的字节数
+        size_t m_ullProcessedBytes;
+        // 是否已被取消
+        bool m_bCancelled;
+
+        /**********************************************************************
+        【函数名称】 Report
+        【函数功能】 累计处理的字节数并调用回调。
+        【参数】
+            Count: 本次处理的字节数。
+        【返回值】
+            是否仍未被取消。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool Report(size_t Count);
+        /**********************************************************************
+        【函数名称】 Flush
+        【函数功能】 向被包装的缓冲区写出已缓存的数据。
+        【参数】 无
+        【返回值】
+            是否全部写出且仍未被取消。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool Flush();
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
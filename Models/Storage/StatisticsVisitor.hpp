@@ -0,0 +1,194 @@
+/*************************************************************************
+【文件名】 StatisticsVisitor.hpp
+【功能模块和目的】 StatisticsVisitor 类在流式导入时统计模型信息。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef STATISTICS_VISITOR_HPP
+#define STATISTICS_VISITOR_HPP
+
+#include <cstddef>
+#include <string>
+#include "ImportVisitor.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/CompensatedSum.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 StatisticsVisitor
+【功能】 统计顶点、线段与面的个数，线段的总长与面的总面积，
+    不保留任何记录，内存占用为常数。总长与总面积使用补偿求和。
+【接口说明】
+    继承于 C3w::Storage::ImportVisitor<N, T>:
+        重写所有访问函数。
+    构造与析构：
+        默认构造函数。
+        拷贝构造函数。
+    属性：
+        GetName: 获取模型的名称。
+        GetVertexCount: 获取顶点的个数。
+        GetLineCount: 获取线段的个数。
+        GetTotalLineLength: 获取线段的总长。
+        GetFaceCount: 获取面的个数。
+        GetTotalFaceArea: 获取面的总面积。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N, typename T = double>
+class StatisticsVisitor final: public ImportVisitor<N, T> {
+    public:
+        // 构造函数
+
+        // 默认构造函数
+        StatisticsVisitor() = default;
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一统计结果初始化 StatisticsVisitor 对象。
+        【参数】
+            Other: 另一个统计结果。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        StatisticsVisitor(const StatisticsVisitor<N, T>& Other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetName
+        【函数功能】 获取模型的名称。
+        【参数】 无
+        【返回值】
+            最后接收到的名称，未接收到时为空。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const string& GetName() const;
+        /**********************************************************************
+        【函数名称】 GetVertexCount
+        【函数功能】 获取顶点的个数。
+        【参数】 无
+        【返回值】
+            文件中顶点的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetVertexCount() const;
+        /**********************************************************************
+        【函数名称】 GetLineCount
+        【函数功能】 获取线段的个数。
+        【参数】 无
+        【返回值】
+            线段的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetLineCount() const;
+        /**********************************************************************
+        【函数名称】 GetTotalLineLength
+        【函数功能】 获取线段的总长。
+        【参数】 无
+        【返回值】
+            所有线段长度之和。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        double GetTotalLineLength() const;
+        /**********************************************************************
+        【函数名称】 GetFaceCount
+        【函数功能】 获取面的个数。
+        【参数】 无
+        【返回值】
+            面的个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetFaceCount() const;
+        /**********************************************************************
+        【函数名称】 GetTotalFaceArea
+        【函数功能】 获取面的总面积。
+        【参数】 无
+        【返回值】
+            所有面面积之和。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        double GetTotalFaceArea() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 VisitName
+        【函数功能】 记录模型的名称。
+        【参数】
+            Name: 模型的名称。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void VisitName(const string& Name) override;
+        /**********************************************************************
+        【函数名称】 VisitVertex
+        【函数功能】 计数一个顶点。
+        【参数】
+            Vertex: 顶点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void VisitVertex(const Point<N, T>& Vertex) override;
+        /**********************************************************************
+        【函数名称】 VisitLine
+        【函数功能】 计数一条线段并累加其长度。
+        【参数】
+            ALine: 线段。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void VisitLine(const Line<N, T>& ALine) override;
+        /**********************************************************************
+        【函数名称】 VisitFace
+        【函数功能】 计数一个面并累加其面积。
+        【参数】
+            AFace: 面。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void VisitFace(const Face<N, T>& AFace) override;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一统计结果赋值给自身。
+        【参数】
+            Other: 从之取值的统计结果。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        StatisticsVisitor<N, T>& operator=(
+            const StatisticsVisitor<N, T>& Other
+        ) = default;
+
+    private:
+        // 模型的名称
+        string m_Name;
+        // 顶点的个数
+        size_t m_ullVertexCount { 0 };
+        // 线段的个数
+        size_t m_ullLineCount { 0 };
+        // 线段的总长
+        Tools::CompensatedSum m_LineLength;
+        // 面的个数
+        size_t m_ullFaceCount { 0 };
+        // 面的总面积
+        Tools::CompensatedSum m_FaceArea;
+};
+
+}
+
+}
+
+#include "StatisticsVisitor.tpp"
+
+#endif
\ No newline at end of file
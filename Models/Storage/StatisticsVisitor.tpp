@@ -0,0 +1,155 @@
+/*************************************************************************
+【文件名】 StatisticsVisitor.tpp
+【功能模块和目的】 为 StatisticsVisitor.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <string>
+#include "StatisticsVisitor.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/CompensatedSum.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/**********************************************************************
+【函数名称】 GetName
+【函数功能】 获取模型的名称。
+【参数】 无
+【返回值】
+    最后接收到的名称，未接收到时为空。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+const string& StatisticsVisitor<N, T>::GetName() const {
+    return m_Name;
+}
+
+/**********************************************************************
+【函数名称】 GetVertexCount
+【函数功能】 获取顶点的个数。
+【参数】 无
+【返回值】
+    文件中顶点的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+size_t StatisticsVisitor<N, T>::GetVertexCount() const {
+    return m_ullVertexCount;
+}
+
+/**********************************************************************
+【函数名称】 GetLineCount
+【函数功能】 获取线段的个数。
+【参数】 无
+【返回值】
+    线段的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+size_t StatisticsVisitor<N, T>::GetLineCount() const {
+    return m_ullLineCount;
+}
+
+/**********************************************************************
+【函数名称】 GetTotalLineLength
+【函数功能】 获取线段的总长。
+【参数】 无
+【返回值】
+    所有线段长度之和。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+double StatisticsVisitor<N, T>::GetTotalLineLength() const {
+    return m_LineLength.GetValue();
+}
+
+/**********************************************************************
+【函数名称】 GetFaceCount
+【函数功能】 获取面的个数。
+【参数】 无
+【返回值】
+    面的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+size_t StatisticsVisitor<N, T>::GetFaceCount() const {
+    return m_ullFaceCount;
+}
+
+/**********************************************************************
+【函数名称】 GetTotalFaceArea
+【函数功能】 获取面的总面积。
+【参数】 无
+【返回值】
+    所有面面积之和。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+double StatisticsVisitor<N, T>::GetTotalFaceArea() const {
+    return m_FaceArea.GetValue();
+}
+
+/**********************************************************************
+【函数名称】 VisitName
+【函数功能】 记录模型的名称。
+【参数】
+    Name: 模型的名称。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void StatisticsVisitor<N, T>::VisitName(const string& Name) {
+    m_Name = Name;
+}
+
+/**********************************************************************
+【函数名称】 VisitVertex
+【函数功能】 计数一个顶点。
+【参数】
+    Vertex: 顶点。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void StatisticsVisitor<N, T>::VisitVertex(const Point<N, T>& Vertex) {
+    m_ullVertexCount++;
+}
+
+/**********************************************************************
+【函数名称】 VisitLine
+【函数功能】 计数一条线段并累加其长度。
+【参数】
+    ALine: 线段。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void StatisticsVisitor<N, T>::VisitLine(const Line<N, T>& ALine) {
+    m_ullLineCount++;
+    m_LineLength += ALine.GetLength();
+}
+
+/**********************************************************************
+【函数名称】 VisitFace
+【函数功能】 计数一个面并累加其面积。
+【参数】
+    AFace: 面。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N, typename T>
+void StatisticsVisitor<N, T>::VisitFace(const Face<N, T>& AFace) {
+    m_ullFaceCount++;
+    m_FaceArea += AFace.GetArea();
+}
+
+}
+
+}
\ No newline at end of file
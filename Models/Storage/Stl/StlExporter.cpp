@@ -0,0 +1,133 @@
+/*************************************************************************
+【文件名】 StlExporter.cpp
+【功能模块和目的】 为 StlExporter.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <vector>
+#include "StlExporter.hpp"
+#include "StlFormat.hpp"
+#include "../ExportOptions.hpp"
+#include "../../Core/Model.hpp"
+#include "../../Errors/InvalidSizeException.hpp"
+#include "../../Mesh/Normals.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Errors;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Stl {
+
+/**********************************************************************
+【函数名称】 InnerExport
+【函数功能】 导出指定模型到输出流中。
+【参数】
+    Stream: 输出流。
+    Model: 模型的引用。
+    Options: 导出选项，只使用其中的法向；未给出法向时由
+        三个顶点求面的单位法向。
+【返回值】 无
+    如果法向的面数与模型不同，或面数超过 32 位整数的范围，
+    抛出 InvalidSizeException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void StlExporter::InnerExport(
+    ostream& Stream,
+    const Model<3>& Model,
+    const ExportOptions& Options
+) const {
+    size_t ullCount = Model.Faces.Count();
+    auto pNormals = Options.pNormals;
+    if (pNormals != nullptr && pNormals->GetFaceCount() != ullCount) {
+        throw InvalidSizeException(pNormals->GetFaceCount(), ullCount);
+    }
+    if (ullCount > numeric_limits<uint32_t>::max()) {
+        throw InvalidSizeException(
+            ullCount,
+            numeric_limits<uint32_t>::max()
+        );
+    }
+    // 整个文件编码到一块缓冲区，属性字节数与文件头的空余部分保持为 0
+    size_t ullHeaderSize = StlFormat::HEADER_SIZE + sizeof(uint32_t);
+    vector<char> Buffer(ullHeaderSize + ullCount * StlFormat::RECORD_SIZE);
+    memcpy(
+        Buffer.data(),
+        Model.Name.data(),
+        min(Model.Name.size(), StlFormat::HEADER_SIZE)
+    );
+    uint32_t ulCount = static_cast<uint32_t>(ullCount);
+    memcpy(Buffer.data() + StlFormat::HEADER_SIZE, &ulCount, sizeof(ulCount));
+    char* pRecord = Buffer.data() + ullHeaderSize;
+    size_t ullFace = 0;
+    for (auto& AFace: Model.Faces) {
+        // 法向与三个顶点，共 12 个单精度浮点数
+        float Values[12];
+        if (pNormals != nullptr) {
+            auto Normal = pNormals->GetFaceNormal(ullFace);
+            for (size_t k = 0; k < 3; k++) {
+                Values[k] = static_cast<float>(Normal[k]);
+            }
+        }
+        else {
+            double rEdges[2][3];
+            for (size_t k = 0; k < 3; k++) {
+                rEdges[0][k] = AFace[1][k] - AFace[0][k];
+                rEdges[1][k] = AFace[2][k] - AFace[0][k];
+            }
+            double rNormal[3] {
+                rEdges[0][1] * rEdges[1][2] - rEdges[0][2] * rEdges[1][1],
+                rEdges[0][2] * rEdges[1][0] - rEdges[0][0] * rEdges[1][2],
+                rEdges[0][0] * rEdges[1][1] - rEdges[0][1] * rEdges[1][0]
+            };
+            double rLength = sqrt(
+                rNormal[0] * rNormal[0] +
+                rNormal[1] * rNormal[1] +
+                rNormal[2] * rNormal[2]
+            );
+            // 面积为 0 的面写出零向量，读取的软件会自行计算
+            for (size_t k = 0; k < 3; k++) {
+                Values[k] = rLength > 0
+                    ? static_cast<float>(rNormal[k] / rLength)
+                    : 0.0f;
+            }
+        }
+        for (size_t j = 0; j < 3; j++) {
+            for (size_t k = 0; k < 3; k++) {
+                Values[3 + j * 3 + k] = static_cast<float>(AFace[j][k]);
+            }
+        }
+        memcpy(pRecord, Values, sizeof(Values));
+        pRecord += StlFormat::RECORD_SIZE;
+        ullFace++;
+    }
+    Stream.write(Buffer.data(), Buffer.size());
+}
+
+/**********************************************************************
+【函数名称】 IsBinary
+【函数功能】 判断是否以二进制方式打开文件。
+【参数】 无
+【返回值】
+    总是为真。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool StlExporter::IsBinary() const {
+    return true;
+}
+
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+/*************************************************************************
+【文件名】 StlExporter.hpp
+【功能模块和目的】 StlExporter 类定义了一个二进制 .stl 文件的导出器。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef STL_EXPORTER_HPP
+#define STL_EXPORTER_HPP
+
+#include <ostream>
+#include "../ExporterBase.hpp"
+#include "../ExportOptions.hpp"
+#include "../../Core/Model.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Stl {
+
+/*************************************************************************
+【类名】 StlExporter
+【功能】 定义一个二进制 .stl 文件的导出器。
+    整个文件先编码到一块缓冲区中，再一次写入输出流。
+    名称写入文件头，超过 80 字节的部分被截断；.stl 文件没有线段，
+    模型中的线段被忽略。坐标以单精度存储，且导入时合并顶点，
+    因此不重写 CanRoundTrip，导出的文件不能作为增量保存的基准。
+【接口说明】
+    继承于 C3w::Storage::ExporterBase<3>:
+        继承全部接口。
+        实现 InnerExport。
+        重写 IsBinary。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class StlExporter: public ExporterBase<3> {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 IsBinary
+        【函数功能】 判断是否以二进制方式打开文件。
+        【参数】 无
+        【返回值】
+            总是为真。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsBinary() const override;
+
+    protected:
+        /**********************************************************************
+        【函数名称】 InnerExport
+        【函数功能】 导出指定模型到输出流中。
+        【参数】
+            Stream: 输出流。
+            Model: 模型的引用。
+            Options: 导出选项，只使用其中的法向；未给出法向时由
+                三个顶点求面的单位法向。
+        【返回值】 无
+            如果法向的面数与模型不同，或面数超过 32 位整数的范围，
+            抛出 InvalidSizeException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void InnerExport(
+            ostream& Stream,
+            const Model<3>& Model,
+            const ExportOptions& Options
+        ) const override;
+};
+
+}
+
+}
+
+}
+
+#endif
\ No newline at end of file
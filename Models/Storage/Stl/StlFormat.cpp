@@ -0,0 +1,32 @@
+/*************************************************************************
+【文件名】 StlFormat.cpp
+【功能模块和目的】 为 StlFormat.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include "StlFormat.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Stl {
+
+// 文件头的字节数
+constexpr size_t StlFormat::HEADER_SIZE;
+// 每个三角形记录的字节数
+constexpr size_t StlFormat::RECORD_SIZE;
+// 记录中法向的字节数
+constexpr size_t StlFormat::NORMAL_SIZE;
+// 记录中一个顶点的字节数
+constexpr size_t StlFormat::VERTEX_SIZE;
+// 文本格式文件开头的关键字
+constexpr const char* StlFormat::TEXT_PREFIX;
+
+}
+
+}
+
+}
\ No newline at end of file
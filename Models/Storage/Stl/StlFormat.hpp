@@ -0,0 +1,64 @@
+/*************************************************************************
+【文件名】 StlFormat.hpp
+【功能模块和目的】 StlFormat 类定义了二进制 .stl 文件的公共常量。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef STL_FORMAT_HPP
+#define STL_FORMAT_HPP
+
+#include <cstddef>
+using namespace std;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Stl {
+
+/*************************************************************************
+【类名】 StlFormat
+【功能】 静态类，二进制 .stl 文件的格式定义。
+    文件依次为：80 字节的文件头，32 位的三角形个数，然后是每个三角形
+    50 字节的记录：法向与三个顶点共 12 个单精度浮点数，以及 16 位的
+    属性字节数（通常为 0）。
+    整数与浮点数均以小端序存储，与所有支持的平台的本机字节序一致。
+    顶点不共享，每个三角形各自存储三个顶点的坐标。
+【接口说明】
+    成员：
+        HEADER_SIZE: 文件头的字节数。
+        RECORD_SIZE: 每个三角形记录的字节数。
+        NORMAL_SIZE: 记录中法向的字节数。
+        VERTEX_SIZE: 记录中一个顶点的字节数。
+        TEXT_PREFIX: 文本格式文件开头的关键字。
+    构造函数：
+        私有默认构造函数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class StlFormat final {
+    public:
+        // 成员
+
+        // 文件头的字节数
+        static constexpr size_t HEADER_SIZE { 80 };
+        // 每个三角形记录的字节数
+        static constexpr size_t RECORD_SIZE { 50 };
+        // 记录中法向的字节数
+        static constexpr size_t NORMAL_SIZE { 12 };
+        // 记录中一个顶点的字节数
+        static constexpr size_t VERTEX_SIZE { 12 };
+        // 文本格式文件开头的关键字
+        static constexpr const char* TEXT_PREFIX { "solid" };
+
+    private:
+        // 静态类，隐藏构造函数。
+        StlFormat();
+};
+
+}
+
+}
+
+}
+
+#endif
\ No newline at end of file
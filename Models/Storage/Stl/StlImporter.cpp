@@ -0,0 +1,402 @@
+/*************************************************************************
+【文件名】 StlImporter.cpp
+【功能模块和目的】 为 StlImporter.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "StlFormat.hpp"
+#include "StlImporter.hpp"
+#include "../ImportVisitor.hpp"
+#include "../Binary/BinaryFormat.hpp"
+#include "../../Core/Face.hpp"
+#include "../../Core/Model.hpp"
+#include "../../Core/Point.hpp"
+#include "../../Errors/FileFormatException.hpp"
+#include "../../Mesh/IndexedMesh.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Errors;
+using namespace C3w::Mesh;
+using namespace C3w::Storage::Binary;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Stl {
+
+// 每次读入的三角形记录数
+constexpr size_t StlImporter::CHUNK_RECORD_COUNT;
+// 空槽的标记
+template <typename K>
+constexpr size_t StlImporter::IndexTable<K>::EMPTY;
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化空表，预留足够容纳指定个数的键的容量。
+【参数】
+    Capacity: 预计的键数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename K>
+StlImporter::IndexTable<K>::IndexTable(size_t Capacity) {
+    size_t ullSlotCount = 16;
+    while (ullSlotCount < Capacity * 2) {
+        ullSlotCount *= 2;
+    }
+    m_Keys.reserve(Capacity);
+    m_Slots.assign(ullSlotCount, EMPTY);
+}
+
+/**********************************************************************
+【函数名称】 GetCount
+【函数功能】 获取键的个数。
+【参数】 无
+【返回值】
+    键的个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename K>
+size_t StlImporter::IndexTable<K>::GetCount() const {
+    return m_Keys.size();
+}
+
+/**********************************************************************
+【函数名称】 GetKey
+【函数功能】 获取指定编号的键。
+【参数】
+    Index: 键的编号，不检查是否越界。
+【返回值】
+    键的常引用。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename K>
+const K& StlImporter::IndexTable<K>::GetKey(size_t Index) const {
+    return m_Keys[Index];
+}
+
+/**********************************************************************
+【函数名称】 Insert
+【函数功能】 查找键，不存在时添加。
+【参数】
+    Key: 要查找的键。
+【返回值】
+    键的编号，等于插入前的键数时表示新添加。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename K>
+size_t StlImporter::IndexTable<K>::Insert(const K& Key) {
+    if ((m_Keys.size() + 1) * 2 > m_Slots.size()) {
+        Grow();
+    }
+    size_t ullMask = m_Slots.size() - 1;
+    size_t ullSlot = GetHash(Key) & ullMask;
+    while (m_Slots[ullSlot] != EMPTY) {
+        if (m_Keys[m_Slots[ullSlot]] == Key) {
+            return m_Slots[ullSlot];
+        }
+        ullSlot = (ullSlot + 1) & ullMask;
+    }
+    m_Slots[ullSlot] = m_Keys.size();
+    m_Keys.push_back(Key);
+    return m_Slots[ullSlot];
+}
+
+/**********************************************************************
+【函数名称】 Grow
+【函数功能】 将槽数加倍，重新放置所有键。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename K>
+void StlImporter::IndexTable<K>::Grow() {
+    m_Slots.assign(m_Slots.size() * 2, EMPTY);
+    size_t ullMask = m_Slots.size() - 1;
+    // 键互不相同，只需找到空槽
+    for (size_t i = 0; i < m_Keys.size(); i++) {
+        size_t ullSlot = GetHash(m_Keys[i]) & ullMask;
+        while (m_Slots[ullSlot] != EMPTY) {
+            ullSlot = (ullSlot + 1) & ullMask;
+        }
+        m_Slots[ullSlot] = i;
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetHash
+【函数功能】 逐个字混合求键的哈希值，每个字一次乘法。
+【参数】
+    Key: 键。
+【返回值】
+    哈希值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename K>
+size_t StlImporter::IndexTable<K>::GetHash(const K& Key) {
+    const uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ull;
+    uint64_t ullHash = 0;
+    for (auto Word: Key) {
+        ullHash = (ullHash ^ static_cast<uint64_t>(Word)) * MULTIPLIER;
+        ullHash ^= ullHash >> 32;
+    }
+    return static_cast<size_t>(ullHash);
+}
+
+/**********************************************************************
+【函数名称】 InnerImport
+【函数功能】 导入输入流到模型中。顶点合并后丢弃退化与重复的面，
+    元素因此互不相同，一次构造模型而不逐个查重。
+【参数】
+    Stream: 输入流。
+    Model: 模型的可变引用。
+【返回值】 无
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void StlImporter::InnerImport(istream& Stream, Model<3>& Model) const {
+    string Name;
+    size_t ullCapacity = 0;
+    size_t ullCount = ReadHeader(Stream, Name, ullCapacity);
+    // 封闭网格的顶点数约为三角形数的一半
+    IndexTable<VertexKey> VertexTable(ullCapacity / 2);
+    IndexTable<array<size_t, 3>> FaceTable(ullCapacity);
+    vector<array<size_t, 3>> Faces;
+    Faces.reserve(ullCapacity);
+    // 与 QuantizedMesh 相同，按排序后的下标去除重复的面
+    ReadTriangles(
+        Stream,
+        ullCount,
+        VertexTable,
+        [&FaceTable, &Faces](const array<size_t, 3>& Indices) {
+            array<size_t, 3> Key(Indices);
+            sort(Key.begin(), Key.end());
+            size_t ullFaceCount = FaceTable.GetCount();
+            if (FaceTable.Insert(Key) == ullFaceCount) {
+                Faces.push_back(Indices);
+            }
+        }
+    );
+    vector<Point<3>> Vertices;
+    Vertices.reserve(VertexTable.GetCount());
+    for (size_t i = 0; i < VertexTable.GetCount(); i++) {
+        Vertices.push_back(ToPoint(VertexTable.GetKey(i)));
+    }
+    Model = IndexedMesh<3>(
+        move(Name),
+        move(Vertices),
+        vector<array<size_t, 2>>(),
+        move(Faces)
+    ).ToModel();
+}
+
+/**********************************************************************
+【函数名称】 InnerVisit
+【函数功能】 流式读取输入流，顶点首次出现时交给访问者，
+    再将每个不退化的面交给访问者。重复的面不做检查，原样输出。
+【参数】
+    Stream: 输入流。
+    Visitor: 接收记录的访问者。
+【返回值】 无
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void StlImporter::InnerVisit(
+    istream& Stream,
+    ImportVisitor<3>& Visitor
+) const {
+    string Name;
+    size_t ullCapacity = 0;
+    size_t ullCount = ReadHeader(Stream, Name, ullCapacity);
+    Visitor.VisitName(Name);
+    IndexTable<VertexKey> VertexTable(ullCapacity / 2);
+    size_t ullVisited = 0;
+    ReadTriangles(
+        Stream,
+        ullCount,
+        VertexTable,
+        [&VertexTable, &Visitor, &ullVisited](
+            const array<size_t, 3>& Indices
+        ) {
+            for (; ullVisited < VertexTable.GetCount(); ullVisited++) {
+                Visitor.VisitVertex(ToPoint(VertexTable.GetKey(ullVisited)));
+            }
+            Visitor.VisitFace(
+                Face<3>(
+                    ToPoint(VertexTable.GetKey(Indices[0])),
+                    ToPoint(VertexTable.GetKey(Indices[1])),
+                    ToPoint(VertexTable.GetKey(Indices[2]))
+                )
+            );
+        }
+    );
+}
+
+/**********************************************************************
+【函数名称】 IsBinary
+【函数功能】 判断是否以二进制方式打开文件。
+【参数】 无
+【返回值】
+    总是为真。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool StlImporter::IsBinary() const {
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 ReadHeader
+【函数功能】 读取文件头与三角形个数。流可以定位时检查剩余的字节数
+    是否足以容纳所有记录，并据此给出预留的容量。
+【参数】
+    Stream: 输入流。
+    Name: 输出，模型的名称。
+    Capacity: 输出，可以安全预留的三角形个数；流不能定位时
+        不超过 CHUNK_RECORD_COUNT，避免损坏的个数导致过大的
+        内存申请。
+【返回值】
+    文件头中的三角形个数。
+    如果文件内容无效，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t StlImporter::ReadHeader(
+    istream& Stream,
+    string& Name,
+    size_t& Capacity
+) {
+    char Header[StlFormat::HEADER_SIZE];
+    if (!Stream.read(Header, StlFormat::HEADER_SIZE)) {
+        throw FileFormatException(0, "unexpected end of file");
+    }
+    Name.assign(Header, StlFormat::HEADER_SIZE);
+    Name.erase(min(Name.find('\0'), Name.size()));
+    while (
+        !Name.empty() &&
+        isspace(static_cast<unsigned char>(Name.back()))
+    ) {
+        Name.pop_back();
+    }
+    size_t ullCount = BinaryFormat::Read<uint32_t>(Stream);
+    // 文件流与内存流可以定位，读取进度缓冲区等不能定位的流时跳过检查
+    Capacity = min(ullCount, CHUNK_RECORD_COUNT);
+    streamoff llStart = Stream.tellg();
+    if (llStart < 0) {
+        return ullCount;
+    }
+    Stream.seekg(0, ios::end);
+    streamoff llEnd = Stream.tellg();
+    Stream.seekg(llStart);
+    if (llEnd < llStart || !Stream) {
+        throw FileFormatException(0, "cannot seek");
+    }
+    size_t ullRemaining = static_cast<size_t>(llEnd - llStart);
+    if (ullRemaining / StlFormat::RECORD_SIZE < ullCount) {
+        // 文本格式的文件以 solid 开头，按二进制读取时个数通常不符
+        size_t ullLength = strlen(StlFormat::TEXT_PREFIX);
+        if (Name.compare(0, ullLength, StlFormat::TEXT_PREFIX) == 0) {
+            throw FileFormatException(0, "text stl is not supported");
+        }
+        throw FileFormatException(0, "unexpected end of file");
+    }
+    Capacity = ullCount;
+    return ullCount;
+}
+
+/**********************************************************************
+【函数名称】 ReadTriangles
+【函数功能】 按块读入三角形记录并合并顶点，对每个不退化的三角形
+    调用一次 OnFace。
+【参数】
+    Stream: 输入流，位于第一个记录处。
+    Count: 三角形个数。
+    Vertices: 顶点表，新的顶点追加在其中。
+    OnFace: 形如 void(const array<size_t, 3>& Indices) 的函数，
+        Indices 为三角形在顶点表中的顶点编号。
+【返回值】 无
+    如果文件提前结束，抛出 FileFormatException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void StlImporter::ReadTriangles(
+    istream& Stream,
+    size_t Count,
+    IndexTable<VertexKey>& Vertices,
+    function<void(const array<size_t, 3>&)> OnFace
+) {
+    static_assert(
+        sizeof(VertexKey) == StlFormat::VERTEX_SIZE,
+        "vertex key must match the record layout"
+    );
+    const uint32_t NEGATIVE_ZERO = 0x80000000u;
+    vector<char> Buffer(
+        min(Count, CHUNK_RECORD_COUNT) * StlFormat::RECORD_SIZE
+    );
+    for (size_t ullRead = 0; ullRead < Count;) {
+        size_t ullChunk = min(Count - ullRead, CHUNK_RECORD_COUNT);
+        // 一次读取整块，文件流对大块读取直接读入目标而不经过其缓冲区
+        if (!Stream.read(Buffer.data(), ullChunk * StlFormat::RECORD_SIZE)) {
+            throw FileFormatException(0, "unexpected end of file");
+        }
+        const char* pRecord = Buffer.data();
+        for (size_t i = 0; i < ullChunk; i++) {
+            // 跳过法向，需要时由顶点重新计算
+            VertexKey Keys[3];
+            memcpy(
+                Keys,
+                pRecord + StlFormat::NORMAL_SIZE,
+                3 * StlFormat::VERTEX_SIZE
+            );
+            array<size_t, 3> Indices;
+            for (size_t j = 0; j < 3; j++) {
+                // -0 与 +0 作为点相等，统一后再按位比较
+                for (auto& ulBits: Keys[j]) {
+                    if (ulBits == NEGATIVE_ZERO) {
+                        ulBits = 0;
+                    }
+                }
+                Indices[j] = Vertices.Insert(Keys[j]);
+            }
+            if (
+                Indices[0] != Indices[1] &&
+                Indices[1] != Indices[2] &&
+                Indices[0] != Indices[2]
+            ) {
+                OnFace(Indices);
+            }
+            pRecord += StlFormat::RECORD_SIZE;
+        }
+        ullRead += ullChunk;
+    }
+}
+
+/**********************************************************************
+【函数名称】 ToPoint
+【函数功能】 将顶点的键转换为点。
+【参数】
+    Key: 顶点的键。
+【返回值】
+    对应的点。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+Point<3> StlImporter::ToPoint(const VertexKey& Key) {
+    float Coordinates[3];
+    memcpy(Coordinates, Key.data(), sizeof(Coordinates));
+    return Point<3> { Coordinates[0], Coordinates[1], Coordinates[2] };
+}
+
+}
+
+}
+
+}
\ No newline at end of file
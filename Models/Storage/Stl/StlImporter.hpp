@@ -0,0 +1,253 @@
+/*************************************************************************
+【文件名】 StlImporter.hpp
+【功能模块和目的】 StlImporter 类定义了一个二进制 .stl 文件的导入器。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef STL_IMPORTER_HPP
+#define STL_IMPORTER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../ImporterBase.hpp"
+#include "../ImportVisitor.hpp"
+#include "../../Core/Model.hpp"
+#include "../../Core/Point.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Stl {
+
+/*************************************************************************
+【类名】 StlImporter
+【功能】 定义一个二进制 .stl 文件的导入器。
+    三角形记录按块整体读入缓冲区，再从缓冲区中取出坐标，不逐个读取。
+    每个三角形各自存储顶点，读取时以坐标的位模式为键在开放寻址的哈希表
+    中合并相同的顶点；合并后退化的三角形与重复的三角形被丢弃。
+    文件头去掉末尾的空字符与空白后作为模型的名称。
+    不支持文本格式的 .stl 文件。
+【接口说明】
+    继承于 C3w::Storage::ImporterBase<3>:
+        继承全部接口。
+        实现 InnerImport，合并顶点并去除重复的面后一次构造模型。
+        实现 InnerVisit，流式输出合并后的顶点与面。
+        重写 IsBinary。
+    成员：
+        CHUNK_RECORD_COUNT: 每次读入的三角形记录数。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class StlImporter: public ImporterBase<3> {
+    public:
+        // 成员
+
+        // 每次读入的三角形记录数
+        static constexpr size_t CHUNK_RECORD_COUNT { 65536 };
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 IsBinary
+        【函数功能】 判断是否以二进制方式打开文件。
+        【参数】 无
+        【返回值】
+            总是为真。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool IsBinary() const override;
+
+    protected:
+        /**********************************************************************
+        【函数名称】 InnerImport
+        【函数功能】 导入输入流到模型中。顶点合并后丢弃退化与重复的面，
+            元素因此互不相同，一次构造模型而不逐个查重。
+        【参数】
+            Stream: 输入流。
+            Model: 模型的可变引用。
+        【返回值】 无
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void InnerImport(istream& Stream, Model<3>& Model) const override;
+        /**********************************************************************
+        【函数名称】 InnerVisit
+        【函数功能】 流式读取输入流，顶点首次出现时交给访问者，
+            再将每个不退化的面交给访问者。重复的面不做检查，原样输出。
+        【参数】
+            Stream: 输入流。
+            Visitor: 接收记录的访问者。
+        【返回值】 无
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void InnerVisit(
+            istream& Stream,
+            ImportVisitor<3>& Visitor
+        ) const override;
+
+    private:
+        /**********************************************************************
+        【类名】 IndexTable
+        【功能】 开放寻址的哈希表，为互不相同的键按首次出现的顺序编号。
+            键存储在连续数组中，槽中只存放键的编号，线性探测时比较键本身。
+            装载因子超过一半时容量加倍。
+        【接口说明】
+            构造与析构：
+                接受预计键数的构造函数。
+            属性：
+                GetCount: 获取键的个数。
+                GetKey: 获取指定编号的键。
+            操作：
+                Insert: 查找键，不存在时添加，返回键的编号。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename K>
+        class IndexTable final {
+            public:
+                // 构造函数
+
+                /**************************************************************
+                【函数名称】 构造函数
+                【函数功能】 初始化空表，预留足够容纳指定个数的键的容量。
+                【参数】
+                    Capacity: 预计的键数。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2024/7/24
+                **************************************************************/
+                explicit IndexTable(size_t Capacity);
+
+                // 属性
+
+                /**************************************************************
+                【函数名称】 GetCount
+                【函数功能】 获取键的个数。
+                【参数】 无
+                【返回值】
+                    键的个数。
+                【开发者及日期】 赵一彤 2024/7/24
+                **************************************************************/
+                size_t GetCount() const;
+                /**************************************************************
+                【函数名称】 GetKey
+                【函数功能】 获取指定编号的键。
+                【参数】
+                    Index: 键的编号，不检查是否越界。
+                【返回值】
+                    键的常引用。
+                【开发者及日期】 赵一彤 2024/7/24
+                **************************************************************/
+                const K& GetKey(size_t Index) const;
+
+                // 操作
+
+                /**************************************************************
+                【函数名称】 Insert
+                【函数功能】 查找键，不存在时添加。
+                【参数】
+                    Key: 要查找的键。
+                【返回值】
+                    键的编号，等于插入前的键数时表示新添加。
+                【开发者及日期】 赵一彤 2024/7/24
+                **************************************************************/
+                size_t Insert(const K& Key);
+
+            private:
+                // 空槽的标记
+                static constexpr size_t EMPTY { SIZE_MAX };
+
+                // 按编号存放的键
+                vector<K> m_Keys;
+                // 槽中的键编号，容量为 2 的幂
+                vector<size_t> m_Slots;
+
+                /**************************************************************
+                【函数名称】 Grow
+                【函数功能】 将槽数加倍，重新放置所有键。
+                【参数】 无
+                【返回值】 无
+                【开发者及日期】 赵一彤 2024/7/24
+                **************************************************************/
+                void Grow();
+                /**************************************************************
+                【函数名称】 GetHash
+                【函数功能】 逐个字混合求键的哈希值，每个字一次乘法。
+                【参数】
+                    Key: 键。
+                【返回值】
+                    哈希值。
+                【开发者及日期】 赵一彤 2024/7/24
+                **************************************************************/
+                static size_t GetHash(const K& Key);
+        };
+
+        // 顶点的键，三个单精度坐标的位模式，-0 已转换为 +0
+        using VertexKey = array<uint32_t, 3>;
+
+        /**********************************************************************
+        【函数名称】 ReadHeader
+        【函数功能】 读取文件头与三角形个数。流可以定位时检查剩余的字节数
+            是否足以容纳所有记录，并据此给出预留的容量。
+        【参数】
+            Stream: 输入流。
+            Name: 输出，模型的名称。
+            Capacity: 输出，可以安全预留的三角形个数；流不能定位时
+                不超过 CHUNK_RECORD_COUNT，避免损坏的个数导致过大的
+                内存申请。
+        【返回值】
+            文件头中的三角形个数。
+            如果文件内容无效，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static size_t ReadHeader(
+            istream& Stream,
+            string& Name,
+            size_t& Capacity
+        );
+        /**********************************************************************
+        【函数名称】 ReadTriangles
+        【函数功能】 按块读入三角形记录并合并顶点，对每个不退化的三角形
+            调用一次 OnFace。
+        【参数】
+            Stream: 输入流，位于第一个记录处。
+            Count: 三角形个数。
+            Vertices: 顶点表，新的顶点追加在其中。
+            OnFace: 形如 void(const array<size_t, 3>& Indices) 的函数，
+                Indices 为三角形在顶点表中的顶点编号。
+        【返回值】 无
+            如果文件提前结束，抛出 FileFormatException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void ReadTriangles(
+            istream& Stream,
+            size_t Count,
+            IndexTable<VertexKey>& Vertices,
+            function<void(const array<size_t, 3>&)> OnFace
+        );
+        /**********************************************************************
+        【函数名称】 ToPoint
+        【函数功能】 将顶点的键转换为点。
+        【参数】
+            Key: 顶点的键。
+        【返回值】
+            对应的点。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Point<3> ToPoint(const VertexKey& Key);
+};
+
+}
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -6,9 +6,15 @@
 
 #include <functional>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
 #include <unordered_map>
 #include "Obj/ObjImporter.hpp"
 #include "Obj/ObjExporter.hpp"
+#include "Binary/BinaryImporter.hpp"
+#include "Binary/BinaryExporter.hpp"
+#include "Stl/StlImporter.hpp"
+#include "Stl/StlExporter.hpp"
 #include "StorageFactory.hpp"
 using namespace std;
 
@@ -22,9 +28,28 @@ unordered_multimap<string, const StorageFactory::Pair> StorageFactory::m_Map {
         ".obj",
         { 
             /* .Dimension */ 3, 
+            /* .Scalar */ type_index(typeid(double)),
             /* .ImporterFactory */ MakeConstructor<Obj::ObjImporter>(),
             /* .ExporterFactory */ MakeConstructor<Obj::ObjExporter>()
         } 
+    },
+    { 
+        ".c3w",
+        { 
+            /* .Dimension */ 3, 
+            /* .Scalar */ type_index(typeid(double)),
+            /* .ImporterFactory */ MakeConstructor<Binary::BinaryImporter>(),
+            /* .ExporterFactory */ MakeConstructor<Binary::BinaryExporter>()
+        } 
+    },
+    { 
+        ".stl",
+        { 
+            /* .Dimension */ 3, 
+            /* .Scalar */ type_index(typeid(double)),
+            /* .ImporterFactory */ MakeConstructor<Stl::StlImporter>(),
+            /* .ExporterFactory */ MakeConstructor<Stl::StlExporter>()
+        } 
     }
 };
 
@@ -12,6 +12,8 @@
 #include <functional>
 #include <memory>
 #include <type_traits>
+#include <typeindex>
+#include <typeinfo>
 #include <unordered_map>
 #include "ImporterBase.hpp"
 #include "ExporterBase.hpp"
@@ -28,7 +30,7 @@ namespace Storage {
     构造函数：
         私有默认构造函数。
     操作：
-        Register: 注册一对导入/导出器类。
+        Register: 注册一对导入/导出器类，分量类型默认为 double。
         GetImporter: 获取一个导入器指针。
         GetExporter: 获取一个导出器指针。
 【开发者及日期】 赵一彤 2024/7/24
@@ -45,10 +47,15 @@ class StorageFactory final {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        template <size_t N, typename Importer, typename Exporter>
+        template <
+            size_t N,
+            typename Importer,
+            typename Exporter,
+            typename T = double
+        >
         static typename enable_if<
-            is_base_of<ImporterBase<N>, Importer>::value &&
-            is_base_of<ExporterBase<N>, Exporter>::value
+            is_base_of<ImporterBase<N, T>, Importer>::value &&
+            is_base_of<ExporterBase<N, T>, Exporter>::value
         >::type Register(string Extension);
         /**********************************************************************
         【函数名称】 Register
@@ -60,10 +67,15 @@ class StorageFactory final {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        template <size_t N, typename Importer, typename Exporter>
+        template <
+            size_t N,
+            typename Importer,
+            typename Exporter,
+            typename T = double
+        >
         static typename enable_if<
-            is_base_of<ImporterBase<N>, Importer>::value &&
-            is_base_of<ExporterBase<N>, Exporter>::value
+            is_base_of<ImporterBase<N, T>, Importer>::value &&
+            is_base_of<ExporterBase<N, T>, Exporter>::value
         >::type Register(
             string Extension,
             function<Importer*()> ImporterFactory,
@@ -71,26 +83,26 @@ class StorageFactory final {
         );
         /**********************************************************************
         【函数名称】 GetImporter
-        【函数功能】 根据维数与文件扩展名获取导入器。
+        【函数功能】 根据维数、分量类型与文件扩展名获取导入器。
         【参数】
             Extension: 文件扩展名。
         【返回值】
             指向导入器的指针。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        template <size_t N>
-        static unique_ptr<ImporterBase<N>> GetImporter(string Extension);
+        template <size_t N, typename T = double>
+        static unique_ptr<ImporterBase<N, T>> GetImporter(string Extension);
         /**********************************************************************
         【函数名称】 GetExporter
-        【函数功能】 根据维数与文件扩展名获取导出器。
+        【函数功能】 根据维数、分量类型与文件扩展名获取导出器。
         【参数】
             Extension: 文件扩展名。
         【返回值】
             指向导出器的指针。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        template <size_t N>
-        static unique_ptr<ExporterBase<N>> GetExporter(string Extension);
+        template <size_t N, typename T = double>
+        static unique_ptr<ExporterBase<N, T>> GetExporter(string Extension);
         
     private:
         /**********************************************************************
@@ -102,6 +114,8 @@ class StorageFactory final {
         struct Pair {
             // 维数
             size_t Dimension;
+            // 点的分量类型
+            type_index Scalar;
             // 导入器“构造函数”
             function<void*()> ImporterFactory;
             // 导出器“构造函数”
@@ -9,6 +9,8 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <typeindex>
+#include <typeinfo>
 #include <utility>
 #include "ImporterBase.hpp"
 #include "ExporterBase.hpp"
@@ -29,12 +31,12 @@ namespace Storage {
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, typename Importer, typename Exporter>
+template <size_t N, typename Importer, typename Exporter, typename T>
 typename enable_if<
-    is_base_of<ImporterBase<N>, Importer>::value &&
-    is_base_of<ExporterBase<N>, Exporter>::value
+    is_base_of<ImporterBase<N, T>, Importer>::value &&
+    is_base_of<ExporterBase<N, T>, Exporter>::value
 >::type StorageFactory::Register(string Extension) {
-    Register<N, Importer, Exporter>(
+    Register<N, Importer, Exporter, T>(
         Extension,
         MakeConstructor<Importer>(),
         MakeConstructor<Exporter>()
@@ -51,34 +53,40 @@ typename enable_if<
 【返回值】 无
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N, typename Importer, typename Exporter>
+template <size_t N, typename Importer, typename Exporter, typename T>
 typename enable_if<
-    is_base_of<ImporterBase<N>, Importer>::value &&
-    is_base_of<ExporterBase<N>, Exporter>::value
+    is_base_of<ImporterBase<N, T>, Importer>::value &&
+    is_base_of<ExporterBase<N, T>, Exporter>::value
 >::type StorageFactory::Register(
     string Extension,
     function<Importer*()> ImporterFactory,
     function<Exporter*()> ExporterFactory
 ) {
-    m_Map.insert({ Extension, { N, ImporterFactory, ExporterFactory }});
+    m_Map.insert({
+        Extension,
+        { N, type_index(typeid(T)), ImporterFactory, ExporterFactory }
+    });
 }
 
 /**********************************************************************
 【函数名称】 GetImporter
-【函数功能】 根据维数与文件扩展名获取导入器。
+【函数功能】 根据维数、分量类型与文件扩展名获取导入器。
 【参数】
     Extension: 文件扩展名。
 【返回值】
     指向导入器的指针。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-unique_ptr<ImporterBase<N>> StorageFactory::GetImporter(string Extension) {
+template <size_t N, typename T>
+unique_ptr<ImporterBase<N, T>> StorageFactory::GetImporter(string Extension) {
     auto Range = m_Map.equal_range(Extension);
     for (auto it = Range.first; it != Range.second; ++it) {
-        if (it->second.Dimension == N) {
-            return unique_ptr<ImporterBase<N>>(
-                static_cast<ImporterBase<N>*>(it->second.ImporterFactory())
+        if (
+            it->second.Dimension == N &&
+            it->second.Scalar == type_index(typeid(T))
+        ) {
+            return unique_ptr<ImporterBase<N, T>>(
+                static_cast<ImporterBase<N, T>*>(it->second.ImporterFactory())
             );
         }
     }
@@ -87,20 +95,23 @@ unique_ptr<ImporterBase<N>> StorageFactory::GetImporter(string Extension) {
 
 /**********************************************************************
 【函数名称】 GetExporter
-【函数功能】 根据维数与文件扩展名获取导出器。
+【函数功能】 根据维数、分量类型与文件扩展名获取导出器。
 【参数】
     Extension: 文件扩展名。
 【返回值】
     指向导出器的指针。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
-template <size_t N>
-unique_ptr<ExporterBase<N>> StorageFactory::GetExporter(string Extension) {
+template <size_t N, typename T>
+unique_ptr<ExporterBase<N, T>> StorageFactory::GetExporter(string Extension) {
     auto Range = m_Map.equal_range(Extension);
     for (auto it = Range.first; it != Range.second; ++it) {
-        if (it->second.Dimension == N) {
-            return unique_ptr<ExporterBase<N>>(
-                static_cast<ExporterBase<N>*>(it->second.ExporterFactory())
+        if (
+            it->second.Dimension == N &&
+            it->second.Scalar == type_index(typeid(T))
+        ) {
+            return unique_ptr<ExporterBase<N, T>>(
+                static_cast<ExporterBase<N, T>*>(it->second.ExporterFactory())
             );
         }
     }
@@ -0,0 +1,114 @@
+/*************************************************************************
+【文件名】 AreaKernel.hpp
+【功能模块和目的】 AreaKernel 类计算 N 维空间中三角形的面积。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef AREA_KERNEL_HPP
+#define AREA_KERNEL_HPP
+
+#include <array>
+#include <cstddef>
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 AreaKernel
+【功能】 静态类，计算 N 维空间中三角形的面积。
+    以第一个点为起点的两条边 U、V 张成的平行四边形面积的平方
+    |U|²|V|² - (U·V)² 等于所有 2×2 子式 (UiVj - UjVi)² 之和（Lagrange 恒等式），
+    三维时即叉积的模长。只开一次方，且不像 Heron 公式或直接计算
+    Gram 行列式那样对针状三角形产生相消误差。
+    批量版本以结构数组（SoA）存储坐标，循环内没有分支，便于编译器向量化。
+【接口说明】
+    成员：
+        DIMENSION: 表示维数。
+        BATCH_SIZE: 每批三角形的最大个数。
+    内嵌类型：
+        Batch: 结构数组形式的一批三角形。
+    构造函数：
+        私有默认构造函数。
+    操作：
+        GetArea: 求一个三角形的面积。
+        GetAreas: 求一批三角形的面积。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N>
+class AreaKernel final {
+    public:
+        // 成员
+
+        // 维数
+        static constexpr size_t DIMENSION { N };
+        // 每批三角形的最大个数
+        static constexpr size_t BATCH_SIZE { 256 };
+
+        // 内嵌类型
+
+        // 一批三角形，[c][k][i] 为第 i 个三角形第 c 个点的第 k 个坐标
+        using Batch = array<array<array<double, BATCH_SIZE>, N>, 3>;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 GetArea
+        【函数功能】 求三角形的面积。
+        【参数】
+            First, Second, Third: 三角形的三个点，分量类型任意。
+        【返回值】
+            三角形的面积，以 double 计算。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename T>
+        static double GetArea(
+            const Point<N, T>& First,
+            const Point<N, T>& Second,
+            const Point<N, T>& Third
+        );
+        /**********************************************************************
+        【函数名称】 GetAreas
+        【函数功能】 求一批三角形的面积。
+        【参数】
+            Triangles: 结构数组形式的三角形。
+            Count: 三角形的个数，不超过 BATCH_SIZE。
+            Areas: 输出各三角形的面积，至少有 Count 个元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void GetAreas(
+            const Batch& Triangles,
+            size_t Count,
+            double* Areas
+        );
+
+    private:
+        /**********************************************************************
+        【函数名称】 GetDoubleAreaSquared
+        【函数功能】 由两条边求平行四边形面积的平方，即 2×2 子式的平方和。
+        【参数】
+            U: 第一条边。
+            V: 第二条边。
+        【返回值】
+            三角形面积平方的 4 倍。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static double GetDoubleAreaSquared(
+            const array<double, N>& U,
+            const array<double, N>& V
+        );
+
+        // 静态类，隐藏构造函数。
+        AreaKernel();
+};
+
+}
+
+}
+
+#include "AreaKernel.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,117 @@
+/*************************************************************************
+【文件名】 AreaKernel.tpp
+【功能模块和目的】 为 AreaKernel.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include "AreaKernel.hpp"
+#include "Unroll.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+// 每批三角形的最大个数
+template <size_t N>
+constexpr size_t AreaKernel<N>::BATCH_SIZE;
+
+/**********************************************************************
+【函数名称】 GetArea
+【函数功能】 求三角形的面积。
+【参数】
+    First, Second, Third: 三角形的三个点，分量类型任意。
+【返回值】
+    三角形的面积，以 double 计算。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename T>
+double AreaKernel<N>::GetArea(
+    const Point<N, T>& First,
+    const Point<N, T>& Second,
+    const Point<N, T>& Third
+) {
+    array<double, N> U;
+    array<double, N> V;
+    Unroll<N>::For([&U, &V, &First, &Second, &Third](size_t k) {
+        double rOrigin = First.GetComponentUnchecked(k);
+        U[k] = Second.GetComponentUnchecked(k) - rOrigin;
+        V[k] = Third.GetComponentUnchecked(k) - rOrigin;
+    });
+    return sqrt(GetDoubleAreaSquared(U, V)) / 2;
+}
+
+/**********************************************************************
+【函数名称】 GetAreas
+【函数功能】 求一批三角形的面积。
+【参数】
+    Triangles: 结构数组形式的三角形。
+    Count: 三角形的个数，不超过 BATCH_SIZE。
+    Areas: 输出各三角形的面积，至少有 Count 个元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+void AreaKernel<N>::GetAreas(
+    const Batch& Triangles,
+    size_t Count,
+    double* Areas
+) {
+    // 先逐个子式累加，最内层对 i 的循环只访问连续的数组且没有分支，
+    // 可以被编译器向量化
+    for (size_t i = 0; i < Count; i++) {
+        Areas[i] = 0;
+    }
+    auto& First = Triangles[0];
+    auto& Second = Triangles[1];
+    auto& Third = Triangles[2];
+    for (size_t j = 0; j < N; j++) {
+        for (size_t k = j + 1; k < N; k++) {
+            for (size_t i = 0; i < Count; i++) {
+                double rUj = Second[j][i] - First[j][i];
+                double rUk = Second[k][i] - First[k][i];
+                double rVj = Third[j][i] - First[j][i];
+                double rVk = Third[k][i] - First[k][i];
+                double rMinor = rUj * rVk - rUk * rVj;
+                Areas[i] += rMinor * rMinor;
+            }
+        }
+    }
+    for (size_t i = 0; i < Count; i++) {
+        Areas[i] = sqrt(Areas[i]) / 2;
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetDoubleAreaSquared
+【函数功能】 由两条边求平行四边形面积的平方，即 2×2 子式的平方和。
+【参数】
+    U: 第一条边。
+    V: 第二条边。
+【返回值】
+    三角形面积平方的 4 倍。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+double AreaKernel<N>::GetDoubleAreaSquared(
+    const array<double, N>& U,
+    const array<double, N>& V
+) {
+    double rSum = 0;
+    for (size_t j = 0; j < N; j++) {
+        for (size_t k = j + 1; k < N; k++) {
+            double rMinor = U[j] * V[k] - U[k] * V[j];
+            rSum += rMinor * rMinor;
+        }
+    }
+    return rSum;
+}
+
+}
+
+}
\ No newline at end of file
@@ -8,6 +8,7 @@
 #define BOX_HPP
 
 #include <cstddef>
+#include "Constexpr.hpp"
 #include "../Core/Point.hpp"
 #include "../Containers/DynamicSet.hpp"
 using namespace std;
@@ -70,7 +71,7 @@ class Box final {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Box(const Point<N>& Vertex1, const Point<N>& Vertex2);
+        C3W_CONSTEXPR Box(const Point<N>& Vertex1, const Point<N>& Vertex2);
         /**********************************************************************
         【函数名称】 拷贝构造函数
         【函数功能】 使用另一 Box 对象初始化 Box 对象。
@@ -101,7 +102,7 @@ class Box final {
             长方体体积。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        double GetVolume() const;
+        C3W_CONSTEXPR double GetVolume() const;
 
         // 操作
 
@@ -114,7 +115,7 @@ class Box final {
             两长方体是否相等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool IsEqual(const Box<N>& Other) const;
+        C3W_CONSTEXPR bool IsEqual(const Box<N>& Other) const;
         /**********************************************************************
         【函数名称】 IsEqual
         【函数功能】 判断两长方体是否相等。
@@ -125,7 +126,10 @@ class Box final {
             两长方体是否相等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        static bool IsEqual(const Box<N>& Left, const Box<N>& Right);
+        static C3W_CONSTEXPR bool IsEqual(
+            const Box<N>& Left,
+            const Box<N>& Right
+        );
 
         // 操作符
 
@@ -138,7 +142,7 @@ class Box final {
             两长方体是否相等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool operator==(const Box<N>& Other) const;
+        C3W_CONSTEXPR bool operator==(const Box<N>& Other) const;
         /**********************************************************************
         【函数名称】 operator!=
         【函数功能】 判断自身和另一长方体是否相等。
@@ -148,7 +152,7 @@ class Box final {
             两长方体是否相等。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        bool operator!=(const Box<N>& Other) const;
+        C3W_CONSTEXPR bool operator!=(const Box<N>& Other) const;
         /**********************************************************************
         【函数名称】 operator=
         【函数功能】 将另一长方体赋值给自身。
@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <limits>
 #include "Box.hpp"
+#include "Unroll.hpp"
 #include "../Core/Point.hpp"
 #include "../Containers/DynamicSet.hpp"
 using namespace std;
@@ -29,7 +30,7 @@ namespace Tools {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-Box<N>::Box(const Point<N>& Vertex1, const Point<N>& Vertex2)
+C3W_CONSTEXPR Box<N>::Box(const Point<N>& Vertex1, const Point<N>& Vertex2)
     : Vertex1(Vertex1), Vertex2(Vertex2) {}
 
 /**********************************************************************
@@ -46,23 +47,22 @@ Box<N> Box<N>::GetBoundingBoxOf(const DynamicSet<Point<N>>& Points) {
     if (Points.Count() == 0) {
         return Box<N>();
     }
-    array<double, N> MaxCoords;
-    MaxCoords.fill(numeric_limits<double>::max());
     array<double, N> MinCoords;
-    MinCoords.fill(numeric_limits<double>::min());
-    Point<N> Vertex1(MaxCoords);
-    Point<N> Vertex2(MinCoords);
-    for (auto& Point: Points) {
-        for (size_t i = 0; i < N; i++) {
-            if (Point[i] < Vertex1[i]) {
-                Vertex1[i] = Point[i];
+    MinCoords.fill(numeric_limits<double>::max());
+    array<double, N> MaxCoords;
+    MaxCoords.fill(numeric_limits<double>::lowest());
+    for (auto& APoint: Points) {
+        Unroll<N>::For([&APoint, &MinCoords, &MaxCoords](size_t i) {
+            double rValue = APoint.GetComponentUnchecked(i);
+            if (rValue < MinCoords[i]) {
+                MinCoords[i] = rValue;
             }
-            if (Point[i] > Vertex2[i]) {
-                Vertex2[i] = Point[i];
+            if (rValue > MaxCoords[i]) {
+                MaxCoords[i] = rValue;
             }
-        }
+        });
     }
-    return Box<N>(Vertex1, Vertex2);
+    return Box<N>(Point<N>(MinCoords), Point<N>(MaxCoords));
 }
 
 /**********************************************************************
@@ -74,10 +74,11 @@ Box<N> Box<N>::GetBoundingBoxOf(const DynamicSet<Point<N>>& Points) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-double Box<N>::GetVolume() const {
+C3W_CONSTEXPR double Box<N>::GetVolume() const {
     double rVolume = 1;
     for (size_t i = 0; i < N; i++) {
-        rVolume *= fabs(Vertex1[i] - Vertex2[i]);
+        double rLength = Vertex1[i] - Vertex2[i];
+        rVolume *= rLength < 0 ? -rLength : rLength;
     }
     return rVolume;
 }
@@ -92,7 +93,7 @@ double Box<N>::GetVolume() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-bool Box<N>::IsEqual(const Box<N>& Other) const {
+C3W_CONSTEXPR bool Box<N>::IsEqual(const Box<N>& Other) const {
     return IsEqual(*this, Other);
 }
 
@@ -107,7 +108,7 @@ bool Box<N>::IsEqual(const Box<N>& Other) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-bool Box<N>::IsEqual(const Box<N>& Left, const Box<N>& Right) {
+C3W_CONSTEXPR bool Box<N>::IsEqual(const Box<N>& Left, const Box<N>& Right) {
     return Left.Vertex1 == Right.Vertex1 && Left.Vertex2 == Right.Vertex2;
 }
 
@@ -121,7 +122,7 @@ bool Box<N>::IsEqual(const Box<N>& Left, const Box<N>& Right) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-bool Box<N>::operator==(const Box<N>& Other) const {
+C3W_CONSTEXPR bool Box<N>::operator==(const Box<N>& Other) const {
     return IsEqual(Other);
 }
 
@@ -135,7 +136,7 @@ bool Box<N>::operator==(const Box<N>& Other) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-bool Box<N>::operator!=(const Box<N>& Other) const {
+C3W_CONSTEXPR bool Box<N>::operator!=(const Box<N>& Other) const {
     return !IsEqual(Other);
 }
 
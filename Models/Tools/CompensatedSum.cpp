@@ -0,0 +1,90 @@
+/*************************************************************************
+【文件名】 CompensatedSum.cpp
+【功能模块和目的】 为 CompensatedSum.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cmath>
+#include "CompensatedSum.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 GetValue
+【函数功能】 获取补偿后的和。
+【参数】 无
+【返回值】
+    补偿后的和。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+double CompensatedSum::GetValue() const {
+    return m_rSum + m_rCompensation;
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】 加上一个数。
+【参数】
+    Value: 要加上的数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void CompensatedSum::Add(double Value) {
+    double rSum = m_rSum + Value;
+    // 绝对值较小的一方在相加时丢失低位
+    if (fabs(m_rSum) >= fabs(Value)) {
+        m_rCompensation += (m_rSum - rSum) + Value;
+    }
+    else {
+        m_rCompensation += (Value - rSum) + m_rSum;
+    }
+    m_rSum = rSum;
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】 合并另一个和，用于并行求和后合并各部分的结果。
+【参数】
+    Other: 另一个和。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void CompensatedSum::Add(const CompensatedSum& Other) {
+    Add(Other.m_rSum);
+    m_rCompensation += Other.m_rCompensation;
+}
+
+/**********************************************************************
+【函数名称】 operator+=
+【函数功能】 同 Add。
+【参数】
+    Value: 要加上的数。
+【返回值】
+    自身的引用。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+CompensatedSum& CompensatedSum::operator+=(double Value) {
+    Add(Value);
+    return *this;
+}
+
+/**********************************************************************
+【函数名称】 operator+=
+【函数功能】 同 Add。
+【参数】
+    Other: 另一个和。
+【返回值】
+    自身的引用。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+CompensatedSum& CompensatedSum::operator+=(const CompensatedSum& Other) {
+    Add(Other);
+    return *this;
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+/*************************************************************************
+【文件名】 CompensatedSum.hpp
+【功能模块和目的】 CompensatedSum 类实现带误差补偿的浮点数求和。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef COMPENSATED_SUM_HPP
+#define COMPENSATED_SUM_HPP
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 CompensatedSum
+【功能】 使用 Neumaier（改进的 Kahan）算法累加浮点数，
+    单独记录每次相加时舍去的低位，使大量数值求和的误差不随项数增长。
+【接口说明】 
+    构造与析构：
+        默认构造函数，和为 0。
+        拷贝构造函数。
+    属性：
+        GetValue: 获取补偿后的和。
+    操作：
+        Add: 加上一个数，或合并另一个和。
+    操作符：
+        operator+=: 同 Add。
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class CompensatedSum final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化和为 0 的 CompensatedSum 对象。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        CompensatedSum() = default;
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一个和初始化 CompensatedSum 对象。
+        【参数】
+            Other: 另一个和。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        CompensatedSum(const CompensatedSum& Other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetValue
+        【函数功能】 获取补偿后的和。
+        【参数】 无
+        【返回值】
+            补偿后的和。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        double GetValue() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】 加上一个数。
+        【参数】
+            Value: 要加上的数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Add(double Value);
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】 合并另一个和，用于并行求和后合并各部分的结果。
+        【参数】
+            Other: 另一个和。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        void Add(const CompensatedSum& Other);
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator+=
+        【函数功能】 同 Add。
+        【参数】
+            Value: 要加上的数。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        CompensatedSum& operator+=(double Value);
+        /**********************************************************************
+        【函数名称】 operator+=
+        【函数功能】 同 Add。
+        【参数】
+            Other: 另一个和。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        CompensatedSum& operator+=(const CompensatedSum& Other);
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一个和赋值给自身。
+        【参数】
+            Other: 从之取值的和。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        CompensatedSum& operator=(const CompensatedSum& Other) = default;
+
+    private:
+        // 直接累加的和
+        double m_rSum { 0 };
+        // 累加时舍去的低位之和
+        double m_rCompensation { 0 };
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
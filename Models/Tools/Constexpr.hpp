@@ -0,0 +1,28 @@
+/*************************************************************************
+【文件名】 Constexpr.hpp
+【功能模块和目的】 定义 C3W_CONSTEXPR 宏，在 C++20 及以上标准中启用 constexpr。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef CONSTEXPR_HPP
+#define CONSTEXPR_HPP
+
+// 编译器实际使用的标准版本，msvc 的 __cplusplus 默认恒为 199711L
+#if defined(_MSVC_LANG)
+    #define C3W_CPLUSPLUS _MSVC_LANG
+#else
+    #define C3W_CPLUSPLUS __cplusplus
+#endif
+
+// Vector 等值类型继承于含虚函数的 Representable，
+// 直到 C++20 才允许虚析构函数为 constexpr、构造函数不初始化全部成员，
+// 因此在更低的标准中此宏为空，函数退化为普通函数。
+#if C3W_CPLUSPLUS >= 202002L
+    #define C3W_CONSTEXPR constexpr
+    #define C3W_HAS_CONSTEXPR 1
+#else
+    #define C3W_CONSTEXPR
+    #define C3W_HAS_CONSTEXPR 0
+#endif
+
+#endif
\ No newline at end of file
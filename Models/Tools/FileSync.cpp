@@ -0,0 +1,132 @@
+/*************************************************************************
+【文件名】 FileSync.cpp
+【功能模块和目的】 为 FileSync.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstdio>
+#include <string>
+#include "FileSync.hpp"
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 Sync
+【函数功能】 清空文件的缓冲区，并等待其内容写入磁盘。
+【参数】
+    pFile: 以写方式打开的文件。
+【返回值】
+    是否成功。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool FileSync::Sync(FILE* pFile) {
+    if (fflush(pFile) != 0) {
+        return false;
+    }
+#if defined(_WIN32)
+    return _commit(_fileno(pFile)) == 0;
+#else
+    return fsync(fileno(pFile)) == 0;
+#endif
+}
+
+/**********************************************************************
+【函数名称】 Sync
+【函数功能】 等待已写入的文件内容写入磁盘。
+【参数】
+    Path: 文件的位置。
+【返回值】
+    是否成功，文件不存在时为假。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool FileSync::Sync(string Path) {
+    // _commit 要求文件以写方式打开，"r+b" 不截断也不创建文件
+    FILE* pFile = fopen(Path.c_str(), "r+b");
+    if (pFile == nullptr) {
+        return false;
+    }
+    bool bSynced = Sync(pFile);
+    return fclose(pFile) == 0 && bSynced;
+}
+
+/**********************************************************************
+【函数名称】 Append
+【函数功能】 向文件末尾追加数据，并等待其写入磁盘。
+    文件不存在时创建文件。
+【参数】
+    Path: 文件的位置。
+    Data: 要追加的数据。
+【返回值】
+    是否成功。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool FileSync::Append(string Path, const string& Data) {
+    FILE* pFile = fopen(Path.c_str(), "ab");
+    if (pFile == nullptr) {
+        return false;
+    }
+    bool bWritten =
+        fwrite(Data.data(), 1, Data.size(), pFile) == Data.size() &&
+        Sync(pFile);
+    return fclose(pFile) == 0 && bWritten;
+}
+
+/**********************************************************************
+【函数名称】 Replace
+【函数功能】 先将新内容写入临时文件并写入磁盘，再替换原文件，
+    因此任何时候文件要么是旧内容，要么是完整的新内容。
+【参数】
+    Path: 文件的位置。
+    Data: 文件的新内容。
+【返回值】
+    是否成功，失败时原文件保持不变。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool FileSync::Replace(string Path, const string& Data) {
+    string TempPath = Path + ".tmp";
+    FILE* pFile = fopen(TempPath.c_str(), "wb");
+    if (pFile == nullptr) {
+        return false;
+    }
+    bool bWritten =
+        fwrite(Data.data(), 1, Data.size(), pFile) == Data.size() &&
+        Sync(pFile);
+    bWritten = fclose(pFile) == 0 && bWritten;
+    if (!bWritten || !Rename(TempPath, Path)) {
+        remove(TempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Rename
+【函数功能】 重命名文件，目标文件已存在时覆盖之。
+【参数】
+    From: 原位置。
+    To: 新位置。
+【返回值】
+    是否成功。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool FileSync::Rename(string From, string To) {
+    // 部分平台上 rename 不覆盖已有文件，此时先删除目标文件
+    return
+        rename(From.c_str(), To.c_str()) == 0 ||
+        (
+            remove(To.c_str()) == 0 &&
+            rename(From.c_str(), To.c_str()) == 0
+        );
+}
+
+}
+
+}
\ No newline at end of file
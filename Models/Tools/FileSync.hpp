@@ -0,0 +1,102 @@
+/*************************************************************************
+【文件名】 FileSync.hpp
+【功能模块和目的】 FileSync 类提供将文件内容可靠写入磁盘的工具。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef FILE_SYNC_HPP
+#define FILE_SYNC_HPP
+
+#include <cstdio>
+#include <string>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 FileSync
+【功能】 标准库只保证数据交给操作系统，断电或崩溃时仍可能丢失。
+    此类在 POSIX 上使用 fsync、在 Windows 上使用 _commit，
+    等待数据真正写入磁盘后才返回。
+【接口说明】
+    构造函数：
+        私有默认构造函数。
+    操作：
+        Sync: 将已打开的文件或指定路径的文件写入磁盘。
+        Append: 向文件末尾追加数据并写入磁盘。
+        Replace: 以新内容原子地替换文件。
+        Rename: 重命名文件，覆盖已有的目标文件。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class FileSync final {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Sync
+        【函数功能】 清空文件的缓冲区，并等待其内容写入磁盘。
+        【参数】
+            pFile: 以写方式打开的文件。
+        【返回值】
+            是否成功。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static bool Sync(FILE* pFile);
+        /**********************************************************************
+        【函数名称】 Sync
+        【函数功能】 等待已写入的文件内容写入磁盘。
+        【参数】
+            Path: 文件的位置。
+        【返回值】
+            是否成功，文件不存在时为假。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static bool Sync(string Path);
+        /**********************************************************************
+        【函数名称】 Append
+        【函数功能】 向文件末尾追加数据，并等待其写入磁盘。
+            文件不存在时创建文件。
+        【参数】
+            Path: 文件的位置。
+            Data: 要追加的数据。
+        【返回值】
+            是否成功。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static bool Append(string Path, const string& Data);
+        /**********************************************************************
+        【函数名称】 Replace
+        【函数功能】 先将新内容写入临时文件并写入磁盘，再替换原文件，
+            因此任何时候文件要么是旧内容，要么是完整的新内容。
+        【参数】
+            Path: 文件的位置。
+            Data: 文件的新内容。
+        【返回值】
+            是否成功，失败时原文件保持不变。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static bool Replace(string Path, const string& Data);
+        /**********************************************************************
+        【函数名称】 Rename
+        【函数功能】 重命名文件，目标文件已存在时覆盖之。
+        【参数】
+            From: 原位置。
+            To: 新位置。
+        【返回值】
+            是否成功。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static bool Rename(string From, string To);
+
+    private:
+        // 静态类，隐藏构造函数。
+        FileSync();
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
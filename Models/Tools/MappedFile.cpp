@@ -0,0 +1,146 @@
+/*************************************************************************
+【文件名】 MappedFile.cpp
+【功能模块和目的】 为 MappedFile.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <string>
+#include "MappedFile.hpp"
+#include "../Errors/FileOpenException.hpp"
+#if defined(_WIN32)
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 以只读方式映射整个文件。
+【参数】
+    Path: 文件的位置。
+【返回值】 无
+    如果文件无法打开或映射，抛出 FileOpenException。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+MappedFile::MappedFile(string Path) {
+#if defined(_WIN32)
+    // 允许其他进程同时写入或替换文件，与 fopen 的行为一致
+    HANDLE hFile = CreateFileA(
+        Path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr
+    );
+    if (hFile == INVALID_HANDLE_VALUE) {
+        throw FileOpenException(Path);
+    }
+    LARGE_INTEGER FileSize;
+    if (!GetFileSizeEx(hFile, &FileSize)) {
+        CloseHandle(hFile);
+        throw FileOpenException(Path);
+    }
+    m_Size = static_cast<size_t>(FileSize.QuadPart);
+    // 长度为 0 的文件无法映射
+    if (m_Size > 0) {
+        HANDLE hMapping = CreateFileMappingA(
+            hFile,
+            nullptr,
+            PAGE_READONLY,
+            0,
+            0,
+            nullptr
+        );
+        // 视图保持对映射与文件的引用，句柄可以立即关闭
+        if (hMapping != nullptr) {
+            m_pData = static_cast<const char*>(
+                MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0)
+            );
+            CloseHandle(hMapping);
+        }
+    }
+    CloseHandle(hFile);
+#else
+    int File = open(Path.c_str(), O_RDONLY);
+    if (File < 0) {
+        throw FileOpenException(Path);
+    }
+    struct stat Status;
+    if (fstat(File, &Status) != 0) {
+        close(File);
+        throw FileOpenException(Path);
+    }
+    m_Size = static_cast<size_t>(Status.st_size);
+    // 长度为 0 的文件无法映射
+    if (m_Size > 0) {
+        void* pData = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, File, 0);
+        if (pData != MAP_FAILED) {
+            m_pData = static_cast<const char*>(pData);
+        }
+    }
+    // 映射保持对文件的引用，描述符可以立即关闭
+    close(File);
+#endif
+    if (m_Size > 0 && m_pData == nullptr) {
+        throw FileOpenException(Path);
+    }
+}
+
+/**********************************************************************
+【函数名称】 析构函数
+【函数功能】 解除映射。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+MappedFile::~MappedFile() {
+    if (m_pData == nullptr) {
+        return;
+    }
+#if defined(_WIN32)
+    UnmapViewOfFile(m_pData);
+#else
+    munmap(const_cast<char*>(m_pData), m_Size);
+#endif
+}
+
+/**********************************************************************
+【函数名称】 GetData
+【函数功能】 获取映射的起始地址。
+【参数】 无
+【返回值】
+    映射的起始地址，在对象析构前有效；文件为空时为空指针。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+const char* MappedFile::GetData() const {
+    return m_pData;
+}
+
+/**********************************************************************
+【函数名称】 GetSize
+【函数功能】 获取文件的字节数。
+【参数】 无
+【返回值】
+    文件的字节数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t MappedFile::GetSize() const {
+    return m_Size;
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+/*************************************************************************
+【文件名】 MappedFile.hpp
+【功能模块和目的】 MappedFile 类将文件以只读方式映射到内存。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 MappedFile
+【功能】 将整个文件以只读方式映射到内存，POSIX 上使用 mmap，
+    Windows 上使用 MapViewOfFile。数据由操作系统按页读入，
+    不经过流的缓冲区，也不复制到堆上。
+    映射期间文件被截断时，访问超出新长度的数据的行为由操作系统决定。
+【接口说明】
+    构造与析构：
+        接受文件位置的构造函数。
+        删除拷贝构造函数。
+        析构函数，解除映射。
+    属性：
+        GetData: 获取映射的起始地址。
+        GetSize: 获取文件的字节数。
+    操作符：
+        删除赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class MappedFile final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以只读方式映射整个文件。
+        【参数】
+            Path: 文件的位置。
+        【返回值】 无
+            如果文件无法打开或映射，抛出 FileOpenException。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit MappedFile(string Path);
+        // 删除拷贝构造函数
+        MappedFile(const MappedFile& Other) = delete;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetData
+        【函数功能】 获取映射的起始地址。
+        【参数】 无
+        【返回值】
+            映射的起始地址，在对象析构前有效；文件为空时为空指针。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        const char* GetData() const;
+        /**********************************************************************
+        【函数名称】 GetSize
+        【函数功能】 获取文件的字节数。
+        【参数】 无
+        【返回值】
+            文件的字节数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetSize() const;
+
+        // 操作符
+
+        // 删除赋值运算符
+        MappedFile& operator=(const MappedFile& Other) = delete;
+
+        /**********************************************************************
+        【函数名称】 析构函数
+        【函数功能】 解除映射。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        ~MappedFile();
+
+    private:
+        // 映射的起始地址，文件为空时为空指针
+        const char* m_pData { nullptr };
+        // 文件的字节数
+        size_t m_Size { 0 };
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,174 @@
+/*************************************************************************
+【文件名】 OrientedBox.hpp
+【功能模块和目的】 OrientedBox 类表示一个棱方向任意的长方体。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef ORIENTED_BOX_HPP
+#define ORIENTED_BOX_HPP
+
+#include <array>
+#include <cstddef>
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Core/Vector.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 OrientedBox
+【功能】 定义一个棱方向任意的 N 维长方体（有向包围盒）。
+    使用中心、一组单位正交的轴与各轴上的半长确定。不能从 OrientedBox 继承。
+【接口说明】
+    成员：
+        DIMENSION: 表示维数。
+        Center: 长方体的中心。
+        Axes: 长方体的轴，单位正交。
+        HalfExtents: 长方体在各轴上的半长。
+    构造与析构：
+        默认构造函数，初始化为原点处、轴为坐标轴的退化长方体。
+        接受中心、轴与半长的构造函数。
+        拷贝构造函数。
+        GetOrientedBoxOf: 使用主成分分析创建模型的有向包围盒。
+    属性：
+        GetVolume: 获取长方体的体积。
+    操作：
+        Contains: 判断点是否在长方体内。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N>
+class OrientedBox final {
+    public:
+        // 内嵌类型
+
+        // 轴的类型
+        using AxisArray = array<Vector<double, N>, N>;
+
+        // 成员
+
+        // 维数
+        static constexpr size_t DIMENSION { N };
+        // 中心
+        Point<N> Center;
+        // 单位正交的轴，按点在其上分布的方差从大到小排列
+        AxisArray Axes;
+        // 各轴上的半长
+        array<double, N> HalfExtents;
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化原点处、轴为坐标轴、半长为 0 的 OrientedBox 对象。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        OrientedBox();
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用中心、轴与半长初始化 OrientedBox 对象。
+        【参数】
+            Center: 中心。
+            Axes: 单位正交的轴。
+            HalfExtents: 各轴上的半长。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        OrientedBox(
+            const Point<N>& Center,
+            const AxisArray& Axes,
+            const array<double, N>& HalfExtents
+        );
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 OrientedBox 对象初始化 OrientedBox 对象。
+        【参数】
+            Other: 另一 OrientedBox 对象。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        OrientedBox(const OrientedBox<N>& Other) = default;
+        /**********************************************************************
+        【函数名称】 GetOrientedBoxOf
+        【函数功能】 获取模型的有向包围盒。对模型的点遍历两次：
+            第一次累加均值与协方差矩阵，以 Jacobi 方法求出其特征向量作为轴；
+            第二次求各点在轴上投影的范围，结果不大于轴对齐的包围盒。
+            不收集点，额外内存与点数无关。
+        【参数】
+            AModel: 模型。
+        【返回值】
+            包含模型中所有点的有向长方体，模型为空时为默认值。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static OrientedBox<N> GetOrientedBoxOf(const Model<N>& AModel);
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetVolume
+        【函数功能】 计算自身的体积。
+        【参数】 无
+        【返回值】
+            长方体体积。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        double GetVolume() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Contains
+        【函数功能】 判断点是否在长方体内（含边界，允许 EPSILON 的误差）。
+        【参数】
+            APoint: 要判断的点。
+        【返回值】
+            点是否在长方体内。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool Contains(const Point<N>& APoint) const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一长方体赋值给自身。
+        【参数】
+            Other: 从之取值的长方体。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        OrientedBox<N>& operator=(const OrientedBox<N>& Other) = default;
+
+    private:
+        // N×N 矩阵类型，按行存储
+        using Matrix = array<array<double, N>, N>;
+
+        // Jacobi 方法的最大轮数
+        static constexpr size_t MAX_SWEEPS { 64 };
+
+        /**********************************************************************
+        【函数名称】 Diagonalize
+        【函数功能】 使用循环 Jacobi 方法求实对称矩阵的特征值与特征向量。
+        【参数】
+            Symmetric: 实对称矩阵，结束时对角线为特征值。
+            Eigenvectors: 输出特征向量，第 i 列对应第 i 个特征值。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void Diagonalize(Matrix& Symmetric, Matrix& Eigenvectors);
+};
+
+}
+
+}
+
+#include "OrientedBox.tpp"
+
+#endif
\ No newline at end of file
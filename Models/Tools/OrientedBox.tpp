@@ -0,0 +1,267 @@
+/*************************************************************************
+【文件名】 OrientedBox.tpp
+【功能模块和目的】 为 OrientedBox.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include "OrientedBox.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Core/Vector.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化原点处、轴为坐标轴、半长为 0 的 OrientedBox 对象。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+OrientedBox<N>::OrientedBox() {
+    for (size_t i = 0; i < N; i++) {
+        Axes[i][i] = 1;
+    }
+    HalfExtents.fill(0);
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用中心、轴与半长初始化 OrientedBox 对象。
+【参数】
+    Center: 中心。
+    Axes: 单位正交的轴。
+    HalfExtents: 各轴上的半长。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+OrientedBox<N>::OrientedBox(
+    const Point<N>& Center,
+    const AxisArray& Axes,
+    const array<double, N>& HalfExtents
+): Center(Center), Axes(Axes), HalfExtents(HalfExtents) {}
+
+/**********************************************************************
+【函数名称】 GetOrientedBoxOf
+【函数功能】 获取模型的有向包围盒。对模型的点遍历两次：
+    第一次累加均值与协方差矩阵，以 Jacobi 方法求出其特征向量作为轴；
+    第二次求各点在轴上投影的范围，结果不大于轴对齐的包围盒。
+    不收集点，额外内存与点数无关。
+【参数】
+    AModel: 模型。
+【返回值】
+    包含模型中所有点的有向长方体，模型为空时为默认值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+OrientedBox<N> OrientedBox<N>::GetOrientedBoxOf(const Model<N>& AModel) {
+    // 以第一个点为参考点累加，避免坐标较大时协方差的相消误差
+    size_t ullCount = 0;
+    array<double, N> Reference {};
+    array<double, N> Sums {};
+    Matrix Products {};
+    AModel.ForEachPoint([&](const Point<N>& APoint) {
+        if (ullCount == 0) {
+            for (size_t i = 0; i < N; i++) {
+                Reference[i] = APoint[i];
+            }
+        }
+        array<double, N> Delta;
+        for (size_t i = 0; i < N; i++) {
+            Delta[i] = APoint[i] - Reference[i];
+            Sums[i] += Delta[i];
+        }
+        for (size_t i = 0; i < N; i++) {
+            for (size_t j = i; j < N; j++) {
+                Products[i][j] += Delta[i] * Delta[j];
+            }
+        }
+        ullCount++;
+    });
+    if (ullCount == 0) {
+        return OrientedBox<N>();
+    }
+    Matrix Covariance;
+    for (size_t i = 0; i < N; i++) {
+        for (size_t j = i; j < N; j++) {
+            Covariance[i][j] = Products[i][j] / ullCount
+                - Sums[i] / ullCount * (Sums[j] / ullCount);
+            Covariance[j][i] = Covariance[i][j];
+        }
+    }
+    Matrix Eigenvectors;
+    Diagonalize(Covariance, Eigenvectors);
+    // 按特征值从大到小排列轴
+    array<size_t, N> Order;
+    for (size_t i = 0; i < N; i++) {
+        Order[i] = i;
+    }
+    sort(Order.begin(), Order.end(), [&Covariance](size_t Left, size_t Right) {
+        return Covariance[Left][Left] > Covariance[Right][Right];
+    });
+    AxisArray Axes;
+    for (size_t k = 0; k < N; k++) {
+        for (size_t i = 0; i < N; i++) {
+            Axes[k][i] = Eigenvectors[i][Order[k]];
+        }
+    }
+    // 同时求坐标轴方向的范围，主成分不明显（如立方体）时
+    // 主轴可能偏离最优方向，此时改用轴对齐的长方体
+    array<array<double, N>, 2> Minimums;
+    Minimums[0].fill(numeric_limits<double>::max());
+    Minimums[1].fill(numeric_limits<double>::max());
+    array<array<double, N>, 2> Maximums;
+    Maximums[0].fill(numeric_limits<double>::lowest());
+    Maximums[1].fill(numeric_limits<double>::lowest());
+    AModel.ForEachPoint([&](const Point<N>& APoint) {
+        for (size_t k = 0; k < N; k++) {
+            double rProjection = 0;
+            for (size_t i = 0; i < N; i++) {
+                rProjection += (APoint[i] - Reference[i]) * Axes[k][i];
+            }
+            Minimums[0][k] = min(Minimums[0][k], rProjection);
+            Maximums[0][k] = max(Maximums[0][k], rProjection);
+            Minimums[1][k] = min(Minimums[1][k], APoint[k] - Reference[k]);
+            Maximums[1][k] = max(Maximums[1][k], APoint[k] - Reference[k]);
+        }
+    });
+    array<double, 2> Volumes { { 1, 1 } };
+    for (size_t ullCandidate = 0; ullCandidate < 2; ullCandidate++) {
+        for (size_t k = 0; k < N; k++) {
+            Volumes[ullCandidate] *= 
+                Maximums[ullCandidate][k] - Minimums[ullCandidate][k];
+        }
+    }
+    size_t ullBest = 0;
+    if (Volumes[1] < Volumes[0]) {
+        ullBest = 1;
+        Axes = OrientedBox<N>().Axes;
+    }
+    array<double, N> CenterCoords = Reference;
+    array<double, N> HalfExtents;
+    for (size_t k = 0; k < N; k++) {
+        double rMiddle = (Minimums[ullBest][k] + Maximums[ullBest][k]) / 2;
+        for (size_t i = 0; i < N; i++) {
+            CenterCoords[i] += rMiddle * Axes[k][i];
+        }
+        HalfExtents[k] = (Maximums[ullBest][k] - Minimums[ullBest][k]) / 2;
+    }
+    return OrientedBox<N>(Point<N>(CenterCoords), Axes, HalfExtents);
+}
+
+/**********************************************************************
+【函数名称】 GetVolume
+【函数功能】 计算自身的体积。
+【参数】 无
+【返回值】
+    长方体体积。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+double OrientedBox<N>::GetVolume() const {
+    double rVolume = 1;
+    for (size_t i = 0; i < N; i++) {
+        rVolume *= 2 * HalfExtents[i];
+    }
+    return rVolume;
+}
+
+/**********************************************************************
+【函数名称】 Contains
+【函数功能】 判断点是否在长方体内（含边界，允许 EPSILON 的误差）。
+【参数】
+    APoint: 要判断的点。
+【返回值】
+    点是否在长方体内。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+bool OrientedBox<N>::Contains(const Point<N>& APoint) const {
+    for (size_t k = 0; k < N; k++) {
+        double rProjection = 0;
+        for (size_t i = 0; i < N; i++) {
+            rProjection += (APoint[i] - Center[i]) * Axes[k][i];
+        }
+        if (fabs(rProjection) > HalfExtents[k] + Vector<double, N>::EPSILON) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Diagonalize
+【函数功能】 使用循环 Jacobi 方法求实对称矩阵的特征值与特征向量。
+【参数】
+    Symmetric: 实对称矩阵，结束时对角线为特征值。
+    Eigenvectors: 输出特征向量，第 i 列对应第 i 个特征值。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+void OrientedBox<N>::Diagonalize(Matrix& Symmetric, Matrix& Eigenvectors) {
+    for (size_t i = 0; i < N; i++) {
+        Eigenvectors[i].fill(0);
+        Eigenvectors[i][i] = 1;
+    }
+    for (size_t ullSweep = 0; ullSweep < MAX_SWEEPS; ullSweep++) {
+        double rOffDiagonal = 0;
+        double rDiagonal = 0;
+        for (size_t i = 0; i < N; i++) {
+            rDiagonal += Symmetric[i][i] * Symmetric[i][i];
+            for (size_t j = i + 1; j < N; j++) {
+                rOffDiagonal += Symmetric[i][j] * Symmetric[i][j];
+            }
+        }
+        // 非对角元相对于对角元可以忽略时收敛
+        if (rOffDiagonal <= rDiagonal * 1e-30) {
+            break;
+        }
+        for (size_t p = 0; p < N; p++) {
+            for (size_t q = p + 1; q < N; q++) {
+                if (Symmetric[p][q] == 0) {
+                    continue;
+                }
+                // 选取使 (p, q) 元为 0 的旋转中绝对值较小的角
+                double rTheta = (Symmetric[q][q] - Symmetric[p][p])
+                    / (2 * Symmetric[p][q]);
+                double rTangent = (rTheta >= 0 ? 1.0 : -1.0)
+                    / (fabs(rTheta) + sqrt(rTheta * rTheta + 1));
+                double rCosine = 1 / sqrt(rTangent * rTangent + 1);
+                double rSine = rTangent * rCosine;
+                for (size_t k = 0; k < N; k++) {
+                    double rKP = Symmetric[k][p];
+                    double rKQ = Symmetric[k][q];
+                    Symmetric[k][p] = rCosine * rKP - rSine * rKQ;
+                    Symmetric[k][q] = rSine * rKP + rCosine * rKQ;
+                }
+                for (size_t k = 0; k < N; k++) {
+                    double rPK = Symmetric[p][k];
+                    double rQK = Symmetric[q][k];
+                    Symmetric[p][k] = rCosine * rPK - rSine * rQK;
+                    Symmetric[q][k] = rSine * rPK + rCosine * rQK;
+                }
+                for (size_t k = 0; k < N; k++) {
+                    double rKP = Eigenvectors[k][p];
+                    double rKQ = Eigenvectors[k][q];
+                    Eigenvectors[k][p] = rCosine * rKP - rSine * rKQ;
+                    Eigenvectors[k][q] = rSine * rKP + rCosine * rKQ;
+                }
+            }
+        }
+    }
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*************************************************************************
+【文件名】 Parallel.cpp
+【功能模块和目的】 为 Parallel.hpp 提供非模板实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include "Parallel.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+// 每个线程至少处理的元素个数。
+constexpr size_t Parallel::MIN_GRAIN;
+
+/**********************************************************************
+【函数名称】 GetThreadCount
+【函数功能】 获取可用的线程数量。
+【参数】 无
+【返回值】
+    硬件支持的并发线程数量，至少为 1。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t Parallel::GetThreadCount() {
+    // hardware_concurrency 在无法确定时返回 0
+    static const size_t ullThreadCount = max(
+        static_cast<size_t>(thread::hardware_concurrency()), 
+        static_cast<size_t>(1)
+    );
+    return ullThreadCount;
+}
+
+/**********************************************************************
+【函数名称】 GetChunkCount
+【函数功能】 根据元素个数决定切分的块数。
+【参数】
+    Count: 元素的总个数。
+【返回值】
+    块的数量，至少为 1。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t Parallel::GetChunkCount(size_t Count) {
+    size_t ullChunkCount = Count / MIN_GRAIN;
+    return max(min(ullChunkCount, GetThreadCount()), static_cast<size_t>(1));
+}
+
+}
+
+}
\ No newline at end of file
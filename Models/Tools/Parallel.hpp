@@ -0,0 +1,119 @@
+/*************************************************************************
+【文件名】 Parallel.hpp
+【功能模块和目的】 Parallel 类提供简单的多线程分块执行工具。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <cstddef>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 Parallel
+【功能】 将 [0, Count) 的下标区间切分为连续的块，分配到多个线程执行。
+【接口说明】
+    成员：
+        MIN_GRAIN: 每个线程至少处理的元素个数。
+    构造函数：
+        私有默认构造函数。
+    属性：
+        GetThreadCount: 获取可用的线程数量。
+        GetChunkCount: 根据元素个数决定切分的块数。
+    操作：
+        For: 并行地对每个块执行函数。
+        Reduce: 并行地对每个块求值，并将结果按块的顺序合并。
+        ForChunks: 按指定的块数并行执行，函数可得知块的编号。
+    * 元素较少时直接在调用线程中执行，不创建线程。
+    * 任一线程抛出的异常会在所有线程结束后在调用线程中重新抛出。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class Parallel final {
+    public:
+        // 成员
+
+        // 每个线程至少处理的元素个数，避免线程创建的开销超过计算本身。
+        static constexpr size_t MIN_GRAIN { 16384 };
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetThreadCount
+        【函数功能】 获取可用的线程数量。
+        【参数】 无
+        【返回值】
+            硬件支持的并发线程数量，至少为 1。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static size_t GetThreadCount();
+        /**********************************************************************
+        【函数名称】 GetChunkCount
+        【函数功能】 根据元素个数决定切分的块数。
+        【参数】
+            Count: 元素的总个数。
+        【返回值】
+            块的数量，至少为 1。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static size_t GetChunkCount(size_t Count);
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 For
+        【函数功能】 将 [0, Count) 切分为连续的块并行执行。
+        【参数】
+            Count: 元素的总个数。
+            Function: 形如 void(size_t Begin, size_t End) 的函数，
+                处理 [Begin, End) 区间内的元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename F>
+        static void For(size_t Count, F Function);
+        /**********************************************************************
+        【函数名称】 Reduce
+        【函数功能】 将 [0, Count) 切分为连续的块并行求值，再按顺序合并。
+        【参数】
+            Count: 元素的总个数。
+            Identity: 合并运算的单位元，即空区间的结果。
+            Map: 形如 T(size_t Begin, size_t End) 的函数，求一个块的结果。
+            Combine: 形如 T(const T& Left, const T& Right) 的函数，合并结果。
+        【返回值】
+            所有块合并后的结果。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename T, typename M, typename C>
+        static T Reduce(size_t Count, const T& Identity, M Map, C Combine);
+        /**********************************************************************
+        【函数名称】 ForChunks
+        【函数功能】 将 [0, Count) 切分为 ChunkCount 个连续的块并行执行。
+            参数相同时块的边界总是相同，第 i 块为
+            [Count * i / ChunkCount, Count * (i + 1) / ChunkCount)。
+        【参数】
+            Count: 元素的总个数。
+            ChunkCount: 块的数量。
+            Function: 形如 void(size_t Chunk, size_t Begin, size_t End) 的函数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename F>
+        static void ForChunks(size_t Count, size_t ChunkCount, F Function);
+
+    private:
+        // 静态类，隐藏构造函数。
+        Parallel();
+};
+
+}
+
+}
+
+#include "Parallel.tpp"
+
+#endif
\ No newline at end of file
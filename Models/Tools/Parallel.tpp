@@ -0,0 +1,120 @@
+/*************************************************************************
+【文件名】 Parallel.tpp
+【功能模块和目的】 为 Parallel.hpp 提供模板实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+#include "Parallel.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 For
+【函数功能】 将 [0, Count) 切分为连续的块并行执行。
+【参数】
+    Count: 元素的总个数。
+    Function: 形如 void(size_t Begin, size_t End) 的函数，
+        处理 [Begin, End) 区间内的元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename F>
+void Parallel::For(size_t Count, F Function) {
+    ForChunks(
+        Count, 
+        GetChunkCount(Count), 
+        [&Function](size_t, size_t Begin, size_t End) {
+            Function(Begin, End);
+        }
+    );
+}
+
+/**********************************************************************
+【函数名称】 Reduce
+【函数功能】 将 [0, Count) 切分为连续的块并行求值，再按顺序合并。
+【参数】
+    Count: 元素的总个数。
+    Identity: 合并运算的单位元，即空区间的结果。
+    Map: 形如 T(size_t Begin, size_t End) 的函数，求一个块的结果。
+    Combine: 形如 T(const T& Left, const T& Right) 的函数，合并结果。
+【返回值】
+    所有块合并后的结果。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename T, typename M, typename C>
+T Parallel::Reduce(size_t Count, const T& Identity, M Map, C Combine) {
+    size_t ullChunkCount = GetChunkCount(Count);
+    vector<T> Partials(ullChunkCount, Identity);
+    ForChunks(
+        Count, 
+        ullChunkCount, 
+        [&Partials, &Map](size_t Chunk, size_t Begin, size_t End) {
+            Partials[Chunk] = Map(Begin, End);
+        }
+    );
+    // 按块的顺序合并，保证结果与线程调度无关
+    T Result = Identity;
+    for (auto& Partial: Partials) {
+        Result = Combine(Result, Partial);
+    }
+    return Result;
+}
+
+/**********************************************************************
+【函数名称】 ForChunks
+【函数功能】 将 [0, Count) 切分为 ChunkCount 个连续的块并行执行。
+【参数】
+    Count: 元素的总个数。
+    ChunkCount: 块的数量。
+    Function: 形如 void(size_t Chunk, size_t Begin, size_t End) 的函数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename F>
+void Parallel::ForChunks(size_t Count, size_t ChunkCount, F Function) {
+    if (ChunkCount <= 1) {
+        Function(0, 0, Count);
+        return;
+    }
+    vector<thread> Threads;
+    vector<exception_ptr> Errors(ChunkCount);
+    Threads.reserve(ChunkCount - 1);
+    // 第 0 块由调用线程自己执行
+    for (size_t i = 1; i < ChunkCount; i++) {
+        size_t ullBegin = Count * i / ChunkCount;
+        size_t ullEnd = Count * (i + 1) / ChunkCount;
+        Threads.emplace_back([&Function, &Errors, i, ullBegin, ullEnd]() {
+            try {
+                Function(i, ullBegin, ullEnd);
+            }
+            catch (...) {
+                Errors[i] = current_exception();
+            }
+        });
+    }
+    try {
+        Function(0, 0, Count / ChunkCount);
+    }
+    catch (...) {
+        Errors[0] = current_exception();
+    }
+    for (auto& AThread: Threads) {
+        AThread.join();
+    }
+    for (auto& Error: Errors) {
+        if (Error) {
+            rethrow_exception(Error);
+        }
+    }
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+/*************************************************************************
+【文件名】 PointEqual.hpp
+【功能模块和目的】 PointEqual 类为点提供精确的相等比较，用于无序容器。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef POINT_EQUAL_HPP
+#define POINT_EQUAL_HPP
+
+#include <cstddef>
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 PointEqual
+【功能】 N 维点的相等比较函数对象，总是逐分量精确比较，不使用 EPSILON
+    容差，与 PointHash 一同作为无序容器的键比较。容差比较不满足传递性，
+    且容差内的两个点可能落入不同的哈希桶，不能用于无序容器。
+【接口说明】 
+    操作符：
+        operator(): 判断两个点是否精确相等。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N>
+class PointEqual final {
+    public:
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator()
+        【函数功能】 判断两个点是否精确相等。0.0 与 -0.0 视为相等。
+        【参数】
+            Left: 要判断的第一个点。
+            Right: 要判断的第二个点。
+        【返回值】
+            两个点是否精确相等。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool operator()(const Point<N>& Left, const Point<N>& Right) const;
+};
+
+}
+
+}
+
+#include "PointEqual.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,37 @@
+/*************************************************************************
+【文件名】 PointEqual.tpp
+【功能模块和目的】 为 PointEqual.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include "PointEqual.hpp"
+#include "../Core/Point.hpp"
+#include "../Core/Vector.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 operator()
+【函数功能】 判断两个点是否精确相等。0.0 与 -0.0 视为相等。
+【参数】
+    Left: 要判断的第一个点。
+    Right: 要判断的第二个点。
+【返回值】
+    两个点是否精确相等。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+bool PointEqual<N>::operator()(
+    const Point<N>& Left, 
+    const Point<N>& Right
+) const {
+    return Vector<double, N>::IsEqual(Left, Right, true);
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+/*************************************************************************
+【文件名】 PointHash.hpp
+【功能模块和目的】 PointHash 类为点提供哈希函数，用于无序容器。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef POINT_HASH_HPP
+#define POINT_HASH_HPP
+
+#include <cstddef>
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 PointHash
+【功能】 N 维点的哈希函数对象，对坐标的值求哈希，与 PointEqual 的
+    精确比较保持一致，须与 PointEqual 一同使用。不与 EPSILON 容差的
+    比较一致：容差内的两个点通常具有不同的哈希值。
+【接口说明】 
+    操作符：
+        operator(): 求点的哈希值。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N>
+class PointHash final {
+    public:
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator()
+        【函数功能】 求点的哈希值。精确相等的点具有相同的哈希值。
+        【参数】
+            APoint: 要求哈希值的点。
+        【返回值】
+            点的哈希值。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t operator()(const Point<N>& APoint) const;
+};
+
+}
+
+}
+
+#include "PointHash.tpp"
+
+#endif
\ No newline at end of file
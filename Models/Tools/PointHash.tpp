@@ -0,0 +1,40 @@
+/*************************************************************************
+【文件名】 PointHash.tpp
+【功能模块和目的】 为 PointHash.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include <functional>
+#include "PointHash.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 operator()
+【函数功能】 求点的哈希值。精确相等的点具有相同的哈希值。
+【参数】
+    APoint: 要求哈希值的点。
+【返回值】
+    点的哈希值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+size_t PointHash<N>::operator()(const Point<N>& APoint) const {
+    // hash<double> 对 0.0 与 -0.0 给出相同的值，与 == 一致
+    hash<double> Hasher;
+    size_t ullSeed = 0;
+    for (size_t i = 0; i < N; i++) {
+        ullSeed ^= Hasher(APoint[i]) 
+            + 0x9e3779b97f4a7c15ULL + (ullSeed << 6) + (ullSeed >> 2);
+    }
+    return ullSeed;
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+/*************************************************************************
+【文件名】 RadixSort.cpp
+【功能模块和目的】 为 RadixSort.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include "Parallel.hpp"
+#include "RadixSort.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+// 每趟处理的位数
+constexpr size_t RadixSort::DIGIT_BITS;
+// 每趟的桶数
+constexpr size_t RadixSort::BUCKET_COUNT;
+
+/**********************************************************************
+【函数名称】 GetOrder
+【函数功能】 稳定地排序键，求排序后每个位置上的原下标。
+【参数】
+    Keys: 要排序的键。
+【返回值】
+    下标顺序，第 i 个元素为排序后第 i 小的键的原下标，
+    相等的键保持原有的相对顺序。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+vector<size_t> RadixSort::GetOrder(const vector<uint64_t>& Keys) {
+    size_t ullCount = Keys.size();
+    vector<uint64_t> SourceKeys(Keys);
+    vector<uint64_t> TargetKeys(ullCount);
+    vector<size_t> SourceOrder(ullCount);
+    vector<size_t> TargetOrder(ullCount);
+    iota(SourceOrder.begin(), SourceOrder.end(), 0);
+    // 统计与分发必须使用相同的块边界
+    size_t ullChunkCount = Parallel::GetChunkCount(ullCount);
+    vector<array<size_t, BUCKET_COUNT>> Offsets(ullChunkCount);
+    for (size_t ullShift = 0; ullShift < 64; ullShift += DIGIT_BITS) {
+        Parallel::ForChunks(
+            ullCount,
+            ullChunkCount,
+            [&](size_t Chunk, size_t Begin, size_t End) {
+                array<size_t, BUCKET_COUNT>& Counts = Offsets[Chunk];
+                Counts.fill(0);
+                for (size_t i = Begin; i < End; i++) {
+                    Counts[(SourceKeys[i] >> ullShift) & (BUCKET_COUNT - 1)]++;
+                }
+            }
+        );
+        // 按桶优先、块其次的顺序求前缀和，得到每块每桶的起始位置
+        size_t ullTotal = 0;
+        bool bSingleBucket = false;
+        for (size_t Bucket = 0; Bucket < BUCKET_COUNT; Bucket++) {
+            size_t ullBucketBegin = ullTotal;
+            for (auto& Counts: Offsets) {
+                size_t ullBucketCount = Counts[Bucket];
+                Counts[Bucket] = ullTotal;
+                ullTotal += ullBucketCount;
+            }
+            if (ullTotal - ullBucketBegin == ullCount) {
+                bSingleBucket = true;
+            }
+        }
+        // 所有键落在同一个桶中，本趟不改变顺序
+        if (bSingleBucket) {
+            continue;
+        }
+        Parallel::ForChunks(
+            ullCount,
+            ullChunkCount,
+            [&](size_t Chunk, size_t Begin, size_t End) {
+                array<size_t, BUCKET_COUNT>& Positions = Offsets[Chunk];
+                for (size_t i = Begin; i < End; i++) {
+                    size_t ullPosition = Positions[
+                        (SourceKeys[i] >> ullShift) & (BUCKET_COUNT - 1)
+                    ]++;
+                    TargetKeys[ullPosition] = SourceKeys[i];
+                    TargetOrder[ullPosition] = SourceOrder[i];
+                }
+            }
+        );
+        swap(SourceKeys, TargetKeys);
+        swap(SourceOrder, TargetOrder);
+    }
+    return SourceOrder;
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*************************************************************************
+【文件名】 RadixSort.hpp
+【功能模块和目的】 RadixSort 类实现 64 位整数键的并行基数排序。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 RadixSort
+【功能】 对 64 位无符号整数键做稳定的低位优先基数排序，每趟处理 8 位。
+    每趟中各线程先统计自己块内每个桶的键数，前缀和后各块得到互不重叠的
+    写入位置，再并行地分发，因此结果与线程调度无关。
+    所有键在某一位上相同时跳过该趟。
+【接口说明】
+    成员：
+        DIGIT_BITS: 每趟处理的位数。
+        BUCKET_COUNT: 每趟的桶数。
+    构造函数：
+        私有默认构造函数。
+    操作：
+        GetOrder: 求使键升序排列的下标顺序。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class RadixSort final {
+    public:
+        // 成员
+
+        // 每趟处理的位数
+        static constexpr size_t DIGIT_BITS { 8 };
+        // 每趟的桶数
+        static constexpr size_t BUCKET_COUNT { 1 << DIGIT_BITS };
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 GetOrder
+        【函数功能】 稳定地排序键，求排序后每个位置上的原下标。
+        【参数】
+            Keys: 要排序的键。
+        【返回值】
+            下标顺序，第 i 个元素为排序后第 i 小的键的原下标，
+            相等的键保持原有的相对顺序。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static vector<size_t> GetOrder(const vector<uint64_t>& Keys);
+
+    private:
+        // 静态类，隐藏构造函数。
+        RadixSort();
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,218 @@
+/*************************************************************************
+【文件名】 Sphere.hpp
+【功能模块和目的】 Sphere 类表示一个 N 维球。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef SPHERE_HPP
+#define SPHERE_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 Sphere
+【功能】 定义一个 N 维球，使用球心与半径确定。不能从 Sphere 继承。
+【接口说明】
+    成员：
+        DIMENSION: 表示维数。
+        Center: 球心。
+        Radius: 半径。
+    构造与析构：
+        默认构造函数，初始化为原点处半径为 0 的球。
+        接受球心与半径的构造函数。
+        拷贝构造函数。
+        GetBoundingSphereOf: 使用 Welzl 算法创建模型的最小包围球。
+    属性：
+        GetVolume: 获取球的体积。
+    操作：
+        Contains: 判断点是否在球内。
+    操作符：
+        operator=: 默认赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N>
+class Sphere final {
+    public:
+        // 成员
+
+        // 维数
+        static constexpr size_t DIMENSION { N };
+        // 球心
+        Point<N> Center;
+        // 半径
+        double Radius;
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化原点处半径为 0 的 Sphere 对象。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Sphere();
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用球心与半径初始化 Sphere 对象。
+        【参数】
+            Center: 球心。
+            Radius: 半径。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Sphere(const Point<N>& Center, double Radius);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 Sphere 对象初始化 Sphere 对象。
+        【参数】
+            Other: 另一 Sphere 对象。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Sphere(const Sphere<N>& Other) = default;
+        /**********************************************************************
+        【函数名称】 GetBoundingSphereOf
+        【函数功能】 获取包含模型中所有点的最小球。遍历一次模型，
+            将点的坐标复制到连续数组并以固定种子打乱，
+            之后使用随机增量的 Welzl 算法，期望时间与点数成线性，
+            递归深度不超过 N + 1。
+        【参数】
+            AModel: 模型。
+        【返回值】
+            模型的最小包围球，模型为空时为默认值。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Sphere<N> GetBoundingSphereOf(const Model<N>& AModel);
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetVolume
+        【函数功能】 计算自身的（N 维）体积。
+        【参数】 无
+        【返回值】
+            球的体积。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        double GetVolume() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Contains
+        【函数功能】 判断点是否在球内（含边界，允许 EPSILON 的误差）。
+        【参数】
+            APoint: 要判断的点。
+        【返回值】
+            点是否在球内。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool Contains(const Point<N>& APoint) const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一球赋值给自身。
+        【参数】
+            Other: 从之取值的球。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Sphere<N>& operator=(const Sphere<N>& Other) = default;
+
+    private:
+        // 点的坐标
+        using Position = array<double, N>;
+        // 位于球面上的支撑点，至多 N + 1 个
+        using Support = array<Position, N + 1>;
+
+        /**********************************************************************
+        【类名】 Ball
+        【功能】 Welzl 算法中的球，以半径的平方表示。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        struct Ball {
+            // 球心
+            Position Center;
+            // 半径的平方，为负表示空集
+            double rRadiusSquared;
+        };
+
+        /**********************************************************************
+        【函数名称】 Enclose
+        【函数功能】 Welzl 算法的递归步骤，求包含前若干个点、
+            且以给定支撑点为边界的最小球。
+        【参数】
+            Positions: 所有点的坐标。
+            Count: 需要包含的点数，即 Positions 的前缀长度。
+            Boundary: 支撑点。
+            BoundaryCount: 支撑点的个数。
+        【返回值】
+            最小球。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Ball Enclose(
+            const vector<Position>& Positions,
+            size_t Count,
+            Support& Boundary,
+            size_t BoundaryCount
+        );
+        /**********************************************************************
+        【函数名称】 Circumscribe
+        【函数功能】 求支撑点在其仿射包中的外接球。
+            支撑点退化（仿射相关）时返回包含它们的近似球。
+        【参数】
+            Boundary: 支撑点。
+            BoundaryCount: 支撑点的个数。
+        【返回值】
+            外接球，没有支撑点时为空集。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static Ball Circumscribe(const Support& Boundary, size_t BoundaryCount);
+        /**********************************************************************
+        【函数名称】 IsInside
+        【函数功能】 判断点是否在球内，允许相对舍入误差。
+        【参数】
+            ABall: 球。
+            APosition: 点的坐标。
+        【返回值】
+            点是否在球内。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static bool IsInside(const Ball& ABall, const Position& APosition);
+        /**********************************************************************
+        【函数名称】 GetDistanceSquared
+        【函数功能】 求两点间距离的平方。
+        【参数】
+            Left: 第一个点。
+            Right: 第二个点。
+        【返回值】
+            距离的平方。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static double GetDistanceSquared(
+            const Position& Left,
+            const Position& Right
+        );
+};
+
+}
+
+}
+
+#include "Sphere.tpp"
+
+#endif
\ No newline at end of file
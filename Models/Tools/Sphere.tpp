@@ -0,0 +1,311 @@
+/*************************************************************************
+【文件名】 Sphere.tpp
+【功能模块和目的】 为 Sphere.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include "Sphere.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Core/Vector.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化原点处半径为 0 的 Sphere 对象。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+Sphere<N>::Sphere(): Radius(0) {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用球心与半径初始化 Sphere 对象。
+【参数】
+    Center: 球心。
+    Radius: 半径。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+Sphere<N>::Sphere(const Point<N>& Center, double Radius)
+    : Center(Center), Radius(Radius) {}
+
+/**********************************************************************
+【函数名称】 GetBoundingSphereOf
+【函数功能】 获取包含模型中所有点的最小球。遍历一次模型，
+    将点的坐标复制到连续数组并以固定种子打乱，
+    之后使用随机增量的 Welzl 算法，期望时间与点数成线性，
+    递归深度不超过 N + 1。
+【参数】
+    AModel: 模型。
+【返回值】
+    模型的最小包围球，模型为空时为默认值。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+Sphere<N> Sphere<N>::GetBoundingSphereOf(const Model<N>& AModel) {
+    // Welzl 算法需要随机访问，重复的点不影响结果，无需查重
+    vector<Position> Positions;
+    Positions.reserve(AModel.Lines.Count() * 2 + AModel.Faces.Count() * 3);
+    AModel.ForEachPoint([&Positions](const Point<N>& APoint) {
+        Position APosition;
+        for (size_t i = 0; i < N; i++) {
+            APosition[i] = APoint[i];
+        }
+        Positions.push_back(APosition);
+    });
+    if (Positions.empty()) {
+        return Sphere<N>();
+    }
+    // 随机顺序保证期望线性时间，固定种子使结果可以复现
+    shuffle(Positions.begin(), Positions.end(), mt19937());
+    Support Boundary;
+    Ball Result = Enclose(Positions, Positions.size(), Boundary, 0);
+    // 比较时允许了舍入误差，最后以实际的最远距离作为半径
+    double rRadiusSquared = 0;
+    for (auto& APosition: Positions) {
+        rRadiusSquared = max(
+            rRadiusSquared,
+            GetDistanceSquared(Result.Center, APosition)
+        );
+    }
+    return Sphere<N>(Point<N>(Result.Center), sqrt(rRadiusSquared));
+}
+
+/**********************************************************************
+【函数名称】 GetVolume
+【函数功能】 计算自身的（N 维）体积。
+【参数】 无
+【返回值】
+    球的体积。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+double Sphere<N>::GetVolume() const {
+    // N 维单位球的体积为 π^(N/2) / Γ(N/2 + 1)
+    const double rPi = acos(-1.0);
+    return pow(rPi, N / 2.0) / tgamma(N / 2.0 + 1) * pow(Radius, N);
+}
+
+/**********************************************************************
+【函数名称】 Contains
+【函数功能】 判断点是否在球内（含边界，允许 EPSILON 的误差）。
+【参数】
+    APoint: 要判断的点。
+【返回值】
+    点是否在球内。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+bool Sphere<N>::Contains(const Point<N>& APoint) const {
+    return Point<N>::Distance(Center, APoint)
+        <= Radius + Vector<double, N>::EPSILON;
+}
+
+/**********************************************************************
+【函数名称】 Enclose
+【函数功能】 Welzl 算法的递归步骤，求包含前若干个点、
+    且以给定支撑点为边界的最小球。
+【参数】
+    Positions: 所有点的坐标。
+    Count: 需要包含的点数，即 Positions 的前缀长度。
+    Boundary: 支撑点。
+    BoundaryCount: 支撑点的个数。
+【返回值】
+    最小球。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+typename Sphere<N>::Ball Sphere<N>::Enclose(
+    const vector<Position>& Positions,
+    size_t Count,
+    Support& Boundary,
+    size_t BoundaryCount
+) {
+    Ball Result = Circumscribe(Boundary, BoundaryCount);
+    // N + 1 个支撑点已唯一确定球
+    if (BoundaryCount == N + 1) {
+        return Result;
+    }
+    for (size_t i = 0; i < Count; i++) {
+        if (!IsInside(Result, Positions[i])) {
+            // 不在当前球内的点必在前 i + 1 个点的最小球的边界上，
+            // 更深的递归只写入 Boundary 中更靠后的位置
+            Boundary[BoundaryCount] = Positions[i];
+            Result = Enclose(Positions, i, Boundary, BoundaryCount + 1);
+        }
+    }
+    return Result;
+}
+
+/**********************************************************************
+【函数名称】 Circumscribe
+【函数功能】 求支撑点在其仿射包中的外接球。
+    支撑点退化（仿射相关）时返回包含它们的近似球。
+【参数】
+    Boundary: 支撑点。
+    BoundaryCount: 支撑点的个数。
+【返回值】
+    外接球，没有支撑点时为空集。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+typename Sphere<N>::Ball Sphere<N>::Circumscribe(
+    const Support& Boundary,
+    size_t BoundaryCount
+) {
+    Ball Result;
+    Result.Center.fill(0);
+    Result.rRadiusSquared = -1;
+    if (BoundaryCount == 0) {
+        return Result;
+    }
+    // 球心为 P0 + Σ λj·Vj，其中 Vj = Pj - P0，
+    // 由 |C - Pj| = |C - P0| 得到 Σ 2(Vi·Vj)λj = Vi·Vi
+    size_t ullSize = BoundaryCount - 1;
+    array<array<double, N + 1>, N> Equations {};
+    array<array<double, N>, N> Edges;
+    double rScale = 0;
+    for (size_t i = 0; i < ullSize; i++) {
+        for (size_t k = 0; k < N; k++) {
+            Edges[i][k] = Boundary[i + 1][k] - Boundary[0][k];
+        }
+    }
+    for (size_t i = 0; i < ullSize; i++) {
+        for (size_t j = 0; j < ullSize; j++) {
+            for (size_t k = 0; k < N; k++) {
+                Equations[i][j] += 2 * Edges[i][k] * Edges[j][k];
+            }
+        }
+        Equations[i][ullSize] = Equations[i][i] / 2;
+        rScale = max(rScale, Equations[i][i]);
+    }
+    // 列主元 Gauss 消元
+    bool bDegenerate = false;
+    for (size_t i = 0; i < ullSize && !bDegenerate; i++) {
+        size_t ullPivot = i;
+        for (size_t j = i + 1; j < ullSize; j++) {
+            if (fabs(Equations[j][i]) > fabs(Equations[ullPivot][i])) {
+                ullPivot = j;
+            }
+        }
+        if (fabs(Equations[ullPivot][i]) <= rScale * 1e-12) {
+            bDegenerate = true;
+            break;
+        }
+        swap(Equations[i], Equations[ullPivot]);
+        for (size_t j = i + 1; j < ullSize; j++) {
+            double rFactor = Equations[j][i] / Equations[i][i];
+            for (size_t k = i; k <= ullSize; k++) {
+                Equations[j][k] -= rFactor * Equations[i][k];
+            }
+        }
+    }
+    if (!bDegenerate) {
+        array<double, N> Lambdas;
+        for (size_t i = ullSize; i-- > 0;) {
+            double rValue = Equations[i][ullSize];
+            for (size_t j = i + 1; j < ullSize; j++) {
+                rValue -= Equations[i][j] * Lambdas[j];
+            }
+            Lambdas[i] = rValue / Equations[i][i];
+        }
+        Result.Center = Boundary[0];
+        for (size_t i = 0; i < ullSize; i++) {
+            for (size_t k = 0; k < N; k++) {
+                Result.Center[k] += Lambdas[i] * Edges[i][k];
+            }
+        }
+    }
+    else {
+        // 退化时以最远的两个支撑点的中点为球心
+        size_t ullFirst = 0;
+        size_t ullSecond = 0;
+        double rFarthest = -1;
+        for (size_t i = 0; i < BoundaryCount; i++) {
+            for (size_t j = i + 1; j < BoundaryCount; j++) {
+                double rDistance = GetDistanceSquared(
+                    Boundary[i],
+                    Boundary[j]
+                );
+                if (rDistance > rFarthest) {
+                    rFarthest = rDistance;
+                    ullFirst = i;
+                    ullSecond = j;
+                }
+            }
+        }
+        for (size_t k = 0; k < N; k++) {
+            Result.Center[k] = 
+                (Boundary[ullFirst][k] + Boundary[ullSecond][k]) / 2;
+        }
+    }
+    // 取到各支撑点距离的最大值，使所有支撑点都在球内
+    Result.rRadiusSquared = 0;
+    for (size_t i = 0; i < BoundaryCount; i++) {
+        Result.rRadiusSquared = max(
+            Result.rRadiusSquared,
+            GetDistanceSquared(Result.Center, Boundary[i])
+        );
+    }
+    return Result;
+}
+
+/**********************************************************************
+【函数名称】 IsInside
+【函数功能】 判断点是否在球内，允许相对舍入误差。
+【参数】
+    ABall: 球。
+    APosition: 点的坐标。
+【返回值】
+    点是否在球内。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+bool Sphere<N>::IsInside(const Ball& ABall, const Position& APosition) {
+    if (ABall.rRadiusSquared < 0) {
+        return false;
+    }
+    return GetDistanceSquared(ABall.Center, APosition)
+        <= ABall.rRadiusSquared * (1 + 1e-12);
+}
+
+/**********************************************************************
+【函数名称】 GetDistanceSquared
+【函数功能】 求两点间距离的平方。
+【参数】
+    Left: 第一个点。
+    Right: 第二个点。
+【返回值】
+    距离的平方。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+double Sphere<N>::GetDistanceSquared(
+    const Position& Left,
+    const Position& Right
+) {
+    double rDistance = 0;
+    for (size_t k = 0; k < N; k++) {
+        double rDelta = Left[k] - Right[k];
+        rDistance += rDelta * rDelta;
+    }
+    return rDistance;
+}
+
+}
+
+}
\ No newline at end of file
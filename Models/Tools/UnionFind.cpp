@@ -0,0 +1,96 @@
+/*************************************************************************
+【文件名】 UnionFind.cpp
+【功能模块和目的】 为 UnionFind.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "UnionFind.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化并查集，每个元素自成一个集合。
+【参数】
+    Count: 元素的个数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+UnionFind::UnionFind(size_t Count): m_Parents(Count) {
+    for (size_t i = 0; i < Count; i++) {
+        m_Parents[i].store(i, memory_order_relaxed);
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetCount
+【函数功能】 获取元素个数。
+【参数】 无
+【返回值】
+    元素个数。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t UnionFind::GetCount() const {
+    return m_Parents.size();
+}
+
+/**********************************************************************
+【函数名称】 Find
+【函数功能】 查找元素所在集合的根，并将经过的节点指向祖父节点。
+【参数】
+    Index: 元素的下标。
+【返回值】
+    集合的根。所有合并结束后，根是集合中最小的下标。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+size_t UnionFind::Find(size_t Index) {
+    size_t ullParent = m_Parents[Index].load();
+    while (ullParent != Index) {
+        size_t ullGrandParent = m_Parents[ullParent].load();
+        // 路径减半，失败说明其他线程已修改，忽略即可
+        m_Parents[Index].compare_exchange_weak(ullParent, ullGrandParent);
+        Index = ullGrandParent;
+        ullParent = m_Parents[Index].load();
+    }
+    return Index;
+}
+
+/**********************************************************************
+【函数名称】 Unite
+【函数功能】 合并两个元素所在的集合。
+【参数】
+    First: 第一个元素的下标。
+    Second: 第二个元素的下标。
+【返回值】
+    两元素原本是否属于不同的集合。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+bool UnionFind::Unite(size_t First, size_t Second) {
+    while (true) {
+        First = Find(First);
+        Second = Find(Second);
+        if (First == Second) {
+            return false;
+        }
+        // 较大的根挂到较小的根下
+        if (First < Second) {
+            swap(First, Second);
+        }
+        size_t ullExpected = First;
+        // 只有 First 仍是根时才能挂接，否则重新查找
+        if (m_Parents[First].compare_exchange_strong(ullExpected, Second)) {
+            return true;
+        }
+    }
+}
+
+}
+
+}
\ No newline at end of file
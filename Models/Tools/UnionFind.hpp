@@ -0,0 +1,118 @@
+/*************************************************************************
+【文件名】 UnionFind.hpp
+【功能模块和目的】 UnionFind 类实现可由多个线程同时使用的并查集。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef UNION_FIND_HPP
+#define UNION_FIND_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 UnionFind
+【功能】 无锁的并查集。Find 与 Unite 可由多个线程同时调用，
+    父节点使用原子变量并以 CAS 修改；合并时总将下标较大的根挂到较小的根下，
+    因此不会形成环，且每个集合的根是其中最小的下标。
+【接口说明】 
+    构造与析构：
+        接受元素个数的构造函数，每个元素自成一个集合。
+        删除拷贝构造函数。
+    属性：
+        GetCount: 获取元素个数。
+    操作：
+        Find: 查找元素所在集合的根，同时压缩路径。
+        Unite: 合并两个元素所在的集合。
+    操作符：
+        删除赋值运算符。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+class UnionFind final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化并查集，每个元素自成一个集合。
+        【参数】
+            Count: 元素的个数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        explicit UnionFind(size_t Count);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 原子变量不可复制，删除拷贝构造函数。
+        【参数】
+            Other: 另一个并查集。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        UnionFind(const UnionFind& Other) = delete;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetCount
+        【函数功能】 获取元素个数。
+        【参数】 无
+        【返回值】
+            元素个数。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t GetCount() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Find
+        【函数功能】 查找元素所在集合的根，并将经过的节点指向祖父节点。
+        【参数】
+            Index: 元素的下标。
+        【返回值】
+            集合的根。所有合并结束后，根是集合中最小的下标。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        size_t Find(size_t Index);
+        /**********************************************************************
+        【函数名称】 Unite
+        【函数功能】 合并两个元素所在的集合。
+        【参数】
+            First: 第一个元素的下标。
+            Second: 第二个元素的下标。
+        【返回值】
+            两元素原本是否属于不同的集合。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        bool Unite(size_t First, size_t Second);
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 原子变量不可复制，删除赋值运算符。
+        【参数】
+            Other: 另一个并查集。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        UnionFind& operator=(const UnionFind& Other) = delete;
+
+    private:
+        // 每个元素的父节点
+        vector<atomic<size_t>> m_Parents;
+};
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*************************************************************************
+【文件名】 Unroll.hpp
+【功能模块和目的】 Unroll 类在编译期展开次数固定的循环。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#ifndef UNROLL_HPP
+#define UNROLL_HPP
+
+#include <cstddef>
+#include "Constexpr.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 Unroll
+【功能】 静态类，将 for (size_t i = 0; i < N; i++) 形式的循环在编译期
+    展开为 N 次顺序调用，下标在内联后均为常量，
+    用于分量个数由模板参数确定的短循环。
+【接口说明】
+    构造函数：
+        私有默认构造函数。
+    操作：
+        For: 依次以 0 到 N - 1 调用函数。
+        All: 依次以 0 到 N - 1 调用谓词，遇到 false 时停止。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <size_t N>
+class Unroll final {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 For
+        【函数功能】 依次以 0 到 N - 1 调用函数。
+        【参数】
+            Function: 形如 void(size_t Index) 的函数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename F>
+        static C3W_CONSTEXPR void For(F&& Function);
+        /**********************************************************************
+        【函数名称】 All
+        【函数功能】 依次以 0 到 N - 1 调用谓词，遇到 false 时停止。
+        【参数】
+            Predicate: 形如 bool(size_t Index) 的函数。
+        【返回值】
+            是否对所有下标都返回 true，N 为 0 时为 true。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename P>
+        static C3W_CONSTEXPR bool All(P&& Predicate);
+
+    private:
+        // 静态类，隐藏构造函数。
+        Unroll();
+};
+
+/*************************************************************************
+【类名】 Unroll<0>
+【功能】 Unroll 的递归终点，不调用函数。
+【接口说明】 同 Unroll。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+template <>
+class Unroll<0> final {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 For
+        【函数功能】 不调用函数。
+        【参数】
+            Function: 形如 void(size_t Index) 的函数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename F>
+        static C3W_CONSTEXPR void For(F&& Function);
+        /**********************************************************************
+        【函数名称】 All
+        【函数功能】 不调用谓词。
+        【参数】
+            Predicate: 形如 bool(size_t Index) 的函数。
+        【返回值】
+            true。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        template <typename P>
+        static C3W_CONSTEXPR bool All(P&& Predicate);
+
+    private:
+        // 静态类，隐藏构造函数。
+        Unroll();
+};
+
+}
+
+}
+
+#include "Unroll.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,72 @@
+/*************************************************************************
+【文件名】 Unroll.tpp
+【功能模块和目的】 为 Unroll.hpp 提供实现。
+【开发者及日期】 赵一彤 2024/7/24
+*************************************************************************/
+
+#include <cstddef>
+#include "Unroll.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 For
+【函数功能】 依次以 0 到 N - 1 调用函数。
+【参数】
+    Function: 形如 void(size_t Index) 的函数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename F>
+C3W_CONSTEXPR inline void Unroll<N>::For(F&& Function) {
+    Unroll<N - 1>::For(Function);
+    Function(N - 1);
+}
+
+/**********************************************************************
+【函数名称】 All
+【函数功能】 依次以 0 到 N - 1 调用谓词，遇到 false 时停止。
+【参数】
+    Predicate: 形如 bool(size_t Index) 的函数。
+【返回值】
+    是否对所有下标都返回 true，N 为 0 时为 true。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <size_t N>
+template <typename P>
+C3W_CONSTEXPR inline bool Unroll<N>::All(P&& Predicate) {
+    return Unroll<N - 1>::All(Predicate) && Predicate(N - 1);
+}
+
+/**********************************************************************
+【函数名称】 For
+【函数功能】 不调用函数。
+【参数】
+    Function: 形如 void(size_t Index) 的函数。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename F>
+C3W_CONSTEXPR inline void Unroll<0>::For(F&&) {}
+
+/**********************************************************************
+【函数名称】 All
+【函数功能】 不调用谓词。
+【参数】
+    Predicate: 形如 bool(size_t Index) 的函数。
+【返回值】
+    true。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+template <typename P>
+C3W_CONSTEXPR inline bool Unroll<0>::All(P&&) {
+    return true;
+}
+
+}
+
+}
\ No newline at end of file
@@ -4,13 +4,17 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <chrono>
 #include <cmath>
+#include <csignal>
+#include <cstddef>
 #include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 #include "../ViewBase.hpp"
 #include "../../Controllers/ControllerBase.hpp"
 #include "ConsoleViewBase.hpp"
@@ -23,6 +27,11 @@ namespace Views {
 
 namespace Cli {
 
+// 等待后台任务时轮询的间隔毫秒数
+constexpr size_t ConsoleViewBase::POLL_INTERVAL;
+// 等待后台任务期间是否按下了 Ctrl+C
+volatile sig_atomic_t ConsoleViewBase::m_bInterrupted { 0 };
+
 /**********************************************************************
 【函数名称】 Display
 【函数功能】 向用户展示此视图。
@@ -190,6 +199,15 @@ string ConsoleViewBase::ResultToString(Result AResult) const {
         case Result::ELEMENT_COLLISION : {
             return "Identical element already exists in model.";
         }
+        case Result::TASK_RUNNING : {
+            return "Another background task is running.";
+        }
+        case Result::CANCELLED : {
+            return "Operation cancelled.";
+        }
+        case Result::FULL_SAVE_REQUIRED : {
+            return "No saved base file; use 'save' first.";
+        }
         case Result::INVALID_VALUE : {
             return "Entered value is invalid.";
         }
@@ -199,6 +217,43 @@ string ConsoleViewBase::ResultToString(Result AResult) const {
     }
 }
 
+/**********************************************************************
+【函数名称】 WaitForTask
+【函数功能】 每隔 POLL_INTERVAL 毫秒显示一次控制器后台任务的进度，
+    直到任务结束。等待期间按 Ctrl+C 取消任务而不是结束程序。
+【参数】
+    Message: 显示在进度前的说明。
+【返回值】
+    后台任务发生的错误。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ConsoleViewBase::Result ConsoleViewBase::WaitForTask(string Message) const {
+    Output << Palette::FG_GRAY << "(Press Ctrl+C to cancel)";
+    Output << Palette::CLEAR << endl;
+    m_bInterrupted = 0;
+    auto PreviousHandler = signal(SIGINT, OnInterrupt);
+    bool bFinished = false;
+    while (!bFinished) {
+        // 先判断再显示，使最后一次显示的是结束时的进度
+        bFinished = m_pController->IsTaskFinished();
+        if (m_bInterrupted) {
+            m_pController->CancelTask();
+        }
+        auto Progress = m_pController->GetTaskProgress();
+        Output << "\r" << Message << ": " << Progress.ProcessedBytes;
+        if (Progress.TotalBytes > 0) {
+            Output << " / " << Progress.TotalBytes;
+        }
+        Output << " bytes, " << Progress.ElementCount << " elements" << flush;
+        if (!bFinished) {
+            this_thread::sleep_for(chrono::milliseconds(POLL_INTERVAL));
+        }
+    }
+    signal(SIGINT, PreviousHandler);
+    Output << endl;
+    return static_cast<Result>(m_pController->EndTask());
+}
+
 /**********************************************************************
 【函数名称】 RegisterCommand
 【函数功能】 注册一个基于回调的命令。
@@ -288,6 +343,20 @@ ostream& operator<<(
     return Stream;
 }
 
+/**********************************************************************
+【函数名称】 OnInterrupt
+【函数功能】 等待后台任务期间的 SIGINT 处理函数，只记录按键。
+【参数】
+    Signal: 信号编号。
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+void ConsoleViewBase::OnInterrupt(int Signal) {
+    m_bInterrupted = 1;
+    // 部分平台在处理一次后恢复默认处理函数，重新注册
+    signal(Signal, OnInterrupt);
+}
+
 }
 
 }
@@ -7,6 +7,8 @@
 #ifndef CONSOLE_VIEW_BASE_HPP
 #define CONSOLE_VIEW_BASE_HPP
 
+#include <csignal>
+#include <cstddef>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -48,6 +50,7 @@ namespace Cli {
         Ask (protected): 询问用户特定问题。
         Select (protected): 让用户在选项中选择一项。
         ResultToString (protected): 将 Result 转化为字符串，虚函数。
+        WaitForTask (protected): 显示控制器后台任务的进度直到其结束。
         RegisterCommand (protected): 注册一个命令。子类应调用此函数。
         ShowHelp (protected): 显示帮助信息，用于 "?" 命令，虚函数。
 【开发者及日期】 赵一彤 2024/7/24
@@ -147,7 +150,10 @@ class ConsoleViewBase: public ViewBase {
             INDEX_OVERFLOW,
             POINT_INDEX_OVERFLOW,
             POINT_COLLISION,
-            ELEMENT_COLLISION
+            ELEMENT_COLLISION,
+            TASK_RUNNING,
+            CANCELLED,
+            FULL_SAVE_REQUIRED
         };
         
         /**********************************************************************
@@ -175,6 +181,17 @@ class ConsoleViewBase: public ViewBase {
             function<Result()> Handler,
             string Help
         );
+        /**********************************************************************
+        【函数名称】 WaitForTask
+        【函数功能】 每隔 POLL_INTERVAL 毫秒显示一次控制器后台任务的进度，
+            直到任务结束。等待期间按 Ctrl+C 取消任务而不是结束程序。
+        【参数】
+            Message: 显示在进度前的说明。
+        【返回值】
+            后台任务发生的错误。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result WaitForTask(string Message) const;
 
         /**********************************************************************
         【函数名称】 ShowHelp
@@ -211,7 +228,13 @@ class ConsoleViewBase: public ViewBase {
             BG_WHITE,
         };
 
+        // 等待后台任务时轮询的间隔毫秒数
+        static constexpr size_t POLL_INTERVAL { 100 };
+
     private:
+        // 等待后台任务期间是否按下了 Ctrl+C
+        static volatile sig_atomic_t m_bInterrupted;
+
         // 存储命令的结构体
         struct Command {
             function<Result()> Handler;
@@ -230,6 +253,15 @@ class ConsoleViewBase: public ViewBase {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         static float Likelihood(string Given, string Has);
+        /**********************************************************************
+        【函数名称】 OnInterrupt
+        【函数功能】 等待后台任务期间的 SIGINT 处理函数，只记录按键。
+        【参数】
+            Signal: 信号编号。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        static void OnInterrupt(int Signal);
 
     /**********************************************************************
     【函数名称】 operator<<
@@ -4,6 +4,7 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <iostream>
@@ -59,6 +60,16 @@ MainConsoleView::MainConsoleView(
         bind(&MainConsoleView::CommandSaveModel, this), 
         "Save loaded model."
     );
+    RegisterCommand(
+        "update",
+        bind(&MainConsoleView::CommandSaveChanges, this),
+        "Save changes to the original file incrementally."
+    );
+    RegisterCommand(
+        "journal",
+        bind(&MainConsoleView::CommandToggleJournal, this),
+        "Toggle logging every edit to a crash-safe journal."
+    );
     RegisterCommand(
         "lines",
         bind(&MainConsoleView::CommandLinesView, this),
@@ -74,6 +85,16 @@ MainConsoleView::MainConsoleView(
         bind(&MainConsoleView::CommandSetName, this),
         "Set name of model."
     );
+    RegisterCommand(
+        "simplify",
+        bind(&MainConsoleView::CommandSimplifyModel, this),
+        "Simplify model to a target face count."
+    );
+    RegisterCommand(
+        "reorder",
+        bind(&MainConsoleView::CommandReorderModel, this),
+        "Reorder lines and faces along a Morton curve."
+    );
 }
 
 /**********************************************************************
@@ -88,7 +109,10 @@ void MainConsoleView::Display() {
     Output << Palette::CLEAR << endl;
     string Path = Ask("Enter model path: ", true);
     if (!Path.empty()) {
-        Result Res = static_cast<Result>(m_pController->LoadModel(Path));
+        Result Res = static_cast<Result>(m_pController->BeginLoadModel(Path));
+        if (Res == Result::OK) {
+            Res = WaitForTask("Loading");
+        }
         if (Res != Result::OK) {
             Output << Palette::FG_RED;
             Output << "error: " << ResultToString(Res); 
@@ -174,6 +198,28 @@ ConsoleViewBase::Result MainConsoleView::CommandShowStatistics() const {
     Output << Palette::FG_PURPLE << "  Bounding Box Volume:";
     Output << Palette::CLEAR << "\t";
     Output << Stats.BoundingBoxVolume << std::endl;
+    Output << Palette::FG_PURPLE << "  Oriented Box Volume:";
+    Output << Palette::CLEAR << "\t";
+    Output << Stats.OrientedBoxVolume << std::endl;
+    Output << Palette::FG_PURPLE << "  Sphere Radius:";
+    Output << Palette::CLEAR << "\t";
+    Output << Stats.BoundingSphereRadius << std::endl;
+    Output << Palette::FG_PURPLE << "  Volume:";
+    Output << Palette::CLEAR << "\t\t";
+    Output << Stats.Volume << std::endl;
+    Output << Palette::FG_PURPLE << "  Centroid:";
+    Output << Palette::CLEAR << "\t\t";
+    Output << Stats.Centroid << std::endl;
+    Output << Palette::FG_PURPLE << "  Inertia Tensor:";
+    Output << Palette::CLEAR;
+    // 张量每行输出一行，与上方的值对齐
+    for (size_t i = 0; i < 3; i++) {
+        Output << (i == 0 ? "\t" : "\t\t\t");
+        for (size_t j = 0; j < 3; j++) {
+            Output << Stats.InertiaTensor[i][j] << (j == 2 ? "" : "\t");
+        }
+        Output << std::endl;
+    }
 
     return Result::OK;
 }
@@ -191,7 +237,53 @@ ConsoleViewBase::Result MainConsoleView::CommandSaveModel() const {
     Output << "(Enter nothing to use original file name)";
     Output << Palette::CLEAR << std::endl;
     std::string fileName = Ask("Save to: ", true);
-    Result Res = static_cast<Result>(m_pController->SaveModel(fileName));
+    Output << Palette::FG_GRAY;
+    Output << "(Levels of detail are only stored in .c3w files)";
+    Output << Palette::CLEAR << std::endl;
+    std::string LevelString = Ask("Levels of detail (empty for 1): ", true);
+    size_t ullLevelCount = 1;
+    if (!LevelString.empty()) {
+        istringstream Stream(LevelString);
+        Stream >> ullLevelCount;
+        if (Stream.fail() || ullLevelCount == 0) {
+            return Result::INVALID_VALUE;
+        }
+    }
+    string OptimizeString = Ask("Optimize for GPU vertex cache? (y/N): ", true);
+    bool bOptimize = false;
+    if (OptimizeString == "y" || OptimizeString == "Y") {
+        bOptimize = true;
+    }
+    else if (
+        !OptimizeString.empty() && 
+        OptimizeString != "n" && 
+        OptimizeString != "N"
+    ) {
+        return Result::INVALID_VALUE;
+    }
+    string NormalsString = Ask("Write vertex normals? (y/N): ", true);
+    bool bNormals = false;
+    if (NormalsString == "y" || NormalsString == "Y") {
+        bNormals = true;
+    }
+    else if (
+        !NormalsString.empty() && 
+        NormalsString != "n" && 
+        NormalsString != "N"
+    ) {
+        return Result::INVALID_VALUE;
+    }
+    Result Res = static_cast<Result>(
+        m_pController->BeginSaveModel(
+            fileName, 
+            ullLevelCount, 
+            bOptimize, 
+            bNormals
+        )
+    );
+    if (Res == Result::OK) {
+        Res = WaitForTask("Saving");
+    }
     if (Res == Result::OK) {
         Output << Palette::FG_GREEN;
         Output << "Successfully saved model '" << m_pController->GetName();
@@ -200,6 +292,94 @@ ConsoleViewBase::Result MainConsoleView::CommandSaveModel() const {
     return Res;
 }
 
+/**********************************************************************
+【函数名称】 CommandSaveChanges
+【函数功能】 实现 update 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandSaveChanges() const {
+    Result Res = static_cast<Result>(m_pController->SaveChanges());
+    if (Res == Result::OK) {
+        Output << Palette::FG_GREEN;
+        Output << "Successfully saved changes to model '";
+        Output << m_pController->GetName() << "'." << Palette::CLEAR << endl;
+    }
+    return Res;
+}
+
+/**********************************************************************
+【函数名称】 CommandToggleJournal
+【函数功能】 实现 journal 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandToggleJournal() const {
+    if (m_pController->IsJournalOpen()) {
+        m_pController->CloseJournal();
+        Output << Palette::FG_GREEN << "Journal closed.";
+        Output << Palette::CLEAR << endl;
+        return Result::OK;
+    }
+    Result Res = static_cast<Result>(m_pController->OpenJournal());
+    if (Res == Result::OK) {
+        Output << Palette::FG_GREEN;
+        Output << "Journal opened; every edit is now logged.";
+        Output << Palette::CLEAR << endl;
+    }
+    return Res;
+}
+
+/**********************************************************************
+【函数名称】 CommandSimplifyModel
+【函数功能】 实现 simplify 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandSimplifyModel() const {
+    istringstream Stream(Ask("Target face count: "));
+    size_t ullTarget;
+    Stream >> ullTarget;
+    if (Stream.fail()) {
+        return Result::INVALID_VALUE;
+    }
+    Result Res = static_cast<Result>(
+        m_pController->SimplifyModel(ullTarget)
+    );
+    if (Res == Result::OK) {
+        Output << Palette::FG_GREEN;
+        Output << "Successfully simplified model to ";
+        Output << m_pController->GetStatistics().TotalFaceCount;
+        Output << " faces.";
+        Output << Palette::CLEAR << endl;
+    }
+    return Res;
+}
+
+/**********************************************************************
+【函数名称】 CommandReorderModel
+【函数功能】 实现 reorder 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandReorderModel() const {
+    Result Res = static_cast<Result>(m_pController->ReorderModel());
+    if (Res == Result::OK) {
+        Output << Palette::FG_GREEN;
+        Output << "Successfully reordered model.";
+        Output << Palette::CLEAR << endl;
+    }
+    return Res;
+}
+
 }
 
 }
@@ -118,6 +118,42 @@ class MainConsoleView: public ConsoleViewBase {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Result CommandSaveModel() const;
+        /**********************************************************************
+        【函数名称】 CommandSaveChanges
+        【函数功能】 实现 update 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result CommandSaveChanges() const;
+        /**********************************************************************
+        【函数名称】 CommandToggleJournal
+        【函数功能】 实现 journal 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result CommandToggleJournal() const;
+        /**********************************************************************
+        【函数名称】 CommandSimplifyModel
+        【函数功能】 实现 simplify 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result CommandSimplifyModel() const;
+        /**********************************************************************
+        【函数名称】 CommandReorderModel
+        【函数功能】 实现 reorder 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        Result CommandReorderModel() const;
 };
 
 }
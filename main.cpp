@@ -1,3 +1,4 @@
+#include <cstdlib>
 #include "Views/CLI/MainConsoleView.hpp"
 #include "Controllers/CLI/ConsoleController.hpp"
 using namespace C3w::Controllers::Cli;
@@ -5,6 +6,11 @@ using namespace C3w::Views::Cli;
 
 int main() {
     auto controller = ConsoleController::GetInstance();
+    // 设置 C3W_CACHE_DIR 环境变量以开启导入缓存
+    const char* cacheDirectory = getenv("C3W_CACHE_DIR");
+    if (cacheDirectory != nullptr) {
+        controller->SetCacheDirectory(cacheDirectory);
+    }
     MainConsoleView view(controller);
     view.Display();
     return 0;